@@ -0,0 +1,185 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <unistd.h>  // for getopt, optarg
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <ucxx/api.h>
+
+/**
+ * Measures the overhead of the C++ layers of UCXX by running the same workloads through
+ * each layer over an endpoint connected to its own worker, such that no network is
+ * involved and differences between layers are due to UCXX alone. Results are printed as
+ * CSV, one line per layer, workload and message size, to be combined with the Python
+ * layers by `python -m ucxx.benchmarks.overhead`.
+ */
+
+enum class Layer {
+  Endpoint,           ///< Raw `ucxx::Endpoint` API progressed by the calling thread
+  DelayedSubmission,  ///< Delayed submission with a polling progress thread
+};
+
+struct app_context_t {
+  std::vector<size_t> message_sizes = {8, 1024, 65536, 1048576};
+  size_t n_iter                     = 1000;
+  size_t warmup_iter                = 100;
+  size_t window_size                = 16;
+};
+
+static void printUsage()
+{
+  std::cerr << " UCXX C++ layers overhead benchmark" << std::endl;
+  std::cerr << std::endl;
+  std::cerr << "Usage: ucxx_overhead [options]" << std::endl;
+  std::cerr << std::endl;
+  std::cerr << "Parameters are:" << std::endl;
+  std::cerr << "  -s <bytes>  comma-separated message sizes (8,1024,65536,1048576)" << std::endl;
+  std::cerr << "  -n <int>    number of iterations to run (1000)" << std::endl;
+  std::cerr << "  -w <int>    number of warmup iterations to run (100)" << std::endl;
+  std::cerr << "  -W <int>    number of messages inflight in windowed workload (16)" << std::endl;
+  std::cerr << "  -h          print this help" << std::endl;
+  std::cerr << std::endl;
+}
+
+ucs_status_t parseCommand(app_context_t* app_context, int argc, char* const argv[])
+{
+  optind = 1;
+  int c;
+  while ((c = getopt(argc, argv, "s:n:w:W:h")) != -1) {
+    switch (c) {
+      case 's': {
+        app_context->message_sizes.clear();
+        std::stringstream sizes(optarg);
+        std::string size;
+        while (std::getline(sizes, size, ',')) {
+          if (atol(size.c_str()) <= 0) {
+            std::cerr << "Wrong message size: " << size << std::endl;
+            return UCS_ERR_INVALID_PARAM;
+          }
+          app_context->message_sizes.push_back(atol(size.c_str()));
+        }
+        break;
+      }
+      case 'n':
+        app_context->n_iter = atoi(optarg);
+        if (app_context->n_iter <= 0) {
+          std::cerr << "Wrong number of iterations: " << app_context->n_iter << std::endl;
+          return UCS_ERR_INVALID_PARAM;
+        }
+        break;
+      case 'w':
+        app_context->warmup_iter = atoi(optarg);
+        if (app_context->warmup_iter <= 0) {
+          std::cerr << "Wrong number of warmup iterations: " << app_context->warmup_iter
+                    << std::endl;
+          return UCS_ERR_INVALID_PARAM;
+        }
+        break;
+      case 'W':
+        app_context->window_size = atoi(optarg);
+        if (app_context->window_size <= 0) {
+          std::cerr << "Wrong window size: " << app_context->window_size << std::endl;
+          return UCS_ERR_INVALID_PARAM;
+        }
+        break;
+      case 'h':
+      default: printUsage(); return UCS_ERR_INVALID_PARAM;
+    }
+  }
+
+  return UCS_OK;
+}
+
+void waitRequests(Layer layer,
+                  std::shared_ptr<ucxx::Worker> worker,
+                  const std::vector<std::shared_ptr<ucxx::Request>>& requests)
+{
+  // The progress thread progresses the worker when using delayed submission
+  for (auto& r : requests) {
+    while (!r->isCompleted())
+      if (layer == Layer::Endpoint) worker->progress();
+    r->checkError();
+  }
+}
+
+/**
+ * Submit `window` send/receive pairs and wait for all of them, returning the time per
+ * message in nanoseconds. A window of one message is a ping-pong.
+ */
+size_t doTransfer(Layer layer,
+                  std::shared_ptr<ucxx::Worker> worker,
+                  std::shared_ptr<ucxx::Endpoint> endpoint,
+                  std::vector<char>& send,
+                  std::vector<char>& recv,
+                  const size_t message_size,
+                  const size_t window)
+{
+  std::vector<std::shared_ptr<ucxx::Request>> requests;
+  requests.reserve(2 * window);
+
+  auto start = std::chrono::high_resolution_clock::now();
+  for (size_t i = 0; i < window; ++i) {
+    requests.push_back(endpoint->tagRecv(recv.data() + i * message_size, message_size, i));
+    requests.push_back(endpoint->tagSend(send.data() + i * message_size, message_size, i));
+  }
+  waitRequests(layer, worker, requests);
+  auto stop = std::chrono::high_resolution_clock::now();
+
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count() / window;
+}
+
+void runLayer(const app_context_t& app_context,
+              std::shared_ptr<ucxx::Context> context,
+              Layer layer)
+{
+  const bool delayedSubmission = layer == Layer::DelayedSubmission;
+  auto worker                  = context->createWorker(delayedSubmission);
+  if (delayedSubmission) worker->startProgressThread(true);
+
+  auto endpoint = worker->createEndpointFromWorkerAddress(worker->getAddress());
+
+  for (const auto message_size : app_context.message_sizes) {
+    std::vector<char> send(message_size * app_context.window_size, 0xaa);
+    std::vector<char> recv(message_size * app_context.window_size);
+
+    for (const size_t window : {static_cast<size_t>(1), app_context.window_size}) {
+      for (size_t n = 0; n < app_context.warmup_iter; ++n)
+        doTransfer(layer, worker, endpoint, send, recv, message_size, window);
+
+      std::vector<size_t> durations(app_context.n_iter);
+      for (size_t n = 0; n < app_context.n_iter; ++n)
+        durations[n] = doTransfer(layer, worker, endpoint, send, recv, message_size, window);
+      std::sort(durations.begin(), durations.end());
+
+      std::cout << (delayedSubmission ? "cpp-delayed-thread" : "cpp-endpoint") << ","
+                << (window == 1 ? "pingpong" : "windowed") << "," << message_size << ","
+                << durations[durations.size() / 2] << std::endl;
+    }
+  }
+
+  if (delayedSubmission) worker->stopProgressThread();
+}
+
+int main(int argc, char** argv)
+{
+  app_context_t app_context;
+  if (parseCommand(&app_context, argc, argv) != UCS_OK) return -1;
+
+  auto context = ucxx::createContext({}, ucxx::Context::defaultFeatureFlags);
+
+  std::cout << "layer,workload,bytes,median_ns" << std::endl;
+  runLayer(app_context, context, Layer::Endpoint);
+  runLayer(app_context, context, Layer::DelayedSubmission);
+
+  return 0;
+}
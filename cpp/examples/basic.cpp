@@ -143,7 +143,9 @@ std::function<void()> getProgressFunction(std::shared_ptr<ucxx::Worker> worker,
     case ProgressMode::Polling: return std::bind(std::mem_fn(&ucxx::Worker::progress), worker);
     case ProgressMode::Blocking:
       return std::bind(std::mem_fn(&ucxx::Worker::progressWorkerEvent), worker, -1);
-    case ProgressMode::Wait: return std::bind(std::mem_fn(&ucxx::Worker::waitProgress), worker);
+    case ProgressMode::Wait:
+      return std::bind(
+        std::mem_fn(static_cast<bool (ucxx::Worker::*)()>(&ucxx::Worker::waitProgress)), worker);
     default: return []() {};
   }
 }
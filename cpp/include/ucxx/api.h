@@ -8,15 +8,37 @@
 #define UCXX_ENABLE_RMM 0
 #endif
 
+#ifndef UCXX_ENABLE_IO_URING
+#define UCXX_ENABLE_IO_URING 0
+#endif
+
 #include <ucxx/address.h>
+#include <ucxx/bootstrap.h>
 #include <ucxx/buffer.h>
+#include <ucxx/channel.h>
+#include <ucxx/codec.h>
 #include <ucxx/constructors.h>
 #include <ucxx/context.h>
+#include <ucxx/copy_engine.h>
+#include <ucxx/dedup.h>
+#include <ucxx/delta_sync.h>
 #include <ucxx/endpoint.h>
+#include <ucxx/expected.h>
+#include <ucxx/framing.h>
 #include <ucxx/header.h>
 #include <ucxx/inflight_requests.h>
+#include <ucxx/io_uring.h>
 #include <ucxx/listener.h>
+#include <ucxx/memory_handle.h>
+#include <ucxx/progressive.h>
+#include <ucxx/pubsub.h>
+#include <ucxx/pull.h>
+#include <ucxx/remote_key.h>
+#include <ucxx/remote_object_cache.h>
 #include <ucxx/request.h>
+#include <ucxx/request_rma.h>
 #include <ucxx/request_tag_multi.h>
+#include <ucxx/router.h>
+#include <ucxx/tag_multi_recv_stream.h>
 #include <ucxx/typedefs.h>
 #include <ucxx/worker.h>
@@ -0,0 +1,272 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/context.h>
+#include <ucxx/endpoint.h>
+#include <ucxx/listener.h>
+#include <ucxx/request.h>
+#include <ucxx/worker.h>
+
+namespace ucxx {
+
+/**
+ * @brief Backend of a bootstrap directory.
+ *
+ * A bootstrap directory allows each rank of a job to publish its worker address and to
+ * fetch the addresses of all ranks in a single collective operation. Backends implement
+ * the out-of-band exchange of addresses.
+ */
+class BootstrapBackend {
+ public:
+  /**
+   * @brief Virtual destructor.
+   *
+   * Virtual destructor with empty implementation.
+   */
+  virtual ~BootstrapBackend() {}
+
+  /**
+   * @brief Publish the address of a rank.
+   *
+   * Publish the address of a rank, must be called exactly once per rank and before
+   * `fetchAll()` is called by that rank.
+   *
+   * @throws ucxx::Error if the address could not be published.
+   *
+   * @param[in] rank    the rank publishing its address.
+   * @param[in] address the address, usually obtained with `ucxx::Address::getString()`.
+   */
+  virtual void publish(const size_t rank, const std::string& address) = 0;
+
+  /**
+   * @brief Fetch the addresses of all ranks.
+   *
+   * Block until all ranks have published their addresses and return them, must be
+   * called by all ranks.
+   *
+   * @throws ucxx::Error if not all addresses were fetched within `timeout`.
+   *
+   * @param[in] worldSize the number of ranks.
+   * @param[in] timeout   the maximum time to wait for all ranks.
+   *
+   * @returns the addresses of all ranks, indexed by rank.
+   */
+  virtual std::vector<std::string> fetchAll(const size_t worldSize,
+                                            const std::chrono::milliseconds timeout) = 0;
+};
+
+/**
+ * @brief In-process bootstrap backend.
+ *
+ * A bootstrap backend where all ranks live in the same process and share the same
+ * backend object, mostly useful for testing.
+ */
+class InProcessBootstrapBackend : public BootstrapBackend {
+ private:
+  std::map<size_t, std::string> _addresses{};  ///< Published addresses by rank
+  std::mutex _mutex{};                         ///< Mutex to access addresses
+  std::condition_variable _cv{};               ///< Condition variable signaling publications
+
+ public:
+  void publish(const size_t rank, const std::string& address) override;
+
+  std::vector<std::string> fetchAll(const size_t worldSize,
+                                    const std::chrono::milliseconds timeout) override;
+};
+
+/**
+ * @brief Shared-file bootstrap backend.
+ *
+ * A bootstrap backend where each rank publishes its address as a file in a directory
+ * visible to all ranks, either on a local or on a shared filesystem. Files are written
+ * to a temporary name and atomically renamed, so that readers never observe partial
+ * addresses. Files are named after a job identifier, which must be unique for each run
+ * of a job, such as a scheduler job identifier together with a restart count, so that
+ * jobs may share a directory. Each file also records the job identifier and the rank it
+ * was published for, files that do not match are rejected as stale and waited on until
+ * they are published again. Files published by a backend are removed when it is
+ * destroyed, thus each rank must keep its backend alive until all ranks have fetched.
+ */
+class FileBootstrapBackend : public BootstrapBackend {
+ private:
+  std::string _directory{};          ///< Directory where addresses are published
+  std::string _jobId{};              ///< Identifier of the job run, namespacing its addresses
+  std::vector<size_t> _published{};  ///< Ranks published by this backend
+
+  /**
+   * @brief Get the path of the address of a rank.
+   *
+   * @param[in] rank  the rank.
+   *
+   * @returns the path of the file containing the address of `rank`.
+   */
+  std::string getPath(const size_t rank) const;
+
+  /**
+   * @brief Read the address of a rank.
+   *
+   * Read the address published by `rank`, rejecting files not published by this job run
+   * for `rank`.
+   *
+   * @param[in]  rank     the rank.
+   * @param[out] address  the address of `rank`, if read.
+   *
+   * @returns whether a valid address was read.
+   */
+  bool readAddress(const size_t rank, std::string& address) const;
+
+ public:
+  /**
+   * @brief Constructor of a shared-file bootstrap backend.
+   *
+   * @throws ucxx::Error if `jobId` is empty or contains a `/`.
+   *
+   * @param[in] directory the directory where addresses are published, must exist.
+   * @param[in] jobId     the identifier of the job run, unique for each run.
+   */
+  FileBootstrapBackend(const std::string& directory, const std::string& jobId);
+
+  /**
+   * @brief Destructor of `ucxx::FileBootstrapBackend`.
+   *
+   * Removes the files of all addresses published by this backend.
+   */
+  ~FileBootstrapBackend();
+
+  void publish(const size_t rank, const std::string& address) override;
+
+  std::vector<std::string> fetchAll(const size_t worldSize,
+                                    const std::chrono::milliseconds timeout) override;
+};
+
+/**
+ * @brief Listener bootstrap backend.
+ *
+ * A bootstrap backend where rank 0 acts as coordinator, listening for connections of all
+ * other ranks. Each rank connects once to the coordinator and sends its address, and
+ * once all ranks are connected the coordinator replies to each of them with the
+ * addresses of all ranks, thus each rank performs a single round trip regardless of the
+ * number of ranks. Exchanges are performed on a dedicated worker that is progressed by
+ * the backend itself.
+ */
+class ListenerBootstrapBackend : public BootstrapBackend {
+ private:
+  size_t _rank{0};                                      ///< Rank of this process
+  std::string _rootHostname{};                          ///< Hostname of the coordinator
+  uint16_t _port{0};                                    ///< Port of the coordinator
+  std::string _address{};                               ///< Address published by this rank
+  std::shared_ptr<Worker> _worker{nullptr};             ///< Worker used for the exchange
+  std::shared_ptr<Listener> _listener{nullptr};         ///< Listener of the coordinator
+  std::vector<std::shared_ptr<Endpoint>> _endpoints{};  ///< Endpoints to other processes
+
+  /**
+   * @brief Callback accepting connections to the coordinator.
+   */
+  static void listenerCallback(ucp_conn_request_h connRequest, void* arg);
+
+  /**
+   * @brief Wait for a request to complete.
+   *
+   * Progress the worker until `request` completes.
+   *
+   * @throws ucxx::Error if `deadline` is reached before the request completes.
+   *
+   * @param[in] request   the request to wait for.
+   * @param[in] deadline  the time after which waiting fails.
+   *
+   * @returns the status of the request.
+   */
+  ucs_status_t wait(std::shared_ptr<Request> request,
+                    const std::chrono::steady_clock::time_point deadline);
+
+  /**
+   * @brief Gather the addresses of all ranks at the coordinator.
+   */
+  std::vector<std::string> fetchAllRoot(const size_t worldSize,
+                                        const std::chrono::steady_clock::time_point deadline);
+
+  /**
+   * @brief Send the address to the coordinator and receive the addresses of all ranks.
+   */
+  std::vector<std::string> fetchAllNonRoot(const size_t worldSize,
+                                           const std::chrono::steady_clock::time_point deadline);
+
+ public:
+  /**
+   * @brief Constructor of a listener bootstrap backend.
+   *
+   * Construct a listener bootstrap backend, creating a dedicated worker from `context`,
+   * and starting to listen on `port` if `rank` is `0`.
+   *
+   * @throws ucxx::Error if the listener could not be created.
+   *
+   * @param[in] context       the context to create the dedicated worker from.
+   * @param[in] rank          the rank of this process.
+   * @param[in] rootHostname  the hostname or IP address of rank 0.
+   * @param[in] port          the port rank 0 listens on, `0` lets rank 0 pick a free port
+   *                          which must then be communicated to other ranks.
+   */
+  ListenerBootstrapBackend(std::shared_ptr<Context> context,
+                           const size_t rank,
+                           const std::string& rootHostname,
+                           const uint16_t port);
+
+  /**
+   * @brief Get the port of the coordinator.
+   *
+   * @returns the port rank 0 listens on, or the port to connect to on other ranks.
+   */
+  uint16_t getPort() const;
+
+  void publish(const size_t rank, const std::string& address) override;
+
+  std::vector<std::string> fetchAll(const size_t worldSize,
+                                    const std::chrono::milliseconds timeout) override;
+};
+
+/**
+ * @brief Connect to all ranks of a job.
+ *
+ * Publish the address of `worker` through `backend`, fetch the addresses of all ranks and
+ * create an endpoint to each other rank.
+ *
+ * @code{.cpp}
+ * // worker is `std::shared_ptr<ucxx::Worker>`
+ * ucxx::FileBootstrapBackend backend("/shared/bootstrap", "job-1234.0");
+ * auto endpoints = ucxx::bootstrapEndpoints(worker, backend, rank, worldSize);
+ * @endcode
+ *
+ * @throws ucxx::Error if not all addresses were fetched within `timeout`.
+ *
+ * @param[in] worker                the worker to publish and create endpoints from.
+ * @param[in] backend               the bootstrap backend.
+ * @param[in] rank                  the rank of this process.
+ * @param[in] worldSize             the number of ranks.
+ * @param[in] timeout               the maximum time to wait for all ranks.
+ * @param[in] endpointErrorHandling whether to enable endpoint error handling.
+ *
+ * @returns the endpoints to all ranks indexed by rank, `nullptr` at index `rank`.
+ */
+std::vector<std::shared_ptr<Endpoint>> bootstrapEndpoints(
+  std::shared_ptr<Worker> worker,
+  BootstrapBackend& backend,
+  const size_t rank,
+  const size_t worldSize,
+  const std::chrono::milliseconds timeout = std::chrono::seconds(60),
+  const bool endpointErrorHandling        = true);
+
+}  // namespace ucxx
@@ -0,0 +1,296 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/component.h>
+#include <ucxx/endpoint.h>
+#include <ucxx/request.h>
+
+namespace ucxx {
+
+/**
+ * @brief Bit set in the tag of all messages transferred through channels.
+ *
+ * Tags of channel messages have this bit set, followed by the channel identifier in the
+ * `ChannelIdBits` bits below it and the channel tag in the lowest `ChannelTagBits` bits,
+ * thus tags of messages transferred directly through the endpoint must not have it set
+ * to prevent matching channel messages.
+ */
+const ucp_tag_t ChannelTagBit = 1ull << 62;
+
+/**
+ * @brief Number of bits of the tag carrying the channel identifier.
+ */
+const unsigned ChannelIdBits = 30;
+
+/**
+ * @brief Number of bits of the tag available to each channel.
+ */
+const unsigned ChannelTagBits = 32;
+
+/**
+ * @brief Largest channel identifier.
+ */
+const uint64_t MaxChannelId = (1ull << ChannelIdBits) - 1;
+
+/**
+ * @brief Largest tag of a channel message.
+ */
+const ucp_tag_t MaxChannelTag = (1ull << ChannelTagBits) - 1;
+
+/**
+ * @brief Statistics of a channel.
+ */
+struct ChannelStats {
+  size_t sendCount{0};  ///< Number of sends submitted
+  size_t sendBytes{0};  ///< Total size of the sends submitted
+  size_t recvCount{0};  ///< Number of receives submitted
+  size_t recvBytes{0};  ///< Total size of the receives submitted
+  size_t completed{0};  ///< Number of requests completed, including failed and canceled
+  size_t canceled{0};   ///< Number of requests canceled by `close()`
+  size_t inflight{0};   ///< Number of requests currently inflight
+};
+
+class Channel : public Component {
+ private:
+  uint64_t _id{0};                   ///< Identifier of the channel
+  std::atomic<bool> _closed{false};  ///< Whether the channel was closed
+  std::mutex _mutex{};               ///< Mutex to access the inflight requests and stats
+  uint64_t _nextOperation{0};        ///< Identifier of the next request submitted
+  std::unordered_map<uint64_t, std::shared_ptr<Request>>
+    _inflightRequests{};  ///< Inflight requests by operation identifier
+  std::unordered_set<uint64_t> _completedEarly{};      ///< Completed before being registered
+  std::vector<std::shared_ptr<Request>> _completed{};  ///< Completed, pending release
+  ChannelStats _stats{};                               ///< Statistics of the channel
+
+  /**
+   * @brief Private constructor of `ucxx::Channel`.
+   *
+   * This is the internal implementation of `ucxx::Channel` constructor, made private not
+   * to be called directly. This constructor is made private to ensure all UCXX objects
+   * are shared pointers and the correct lifetime management of each one.
+   *
+   * Instead the user should use one of the following:
+   *
+   * - `ucxx::createChannel()`
+   *
+   * @param[in] endpoint  the endpoint the channel is multiplexed over.
+   * @param[in] id        the identifier of the channel.
+   */
+  Channel(std::shared_ptr<Endpoint> endpoint, const uint64_t id);
+
+  /**
+   * @brief Get the tag of a channel message.
+   *
+   * @throws ucxx::Error if `tag` is larger than `ucxx::MaxChannelTag`.
+   *
+   * @param[in] tag the tag of the message within the channel.
+   *
+   * @returns the tag of the message within the endpoint.
+   */
+  ucp_tag_t getEndpointTag(const ucp_tag_t tag) const;
+
+  /**
+   * @brief Submit a request through the endpoint and register it with the channel.
+   *
+   * @throws ucxx::NotConnectedError if the channel was closed.
+   *
+   * @param[in] isSend            whether the request is a send, or a receive otherwise.
+   * @param[in] length            the size in bytes of the message.
+   * @param[in] callbackFunction  user-defined callback function to call upon completion.
+   * @param[in] callbackData      user-defined data to pass to the `callbackFunction`.
+   * @param[in] submit            function submitting the request through the endpoint
+   *                              with the given completion callback.
+   *
+   * @returns the request submitted.
+   */
+  std::shared_ptr<Request> submit(
+    const bool isSend,
+    const size_t length,
+    RequestCallbackUserFunction callbackFunction,
+    RequestCallbackUserData callbackData,
+    std::function<std::shared_ptr<Request>(RequestCallbackUserFunction)> submit);
+
+  /**
+   * @brief Remove a completed request from the inflight requests.
+   *
+   * Called from the completion callback of the request, the reference to the request is
+   * only released by the next submission, preventing the request from being destroyed
+   * while its callback is executing.
+   *
+   * @param[in] operation the operation identifier of the request.
+   */
+  void markCompleted(const uint64_t operation);
+
+ public:
+  Channel()               = delete;
+  Channel(const Channel&) = delete;
+  Channel& operator=(Channel const&) = delete;
+  Channel(Channel&& o)               = delete;
+  Channel& operator=(Channel&& o) = delete;
+
+  /**
+   * @brief Constructor for `shared_ptr<ucxx::Channel>`.
+   *
+   * The constructor for a `shared_ptr<ucxx::Channel>` object, a lightweight logical
+   * connection multiplexed over `endpoint`. Each channel reserves a slice of the tag
+   * space identified by `id`, such that messages of different channels never match each
+   * other, and tracks its own inflight requests and statistics, so that closing a channel
+   * cancels only its own requests and leaves the endpoint and other channels untouched.
+   * Creating a channel involves no communication nor transport resources, allowing
+   * thousands of channels over a single endpoint.
+   *
+   * Both ends must create a channel with the same `id` to communicate. As tag matching
+   * is performed by the worker, channels with the same `id` over different endpoints of
+   * the same worker would share the same slice of the tag space and receive each other's
+   * messages. An `id` is thus bound to a single endpoint of each worker until all its
+   * channels are closed, creating a channel with the same `id` over another endpoint of
+   * the same worker raises `ucxx::Error`.
+   *
+   * @code{.cpp}
+   * // endpoint is `std::shared_ptr<ucxx::Endpoint>`
+   * auto channel = ucxx::createChannel(endpoint, tenantId);
+   * auto request = channel->tagSend(buffer, length, 0);
+   *
+   * // Cancel all inflight requests of the channel only
+   * channel->close();
+   * @endcode
+   *
+   * @throws ucxx::Error if the endpoint is not initialized, `id` is larger than
+   *                     `ucxx::MaxChannelId` or `id` is open over another endpoint of
+   *                     the same worker.
+   *
+   * @param[in] endpoint  the endpoint the channel is multiplexed over.
+   * @param[in] id        the identifier of the channel.
+   *
+   * @returns The `shared_ptr<ucxx::Channel>` object.
+   */
+  friend std::shared_ptr<Channel> createChannel(std::shared_ptr<Endpoint> endpoint,
+                                                const uint64_t id);
+
+  /**
+   * @brief Destructor of `ucxx::Channel`.
+   *
+   * Closes the channel, canceling its inflight requests.
+   */
+  ~Channel();
+
+  /**
+   * @brief Get the identifier of the channel.
+   *
+   * @returns the identifier of the channel.
+   */
+  uint64_t getId() const;
+
+  /**
+   * @brief Get the endpoint the channel is multiplexed over.
+   *
+   * @returns the endpoint the channel is multiplexed over.
+   */
+  std::shared_ptr<Endpoint> getEndpoint() const;
+
+  /**
+   * @brief Enqueue a tag send operation on the channel.
+   *
+   * Enqueue a tag send operation matched only by a tag receive with the same `tag` on a
+   * channel with the same identifier at the remote end, see `ucxx::Endpoint::tagSend()`.
+   *
+   * @throws ucxx::NotConnectedError if the channel was closed.
+   * @throws ucxx::Error             if `tag` is larger than `ucxx::MaxChannelTag`.
+   *
+   * @param[in] buffer              a raw pointer to the data to be sent.
+   * @param[in] length              the size in bytes of the tag message to be sent.
+   * @param[in] tag                 the tag to match within the channel.
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified.
+   * @param[in] callbackFunction    user-defined callback function to call upon completion.
+   * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
+   *
+   * @returns Request to be subsequently checked for the completion and its state.
+   */
+  std::shared_ptr<Request> tagSend(
+    void* buffer,
+    size_t length,
+    ucp_tag_t tag,
+    const bool enablePythonFuture                = false,
+    RequestCallbackUserFunction callbackFunction = nullptr,
+    RequestCallbackUserData callbackData         = nullptr);
+
+  /**
+   * @brief Enqueue a tag receive operation on the channel.
+   *
+   * Enqueue a tag receive operation matching only a tag send with the same `tag` on a
+   * channel with the same identifier, see `ucxx::Endpoint::tagRecv()`.
+   *
+   * @throws ucxx::NotConnectedError if the channel was closed.
+   * @throws ucxx::Error             if `tag` is larger than `ucxx::MaxChannelTag`.
+   *
+   * @param[in] buffer              a raw pointer to pre-allocated memory where resulting
+   *                                data will be stored.
+   * @param[in] length              the size in bytes of the tag message to be received.
+   * @param[in] tag                 the tag to match within the channel.
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified.
+   * @param[in] callbackFunction    user-defined callback function to call upon completion.
+   * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
+   *
+   * @returns Request to be subsequently checked for the completion and its state.
+   */
+  std::shared_ptr<Request> tagRecv(
+    void* buffer,
+    size_t length,
+    ucp_tag_t tag,
+    const bool enablePythonFuture                = false,
+    RequestCallbackUserFunction callbackFunction = nullptr,
+    RequestCallbackUserData callbackData         = nullptr);
+
+  /**
+   * @brief Get the statistics of the channel.
+   *
+   * @returns a snapshot of the statistics of the channel.
+   */
+  ChannelStats getStats();
+
+  /**
+   * @brief Get the number of inflight requests of the channel.
+   *
+   * @returns the number of inflight requests of the channel.
+   */
+  size_t getInflightCount();
+
+  /**
+   * @brief Check whether the channel was closed.
+   *
+   * @returns `true` if the channel was closed, `false` otherwise.
+   */
+  bool isClosed() const;
+
+  /**
+   * @brief Close the channel.
+   *
+   * Close the channel, canceling all its inflight requests, after which submitting
+   * requests on the channel raises `ucxx::NotConnectedError`. The endpoint and other
+   * channels multiplexed over it are not affected. Canceled requests complete with
+   * `UCS_ERR_CANCELED` when the worker is progressed. Once all channels with this
+   * identifier over the endpoint are closed, the identifier may be used over another
+   * endpoint of the worker. Closing a channel that was already closed is a no-op.
+   *
+   * @returns the number of requests canceled.
+   */
+  size_t close();
+};
+
+}  // namespace ucxx
@@ -0,0 +1,108 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace ucxx {
+
+/**
+ * @brief Codec used to encode frames of multi-buffer transfers.
+ *
+ * Identifier of the codec used to encode a frame, transmitted as part of the `ucxx::Header`
+ * and of each encoded chunk, thus values must be kept stable.
+ */
+enum class CodecType {
+  Raw = 0,    ///< No encoding, frame is transferred as is
+  Lz,         ///< LZ77-class compression
+  ShuffleLz,  ///< Byte-shuffle followed by LZ77-class compression
+  Invalid,
+};
+
+/**
+ * @brief Parameters of the codec stage of multi-buffer transfers.
+ *
+ * Control which codec is used to encode host frames and when encoding is skipped in favor
+ * of raw transfers. CUDA frames are always transferred raw.
+ */
+struct CodecParams {
+  CodecType codec{CodecType::Raw};  ///< Codec to encode eligible frames with
+  size_t chunkSize{1 << 20};        ///< Encoded frames are split in chunks of this size
+  size_t minFrameSize{64 << 10};    ///< Frames smaller than this are always sent raw
+  double maxRatio{0.9};  ///< Chunks whose encoded to raw size ratio exceed this are sent raw
+  size_t elementSize{8};  ///< Size in bytes of each element, used by byte-shuffle
+};
+
+/**
+ * @brief Header of an encoded chunk.
+ *
+ * Header prepended to each encoded chunk, allowing the receiver to decode chunks
+ * independently, including those that fell back to raw.
+ */
+struct CodecChunkHeader {
+  uint32_t codec;        ///< The `ucxx::CodecType` the chunk was effectively encoded with
+  uint32_t elementSize;  ///< Element size used by byte-shuffle
+  uint64_t decodedSize;  ///< Size in bytes of the decoded chunk
+  uint64_t encodedSize;  ///< Size in bytes of the encoded payload following the header
+};
+
+/**
+ * @brief Validate codec parameters.
+ *
+ * Validate codec parameters before they are used to encode frames.
+ *
+ * @throws ucxx::Error if any of the parameters is invalid.
+ *
+ * @param[in] params  the codec parameters to validate.
+ */
+void codecValidateParams(const CodecParams& params);
+
+/**
+ * @brief Get the maximum size of an encoded chunk.
+ *
+ * Get the maximum size in bytes of an encoded chunk, including its `ucxx::CodecChunkHeader`,
+ * that may be used to allocate the buffer where an encoded chunk is received.
+ *
+ * @param[in] decodedSize the size in bytes of the decoded chunk.
+ *
+ * @returns the maximum size in bytes of the encoded chunk.
+ */
+size_t codecMaxEncodedSize(const size_t decodedSize);
+
+/**
+ * @brief Encode a chunk.
+ *
+ * Encode a chunk with the codec specified in `params`, prepending a
+ * `ucxx::CodecChunkHeader`. If the encoded size exceeds `params.maxRatio` of the input
+ * size, the chunk is stored raw instead.
+ *
+ * @param[in] params  the codec parameters.
+ * @param[in] data    pointer to the chunk to encode.
+ * @param[in] size    the size in bytes of the chunk.
+ *
+ * @returns the encoded chunk.
+ */
+std::string codecEncode(const CodecParams& params, const void* data, const size_t size);
+
+/**
+ * @brief Decode a chunk.
+ *
+ * Decode a chunk previously encoded with `codecEncode()` into `output`.
+ *
+ * @throws ucxx::Error if the encoded chunk is malformed or its decoded size does not
+ *                     match `outputSize`.
+ *
+ * @param[in]  encoded      pointer to the encoded chunk, including its header.
+ * @param[in]  encodedSize  the size in bytes of the buffer holding the encoded chunk.
+ * @param[out] output       pointer to the buffer where the chunk is decoded to.
+ * @param[in]  outputSize   the size in bytes of the decoded chunk.
+ */
+void codecDecode(const void* encoded,
+                 const size_t encodedSize,
+                 void* output,
+                 const size_t outputSize);
+
+}  // namespace ucxx
@@ -13,7 +13,7 @@ namespace ucxx {
 class Config {
  private:
   ucp_config_t* _handle{nullptr};  ///< Handle to the UCP config
-  ConfigMap _configMap;            ///< Map containing all visible UCP configurations
+  ConfigMap _configMap{};          ///< Map containing all visible UCP configurations
 
   /**
    * @brief Read UCX configuration and apply user options.
@@ -32,7 +32,8 @@ class Config {
    * @brief Parse UCP configurations and convert them to a map.
    *
    * Parse UCP configurations obtained from `ucp_config_print()` and convert them to a map
-   * for easy access.
+   * for easy access. The configurations are printed to an in-memory stream, and parsed
+   * only once at construction time.
    *
    * @returns The map to the UCP configurations defined for the process.
    */
@@ -62,11 +63,11 @@ class Config {
    * @brief Get the configuration map.
    *
    * Get the configuration map with all visible UCP configurations that are in effect for
-   * the current process.
+   * the current process, as parsed at construction time.
    *
    * @returns The map to the UCP configurations defined for the process.
    */
-  ConfigMap get();
+  ConfigMap get() const;
 
   /**
    * @brief Get the underlying `ucp_config_t*` handle
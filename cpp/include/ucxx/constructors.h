@@ -5,32 +5,74 @@
 #pragma once
 
 #include <memory>
+#include <new>
 #include <string>
 #include <vector>
 
+#include <ucxx/codec.h>
+#include <ucxx/expected.h>
 #include <ucxx/typedefs.h>
 
 namespace ucxx {
 
 class Address;
+class Buffer;
+class Channel;
 class Context;
+class DeltaSyncReceiver;
+class DeltaSyncSender;
 class Endpoint;
 class Future;
 class Listener;
+class MemoryHandle;
 class Notifier;
+class ProgressiveReceiver;
+class ProgressiveSender;
+class Publisher;
+class PullReceiver;
+class PullSender;
+class RemoteKey;
+class RemoteObjectCache;
+class RemoteObjectCacheClient;
 class Request;
+class RequestRma;
 class RequestStream;
 class RequestTag;
 class RequestTagMulti;
+class Subscription;
+class TagMultiRecvStream;
 class Worker;
 
+enum class ContextProfile;
+enum class SlowSubscriberPolicy;
+
 // Components
 std::shared_ptr<Address> createAddressFromWorker(std::shared_ptr<ucxx::Worker> worker);
 
 std::shared_ptr<Address> createAddressFromString(std::string addressString);
 
+std::shared_ptr<Channel> createChannel(std::shared_ptr<Endpoint> endpoint, const uint64_t id);
+
 std::shared_ptr<Context> createContext(const ConfigMap ucxConfig, const uint64_t featureFlags);
 
+std::shared_ptr<Context> createContextFromProfile(const ConfigMap ucxConfig,
+                                                  const ContextProfile profile);
+
+std::shared_ptr<Context> createSharedContext(const ConfigMap ucxConfig,
+                                             const uint64_t featureFlags);
+
+std::shared_ptr<DeltaSyncReceiver> createDeltaSyncReceiver(std::shared_ptr<Endpoint> endpoint,
+                                                           void* buffer,
+                                                           const size_t size,
+                                                           const size_t blockSize,
+                                                           const ucp_tag_t tag);
+
+std::shared_ptr<DeltaSyncSender> createDeltaSyncSender(std::shared_ptr<Endpoint> endpoint,
+                                                       void* buffer,
+                                                       const size_t size,
+                                                       const size_t blockSize,
+                                                       const ucp_tag_t tag);
+
 std::shared_ptr<Endpoint> createEndpointFromHostname(std::shared_ptr<Worker> worker,
                                                      std::string ipAddress,
                                                      uint16_t port,
@@ -44,15 +86,92 @@ std::shared_ptr<Endpoint> createEndpointFromWorkerAddress(std::shared_ptr<Worker
                                                           std::shared_ptr<Address> address,
                                                           bool endpointErrorHandling);
 
+Expected<std::shared_ptr<Endpoint>> createEndpointFromHostname(std::nothrow_t,
+                                                               std::shared_ptr<Worker> worker,
+                                                               std::string ipAddress,
+                                                               uint16_t port,
+                                                               bool endpointErrorHandling) noexcept;
+
+Expected<std::shared_ptr<Endpoint>> createEndpointFromConnRequest(
+  std::nothrow_t,
+  std::shared_ptr<Listener> listener,
+  ucp_conn_request_h connRequest,
+  bool endpointErrorHandling) noexcept;
+
+Expected<std::shared_ptr<Endpoint>> createEndpointFromWorkerAddress(
+  std::nothrow_t,
+  std::shared_ptr<Worker> worker,
+  std::shared_ptr<Address> address,
+  bool endpointErrorHandling) noexcept;
+
 std::shared_ptr<Listener> createListener(std::shared_ptr<Worker> worker,
                                          uint16_t port,
                                          ucp_listener_conn_callback_t callback,
                                          void* callback_args);
 
+std::shared_ptr<MemoryHandle> createMemoryHandle(std::shared_ptr<Context> context,
+                                                 const size_t size,
+                                                 void* buffer);
+
+std::shared_ptr<RemoteKey> createRemoteKeyFromMemoryHandle(
+  std::shared_ptr<MemoryHandle> memoryHandle);
+
+std::shared_ptr<RemoteKey> createRemoteKeyFromSerialized(std::shared_ptr<Endpoint> endpoint,
+                                                         const std::string& serializedRemoteKey);
+
+std::shared_ptr<ProgressiveReceiver> createProgressiveReceiver(
+  std::shared_ptr<Endpoint> endpoint,
+  void* buffer,
+  const size_t capacity,
+  const ucp_tag_t tag,
+  std::function<void(size_t, size_t)> chunkCallback = nullptr);
+
+std::shared_ptr<ProgressiveSender> createProgressiveSender(std::shared_ptr<Endpoint> endpoint,
+                                                           void* buffer,
+                                                           const size_t size,
+                                                           const ucp_tag_t tag,
+                                                           const size_t chunkSize = 1 << 20);
+
+std::shared_ptr<Publisher> createPublisher(std::shared_ptr<Worker> worker,
+                                           const size_t maxLag,
+                                           const SlowSubscriberPolicy policy);
+
+std::shared_ptr<PullReceiver> createPullReceiver(std::shared_ptr<Endpoint> endpoint,
+                                                 const ucp_tag_t tag,
+                                                 const size_t maxInflight = 4,
+                                                 const size_t chunkSize   = 1 << 20);
+
+std::shared_ptr<PullSender> createPullSender(std::shared_ptr<Endpoint> endpoint,
+                                             const std::vector<void*>& buffer,
+                                             const std::vector<size_t>& size,
+                                             const ucp_tag_t tag);
+
+std::shared_ptr<RemoteObjectCache> createRemoteObjectCache(std::shared_ptr<Worker> worker,
+                                                           const size_t numBuckets = 1024);
+
+std::shared_ptr<RemoteObjectCacheClient> createRemoteObjectCacheClient(
+  std::shared_ptr<Endpoint> endpoint, const std::string& descriptor, const size_t maxRetries = 16);
+
+std::shared_ptr<Subscription> createSubscription(
+  std::shared_ptr<Worker> worker,
+  const ucp_tag_t topic,
+  std::function<void(std::shared_ptr<Buffer>)> callback);
+
 std::shared_ptr<Worker> createWorker(std::shared_ptr<Context> context,
                                      const bool enableDelayedSubmission);
 
 // Transfers
+std::shared_ptr<RequestRma> createRequestRma(
+  std::shared_ptr<Endpoint> endpoint,
+  bool put,
+  void* buffer,
+  size_t length,
+  uint64_t remoteAddress,
+  std::shared_ptr<RemoteKey> remoteKey,
+  const bool enablePythonFuture,
+  RequestCallbackUserFunction callbackFunction,
+  RequestCallbackUserData callbackData);
+
 std::shared_ptr<RequestStream> createRequestStream(std::shared_ptr<Endpoint> endpoint,
                                                    bool send,
                                                    void* buffer,
@@ -60,24 +179,62 @@ std::shared_ptr<RequestStream> createRequestStream(std::shared_ptr<Endpoint> end
                                                    const bool enablePythonFuture);
 
 std::shared_ptr<RequestTag> createRequestTag(
-  std::shared_ptr<Component> endpointOrWorker,
+  std::shared_ptr<Endpoint> endpoint,
   bool send,
   void* buffer,
   size_t length,
   ucp_tag_t tag,
   const bool enablePythonFuture,
-  std::function<void(std::shared_ptr<void>)> callbackFunction,
-  std::shared_ptr<void> callbackData);
+  RequestCallbackUserFunction callbackFunction,
+  RequestCallbackUserData callbackData,
+  const TagSendMode sendMode);
 
-std::shared_ptr<RequestTagMulti> createRequestTagMultiSend(std::shared_ptr<Endpoint> endpoint,
-                                                           const std::vector<void*>& buffer,
-                                                           const std::vector<size_t>& size,
-                                                           const std::vector<int>& isCUDA,
-                                                           const ucp_tag_t tag,
-                                                           const bool enablePythonFuture);
+std::shared_ptr<RequestTag> createRequestTag(
+  std::shared_ptr<Worker> worker,
+  bool send,
+  void* buffer,
+  size_t length,
+  ucp_tag_t tag,
+  const bool enablePythonFuture,
+  RequestCallbackUserFunction callbackFunction,
+  RequestCallbackUserData callbackData,
+  const TagSendMode sendMode);
+
+std::shared_ptr<RequestTag> createRequestTag(
+  std::shared_ptr<Worker> worker,
+  ucp_tag_message_h message,
+  void* buffer,
+  size_t length,
+  ucp_tag_t tag,
+  const bool enablePythonFuture,
+  RequestCallbackUserFunction callbackFunction,
+  RequestCallbackUserData callbackData);
+
+std::shared_ptr<RequestTag> createRequestTag(
+  std::shared_ptr<Endpoint> endpoint,
+  std::vector<ucp_dt_iov_t> iov,
+  ucp_tag_t tag,
+  const bool enablePythonFuture,
+  RequestCallbackUserFunction callbackFunction,
+  RequestCallbackUserData callbackData);
+
+std::shared_ptr<RequestTagMulti> createRequestTagMultiSend(
+  std::shared_ptr<Endpoint> endpoint,
+  const std::vector<void*>& buffer,
+  const std::vector<size_t>& size,
+  const std::vector<int>& isCUDA,
+  const ucp_tag_t tag,
+  const bool enablePythonFuture,
+  const CodecParams& codecParams = {},
+  const TagSendMode sendMode     = TagSendMode::Standard);
 
 std::shared_ptr<RequestTagMulti> createRequestTagMultiRecv(std::shared_ptr<Endpoint> endpoint,
                                                            const ucp_tag_t tag,
                                                            const bool enablePythonFuture);
 
+std::shared_ptr<TagMultiRecvStream> createTagMultiRecvStream(
+  std::shared_ptr<Endpoint> endpoint,
+  const ucp_tag_t tag,
+  std::function<void(std::shared_ptr<RequestTagMulti>)> callback = nullptr);
+
 }  // namespace ucxx
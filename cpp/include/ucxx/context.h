@@ -8,6 +8,7 @@
 #include <cstring>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include <ucp/api/ucp.h>
 
@@ -19,12 +20,48 @@ namespace ucxx {
 
 class Worker;
 
+/**
+ * @brief Usage profiles of a UCP context.
+ *
+ * Named sets of UCP features matching common usage patterns. Each enabled feature may
+ * add wireup lanes, per-endpoint resources and worker address size, enabling only the
+ * features an application uses saves memory and connection time with many endpoints.
+ */
+enum class ContextProfile {
+  Full = 0,     ///< Tag, stream, active messages and RMA, with wakeup
+  TagOnly,      ///< Tag messages only, with wakeup
+  StreamOnly,   ///< Stream messages only, with wakeup
+  Rma,          ///< RMA, plus tag messages to exchange remote keys, with wakeup
+  PollingOnly,  ///< Tag, stream, active messages and RMA, without wakeup
+};
+
+/**
+ * @brief Capabilities of a UCP context.
+ *
+ * Capabilities derived from the UCP context and its configuration, computed once when
+ * the `ucxx::Context` is constructed.
+ */
+struct ContextCapabilities {
+  std::vector<std::string> transports{};  ///< Transports listed in `UCX_TLS`
+  bool transportsExcluded{false};         ///< Whether `transports` are excluded (`^` prefix)
+  uint64_t memoryTypes{0};                ///< Bitmap of `ucs_memory_type_t` supported by UCP
+  bool cudaSupport{false};                ///< Whether CUDA support is enabled
+};
+
 class Context : public Component {
  private:
-  ucp_context_h _handle{nullptr};  ///< The UCP context handle
-  Config _config{{}};              ///< UCP context configuration variables
-  uint64_t _featureFlags{0};       ///< Feature flags used to construct UCP context
-  bool _cudaSupport{false};        ///< Whether CUDA support is enabled
+  ucp_context_h _handle{nullptr};       ///< The UCP context handle
+  Config _config{{}};                   ///< UCP context configuration variables
+  uint64_t _featureFlags{0};            ///< Feature flags used to construct UCP context
+  ContextCapabilities _capabilities{};  ///< Capabilities of the UCP context
+
+  /**
+   * @brief Compute the context capabilities.
+   *
+   * Compute the capabilities of the UCP context from its configuration and attributes,
+   * called once at construction time.
+   */
+  void computeCapabilities();
 
   /**
    * @brief Private constructor of `shared_ptr<ucxx::Context>`.
@@ -42,6 +79,18 @@ class Context : public Component {
   static constexpr uint64_t defaultFeatureFlags =
     UCP_FEATURE_TAG | UCP_FEATURE_WAKEUP | UCP_FEATURE_STREAM | UCP_FEATURE_AM | UCP_FEATURE_RMA;
 
+  /**
+   * @brief Get the feature flags of a usage profile.
+   *
+   * Get the UCP feature flags enabled by a usage profile. All profiles except
+   * `ucxx::ContextProfile::PollingOnly` enable `UCP_FEATURE_WAKEUP`, workers of a context
+   * without wakeup support can only be progressed in polling mode.
+   *
+   * @param[in] profile the usage profile.
+   * @return The feature flags of `profile`.
+   */
+  static uint64_t getProfileFeatureFlags(const ContextProfile profile);
+
   Context()               = delete;
   Context(const Context&) = delete;
   Context& operator=(Context const&) = delete;
@@ -66,6 +115,46 @@ class Context : public Component {
    */
   friend std::shared_ptr<Context> createContext(ConfigMap ucxConfig, const uint64_t featureFlags);
 
+  /**
+   * @brief Constructor of `shared_ptr<ucxx::Context>` from a usage profile.
+   *
+   * Construct a `shared_ptr<ucxx::Context>` enabling only the features required by the
+   * usage profile, see `ucxx::Context::getProfileFeatureFlags()`.
+   *
+   * @code{.cpp}
+   *   auto context = ucxx::createContextFromProfile({}, ucxx::ContextProfile::TagOnly);
+   * @endcode
+   *
+   * @param[in] ucxConfig configurations overriding `UCX_*` defaults and environment
+   *                      variables.
+   * @param[in] profile   the usage profile.
+   * @return The `shared_ptr<ucxx::Context>` object
+   */
+  friend std::shared_ptr<Context> createContextFromProfile(ConfigMap ucxConfig,
+                                                           const ContextProfile profile);
+
+  /**
+   * @brief Get a process-wide shared `shared_ptr<ucxx::Context>`.
+   *
+   * Get a `shared_ptr<ucxx::Context>` shared by all callers within the process that
+   * request the same configurations and feature flags, thus allowing multiple components
+   * to reuse a single UCP context instead of each paying for `ucp_init()`. A new context
+   * is created if no context with the same configurations and feature flags is alive.
+   *
+   * @code{.cpp}
+   *   auto context = ucxx::createSharedContext({}, ucxx::Context::defaultFeatureFlags);
+   *   // Returns the same object while `context` is alive
+   *   auto other = ucxx::createSharedContext({}, ucxx::Context::defaultFeatureFlags);
+   * @endcode
+   *
+   * @param[in] ucxConfig configurations overriding `UCX_*` defaults and environment
+   *                      variables.
+   * @param[in] featureFlags feature flags to be used at UCP context construction time.
+   * @return The `shared_ptr<ucxx::Context>` object
+   */
+  friend std::shared_ptr<Context> createSharedContext(ConfigMap ucxConfig,
+                                                      const uint64_t featureFlags);
+
   /**
    * @brief `ucxx::Context` destructor
    */
@@ -135,6 +224,22 @@ class Context : public Component {
    */
   uint64_t getFeatureFlags() const;
 
+  /**
+   * @brief Get the capabilities of the UCP context.
+   *
+   * Get the capabilities of the UCP context, such as the transports configured and the
+   * memory types supported. Capabilities are computed once at construction time, thus
+   * this method does not query UCX.
+   *
+   * @code{.cpp}
+   *   // context is `std::shared_ptr<ucxx::Context>`
+   *   bool cudaSupport = context->getCapabilities().cudaSupport;
+   * @endcode
+   *
+   * @return The capabilities of this context
+   */
+  const ContextCapabilities& getCapabilities() const;
+
   /**
    * @brief Create a new `ucxx::Worker`.
    *
@@ -152,6 +257,25 @@ class Context : public Component {
    * @return Shared pointer to the `ucxx::Worker` object.
    */
   std::shared_ptr<Worker> createWorker(const bool enableDelayedSubmission = false);
+
+  /**
+   * @brief Create a new `ucxx::MemoryHandle`.
+   *
+   * Create a new `ucxx::MemoryHandle` as a child of the current `ucxx::Context`, mapping
+   * `buffer` (or allocating a new region if `buffer` is `nullptr`) so that it may be
+   * accessed by remote peers via RMA operations.
+   *
+   * @code{.cpp}
+   *   // context is `std::shared_ptr<ucxx::Context>`
+   *   auto memoryHandle = context->createMemoryHandle(1024, nullptr);
+   * @endcode
+   *
+   * @param[in] size    the size of the memory region to map or allocate.
+   * @param[in] buffer  a raw pointer to memory previously allocated by the user that
+   *                    should be mapped, or `nullptr` to let UCX allocate memory.
+   * @return Shared pointer to the `ucxx::MemoryHandle` object.
+   */
+  std::shared_ptr<MemoryHandle> createMemoryHandle(const size_t size, void* buffer);
 };
 
 }  // namespace ucxx
@@ -0,0 +1,205 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ucxx {
+
+/**
+ * @brief Parameters of a copy engine.
+ *
+ * Parameters of a `ucxx::CopyEngine`, controlling when copies are split across helper
+ * threads and how large each piece is.
+ */
+struct CopyEngineParams {
+  size_t numThreads{4};             ///< Helper threads per NUMA node, zero always copies inline
+  size_t inlineThreshold{1 << 20};  ///< Copies smaller than this are performed inline
+  size_t minChunkSize{256 << 10};   ///< Minimum size in bytes of each chunk
+  bool numaAware{true};             ///< Run chunks on helpers local to the destination memory
+};
+
+/**
+ * @brief Statistics of a copy engine.
+ */
+struct CopyEngineStats {
+  size_t inlineCopies{0};    ///< Number of copies performed inline by the caller
+  size_t parallelCopies{0};  ///< Number of copies split across helper threads
+  size_t chunks{0};          ///< Number of chunks of all parallel copies
+  size_t bytes{0};           ///< Number of bytes copied
+};
+
+/**
+ * @brief Copy engine splitting large host memory copies across helper threads.
+ *
+ * A single `memcpy` is bound by the bandwidth a single core can sustain, which is a
+ * fraction of the memory bandwidth of a node. The copy engine splits copies of at least
+ * `CopyEngineParams::inlineThreshold` bytes into page-aligned chunks of at least
+ * `CopyEngineParams::minChunkSize` bytes, the caller copies one chunk and helps copying
+ * the others together with a small pool of helper threads, returning once all chunks are
+ * copied. Smaller copies are performed inline by the caller without synchronization.
+ *
+ * When NUMA awareness is enabled and the system has more than one NUMA node, each chunk
+ * is copied by helpers pinned to the node where its destination pages reside, helpers of
+ * each node are created on first use. Otherwise a single unpinned pool is used.
+ *
+ * Copies may be submitted concurrently from multiple threads. Source and destination must
+ * be host memory and must not overlap.
+ */
+class CopyEngine {
+ private:
+  struct Job;
+
+  /**
+   * @brief A chunk of a copy.
+   */
+  struct Chunk {
+    void* dst{nullptr};        ///< Destination of the chunk
+    const void* src{nullptr};  ///< Source of the chunk
+    size_t size{0};            ///< Size in bytes of the chunk
+    Job* job{nullptr};         ///< Copy the chunk belongs to
+  };
+
+  /**
+   * @brief A pool of helper threads, pinned to one NUMA node or unpinned.
+   */
+  struct Pool {
+    std::vector<std::thread> threads{};  ///< Helper threads
+    std::deque<Chunk> chunks{};          ///< Chunks pending copy
+    std::mutex mutex{};                  ///< Mutex to access `chunks`
+    std::condition_variable cv{};        ///< Notifies helpers of new chunks or stop
+    bool stop{false};                    ///< Whether helpers should stop
+  };
+
+  CopyEngineParams _params{};                   ///< Copy engine parameters
+  std::vector<std::vector<int>> _nodeCpus{};    ///< CPUs of each NUMA node
+  std::vector<std::unique_ptr<Pool>> _pools{};  ///< Pool of each NUMA node, created lazily
+  std::mutex _poolsMutex{};                     ///< Mutex to create pools
+  std::atomic<size_t> _inlineCopies{0};         ///< Number of inline copies
+  std::atomic<size_t> _parallelCopies{0};       ///< Number of parallel copies
+  std::atomic<size_t> _chunks{0};               ///< Number of chunks copied
+  std::atomic<size_t> _bytes{0};                ///< Number of bytes copied
+
+  /**
+   * @brief Get the pool of a NUMA node, creating it if necessary.
+   *
+   * @param[in] node  the index of the NUMA node, or zero when not NUMA-aware.
+   *
+   * @returns the pool of the NUMA node.
+   */
+  Pool& getPool(const size_t node);
+
+  /**
+   * @brief Get the index of the pool that should copy to `address`.
+   *
+   * @param[in] address  the destination address of a chunk.
+   *
+   * @returns the index of the pool local to the memory at `address`.
+   */
+  size_t getPoolIndex(const void* address) const;
+
+  /**
+   * @brief Copy a chunk and mark it completed in its job.
+   *
+   * @param[in] chunk  the chunk to copy.
+   */
+  static void copyChunk(const Chunk& chunk);
+
+  /**
+   * @brief Run a helper thread until its pool is stopped.
+   *
+   * @param[in] pool  the pool the helper belongs to.
+   * @param[in] cpus  the CPUs to pin the helper to, empty to leave it unpinned.
+   */
+  static void runHelper(Pool& pool, std::vector<int> cpus);
+
+ public:
+  /**
+   * @brief Constructor of a copy engine.
+   *
+   * Construct a copy engine, no helper threads are created until the first copy that is
+   * split across helpers.
+   *
+   * @param[in] params  the copy engine parameters.
+   */
+  explicit CopyEngine(const CopyEngineParams& params = {});
+
+  CopyEngine(const CopyEngine&)            = delete;
+  CopyEngine& operator=(CopyEngine const&) = delete;
+  CopyEngine(CopyEngine&& o)               = delete;
+  CopyEngine& operator=(CopyEngine&& o)    = delete;
+
+  /**
+   * @brief Destructor of a copy engine, stopping and joining all helper threads.
+   */
+  ~CopyEngine();
+
+  /**
+   * @brief Copy memory.
+   *
+   * Copy `size` bytes from `src` to `dst`, blocking until the copy is complete. Copies
+   * smaller than `CopyEngineParams::inlineThreshold` are performed inline, larger copies
+   * are split across helper threads.
+   *
+   * @param[in] dst   the destination buffer.
+   * @param[in] src   the source buffer, must not overlap with `dst`.
+   * @param[in] size  the size in bytes to copy.
+   */
+  void copy(void* dst, const void* src, const size_t size);
+
+  /**
+   * @brief Get the copy engine parameters.
+   *
+   * @returns the copy engine parameters.
+   */
+  const CopyEngineParams& getParams() const;
+
+  /**
+   * @brief Get the number of NUMA nodes helpers are distributed over.
+   *
+   * @returns the number of NUMA nodes, one if NUMA awareness is disabled or unavailable.
+   */
+  size_t getNumaNodeCount() const;
+
+  /**
+   * @brief Get the copy engine statistics.
+   *
+   * @returns the copy engine statistics.
+   */
+  CopyEngineStats getStats() const;
+};
+
+/**
+ * @brief Get the process-wide copy engine.
+ *
+ * Get the copy engine used by UCXX for its host staging copies, such as resolving
+ * deduplicated frames and copying uncompressed chunks, constructed upon first use with
+ * default parameters except for the number of helper threads, which is limited to the
+ * number of CPUs minus one.
+ *
+ * @returns the process-wide copy engine.
+ */
+CopyEngine& getDefaultCopyEngine();
+
+/**
+ * @brief Copy memory with the process-wide copy engine.
+ *
+ * Copy `size` bytes from `src` to `dst` with `ucxx::getDefaultCopyEngine()`, a drop-in
+ * replacement of `std::memcpy` for large host copies.
+ *
+ * @param[in] dst   the destination buffer.
+ * @param[in] src   the source buffer, must not overlap with `dst`.
+ * @param[in] size  the size in bytes to copy.
+ */
+void copyMemory(void* dst, const void* src, const size_t size);
+
+}  // namespace ucxx
@@ -0,0 +1,192 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ucxx {
+
+/**
+ * @brief Deduplication action of a frame.
+ *
+ * Action taken for a frame of a multi-buffer transfer by the deduplication layer,
+ * transmitted as part of the `ucxx::Header`, thus values must be kept stable.
+ */
+enum class DedupAction {
+  None = 0,   ///< Frame is not subject to deduplication
+  Store,      ///< Frame is transferred and stored in the receiver cache
+  Reference,  ///< Frame is replaced by its fingerprint, resolved from the receiver cache
+  Invalid,
+};
+
+/**
+ * @brief Parameters of frame deduplication.
+ *
+ * Parameters of the per-peer frame deduplication of multi-buffer transfers. Both ends of
+ * an endpoint must use the same parameters, as the sender mirrors the receiver cache.
+ */
+struct DedupParams {
+  size_t minFrameSize{4096};   ///< Frames smaller than this are never deduplicated
+  size_t maxEntries{1024};     ///< Maximum number of frames cached
+  size_t maxBytes{256 << 20};  ///< Maximum number of bytes cached
+};
+
+/**
+ * @brief Statistics of frame deduplication.
+ */
+struct DedupStats {
+  size_t frames{0};      ///< Number of frames eligible for deduplication
+  size_t hits{0};        ///< Number of frames replaced by a reference
+  size_t bytesSaved{0};  ///< Number of bytes not transferred due to references
+
+  /**
+   * @brief Get the deduplication hit rate.
+   *
+   * @returns the ratio of eligible frames that were replaced by a reference.
+   */
+  double hitRate() const;
+};
+
+/**
+ * @brief Compute the fingerprint of a frame.
+ *
+ * Compute a 64-bit fingerprint of a frame using XXH64, which processes input in four
+ * independent lanes that map well onto the vector units of modern CPUs.
+ *
+ * @param[in] data  pointer to the frame.
+ * @param[in] size  the size in bytes of the frame.
+ *
+ * @returns the fingerprint of the frame.
+ */
+uint64_t dedupFingerprint(const void* data, const size_t size);
+
+class DedupCache {
+ private:
+  struct Entry {
+    uint64_t fingerprint{0};                     ///< Fingerprint of the frame
+    size_t size{0};                              ///< Size of the frame in bytes
+    std::shared_ptr<std::string> data{nullptr};  ///< Copy of the frame, receiver only
+  };
+
+  DedupParams _params{};    ///< Deduplication parameters
+  bool _storeData{false};   ///< Whether to store frame data (receiver) or not (sender)
+  std::list<Entry> _lru{};  ///< Cached frames, most recently used first
+  std::unordered_map<uint64_t, std::list<Entry>::iterator>
+    _index{};           ///< Cached frames by fingerprint
+  size_t _bytes{0};     ///< Number of bytes of frames cached
+  uint64_t _epoch{0};   ///< Epoch of the cache, advanced when the cache is invalidated
+  DedupStats _stats{};  ///< Deduplication statistics
+  std::mutex _mutex{};  ///< Mutex to access the cache
+
+  /**
+   * @brief Find a frame.
+   *
+   * @returns an iterator to the cached frame or the end of the LRU list if not cached.
+   */
+  std::list<Entry>::iterator find(const uint64_t fingerprint, const size_t size);
+
+  /**
+   * @brief Insert or refresh a frame.
+   *
+   * Insert a frame as most recently used, or refresh it if already cached, evicting least
+   * recently used frames until the cache fits within its bounds.
+   */
+  void insert(const uint64_t fingerprint, const size_t size, const void* data);
+
+  /**
+   * @brief Drop all cached frames.
+   */
+  void clear();
+
+ public:
+  /**
+   * @brief Constructor of a deduplication cache.
+   *
+   * Construct the cache of one end of an endpoint. The sender cache only tracks
+   * fingerprints of frames known to be cached by the receiver, while the receiver cache
+   * stores copies of the frames. Both caches evolve identically, as long as the receiver
+   * completes transfers in the order they were sent. If a send fails the receiver may not
+   * have stored its frames, the sender cache is then invalidated and starts a new epoch,
+   * and the receiver drops its frames once it receives the first transfer of that epoch.
+   *
+   * @param[in] params    the deduplication parameters.
+   * @param[in] storeData whether to store frame data, `true` for receivers.
+   */
+  DedupCache(const DedupParams& params, const bool storeData);
+
+  /**
+   * @brief Get the deduplication parameters.
+   *
+   * @returns the deduplication parameters.
+   */
+  const DedupParams& getParams() const;
+
+  /**
+   * @brief Plan deduplication of a transfer.
+   *
+   * Decide the `ucxx::DedupAction` of each frame of a transfer being sent, replacing
+   * frames already cached by the receiver by references, and update the cache to mirror
+   * the state the receiver will have after completing the transfer.
+   *
+   * @param[in] fingerprint the fingerprint of each frame.
+   * @param[in] size        the size in bytes of each frame.
+   * @param[in] eligible    whether each frame is eligible for deduplication.
+   * @param[out] epoch      the epoch of the cache the actions were decided against.
+   *
+   * @returns the action of each frame, as integers to be stored in `ucxx::Header`.
+   */
+  std::vector<int> planSend(const std::vector<uint64_t>& fingerprint,
+                            const std::vector<size_t>& size,
+                            const std::vector<int>& eligible,
+                            uint64_t& epoch);
+
+  /**
+   * @brief Invalidate the cache after a failed send.
+   *
+   * Drop all frames of the sender cache and start a new epoch, unless the cache was
+   * already invalidated since `epoch`. Transfers of the new epoch store all their frames
+   * again, and instruct the receiver to drop the frames it cached previously.
+   *
+   * @param[in] epoch the epoch the failed transfer was planned against.
+   */
+  void invalidate(const uint64_t epoch);
+
+  /**
+   * @brief Apply deduplication of a received transfer.
+   *
+   * Resolve all references of a completed transfer from the cache, and then store the
+   * frames of the transfer in the cache in the same order as the sender did. A transfer
+   * of a newer epoch first drops all cached frames, references of transfers of an older
+   * epoch are never resolved and their frames are not stored.
+   *
+   * @param[in] action      the `ucxx::DedupAction` of each frame.
+   * @param[in] fingerprint the fingerprint of referenced frames, ignored for others.
+   * @param[in] size        the size in bytes of each frame.
+   * @param[in] data        pointer to each received frame, where references are resolved.
+   * @param[in] epoch       the epoch of the sender cache the transfer was planned against.
+   *
+   * @returns whether all references could be resolved.
+   */
+  bool applyRecv(const std::vector<int>& action,
+                 const std::vector<uint64_t>& fingerprint,
+                 const std::vector<size_t>& size,
+                 const std::vector<void*>& data,
+                 const uint64_t epoch);
+
+  /**
+   * @brief Get deduplication statistics.
+   *
+   * @returns the deduplication statistics.
+   */
+  DedupStats getStats();
+};
+
+}  // namespace ucxx
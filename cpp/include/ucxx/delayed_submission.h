@@ -4,6 +4,7 @@
  */
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -19,6 +20,22 @@ typedef std::function<void()> DelayedSubmissionCallbackType;
 
 typedef std::shared_ptr<DelayedSubmissionCallbackType> DelayedSubmissionCallbackPtrType;
 
+/**
+ * @brief Policy deciding when requests are delayed to the progress thread.
+ */
+enum class DelayedSubmissionPolicy {
+  Always = 0,  ///< Always delay submission to the next progress thread iteration
+  Adaptive,    ///< Submit immediately when uncontended, delay otherwise
+};
+
+/**
+ * @brief Statistics of the submission paths taken by delayed submissions.
+ */
+struct DelayedSubmissionStats {
+  size_t direct{0};   ///< Number of submissions executed immediately by the caller
+  size_t delayed{0};  ///< Number of submissions delayed to the progress thread
+};
+
 class DelayedSubmission {
  public:
   bool _send{false};       ///< Whether this is a send (`true`) operation or recv (`false`)
@@ -56,7 +73,65 @@ class DelayedSubmissionCollection {
     _collection{};      ///< The collection of all known delayed submission operations.
   std::mutex _mutex{};  ///< Mutex to provide access to the collection.
 
+  std::mutex _workerMutex{};  ///< Mutex held while the worker is progressed or submitting
+  std::atomic<DelayedSubmissionPolicy> _policy{
+    DelayedSubmissionPolicy::Always};  ///< Policy deciding when submissions are delayed
+  std::atomic<size_t> _unlocked{0};    ///< Number of threads holding the worker unlocked
+  std::atomic<size_t> _direct{0};      ///< Number of submissions executed immediately
+  std::atomic<size_t> _delayed{0};     ///< Number of submissions delayed
+
  public:
+  /**
+   * @brief A lock on the worker owning a delayed submission collection.
+   *
+   * Held while the worker is progressed, while delayed submissions are processed and while
+   * a submission is executed immediately, so that immediate submissions never run
+   * concurrently with the progress thread. The mutex is only locked with
+   * `DelayedSubmissionPolicy::Adaptive`, the only policy submitting immediately, other
+   * policies only count the threads holding the worker so that immediate submissions wait
+   * for them after switching policies. The lock is re-entrant, a thread already holding
+   * the lock of a collection, for example executing completion callbacks while
+   * progressing the worker, holds it again without locking.
+   */
+  class WorkerLock {
+   private:
+    std::unique_lock<std::mutex> _lock{};  ///< The lock, owned unless locked re-entrantly
+    const DelayedSubmissionCollection* _previous{nullptr};  ///< Collection locked before
+    DelayedSubmissionCollection* _unlocked{nullptr};  ///< Collection held without locking
+    bool _locked{false};                              ///< Whether the worker is held
+
+   public:
+    /**
+     * @brief Lock the worker owning a collection.
+     *
+     * @param[in] collection  the collection, nothing is locked if `nullptr`.
+     * @param[in] tryLock     only lock if the worker is not held by another thread.
+     */
+    explicit WorkerLock(DelayedSubmissionCollection* collection, const bool tryLock = false);
+
+    WorkerLock(const WorkerLock&)            = delete;
+    WorkerLock& operator=(WorkerLock const&) = delete;
+    WorkerLock(WorkerLock&& o)               = delete;
+    WorkerLock& operator=(WorkerLock&& o)    = delete;
+
+    ~WorkerLock();
+
+    /**
+     * @brief Check whether the calling thread holds the worker.
+     *
+     * @returns `true` if the worker is held, `false` if `tryLock` failed or no collection
+     *          was given.
+     */
+    bool isLocked() const;
+
+    /**
+     * @brief Check whether the worker was already held by the calling thread.
+     *
+     * @returns `true` if the lock was acquired re-entrantly.
+     */
+    bool isReentrant() const;
+  };
+
   /**
    * @brief Default delayed submission collection constructor.
    *
@@ -73,10 +148,11 @@ class DelayedSubmissionCollection {
   /**
    * @brief Process all pending delayed submission operations.
    *
-   * Process all pending delayed submissions and execute their callbacks. The execution
-   * of the callbacks does not imply completion of the operation, only that it has been
-   * submitted. The completion of each operation is handled externally by the
-   * implementation of the object being processed, for example by checking the result
+   * Process all pending delayed submissions and execute their callbacks, holding the
+   * worker lock. The execution of the callbacks does not imply completion of the
+   * operation, only that it has been submitted. The completion of each operation is
+   * handled externally by the implementation of the object being processed, for example
+   * by checking the result
    * of `ucxx::Request::isCompleted()`.
    */
   void process();
@@ -91,6 +167,45 @@ class DelayedSubmissionCollection {
    *                      operation is submitted.
    */
   void registerRequest(DelayedSubmissionCallbackType callback);
+
+  /**
+   * @brief Attempt to execute a submission immediately.
+   *
+   * With `DelayedSubmissionPolicy::Adaptive`, execute `callback` immediately if the
+   * calling thread already holds the worker lock, for example from a completion callback
+   * of the progress thread, or if the worker lock is free, meaning the worker is neither
+   * being progressed nor executing submissions, no thread still holds the worker unlocked
+   * since a previous policy, and no submission is pending, thus preserving the order of
+   * submissions of each thread.
+   * Otherwise, or with `DelayedSubmissionPolicy::Always`, nothing is done and the
+   * submission must be registered with `registerRequest()`.
+   *
+   * @param[in] callback  the callback executing the submission.
+   *
+   * @returns `true` if `callback` was executed, `false` otherwise.
+   */
+  bool trySubmit(const DelayedSubmissionCallbackType& callback);
+
+  /**
+   * @brief Set the delayed submission policy.
+   *
+   * @param[in] policy  the policy deciding when submissions are delayed.
+   */
+  void setPolicy(const DelayedSubmissionPolicy policy);
+
+  /**
+   * @brief Get the delayed submission policy.
+   *
+   * @returns the policy deciding when submissions are delayed.
+   */
+  DelayedSubmissionPolicy getPolicy() const;
+
+  /**
+   * @brief Get the statistics of the submission paths taken.
+   *
+   * @returns the number of submissions executed immediately and delayed.
+   */
+  DelayedSubmissionStats getStats() const;
 };
 
 }  // namespace ucxx
@@ -0,0 +1,313 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/component.h>
+#include <ucxx/endpoint.h>
+#include <ucxx/memory_handle.h>
+#include <ucxx/request.h>
+
+namespace ucxx {
+
+/**
+ * @brief Statistics of delta synchronization.
+ *
+ * Statistics of a single delta synchronization round or accumulated over all rounds.
+ */
+struct DeltaSyncStats {
+  uint64_t rounds{0};     ///< Number of rounds
+  size_t dirtyBlocks{0};  ///< Number of blocks that changed and were transferred
+  size_t extents{0};      ///< Number of contiguous extents transferred
+  size_t bytesSent{0};    ///< Number of bytes of blocks transferred
+  size_t bytesSaved{0};   ///< Number of bytes not transferred compared to full transfers
+};
+
+/**
+ * @brief Size of a delta synchronization descriptor.
+ *
+ * Get the maximum size in bytes of the descriptor of a delta synchronization round for a
+ * buffer split in `numBlocks` blocks, where at most every other block starts an extent.
+ *
+ * @param[in] numBlocks the number of blocks the buffer is split into.
+ *
+ * @returns the maximum size of the descriptor in bytes.
+ */
+size_t deltaSyncMaxDescriptorSize(const size_t numBlocks);
+
+class DeltaSyncSender : public Component {
+ private:
+  void* _buffer{nullptr};                             ///< The buffer being synchronized
+  size_t _size{0};                                    ///< The size of the buffer in bytes
+  size_t _blockSize{0};                               ///< The size of each block in bytes
+  ucp_tag_t _tag{0};                                  ///< Tag used to transfer rounds
+  std::shared_ptr<MemoryHandle> _snapshot{nullptr};   ///< Registered last-sent snapshot
+  bool _snapshotValid{false};                         ///< Whether the snapshot was sent
+  std::string _descriptor{};                          ///< Descriptor of the current round
+  std::vector<std::shared_ptr<Request>> _requests{};  ///< Requests of the current round
+  DeltaSyncStats _stats{};                            ///< Accumulated statistics
+
+  /**
+   * @brief Private constructor of `ucxx::DeltaSyncSender`.
+   *
+   * This is the internal implementation of `ucxx::DeltaSyncSender` constructor, made
+   * private not to be called directly. This constructor is made private to ensure all
+   * UCXX objects are shared pointers and the correct lifetime management of each one.
+   *
+   * Instead the user should use one of the following:
+   *
+   * - `ucxx::createDeltaSyncSender()`
+   *
+   * @param[in] endpoint  the endpoint to the receiver holding the replica.
+   * @param[in] buffer    the buffer to synchronize.
+   * @param[in] size      the size of the buffer in bytes.
+   * @param[in] blockSize the granularity in bytes at which changes are detected.
+   * @param[in] tag       the tag used to transfer rounds.
+   */
+  DeltaSyncSender(std::shared_ptr<Endpoint> endpoint,
+                  void* buffer,
+                  const size_t size,
+                  const size_t blockSize,
+                  const ucp_tag_t tag);
+
+ public:
+  DeltaSyncSender()                       = delete;
+  DeltaSyncSender(const DeltaSyncSender&) = delete;
+  DeltaSyncSender& operator=(DeltaSyncSender const&) = delete;
+  DeltaSyncSender(DeltaSyncSender&& o)               = delete;
+  DeltaSyncSender& operator=(DeltaSyncSender&& o) = delete;
+
+  /**
+   * @brief Destructor of `ucxx::DeltaSyncSender`.
+   *
+   * Cancels the inflight sends of the current round and waits for their completion
+   * before releasing the descriptor and snapshot they transfer from.
+   */
+  ~DeltaSyncSender();
+
+  /**
+   * @brief Constructor for `shared_ptr<ucxx::DeltaSyncSender>`.
+   *
+   * The constructor for a `shared_ptr<ucxx::DeltaSyncSender>` object, synchronizing the
+   * contents of `buffer` to a `ucxx::DeltaSyncReceiver` replica at the remote end of
+   * `endpoint`. The sender keeps a registered snapshot of the contents last sent, which
+   * each round is compared against to detect the blocks that changed.
+   *
+   * @code{.cpp}
+   * // endpoint is `std::shared_ptr<ucxx::Endpoint>`
+   * auto sender = ucxx::createDeltaSyncSender(endpoint, buffer, size, 4096, tag);
+   * auto stats  = sender->sync();
+   * @endcode
+   *
+   * @throws ucxx::Error if `blockSize` is `0`.
+   *
+   * @param[in] endpoint  the endpoint to the receiver holding the replica.
+   * @param[in] buffer    the buffer to synchronize.
+   * @param[in] size      the size of the buffer in bytes.
+   * @param[in] blockSize the granularity in bytes at which changes are detected.
+   * @param[in] tag       the tag used to transfer rounds.
+   *
+   * @returns The `shared_ptr<ucxx::DeltaSyncSender>` object.
+   */
+  friend std::shared_ptr<DeltaSyncSender> createDeltaSyncSender(
+    std::shared_ptr<Endpoint> endpoint,
+    void* buffer,
+    const size_t size,
+    const size_t blockSize,
+    const ucp_tag_t tag);
+
+  /**
+   * @brief Synchronize the replica.
+   *
+   * Compare the buffer against the snapshot of the last round, copy blocks that changed
+   * to the snapshot and transfer them to the receiver, coalescing adjacent blocks into
+   * contiguous extents. The first round transfers the entire buffer, and so does the
+   * round following one where any transfer failed, since the receiver may then hold
+   * only part of the snapshot. This is a non-blocking operation, the buffer may be
+   * modified once this method returns, but a new round may only start once
+   * `isCompleted()` returns `true`.
+   *
+   * @throws ucxx::Error if the previous round has not completed yet.
+   *
+   * @returns the statistics of this round.
+   */
+  DeltaSyncStats sync();
+
+  /**
+   * @brief Check whether the current round has completed.
+   *
+   * Check whether all transfers of the current round have completed.
+   *
+   * @returns whether the current round has completed.
+   */
+  bool isCompleted();
+
+  /**
+   * @brief Get accumulated statistics.
+   *
+   * Get the statistics accumulated over all rounds.
+   *
+   * @returns the accumulated statistics.
+   */
+  DeltaSyncStats getStats() const;
+};
+
+class DeltaSyncReceiver : public Component {
+ private:
+  void* _buffer{nullptr};                             ///< The replica buffer
+  size_t _size{0};                                    ///< The size of the replica in bytes
+  size_t _blockSize{0};                               ///< The size of each block in bytes
+  ucp_tag_t _tag{0};                                  ///< Tag used to transfer rounds
+  std::shared_ptr<MemoryHandle> _replica{nullptr};    ///< Memory handle of the replica
+  std::string _descriptor{};                          ///< Descriptor of the current round
+  uint64_t _round{0};                                 ///< Number of the current round
+  std::atomic<size_t> _pending{0};                    ///< Pending transfers of the round
+  std::atomic<ucs_status_t> _roundStatus{UCS_OK};     ///< Status of the round transfers
+  std::atomic<ucs_status_t> _status{UCS_OK};          ///< Status of the current round
+  DeltaSyncStats _roundStats{};                       ///< Statistics of the current round
+  DeltaSyncStats _stats{};                            ///< Accumulated statistics
+  std::vector<std::shared_ptr<Request>> _requests{};  ///< Requests of the current round
+  std::mutex _mutex{};                                ///< Mutex to access stats and requests
+
+  /**
+   * @brief Private constructor of `ucxx::DeltaSyncReceiver`.
+   *
+   * This is the internal implementation of `ucxx::DeltaSyncReceiver` constructor, made
+   * private not to be called directly. This constructor is made private to ensure all
+   * UCXX objects are shared pointers and the correct lifetime management of each one.
+   *
+   * Instead the user should use one of the following:
+   *
+   * - `ucxx::createDeltaSyncReceiver()`
+   *
+   * @param[in] endpoint  the endpoint to the sender.
+   * @param[in] buffer    the replica buffer.
+   * @param[in] size      the size of the replica in bytes.
+   * @param[in] blockSize the granularity in bytes at which changes are detected.
+   * @param[in] tag       the tag used to transfer rounds.
+   */
+  DeltaSyncReceiver(std::shared_ptr<Endpoint> endpoint,
+                    void* buffer,
+                    const size_t size,
+                    const size_t blockSize,
+                    const ucp_tag_t tag);
+
+  /**
+   * @brief Handle the reception of a descriptor.
+   *
+   * Validate the descriptor of the current round and post the receives of all its
+   * extents directly into the replica. If the descriptor receive failed the round fails
+   * with its status.
+   *
+   * @param[in] status  the status of the descriptor receive.
+   */
+  void recvExtents(const ucs_status_t status);
+
+  /**
+   * @brief Mark a transfer of the current round as completed.
+   *
+   * Mark a transfer of the current round as completed, completing the round and updating
+   * the statistics once all transfers have completed. The round completes with the status
+   * of the first transfer that failed, if any.
+   *
+   * @param[in] status  the status of the transfer that completed.
+   */
+  void markCompleted(const ucs_status_t status = UCS_OK);
+
+ public:
+  DeltaSyncReceiver()                         = delete;
+  DeltaSyncReceiver(const DeltaSyncReceiver&) = delete;
+  DeltaSyncReceiver& operator=(DeltaSyncReceiver const&) = delete;
+  DeltaSyncReceiver(DeltaSyncReceiver&& o)               = delete;
+  DeltaSyncReceiver& operator=(DeltaSyncReceiver&& o) = delete;
+
+  /**
+   * @brief Destructor of `ucxx::DeltaSyncReceiver`.
+   *
+   * Cancels the inflight receives of the current round and waits for their completion
+   * before releasing the descriptor they write to.
+   */
+  ~DeltaSyncReceiver();
+
+  /**
+   * @brief Constructor for `shared_ptr<ucxx::DeltaSyncReceiver>`.
+   *
+   * The constructor for a `shared_ptr<ucxx::DeltaSyncReceiver>` object, keeping `buffer`
+   * as a registered replica of the buffer of a `ucxx::DeltaSyncSender` at the remote end
+   * of `endpoint`. The `size`, `blockSize` and `tag` must match those of the sender.
+   *
+   * @code{.cpp}
+   * // endpoint is `std::shared_ptr<ucxx::Endpoint>`
+   * auto receiver = ucxx::createDeltaSyncReceiver(endpoint, replica, size, 4096, tag);
+   * receiver->receive();
+   * while (!receiver->isCompleted()) worker->progress();
+   * @endcode
+   *
+   * @throws ucxx::Error if `blockSize` is `0`.
+   *
+   * @param[in] endpoint  the endpoint to the sender.
+   * @param[in] buffer    the replica buffer.
+   * @param[in] size      the size of the replica in bytes.
+   * @param[in] blockSize the granularity in bytes at which changes are detected.
+   * @param[in] tag       the tag used to transfer rounds.
+   *
+   * @returns The `shared_ptr<ucxx::DeltaSyncReceiver>` object.
+   */
+  friend std::shared_ptr<DeltaSyncReceiver> createDeltaSyncReceiver(
+    std::shared_ptr<Endpoint> endpoint,
+    void* buffer,
+    const size_t size,
+    const size_t blockSize,
+    const ucp_tag_t tag);
+
+  /**
+   * @brief Receive a round.
+   *
+   * Post the receive of the next round, patching the changed extents of the replica in
+   * place as they arrive. This is a non-blocking operation, the replica is consistent
+   * with the sender once `isCompleted()` returns `true` and `getStatus()` is `UCS_OK`.
+   *
+   * @throws ucxx::Error if the previous round has not completed yet.
+   */
+  void receive();
+
+  /**
+   * @brief Check whether the current round has completed.
+   *
+   * Check whether all transfers of the current round have completed.
+   *
+   * @returns whether the current round has completed.
+   */
+  bool isCompleted() const;
+
+  /**
+   * @brief Get the status of the current round.
+   *
+   * Get the status of the current round, `UCS_INPROGRESS` while transfers are pending,
+   * `UCS_OK` if it completed successfully or an error if the descriptor was malformed.
+   *
+   * @returns the status of the current round.
+   */
+  ucs_status_t getStatus() const;
+
+  /**
+   * @brief Get accumulated statistics.
+   *
+   * Get the statistics accumulated over all completed rounds.
+   *
+   * @returns the accumulated statistics.
+   */
+  DeltaSyncStats getStats();
+};
+
+}  // namespace ucxx
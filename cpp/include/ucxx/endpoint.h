@@ -6,15 +6,20 @@
 
 #include <netdb.h>
 
+#include <future>
 #include <memory>
+#include <new>
 #include <string>
 #include <vector>
 
 #include <ucp/api/ucp.h>
 
 #include <ucxx/address.h>
+#include <ucxx/codec.h>
 #include <ucxx/component.h>
+#include <ucxx/dedup.h>
 #include <ucxx/exception.h>
+#include <ucxx/expected.h>
 #include <ucxx/inflight_requests.h>
 #include <ucxx/listener.h>
 #include <ucxx/request.h>
@@ -38,14 +43,19 @@ struct ErrorCallbackData {
 
 class Endpoint : public Component {
  private:
-  ucp_ep_h _handle{nullptr};          ///< Handle to the UCP endpoint
-  ucp_ep_h _originalHandle{nullptr};  ///< Handle to the UCP endpoint, after it was previously
-                                      ///< closed, used for logging purposes only
-  bool _endpointErrorHandling{true};  ///< Whether the endpoint enables error handling
+  ucp_ep_h _handle{nullptr};                 ///< Handle to the UCP endpoint
+  ucp_ep_h _originalHandle{nullptr};         ///< Handle to the UCP endpoint, after it was
+                                             ///< previously closed, used for logging only
+  bool _endpointErrorHandling{true};         ///< Whether the endpoint enables error handling
+  std::shared_ptr<Worker> _worker{nullptr};  ///< Worker the endpoint has been created from
   std::unique_ptr<ErrorCallbackData> _callbackData{
     nullptr};  ///< Data struct to pass to endpoint error handling callback
   std::shared_ptr<InflightRequests> _inflightRequests{
     std::make_shared<InflightRequests>()};  ///< The inflight requests
+  std::shared_ptr<DedupCache> _dedupSendCache{
+    nullptr};  ///< Mirror of the remote cache of deduplicated frames
+  std::shared_ptr<DedupCache> _dedupRecvCache{
+    nullptr};  ///< Cache of deduplicated frames received
 
   /**
    * @brief Private constructor of `ucxx::Endpoint`.
@@ -63,16 +73,40 @@ class Endpoint : public Component {
    * - `ucxx::createEndpointFromHostname()`
    * - `ucxx::createEndpointFromWorkerAddress()`
    *
+   * The UCP endpoint is not created by the constructor, but by `create()`.
+   *
    * @param[in] workerOrListener      the parent component, which may either be a
    *                                  `std::shared_ptr<Listener>` or
    *                                  `std::shared_ptr<Worker>`.
-   * @param[in] params                parameters specifying UCP endpoint capabilities.
+   * @param[in] worker                the worker the endpoint is created from.
    * @param[in] endpointErrorHandling whether to enable endpoint error handling.
    */
   Endpoint(std::shared_ptr<Component> workerOrListener,
-           std::unique_ptr<ucp_ep_params_t, EpParamsDeleter> params,
+           std::shared_ptr<Worker> worker,
            bool endpointErrorHandling);
 
+  /**
+   * @brief Create a `ucxx::Endpoint` and its underlying UCP endpoint, without throwing.
+   *
+   * Common implementation of all endpoint constructors, reporting failures to create the
+   * UCP endpoint, such as an unreachable peer, as a status rather than an exception.
+   *
+   * @param[in] workerOrListener      the parent component, which may either be a
+   *                                  `std::shared_ptr<Listener>` or
+   *                                  `std::shared_ptr<Worker>`.
+   * @param[in] worker                the worker the endpoint is created from, either
+   *                                  `workerOrListener` itself or the listener's worker.
+   * @param[in] params                parameters specifying UCP endpoint capabilities.
+   * @param[in] endpointErrorHandling whether to enable endpoint error handling.
+   *
+   * @returns the `shared_ptr<ucxx::Endpoint>` object or the status of the failure.
+   */
+  static Expected<std::shared_ptr<Endpoint>> create(
+    std::shared_ptr<Component> workerOrListener,
+    std::shared_ptr<Worker> worker,
+    std::unique_ptr<ucp_ep_params_t, EpParamsDeleter> params,
+    bool endpointErrorHandling) noexcept;
+
   /**
    * @brief Register an inflight request.
    *
@@ -86,6 +120,48 @@ class Endpoint : public Component {
    */
   std::shared_ptr<Request> registerInflightRequest(std::shared_ptr<Request> request);
 
+  /**
+   * @brief Submit a request, without throwing.
+   *
+   * Common implementation of exception-free request submission. Verify the endpoint is
+   * alive, create the request with `createRequest` and register it as inflight.
+   *
+   * @param[in] createRequest callable receiving this endpoint and returning the request.
+   *
+   * @returns the request that was registered or the status of the failure.
+   */
+  template <typename CreateRequest>
+  Expected<std::shared_ptr<Request>> submitRequest(CreateRequest createRequest) noexcept;
+
+  /**
+   * @brief Start closing the UCP endpoint.
+   *
+   * Cancel inflight requests and submit the UCP endpoint close operation, common to
+   * `close()` and `closeAsync()`. The caller must complete closing with
+   * `closeCompleted()` once the returned request, if any, completes.
+   *
+   * @param[in] param the request parameters, the close flags are set by this method.
+   *
+   * @returns the status pointer returned by `ucp_ep_close_nbx()`.
+   */
+  ucs_status_ptr_t closeSubmit(ucp_request_param_t* param);
+
+  /**
+   * @brief Complete closing the endpoint.
+   *
+   * Call the user-defined close callback, if any, and release the endpoint handle.
+   */
+  void closeCompleted();
+
+  /**
+   * @brief Callback of the UCP endpoint close request submitted by `closeAsync()`.
+   *
+   * @param[in] request the UCP request, freed by the callback.
+   * @param[in] status  the status of the close operation.
+   * @param[in] arg     the close operation data, owned by the callback.
+   */
+  static void closeAsyncCallback(void* request, ucs_status_t status, void* arg);
+
  public:
   Endpoint()                = delete;
   Endpoint(const Endpoint&) = delete;
@@ -171,6 +247,67 @@ class Endpoint : public Component {
                                                                    std::shared_ptr<Address> address,
                                                                    bool endpointErrorHandling);
 
+  /**
+   * @brief Constructor for `shared_ptr<ucxx::Endpoint>`, without throwing.
+   *
+   * Exception-free variant of `createEndpointFromHostname()`.
+   *
+   * @code{.cpp}
+   * // worker is `std::shared_ptr<ucxx::Worker>`, with a presumed listener on
+   * // "localhost:12345"
+   * auto result = ucxx::createEndpointFromHostname(std::nothrow, worker, "localhost", 12345, true);
+   * if (result) auto endpoint = result.getValue();
+   * @endcode
+   *
+   * @param[in] worker                parent worker from which to create the endpoint.
+   * @param[in] ipAddress             hostname or IP address the listener is bound to.
+   * @param[in] port                  port the listener is bound to.
+   * @param[in] endpointErrorHandling whether to enable endpoint error handling.
+   *
+   * @returns The `shared_ptr<ucxx::Endpoint>` object or the status of the failure.
+   */
+  friend Expected<std::shared_ptr<Endpoint>> createEndpointFromHostname(
+    std::nothrow_t,
+    std::shared_ptr<Worker> worker,
+    std::string ipAddress,
+    uint16_t port,
+    bool endpointErrorHandling) noexcept;
+
+  /**
+   * @brief Constructor for `shared_ptr<ucxx::Endpoint>`, without throwing.
+   *
+   * Exception-free variant of `createEndpointFromConnRequest()`.
+   *
+   * @param[in] listener              listener from which to create the endpoint.
+   * @param[in] connRequest           handle to connection request delivered by a
+   *                                  listener callback.
+   * @param[in] endpointErrorHandling whether to enable endpoint error handling.
+   *
+   * @returns The `shared_ptr<ucxx::Endpoint>` object or the status of the failure.
+   */
+  friend Expected<std::shared_ptr<Endpoint>> createEndpointFromConnRequest(
+    std::nothrow_t,
+    std::shared_ptr<Listener> listener,
+    ucp_conn_request_h connRequest,
+    bool endpointErrorHandling) noexcept;
+
+  /**
+   * @brief Constructor for `shared_ptr<ucxx::Endpoint>`, without throwing.
+   *
+   * Exception-free variant of `createEndpointFromWorkerAddress()`.
+   *
+   * @param[in] worker                parent worker from which to create the endpoint.
+   * @param[in] address               address of the remote UCX worker
+   * @param[in] endpointErrorHandling whether to enable endpoint error handling.
+   *
+   * @returns The `shared_ptr<ucxx::Endpoint>` object or the status of the failure.
+   */
+  friend Expected<std::shared_ptr<Endpoint>> createEndpointFromWorkerAddress(
+    std::nothrow_t,
+    std::shared_ptr<Worker> worker,
+    std::shared_ptr<Address> address,
+    bool endpointErrorHandling) noexcept;
+
   /**
    * @brief Get the underlying `ucp_ep_h` handle.
    *
@@ -309,6 +446,11 @@ class Endpoint : public Component {
    * Python future is requested, the Python application must then await on this future to
    * ensure the transfer has completed. Requires UCXX Python support.
    *
+   * By default the request completes once `buffer` may be reused, specifying
+   * `ucxx::TagSendMode::Sync` as `sendMode` delays completion until the message was
+   * matched by a receive at the remote end, removing the need for an application-level
+   * acknowledgement when the sender must know the message was delivered.
+   *
    * @param[in] buffer              a raw pointer to the data to be sent.
    * @param[in] length              the size in bytes of the tag message to be sent.
    * @param[in] tag                 the tag to match.
@@ -316,6 +458,7 @@ class Endpoint : public Component {
    *                                subsequently notified.
    * @param[in] callbackFunction    user-defined callback function to call upon completion.
    * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
+   * @param[in] sendMode            the completion semantics of the send.
    *
    * @returns Request to be subsequently checked for the completion and its state.
    */
@@ -323,9 +466,10 @@ class Endpoint : public Component {
     void* buffer,
     size_t length,
     ucp_tag_t tag,
-    const bool enablePythonFuture                               = false,
-    std::function<void(std::shared_ptr<void>)> callbackFunction = nullptr,
-    std::shared_ptr<void> callbackData                          = nullptr);
+    const bool enablePythonFuture                = false,
+    RequestCallbackUserFunction callbackFunction = nullptr,
+    RequestCallbackUserData callbackData         = nullptr,
+    const TagSendMode sendMode                   = TagSendMode::Standard);
 
   /**
    * @brief Enqueue a tag receive operation.
@@ -354,9 +498,208 @@ class Endpoint : public Component {
     void* buffer,
     size_t length,
     ucp_tag_t tag,
-    const bool enablePythonFuture                               = false,
-    std::function<void(std::shared_ptr<void>)> callbackFunction = nullptr,
-    std::shared_ptr<void> callbackData                          = nullptr);
+    const bool enablePythonFuture                = false,
+    RequestCallbackUserFunction callbackFunction = nullptr,
+    RequestCallbackUserData callbackData         = nullptr);
+
+  /**
+   * @brief Enqueue a tag send operation gathering multiple segments.
+   *
+   * Enqueue a tag send operation of the segments in `iov` as a single tag message, UCX
+   * gathers the segments directly from their memory instead of requiring the application
+   * to first copy them into a contiguous buffer. The message is received by a regular
+   * `tagRecv()` of the total length of all segments, where segments are laid out
+   * contiguously in order. The memory of each segment must remain valid until the
+   * request completes.
+   *
+   * @code{.cpp}
+   * // endpoint is `std::shared_ptr<ucxx::Endpoint>`
+   * auto request = endpoint->tagSendIov({{&header, sizeof(header)}, {payload, payloadLength}},
+   *                                     tag);
+   * @endcode
+   *
+   * @throws ucxx::Error  if `iov` is empty.
+   *
+   * @param[in] iov                 the segments to be sent.
+   * @param[in] tag                 the tag to match.
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified.
+   * @param[in] callbackFunction    user-defined callback function to call upon completion.
+   * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
+   *
+   * @returns Request to be subsequently checked for the completion and its state.
+   */
+  std::shared_ptr<Request> tagSendIov(
+    std::vector<ucp_dt_iov_t> iov,
+    ucp_tag_t tag,
+    const bool enablePythonFuture                = false,
+    RequestCallbackUserFunction callbackFunction = nullptr,
+    RequestCallbackUserData callbackData         = nullptr);
+
+  /**
+   * @brief Enqueue a stream send operation, without throwing.
+   *
+   * Exception-free variant of `streamSend()`. Submission failures, such as submitting
+   * on an endpoint that was already closed, are returned as a status.
+   *
+   * @code{.cpp}
+   * // endpoint is `std::shared_ptr<ucxx::Endpoint>`
+   * auto result = endpoint->streamSend(std::nothrow, buffer, length, false);
+   * if (result.getStatus() == UCS_ERR_NOT_CONNECTED) return;
+   * auto request = result.getValue();
+   * @endcode
+   *
+   * @param[in] buffer              a raw pointer to the data to be sent.
+   * @param[in] length              the size in bytes of the tag message to be sent.
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified.
+   *
+   * @returns Request to be subsequently checked for the completion and its state, or the
+   *          status of the submission failure.
+   */
+  Expected<std::shared_ptr<Request>> streamSend(std::nothrow_t,
+                                                void* buffer,
+                                                size_t length,
+                                                const bool enablePythonFuture) noexcept;
+
+  /**
+   * @brief Enqueue a stream receive operation, without throwing.
+   *
+   * Exception-free variant of `streamRecv()`, see `streamSend(std::nothrow_t, ...)`.
+   *
+   * @param[in] buffer              a raw pointer to pre-allocated memory where resulting
+   *                                data will be stored.
+   * @param[in] length              the size in bytes of the tag message to be received.
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified.
+   *
+   * @returns Request to be subsequently checked for the completion and its state, or the
+   *          status of the submission failure.
+   */
+  Expected<std::shared_ptr<Request>> streamRecv(std::nothrow_t,
+                                                void* buffer,
+                                                size_t length,
+                                                const bool enablePythonFuture) noexcept;
+
+  /**
+   * @brief Enqueue a tag send operation, without throwing.
+   *
+   * Exception-free variant of `tagSend()`, see `streamSend(std::nothrow_t, ...)`.
+   *
+   * @param[in] buffer              a raw pointer to the data to be sent.
+   * @param[in] length              the size in bytes of the tag message to be sent.
+   * @param[in] tag                 the tag to match.
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified.
+   * @param[in] callbackFunction    user-defined callback function to call upon completion.
+   * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
+   * @param[in] sendMode            the completion semantics of the send.
+   *
+   * @returns Request to be subsequently checked for the completion and its state, or the
+   *          status of the submission failure.
+   */
+  Expected<std::shared_ptr<Request>> tagSend(
+    std::nothrow_t,
+    void* buffer,
+    size_t length,
+    ucp_tag_t tag,
+    const bool enablePythonFuture                = false,
+    RequestCallbackUserFunction callbackFunction = nullptr,
+    RequestCallbackUserData callbackData         = nullptr,
+    const TagSendMode sendMode                   = TagSendMode::Standard) noexcept;
+
+  /**
+   * @brief Enqueue a tag receive operation, without throwing.
+   *
+   * Exception-free variant of `tagRecv()`, see `streamSend(std::nothrow_t, ...)`.
+   *
+   * @param[in] buffer              a raw pointer to pre-allocated memory where resulting
+   *                                data will be stored.
+   * @param[in] length              the size in bytes of the tag message to be received.
+   * @param[in] tag                 the tag to match.
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified.
+   * @param[in] callbackFunction    user-defined callback function to call upon completion.
+   * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
+   *
+   * @returns Request to be subsequently checked for the completion and its state, or the
+   *          status of the submission failure.
+   */
+  Expected<std::shared_ptr<Request>> tagRecv(
+    std::nothrow_t,
+    void* buffer,
+    size_t length,
+    ucp_tag_t tag,
+    const bool enablePythonFuture                = false,
+    RequestCallbackUserFunction callbackFunction = nullptr,
+    RequestCallbackUserData callbackData         = nullptr) noexcept;
+
+  /**
+   * @brief Enqueue a one-sided RMA put operation.
+   *
+   * Enqueue a one-sided RMA put operation, writing `length` bytes from `buffer` to
+   * `remoteAddress` in the remote peer's memory, returning a `std::shared<ucxx::Request>`
+   * that can be later awaited and checked for errors. This is a non-blocking operation,
+   * and the status of the transfer must be verified from the resulting request object
+   * before the data can be released. The remote peer is not involved in the transfer.
+   *
+   * Using a Python future may be requested by specifying `enablePythonFuture`. If a
+   * Python future is requested, the Python application must then await on this future to
+   * ensure the transfer has completed. Requires UCXX Python support.
+   *
+   * @param[in] buffer              a raw pointer to the data to be written.
+   * @param[in] length              the size in bytes of the data to be written.
+   * @param[in] remoteAddress       the remote address to write to.
+   * @param[in] remoteKey           the remote key of the memory containing `remoteAddress`.
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified.
+   * @param[in] callbackFunction    user-defined callback function to call upon completion.
+   * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
+   *
+   * @returns Request to be subsequently checked for the completion and its state.
+   */
+  std::shared_ptr<Request> rmaPut(
+    void* buffer,
+    size_t length,
+    uint64_t remoteAddress,
+    std::shared_ptr<RemoteKey> remoteKey,
+    const bool enablePythonFuture                = false,
+    RequestCallbackUserFunction callbackFunction = nullptr,
+    RequestCallbackUserData callbackData         = nullptr);
+
+  /**
+   * @brief Enqueue a one-sided RMA get operation.
+   *
+   * Enqueue a one-sided RMA get operation, reading `length` bytes from `remoteAddress` in
+   * the remote peer's memory into `buffer`, returning a `std::shared<ucxx::Request>` that
+   * can be later awaited and checked for errors. This is a non-blocking operation, and the
+   * status of the transfer must be verified from the resulting request object before the
+   * data can be consumed. The remote peer is not involved in the transfer.
+   *
+   * Using a Python future may be requested by specifying `enablePythonFuture`. If a
+   * Python future is requested, the Python application must then await on this future to
+   * ensure the transfer has completed. Requires UCXX Python support.
+   *
+   * @param[in] buffer              a raw pointer to pre-allocated memory where resulting
+   *                                data will be stored.
+   * @param[in] length              the size in bytes of the data to be read.
+   * @param[in] remoteAddress       the remote address to read from.
+   * @param[in] remoteKey           the remote key of the memory containing `remoteAddress`.
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified.
+   * @param[in] callbackFunction    user-defined callback function to call upon completion.
+   * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
+   *
+   * @returns Request to be subsequently checked for the completion and its state.
+   */
+  std::shared_ptr<Request> rmaGet(
+    void* buffer,
+    size_t length,
+    uint64_t remoteAddress,
+    std::shared_ptr<RemoteKey> remoteKey,
+    const bool enablePythonFuture                = false,
+    RequestCallbackUserFunction callbackFunction = nullptr,
+    RequestCallbackUserData callbackData         = nullptr);
 
   /**
    * @brief Enqueue a multi-buffer tag send operation.
@@ -377,7 +720,14 @@ class Endpoint : public Component {
    * Python future is requested, the Python application must then await on this future to
    * ensure the transfer has completed. Requires UCXX Python support.
    *
+   * Host frames may be encoded before transfer by specifying a codec in `codecParams`,
+   * see `ucxx::CodecParams` for details. The receiver decodes frames transparently.
+   *
+   * Specifying `ucxx::TagSendMode::Sync` as `sendMode` sends all frames synchronously,
+   * thus the request completes only after all frames were matched by the receiver.
+   *
    * @throws  std::runtime_error  if sizes of `buffer`, `size` and `isCUDA` do not match.
+   * @throws  ucxx::Error         if `codecParams` are invalid.
    *
    * @param[in] buffer              a vector of raw pointers to the data frames to be sent.
    * @param[in] length              a vector of size in bytes of each frame to be sent.
@@ -388,16 +738,19 @@ class Endpoint : public Component {
    * @param[in] tag                 the tag to match.
    * @param[in] enablePythonFuture  whether a python future should be created and
    *                                subsequently notified.
-   * @param[in] callbackFunction    user-defined callback function to call upon completion.
-   * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
+   * @param[in] codecParams         parameters of the codec used to encode host frames.
+   * @param[in] sendMode            the completion semantics of the frame sends.
    *
    * @returns Request to be subsequently checked for the completion and its state.
    */
-  std::shared_ptr<RequestTagMulti> tagMultiSend(const std::vector<void*>& buffer,
-                                                const std::vector<size_t>& size,
-                                                const std::vector<int>& isCUDA,
-                                                const ucp_tag_t tag,
-                                                const bool enablePythonFuture);
+  std::shared_ptr<RequestTagMulti> tagMultiSend(
+    const std::vector<void*>& buffer,
+    const std::vector<size_t>& size,
+    const std::vector<int>& isCUDA,
+    const ucp_tag_t tag,
+    const bool enablePythonFuture,
+    const CodecParams& codecParams = {},
+    const TagSendMode sendMode     = TagSendMode::Standard);
 
   /**
    * @brief Enqueue a multi-buffer tag receive operation.
@@ -423,20 +776,75 @@ class Endpoint : public Component {
   std::shared_ptr<RequestTagMulti> tagMultiRecv(const ucp_tag_t tag, const bool enablePythonFuture);
 
   /**
-   * @brief Get `ucxx::Worker` component form a worker or listener object.
+   * @brief Enable deduplication of multi-buffer transfers.
+   *
+   * Enable per-peer deduplication of host frames of multi-buffer transfers. Frames that
+   * were recently sent to the same peer are replaced by their fingerprint and copied from
+   * a bounded cache by the receiver, see `ucxx::DedupParams` for details.
    *
-   * A `ucxx::Endpoint` needs to be created and registered by and registered on
-   * `std::shared_ptr<ucxx::Worker>`, but the endpoint may be a child of a `ucxx::Listener`
-   * object. For convenience, this method can be used to derive the
-   * `std::shared_ptr<ucxx::Worker>` from either the `std::shared_ptr<ucxx::Worker>` itself
-   * or from a `std::shared_ptr<ucxx::Listener>`.
+   * Both ends of the endpoint must enable deduplication with the same parameters before
+   * any multi-buffer transfer is posted, and multi-buffer transfers must be received in
+   * the same order they were sent, which is always the case for transfers with the same
+   * tag. A receiver unable to resolve a reference completes the transfer with
+   * `UCS_ERR_NO_ELEM`.
+   *
+   * @code{.cpp}
+   * // endpoint is `std::shared_ptr<ucxx::Endpoint>`, on both ends
+   * endpoint->enableDedup(ucxx::DedupParams{.minFrameSize = 65536});
+   * @endcode
+   *
+   * @param[in] params  the deduplication parameters.
+   */
+  void enableDedup(const DedupParams& params = {});
+
+  /**
+   * @brief Get the deduplication cache of frames sent.
+   *
+   * Get the cache mirroring the frames cached by the remote end, used to plan
+   * deduplication of multi-buffer transfers sent.
+   *
+   * @returns the cache of frames sent or `nullptr` if deduplication is not enabled.
+   */
+  std::shared_ptr<DedupCache> getDedupSendCache();
+
+  /**
+   * @brief Get the deduplication cache of frames received.
+   *
+   * Get the cache storing frames received, used to resolve references of multi-buffer
+   * transfers received.
+   *
+   * @returns the cache of frames received or `nullptr` if deduplication is not enabled.
+   */
+  std::shared_ptr<DedupCache> getDedupRecvCache();
+
+  /**
+   * @brief Get the `ucxx::Worker` the endpoint has been created from.
+   *
+   * A `ucxx::Endpoint` is always created and registered on a `std::shared_ptr<ucxx::Worker>`,
+   * but its parent may be a `ucxx::Listener` object. The worker is resolved once when the
+   * endpoint is created and cached, so that requests created by the endpoint obtain it
+   * without walking the parent chain.
+   *
+   * @returns The `std::shared_ptr<ucxx::Worker>` the endpoint has been created from.
+   */
+  std::shared_ptr<Worker> getWorker() const;
+
+  /**
+   * @brief Get `ucxx::Worker` component from a worker or listener object.
+   *
+   * Derive the `std::shared_ptr<ucxx::Worker>` from either the
+   * `std::shared_ptr<ucxx::Worker>` itself or from a `std::shared_ptr<ucxx::Listener>`.
+   *
+   * @deprecated Use the `getWorker()` method of the endpoint or of the listener instead,
+   *             which return the cached worker without dynamic casts.
    *
    * @param[in] workerOrListener the `std::shared_ptr<ucxx::Worker>` or
    *                             `std::shared_ptr<ucxx::Listener>` object.
    *
    * @returns The `std::shared_ptr<ucxx::Worker>` derived from `workerOrListener` argument.
    */
-  static std::shared_ptr<Worker> getWorker(std::shared_ptr<Component> workerOrListener);
+  [[deprecated("Use the getWorker() method instead")]] static std::shared_ptr<Worker> getWorker(
+    std::shared_ptr<Component> workerOrListener);
 
   /**
    * @brief The error callback registered at endpoint creation time.
@@ -461,6 +869,20 @@ class Endpoint : public Component {
    * registered with `setCloseCallback()`.
    */
   void close();
+
+  /**
+   * @brief Close the endpoint asynchronously while keeping the object alive.
+   *
+   * Equivalent to `close()`, but the close operation is submitted by the worker progress
+   * thread when delayed submission is enabled, preventing the caller thread from contending
+   * with the progress thread for the UCX spinlock, and immediately otherwise. Closing does
+   * not progress the worker, it completes from the UCP request callback, thus the worker
+   * must be progressed for the future to become ready. The endpoint is kept alive until
+   * closing completes.
+   *
+   * @returns The future that becomes ready once the endpoint is closed.
+   */
+  std::future<void> closeAsync();
 };
 
 }  // namespace ucxx
@@ -0,0 +1,153 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <exception>
+#include <new>
+#include <utility>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/exception.h>
+#include <ucxx/utils/ucx.h>
+
+namespace ucxx {
+
+/**
+ * @brief The result of an exception-free operation.
+ *
+ * Holds either the value produced by a successful operation or the `ucs_status_t` of a
+ * failed one, allowing expected failures on hot paths, such as a receive canceled during
+ * shutdown or `UCS_ERR_NO_RESOURCE`, to be handled without the cost of exceptions. A
+ * failure may carry a static, human-readable message or, when the failure originated
+ * from an exception raised by a dependency (e.g., `std::bad_alloc`), the original
+ * exception which is then rethrown by `getValue()` unchanged.
+ *
+ * @code{.cpp}
+ * // endpoint is `std::shared_ptr<ucxx::Endpoint>`
+ * auto result = endpoint->tagRecv(std::nothrow, buffer, length, tag);
+ * if (!result) return result.getStatus();
+ * auto request = result.getValue();
+ * @endcode
+ *
+ * @tparam T  the type of the value held on success.
+ */
+template <typename T>
+class Expected {
+ private:
+  T _value{};                              ///< The value, valid only if `_status == UCS_OK`
+  ucs_status_t _status{UCS_OK};            ///< The status of the operation
+  const char* _message{nullptr};           ///< Static message describing the failure
+  std::exception_ptr _exception{nullptr};  ///< Exception that caused the failure, if any
+
+  /**
+   * @brief Throw the exception corresponding to the failure.
+   */
+  [[noreturn]] void throwError() const
+  {
+    if (_exception) std::rethrow_exception(_exception);
+    utils::ucsErrorThrow(_status, _message == nullptr ? "" : _message);
+    throw ucxx::Error(ucs_status_string(_status));
+  }
+
+ public:
+  /**
+   * @brief Construct a successful result.
+   *
+   * @param[in] value the value produced by the operation.
+   */
+  Expected(T value) noexcept : _value(std::move(value)) {}
+
+  /**
+   * @brief Construct a failed result.
+   *
+   * @param[in] status  the status of the failure, must not be `UCS_OK` or `UCS_INPROGRESS`.
+   * @param[in] message a static message describing the failure, or `nullptr` to use the
+   *                    UCX status string.
+   */
+  Expected(const ucs_status_t status, const char* message = nullptr) noexcept
+    : _status(status), _message(message)
+  {
+  }
+
+  /**
+   * @brief Construct a failed result from the exception currently being handled.
+   *
+   * Must be called from within a `catch` block. `std::bad_alloc` is mapped to
+   * `UCS_ERR_NO_MEMORY` and any other exceptions to `UCS_ERR_IO_ERROR`.
+   *
+   * @returns the failed result holding the current exception.
+   */
+  static Expected fromCurrentException() noexcept
+  {
+    Expected expected{UCS_ERR_IO_ERROR};
+    expected._exception = std::current_exception();
+    try {
+      std::rethrow_exception(expected._exception);
+    } catch (const std::bad_alloc&) {
+      expected._status = UCS_ERR_NO_MEMORY;
+    } catch (...) {
+    }
+    return expected;
+  }
+
+  /**
+   * @brief Check whether the result holds a value.
+   *
+   * @returns `true` if the operation succeeded, `false` otherwise.
+   */
+  bool hasValue() const noexcept { return _status == UCS_OK; }
+
+  /**
+   * @brief Check whether the result holds a value.
+   *
+   * @returns `true` if the operation succeeded, `false` otherwise.
+   */
+  explicit operator bool() const noexcept { return hasValue(); }
+
+  /**
+   * @brief Get the status of the operation.
+   *
+   * @returns `UCS_OK` if the operation succeeded, or the status of the failure otherwise.
+   */
+  ucs_status_t getStatus() const noexcept { return _status; }
+
+  /**
+   * @brief Get the message describing the failure.
+   *
+   * @returns the static message describing the failure, or `nullptr` if none was given.
+   */
+  const char* getMessage() const noexcept { return _message; }
+
+  /**
+   * @brief Get the value, throwing if the operation failed.
+   *
+   * Get the value produced by the operation. If the operation failed, the original
+   * exception is rethrown if one caused the failure, otherwise the exception mapped
+   * from the status by `ucxx::utils::ucsErrorThrow()` is thrown.
+   *
+   * @throws ucxx::Error or the original exception if the operation failed.
+   *
+   * @returns the value produced by the operation.
+   */
+  T& getValue() &
+  {
+    if (_status != UCS_OK) throwError();
+    return _value;
+  }
+
+  /**
+   * @brief Get the value, throwing if the operation failed.
+   *
+   * @copydetails getValue() &
+   */
+  T getValue() &&
+  {
+    if (_status != UCS_OK) throwError();
+    return std::move(_value);
+  }
+};
+
+}  // namespace ucxx
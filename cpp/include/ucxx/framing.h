@@ -0,0 +1,300 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/endpoint.h>
+#include <ucxx/exception.h>
+#include <ucxx/request.h>
+
+namespace ucxx {
+
+/**
+ * @brief Alignment in bytes of each part of a frame.
+ *
+ * The fixed fields and each variable-length field of a frame start at an offset that is
+ * a multiple of `FrameAlignment` from the beginning of the frame, types stored in frames
+ * must thus not require a larger alignment.
+ */
+const size_t FrameAlignment = 8;
+
+/**
+ * @brief A view of a variable-length field of a frame.
+ *
+ * A pointer and a number of elements, not owning the memory it points to. On the sender
+ * it points to the source memory of the field, on the receiver it points into the buffer
+ * where the frame was received.
+ */
+template <typename T>
+struct FrameSpan {
+  T* data{nullptr};  ///< Pointer to the first element
+  size_t size{0};    ///< Number of elements
+
+  /**
+   * @brief Get the size in bytes of the field.
+   *
+   * @returns the size in bytes of the field.
+   */
+  size_t getBytes() const { return size * sizeof(T); }
+};
+
+/**
+ * @brief A message schema described at compile time.
+ *
+ * A frame is a tag message made of a trivially copyable `Fixed` type, holding all
+ * fixed-size fields, followed by one variable-length field per type in `Fields`, each an
+ * array of trivially copyable elements. The fixed fields are sent inline, together with
+ * the number of elements of each variable-length field, while the variable-length fields
+ * are sent as IOV segments directly from their source memory, without copying them into
+ * a contiguous buffer. The receiver receives the whole frame in a single buffer and
+ * accesses all fields through a `Frame::View` pointing into that buffer, without
+ * copying or allocating.
+ *
+ * The layout of a frame is the `Fixed` object, the number of elements of each
+ * variable-length field as `uint64_t` and the elements of each variable-length field,
+ * each part starting at an offset that is a multiple of `FrameAlignment`. Sender and
+ * receiver must share the same host architecture.
+ *
+ * @code{.cpp}
+ * struct RpcHeader {
+ *   uint64_t requestId;
+ *   uint32_t method;
+ * };
+ * // A `RpcHeader`, a key of `char` and values of `float`
+ * using RpcMessage = ucxx::Frame<RpcHeader, char, float>;
+ *
+ * // Sender, `endpoint` is `std::shared_ptr<ucxx::Endpoint>`
+ * auto request = RpcMessage::tagSend(
+ *   endpoint, {requestId, method}, {key.data(), key.size()}, {values.data(), values.size()}, tag);
+ *
+ * // Receiver, `worker` is `std::shared_ptr<ucxx::Worker>`
+ * std::vector<uint64_t> buffer;
+ * auto allocate = [&buffer](size_t length) {
+ *   buffer.resize((length + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+ *   return buffer.data();
+ * };
+ * std::shared_ptr<ucxx::Request> recvRequest;
+ * while (!(recvRequest = worker->tagProbeRecv(tag, allocate)))
+ *   worker->progress();
+ * // Wait for `recvRequest` to complete
+ * auto view   = RpcMessage::View(buffer.data(), buffer.size() * sizeof(uint64_t));
+ * auto method = view.getFixed().method;
+ * auto values = view.get<1>();  // `ucxx::FrameSpan<const float>`
+ * @endcode
+ */
+template <typename Fixed, typename... Fields>
+class Frame {
+  static_assert(std::is_trivially_copyable_v<Fixed>, "Fixed fields must be trivially copyable");
+  static_assert((std::is_trivially_copyable_v<Fields> && ...),
+                "Variable-length fields must be trivially copyable");
+  static_assert(alignof(Fixed) <= FrameAlignment && ((alignof(Fields) <= FrameAlignment) && ...),
+                "Frame types must not require an alignment larger than FrameAlignment");
+
+ public:
+  /**
+   * @brief Number of variable-length fields.
+   */
+  static constexpr size_t FieldCount = sizeof...(Fields);
+
+  /**
+   * @brief Type of the variable-length field at `Index`.
+   */
+  template <size_t Index>
+  using Field = std::tuple_element_t<Index, std::tuple<Fields...>>;
+
+ private:
+  static constexpr size_t align(size_t size)
+  {
+    return (size + FrameAlignment - 1) / FrameAlignment * FrameAlignment;
+  }
+
+  static constexpr size_t CountsOffset = align(sizeof(Fixed));
+  static constexpr size_t HeaderSize   = CountsOffset + FieldCount * sizeof(uint64_t);
+
+  /**
+   * @brief Zeroed memory sent as padding between variable-length fields.
+   */
+  static inline const std::array<char, FrameAlignment> Padding{};
+
+  /**
+   * @brief Compute the offset and size in bytes of each variable-length field.
+   *
+   * @param[in] bytes the size in bytes of each variable-length field.
+   *
+   * @returns the offset of each variable-length field and the total size of the frame.
+   */
+  static std::pair<std::array<size_t, FieldCount>, size_t> getLayout(
+    const std::array<size_t, FieldCount>& bytes)
+  {
+    std::array<size_t, FieldCount> offsets{};
+    size_t end = HeaderSize;
+    for (size_t i = 0; i < FieldCount; ++i) {
+      offsets[i] = align(end);
+      end        = offsets[i] + bytes[i];
+    }
+    return {offsets, end};
+  }
+
+ public:
+  Frame() = delete;
+
+  /**
+   * @brief Get the size in bytes of a frame.
+   *
+   * Get the size in bytes of a frame with the given variable-length fields, which is the
+   * length of the tag message sent by `tagSend()`.
+   *
+   * @param[in] fields the variable-length fields of the frame.
+   *
+   * @returns the size in bytes of the frame.
+   */
+  static size_t getSize(const FrameSpan<const Fields>&... fields)
+  {
+    return getLayout({fields.getBytes()...}).second;
+  }
+
+  /**
+   * @brief Enqueue a tag send of a frame.
+   *
+   * Enqueue a tag send of a frame through `ucxx::Endpoint::tagSendIov()`. The fixed
+   * fields are copied inline into a header owned by the request, the variable-length
+   * fields are sent directly from their source memory, which must remain valid until the
+   * request completes. Empty variable-length fields are not sent.
+   *
+   * @param[in] endpoint            the endpoint to send the frame through.
+   * @param[in] fixed               the fixed fields of the frame.
+   * @param[in] fields              the variable-length fields of the frame.
+   * @param[in] tag                 the tag to match.
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified.
+   * @param[in] callbackFunction    user-defined callback function to call upon completion.
+   * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
+   *
+   * @returns Request to be subsequently checked for the completion and its state.
+   */
+  static std::shared_ptr<Request> tagSend(
+    std::shared_ptr<Endpoint> endpoint,
+    const Fixed& fixed,
+    FrameSpan<const Fields>... fields,
+    ucp_tag_t tag,
+    const bool enablePythonFuture                = false,
+    RequestCallbackUserFunction callbackFunction = nullptr,
+    RequestCallbackUserData callbackData         = nullptr)
+  {
+    const std::array<size_t, FieldCount> bytes{fields.getBytes()...};
+    const std::array<const void*, FieldCount> data{fields.data...};
+    const std::array<uint64_t, FieldCount> counts{fields.size...};
+    auto offsets = getLayout(bytes).first;
+
+    auto header = std::make_shared<std::array<char, HeaderSize>>();
+    std::memcpy(header->data(), &fixed, sizeof(Fixed));
+    if constexpr (FieldCount > 0)
+      std::memcpy(header->data() + CountsOffset, counts.data(), sizeof(counts));
+
+    std::vector<ucp_dt_iov_t> iov;
+    iov.reserve(1 + 2 * FieldCount);
+    iov.push_back({header->data(), HeaderSize});
+    size_t end = HeaderSize;
+    for (size_t i = 0; i < FieldCount; ++i) {
+      if (offsets[i] > end)
+        iov.push_back({const_cast<char*>(Padding.data()), offsets[i] - end});
+      if (bytes[i] > 0) iov.push_back({const_cast<void*>(data[i]), bytes[i]});
+      end = offsets[i] + bytes[i];
+    }
+
+    // The header is owned by the completion callback, which lives as long as the request
+    auto callback = [header, callbackFunction](ucs_status_t status, std::shared_ptr<void> data) {
+      if (callbackFunction) callbackFunction(status, data);
+    };
+    return endpoint->tagSendIov(std::move(iov), tag, enablePythonFuture, callback, callbackData);
+  }
+
+  /**
+   * @brief A view of a received frame.
+   *
+   * Provides access to the fields of a frame received in a buffer, pointing into the
+   * buffer without copying. The buffer must remain valid while the view and any field
+   * obtained from it are used.
+   */
+  class View {
+   private:
+    const char* _buffer{nullptr};                ///< The buffer where the frame was received
+    std::array<size_t, FieldCount> _offsets{};  ///< Offset of each variable-length field
+    std::array<size_t, FieldCount> _counts{};   ///< Elements of each variable-length field
+
+   public:
+    View() = delete;
+
+    /**
+     * @brief Constructor of a frame view.
+     *
+     * Constructs a view of the frame received in `buffer`, validating that the number of
+     * elements of all variable-length fields is consistent with `length`.
+     *
+     * @throws ucxx::Error if `buffer` is not aligned to `ucxx::FrameAlignment` or
+     *                     `length` does not match the size of the frame.
+     *
+     * @param[in] buffer  the buffer where the frame was received.
+     * @param[in] length  the size in bytes of the received message.
+     */
+    View(const void* buffer, size_t length) : _buffer(static_cast<const char*>(buffer))
+    {
+      if (reinterpret_cast<uintptr_t>(buffer) % FrameAlignment != 0)
+        throw ucxx::Error("Frame buffer is not aligned to FrameAlignment");
+      if (length < HeaderSize) throw ucxx::Error("Frame truncated");
+
+      std::array<uint64_t, FieldCount> counts{};
+      if constexpr (FieldCount > 0)
+        std::memcpy(counts.data(), _buffer + CountsOffset, sizeof(counts));
+
+      const std::array<size_t, FieldCount> maxCounts{(length / sizeof(Fields))...};
+      std::array<size_t, FieldCount> bytes{};
+      const std::array<size_t, FieldCount> elementSizes{sizeof(Fields)...};
+      for (size_t i = 0; i < FieldCount; ++i) {
+        if (counts[i] > maxCounts[i]) throw ucxx::Error("Frame truncated");
+        _counts[i] = counts[i];
+        bytes[i]   = counts[i] * elementSizes[i];
+      }
+
+      auto layout = getLayout(bytes);
+      if (layout.second != length) throw ucxx::Error("Frame length mismatch");
+      _offsets = layout.first;
+    }
+
+    /**
+     * @brief Get the fixed fields of the frame.
+     *
+     * @returns a reference to the fixed fields within the buffer.
+     */
+    const Fixed& getFixed() const { return *reinterpret_cast<const Fixed*>(_buffer); }
+
+    /**
+     * @brief Get a variable-length field of the frame.
+     *
+     * @tparam Index the index of the variable-length field in `Fields`.
+     *
+     * @returns a view of the field within the buffer.
+     */
+    template <size_t Index>
+    FrameSpan<const Field<Index>> get() const
+    {
+      static_assert(Index < FieldCount, "Field index out of range");
+      return {reinterpret_cast<const Field<Index>*>(_buffer + _offsets[Index]), _counts[Index]};
+    }
+  };
+};
+
+}  // namespace ucxx
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <array>
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -12,6 +13,10 @@ namespace ucxx {
 
 const size_t HeaderFramesSize = 100;
 
+const uint8_t HeaderFlagNext          = 1 << 0;  ///< Serialized flag of `Header::next`
+const uint8_t HeaderFlagExtended      = 1 << 1;  ///< Serialized flag of `Header::extended`
+const uint32_t HeaderExtensionVersion = 1;       ///< Version of the serialized extension
+
 class Header {
  private:
   /**
@@ -25,9 +30,14 @@ class Header {
 
  public:
   bool next;                                  ///< Whether there is a next header
+  bool extended;                              ///< Whether a header extension follows
   size_t nframes;                             ///< Number of frames
   std::array<int, HeaderFramesSize> isCUDA;   ///< Flag for whether each frame is CUDA or host
   std::array<size_t, HeaderFramesSize> size;  ///< Size in bytes of each frame
+  std::array<int, HeaderFramesSize> codec;    ///< `ucxx::CodecType` each frame is encoded with
+  size_t chunkSize;                           ///< Size in bytes of chunks of encoded frames
+  std::array<int, HeaderFramesSize> dedup;    ///< `ucxx::DedupAction` of each frame
+  uint64_t dedupEpoch;                        ///< Epoch of the sender deduplication cache
 
   Header() = delete;
 
@@ -41,7 +51,12 @@ class Header {
    * receiver should expect is another header (in case the number of frames is larger than
    * the pre-defined size), the number of frames `nframes` it contains information for,
    * and pointers to `nframes` arrays of whether each frame is CUDA (`isCUDA == true`) or
-   * host (`isCUDA == false`) and the size `size` of each frame in bytes.
+   * host (`isCUDA == false`) and the size `size` of each frame in bytes. Optionally, a
+   * pointer to an array with the `ucxx::CodecType` each frame is encoded with may be
+   * specified, together with the size of chunks encoded frames are split into, as well
+   * as a pointer to an array with the `ucxx::DedupAction` of each frame and the epoch of
+   * the cache they were decided against. The header is `extended` only if at least one
+   * frame is encoded or deduplicated.
    *
    * @param[in] next    whether the receiver should expect a next header.
    * @param[in] nframes the number of frames the header contains information for (must be
@@ -50,8 +65,21 @@ class Header {
    *                    frames being transferred are CUDA (`true`) or host (`false`).
    * @param[in] size    array with length `nframes` containing the size in bytes of each
    *                    frame.
+   * @param[in] codec   array with length `nframes` containing the `ucxx::CodecType` of
+   *                    each frame, or `nullptr` if all frames are raw.
+   * @param[in] chunkSize the size in bytes of chunks encoded frames are split into.
+   * @param[in] dedup   array with length `nframes` containing the `ucxx::DedupAction` of
+   *                    each frame, or `nullptr` if no frames are deduplicated.
+   * @param[in] dedupEpoch the epoch of the sender deduplication cache.
    */
-  Header(bool next, size_t nframes, int* isCUDA, size_t* size);
+  Header(bool next,
+         size_t nframes,
+         int* isCUDA,
+         size_t* size,
+         int* codec          = nullptr,
+         size_t chunkSize    = 0,
+         int* dedup          = nullptr,
+         uint64_t dedupEpoch = 0);
 
   /**
    * @brief Constructor of a fixed-size header from serialized data.
@@ -66,35 +94,90 @@ class Header {
    * @brief Get the size of the underlying data.
    *
    * Get the size of the underlying data, in other words, the size of a serialized
-   * `ucxx::Header` ready for transfer.
+   * `ucxx::Header` ready for transfer, excluding its extension.
    *
    * @returns the size of the underlying data.
    */
   static size_t dataSize();
 
+  /**
+   * @brief Get the size of the serialized header extension.
+   *
+   * Get the size of the extension carrying the `codec`, `chunkSize`, `dedup` and
+   * `dedupEpoch` fields, transferred after the header only if it is `extended`.
+   *
+   * @returns the size of the serialized header extension.
+   */
+  static size_t extensionDataSize();
+
   /**
    * @brief Get the serialized data.
    *
-   * Get the serialized data ready for transfer.
+   * Get the serialized data ready for transfer. The data of headers that are not
+   * `extended` is identical to that of peers predating header extensions.
    *
    * @returns the serialized data.
    */
   const std::string serialize() const;
 
+  /**
+   * @brief Get the serialized header extension.
+   *
+   * Get the serialized `codec`, `chunkSize`, `dedup` and `dedupEpoch` fields, preceded by
+   * the `HeaderExtensionVersion`, ready for transfer after the header.
+   *
+   * @returns the serialized header extension.
+   */
+  const std::string serializeExtension() const;
+
+  /**
+   * @brief Deserialize the header extension.
+   *
+   * Deserialize the `codec`, `chunkSize`, `dedup` and `dedupEpoch` fields from a
+   * serialized header extension.
+   *
+   * @param[in] serializedExtension the header extension in serialized format.
+   *
+   * @returns `false` if the size or the version of the extension is not supported,
+   *          `true` otherwise.
+   */
+  bool deserializeExtension(const std::string& serializedExtension);
+
+  /**
+   * @brief Check whether the header describes frames that can be received.
+   *
+   * Validate fields received from a peer: the number of frames, the `ucxx::CodecType`
+   * and `ucxx::DedupAction` of each frame, and that encoded frames have a non-zero
+   * `chunkSize`.
+   *
+   * @returns `true` if the header is valid, `false` otherwise.
+   */
+  bool isValid() const;
+
   /**
    * @brief Convenience method to build headers given arbitrary-sized input.
    *
    * Convenience method to build one or more headers given arbitrary-sized input `size` and
-   * `isCUDA` vectors.
+   * `isCUDA` vectors, and optionally `codec` and `dedup` vectors.
    *
    * @param[in] isCUDA  vector containing flag of whether each frame being transferred are
    *                    CUDA (`1`) or host (`0`).
    * @param[in] size    vector containing the size in bytes of eachf frame.
+   * @param[in] codec   vector containing the `ucxx::CodecType` of each frame, or empty if
+   *                    all frames are raw.
+   * @param[in] chunkSize the size in bytes of chunks encoded frames are split into.
+   * @param[in] dedup   vector containing the `ucxx::DedupAction` of each frame, or empty
+   *                    if no frames are deduplicated.
+   * @param[in] dedupEpoch the epoch of the sender deduplication cache.
    *
    * @returns A vector of one or more `ucxx::Header` objects.
    */
   static std::vector<Header> buildHeaders(const std::vector<size_t>& size,
-                                          const std::vector<int>& isCUDA);
+                                          const std::vector<int>& isCUDA,
+                                          const std::vector<int>& codec = {},
+                                          const size_t chunkSize        = 0,
+                                          const std::vector<int>& dedup = {},
+                                          const uint64_t dedupEpoch     = 0);
 };
 
 }  // namespace ucxx
@@ -4,14 +4,31 @@
  */
 #pragma once
 
+#include <chrono>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <string>
+#include <vector>
+
+#include <ucp/api/ucp.h>
 
 namespace ucxx {
 
 class Request;
 
+/**
+ * @brief Description of an inflight request, for diagnostics.
+ */
+struct InflightRequestInfo {
+  const Request* request{nullptr};                     ///< The request, as an identifier only
+  std::string operationName{};                         ///< Operation name, e.g. `tagRecv`
+  std::string ownerString{};                           ///< Endpoint or worker that submitted it
+  ucp_tag_t tag{0};                                    ///< Tag to match, `0` if not a tag operation
+  size_t length{0};                                    ///< Length of the transfer in bytes
+  std::chrono::steady_clock::time_point submitTime{};  ///< Time the request was submitted
+};
+
 typedef std::map<const Request* const, std::shared_ptr<Request>> InflightRequestsMap;
 typedef std::unique_ptr<InflightRequestsMap> InflightRequestsMapPtr;
 
@@ -49,6 +66,17 @@ class InflightRequests {
    */
   size_t size();
 
+  /**
+   * @brief Get the description of all pending inflight requests.
+   *
+   * Get the description of all inflight requests in the container that have not yet
+   * completed, in no particular order. Meant for diagnostics, the container is locked
+   * while the descriptions are copied.
+   *
+   * @returns The description of all pending inflight requests.
+   */
+  std::vector<InflightRequestInfo> getInfo();
+
   /**
    * @brief Insert an inflight requests to the container.
    *
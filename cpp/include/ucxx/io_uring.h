@@ -0,0 +1,134 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <sys/types.h>
+
+#include <functional>
+#include <memory>
+
+namespace ucxx {
+
+/**
+ * @brief Callback of a file I/O operation.
+ *
+ * Called with the number of bytes transferred, or `-errno` if the operation failed.
+ */
+typedef std::function<void(ssize_t result)> FileIOCallback;
+
+/**
+ * @brief An io_uring instance used for blocking progress and file I/O.
+ *
+ * Waits for readiness of a file descriptor, such as the UCP worker's event file
+ * descriptor, and executes asynchronous file reads and writes through a single io_uring,
+ * such that waking up for worker events and completing file I/O are batched into the
+ * same system calls instead of requiring one `epoll_wait` and one `read`/`write` call
+ * each. Requires UCXX built with `UCXX_ENABLE_IO_URING` and a kernel supporting io_uring,
+ * which may be verified with `isAvailable()`.
+ *
+ * File I/O may be prepared and submitted from any thread, but completions are only
+ * processed, and their callbacks executed, by the thread calling `wait()`.
+ */
+class IoUring {
+ private:
+  struct Impl;
+  std::unique_ptr<Impl> _impl{nullptr};  ///< The io_uring implementation
+
+ public:
+  /**
+   * @brief Constructor of `ucxx::IoUring`.
+   *
+   * @throws ucxx::UnsupportedError if io_uring is not available, see `isAvailable()`.
+   * @throws std::ios_base::failure if the io_uring could not be created.
+   *
+   * @param[in] entries the number of submission queue entries.
+   */
+  explicit IoUring(const unsigned entries = 64);
+
+  IoUring(const IoUring&)            = delete;
+  IoUring& operator=(IoUring const&) = delete;
+  IoUring(IoUring&& o)               = delete;
+  IoUring& operator=(IoUring&& o)    = delete;
+
+  ~IoUring();
+
+  /**
+   * @brief Check whether io_uring is available.
+   *
+   * Check whether UCXX was built with io_uring support and the running kernel supports all
+   * io_uring features required, probing the kernel only once.
+   *
+   * @returns `true` if io_uring is available, `false` otherwise.
+   */
+  static bool isAvailable();
+
+  /**
+   * @brief Prepare a file read.
+   *
+   * Prepare a read of `length` bytes at `offset` of `fd` into `buffer`, that is submitted
+   * by the next call to `submit()` or `wait()`, allowing multiple operations to be
+   * submitted with a single system call.
+   *
+   * @throws ucxx::NoResourceError if the submission queue is full.
+   *
+   * @param[in] fd        the file descriptor to read from.
+   * @param[in] buffer    the buffer to read into, must remain valid until completion.
+   * @param[in] length    the number of bytes to read.
+   * @param[in] offset    the offset in the file to read from.
+   * @param[in] callback  the callback executed upon completion.
+   *
+   * @returns the number of operations prepared and not yet submitted, including this one.
+   */
+  size_t prepareRead(
+    int fd, void* buffer, const size_t length, const off_t offset, FileIOCallback callback);
+
+  /**
+   * @brief Prepare a file write.
+   *
+   * Prepare a write of `length` bytes from `buffer` to `fd` at `offset`, that is submitted
+   * by the next call to `submit()` or `wait()`.
+   *
+   * @throws ucxx::NoResourceError if the submission queue is full.
+   *
+   * @param[in] fd        the file descriptor to write to.
+   * @param[in] buffer    the buffer to write from, must remain valid until completion.
+   * @param[in] length    the number of bytes to write.
+   * @param[in] offset    the offset in the file to write to.
+   * @param[in] callback  the callback executed upon completion.
+   *
+   * @returns the number of operations prepared and not yet submitted, including this one.
+   */
+  size_t prepareWrite(
+    int fd, const void* buffer, const size_t length, const off_t offset, FileIOCallback callback);
+
+  /**
+   * @brief Submit prepared operations.
+   *
+   * Submit all operations prepared with `prepareRead()` and `prepareWrite()`.
+   *
+   * @throws std::ios_base::failure if submission failed.
+   *
+   * @returns the number of operations submitted.
+   */
+  size_t submit();
+
+  /**
+   * @brief Wait until a file descriptor is readable or file I/O completes.
+   *
+   * Submit all prepared operations together with a poll on `fd` if one is not already
+   * pending, block until the poll or any other operation completes or `timeout` elapses,
+   * and process all completions, executing file I/O callbacks.
+   *
+   * @throws std::ios_base::failure if waiting failed.
+   *
+   * @param[in] fd      the file descriptor to wait for, must be the same in all calls.
+   * @param[in] timeout timeout in ms, or -1 to block indefinitely.
+   *
+   * @returns `true` if `fd` became readable, `false` otherwise.
+   */
+  bool wait(int fd, const int timeout);
+};
+
+}  // namespace ucxx
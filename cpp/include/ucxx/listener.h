@@ -4,12 +4,15 @@
  */
 #pragma once
 
+#include <future>
 #include <memory>
+#include <new>
 #include <string>
 
 #include <ucp/api/ucp.h>
 
 #include <ucxx/component.h>
+#include <ucxx/expected.h>
 #include <ucxx/worker.h>
 
 namespace ucxx {
@@ -19,9 +22,10 @@ void ucpListenerDestructor(ucp_listener_h ptr);
 class Listener : public Component {
  private:
   std::unique_ptr<ucp_listener, void (*)(ucp_listener_h)> _handle{
-    nullptr, ucpListenerDestructor};  ///< The UCP listener handle
-  std::string _ip{};                  ///< The IP address to which the listener is bound to
-  uint16_t _port{0};                  ///< The port to which the listener is bound to
+    nullptr, ucpListenerDestructor};         ///< The UCP listener handle
+  std::string _ip{};                         ///< The IP address to which the listener is bound to
+  uint16_t _port{0};                         ///< The port to which the listener is bound to
+  std::shared_ptr<Worker> _worker{nullptr};  ///< The worker the listener was created from
 
   /**
    * @brief Private constructor of `ucxx::Listener`.
@@ -118,6 +122,45 @@ class Listener : public Component {
   std::shared_ptr<Endpoint> createEndpointFromConnRequest(ucp_conn_request_h connRequest,
                                                           bool endpointErrorHandling = true);
 
+  /**
+   * @brief Constructor for `shared_ptr<ucxx::Endpoint>`, without throwing.
+   *
+   * Exception-free variant of `createEndpointFromConnRequest()`.
+   *
+   * @param[in] connRequest           handle to connection request delivered by a
+   *                                  listener callback.
+   * @param[in] endpointErrorHandling whether to enable endpoint error handling.
+   *
+   * @returns The `shared_ptr<ucxx::Endpoint>` object or the status of the failure.
+   */
+  Expected<std::shared_ptr<Endpoint>> createEndpointFromConnRequest(
+    std::nothrow_t, ucp_conn_request_h connRequest, bool endpointErrorHandling = true) noexcept;
+
+  /**
+   * @brief Create an endpoint from a connection request asynchronously.
+   *
+   * Equivalent to `createEndpointFromConnRequest()`, but the endpoint is created by the
+   * worker progress thread when delayed submission is enabled, preventing the caller
+   * thread, for example a Python thread accepting the connection, from contending with
+   * the progress thread for the UCX spinlock. When delayed submission is disabled the
+   * endpoint is created immediately.
+   *
+   * @code{.cpp}
+   * // listener is `std::shared_ptr<ucxx::Listener>`, with a `ucp_conn_request_h` delivered
+   * // by a `ucxx::Listener` connection callback.
+   * auto future   = listener->createEndpointFromConnRequestAsync(connRequest, true);
+   * auto endpoint = future.get();
+   * @endcode
+   *
+   * @param[in] connRequest           handle to connection request delivered by a
+   *                                  listener callback.
+   * @param[in] endpointErrorHandling whether to enable endpoint error handling.
+   *
+   * @returns The future to the `shared_ptr<ucxx::Endpoint>` object.
+   */
+  std::future<std::shared_ptr<Endpoint>> createEndpointFromConnRequestAsync(
+    ucp_conn_request_h connRequest, bool endpointErrorHandling = true);
+
   /**
    * @brief Get the underlying `ucp_listener_h` handle.
    *
@@ -135,6 +178,16 @@ class Listener : public Component {
    */
   ucp_listener_h getHandle();
 
+  /**
+   * @brief Get the worker the listener was created from.
+   *
+   * Get the worker the listener was created from, which is also the worker of all
+   * endpoints created from its connection requests.
+   *
+   * @returns the worker the listener was created from.
+   */
+  std::shared_ptr<Worker> getWorker() const;
+
   /**
    * @brief Get the port to which the listener is bound to.
    *
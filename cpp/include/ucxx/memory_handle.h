@@ -0,0 +1,107 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <memory>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/component.h>
+#include <ucxx/context.h>
+
+namespace ucxx {
+
+class MemoryHandle : public Component {
+ private:
+  ucp_mem_h _handle{nullptr};  ///< The UCP handle to the memory allocation
+  size_t _size{0};             ///< The actual allocation size
+  uint64_t _baseAddress{0};    ///< The allocation's base address
+
+  /**
+   * @brief Private constructor of `ucxx::MemoryHandle`.
+   *
+   * This is the internal implementation of `ucxx::MemoryHandle` constructor, made private
+   * not to be called directly. This constructor is made private to ensure all UCXX objects
+   * are shared pointers and the correct lifetime management of each one.
+   *
+   * Instead the user should use one of the following:
+   *
+   * - `ucxx::Context::createMemoryHandle()`
+   * - `ucxx::createMemoryHandle()`
+   *
+   * @param[in] context parent context from which the memory will be mapped.
+   * @param[in] size    the size of the memory region to map or allocate.
+   * @param[in] buffer  a raw pointer to memory previously allocated by the user that
+   *                    should be mapped, or `nullptr` to let UCX allocate memory.
+   */
+  MemoryHandle(std::shared_ptr<Context> context, const size_t size, void* buffer);
+
+ public:
+  MemoryHandle()                    = delete;
+  MemoryHandle(const MemoryHandle&) = delete;
+  MemoryHandle& operator=(MemoryHandle const&) = delete;
+  MemoryHandle(MemoryHandle&& o)               = delete;
+  MemoryHandle& operator=(MemoryHandle&& o) = delete;
+
+  /**
+   * @brief Constructor for `shared_ptr<ucxx::MemoryHandle>`.
+   *
+   * The constructor for a `shared_ptr<ucxx::MemoryHandle>` object, mapping a memory buffer
+   * with UCX, so that it may be accessed by remote peers with RMA operations. If `buffer`
+   * is `nullptr`, UCX allocates a new region of at least `size` bytes, otherwise the
+   * user-provided buffer is mapped and must remain valid for the lifetime of the handle.
+   *
+   * @code{.cpp}
+   * // context is `std::shared_ptr<ucxx::Context>`
+   * auto memoryHandle = context->createMemoryHandle(1024, nullptr);
+   *
+   * // Equivalent to line above
+   * // auto memoryHandle = ucxx::createMemoryHandle(context, 1024, nullptr);
+   * @endcode
+   *
+   * @param[in] context parent context from which the memory will be mapped.
+   * @param[in] size    the size of the memory region to map or allocate.
+   * @param[in] buffer  a raw pointer to memory previously allocated by the user that
+   *                    should be mapped, or `nullptr` to let UCX allocate memory.
+   *
+   * @returns The `shared_ptr<ucxx::MemoryHandle>` object
+   */
+  friend std::shared_ptr<MemoryHandle> createMemoryHandle(std::shared_ptr<Context> context,
+                                                          const size_t size,
+                                                          void* buffer);
+
+  ~MemoryHandle();
+
+  /**
+   * @brief Get the underlying `ucp_mem_h` handle.
+   *
+   * Lifetime of the `ucp_mem_h` handle is managed by the `ucxx::MemoryHandle` object and
+   * its ownership is non-transferrable. Once the `ucxx::MemoryHandle` is destroyed the
+   * handle is not valid anymore, it is the user's responsibility to ensure the owner's
+   * lifetime while using the handle.
+   *
+   * @returns The underlying `ucp_mem_h` handle.
+   */
+  ucp_mem_h getHandle();
+
+  /**
+   * @brief Get the size of the memory region.
+   *
+   * Get the size of the memory region, which may be larger than requested if UCX
+   * allocated it.
+   *
+   * @returns The size of the memory region in bytes.
+   */
+  size_t getSize() const;
+
+  /**
+   * @brief Get the base address of the memory region.
+   *
+   * @returns The base address of the memory region.
+   */
+  uint64_t getBaseAddress();
+};
+
+}  // namespace ucxx
@@ -0,0 +1,398 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/component.h>
+#include <ucxx/endpoint.h>
+#include <ucxx/request.h>
+
+namespace ucxx {
+
+/**
+ * @brief A user-defined function called when a chunk of a progressive receive arrives.
+ *
+ * The function receives the offset and the size in bytes of the chunk in the buffer.
+ */
+typedef std::function<void(size_t, size_t)> ProgressiveChunkCallback;
+
+/**
+ * @brief The sending end of a progressive transfer.
+ *
+ * Send a buffer of known size while it is still being produced. The buffer is split in
+ * chunks of equal size, the last one possibly shorter, each sent as a tagged message as
+ * soon as it and all chunks preceding it were published by the producer. Chunks are thus
+ * sent in order, pipelining the production of the buffer with its transfer.
+ */
+class ProgressiveSender : public Component {
+ private:
+  ucp_tag_t _tag{0};                                  ///< Tag of the transfer
+  char* _buffer{nullptr};                             ///< Buffer being produced
+  size_t _size{0};                                    ///< Total size of the buffer in bytes
+  size_t _chunkSize{0};                               ///< Size of each chunk in bytes
+  size_t _numChunks{0};                               ///< Number of chunks of the buffer
+  std::string _header{};                              ///< Header of the transfer
+  std::vector<size_t> _published{};                   ///< Bytes published by chunk
+  size_t _nextChunk{0};                               ///< Next chunk to be sent
+  size_t _readyChunks{0};                             ///< Chunks fully published in order
+  bool _posting{false};                               ///< Whether sends are being posted
+  std::vector<std::shared_ptr<Request>> _requests{};  ///< Header and chunk sends
+  std::atomic<size_t> _sentChunks{0};                 ///< Chunk sends completed
+  std::mutex _mutex{};                                ///< Mutex to access the send state
+
+  /**
+   * @brief Private constructor of `ucxx::ProgressiveSender`.
+   *
+   * This is the internal implementation of `ucxx::ProgressiveSender` constructor, made
+   * private not to be called directly. This constructor is made private to ensure all
+   * UCXX objects are shared pointers and the correct lifetime management of each one.
+   *
+   * Instead the user should use one of the following:
+   *
+   * - `ucxx::createProgressiveSender()`
+   *
+   * @param[in] endpoint  the endpoint to the receiver.
+   * @param[in] buffer    a raw pointer to the buffer being produced.
+   * @param[in] size      the total size of the buffer in bytes.
+   * @param[in] tag       the tag of the transfer.
+   * @param[in] chunkSize the size in bytes of each chunk sent.
+   */
+  ProgressiveSender(std::shared_ptr<Endpoint> endpoint,
+                    void* buffer,
+                    const size_t size,
+                    const ucp_tag_t tag,
+                    const size_t chunkSize);
+
+  /**
+   * @brief Send the header of the transfer.
+   */
+  void sendHeader();
+
+  /**
+   * @brief Get the size of a chunk.
+   *
+   * @param[in] chunk the index of the chunk.
+   *
+   * @returns the size of the chunk in bytes, smaller than the chunk size for the last one.
+   */
+  size_t getChunkLength(const size_t chunk) const;
+
+  /**
+   * @brief Post the sends of chunks fully published.
+   *
+   * Post, in order, the sends of all chunks fully published whose previous chunks were
+   * all sent. Only one thread posts sends at any time, others return immediately leaving
+   * ready chunks to be posted by the posting thread, thus preserving the order of chunks.
+   */
+  void postChunks();
+
+ public:
+  ProgressiveSender()                                    = delete;
+  ProgressiveSender(const ProgressiveSender&)            = delete;
+  ProgressiveSender& operator=(ProgressiveSender const&) = delete;
+  ProgressiveSender(ProgressiveSender&& o)               = delete;
+  ProgressiveSender& operator=(ProgressiveSender&& o)    = delete;
+
+  /**
+   * @brief Constructor for `shared_ptr<ucxx::ProgressiveSender>`.
+   *
+   * The constructor for a `shared_ptr<ucxx::ProgressiveSender>` object, opening the
+   * progressive send of a buffer of known size that is still being produced. A header
+   * with the size of the buffer is sent immediately, then the producer publishes ranges
+   * of the buffer as it fills them with `publish()`, and each chunk of `chunkSize` bytes
+   * is sent as soon as it and all chunks preceding it are fully published, overlapping
+   * the production of the buffer with its transfer.
+   *
+   * The remote end of `endpoint` receives the buffer with a `ucxx::ProgressiveReceiver`
+   * created with the same tag. No other message should be sent with the same tag to the
+   * same endpoint until `isCompleted()` returns `true`, and published ranges of the buffer
+   * must not be modified until then.
+   *
+   * @code{.cpp}
+   * // endpoint is `std::shared_ptr<ucxx::Endpoint>`
+   * auto sender = ucxx::createProgressiveSender(endpoint, buffer, size, tag);
+   * for (size_t offset = 0; offset < size; offset += produced) {
+   *   produced = produce(buffer + offset);
+   *   sender->publish(offset, produced);
+   * }
+   * while (!sender->isCompleted()) worker->progress();
+   * @endcode
+   *
+   * @throws ucxx::Error if the endpoint is not initialized or `chunkSize` is `0`.
+   *
+   * @param[in] endpoint  the endpoint to the receiver.
+   * @param[in] buffer    a raw pointer to the buffer being produced.
+   * @param[in] size      the total size of the buffer in bytes.
+   * @param[in] tag       the tag of the transfer.
+   * @param[in] chunkSize the size in bytes of each chunk sent.
+   *
+   * @returns The `shared_ptr<ucxx::ProgressiveSender>` object.
+   */
+  friend std::shared_ptr<ProgressiveSender> createProgressiveSender(
+    std::shared_ptr<Endpoint> endpoint,
+    void* buffer,
+    const size_t size,
+    const ucp_tag_t tag,
+    const size_t chunkSize);
+
+  /**
+   * @brief Publish a filled range of the buffer.
+   *
+   * Publish a range of the buffer the producer finished writing, posting the sends of
+   * all chunks it completes. Ranges may be published in any order and from any thread,
+   * but must not overlap. This is a non-blocking operation.
+   *
+   * @throws ucxx::Error if the range exceeds the buffer or overlaps a range already
+   *                     published.
+   *
+   * @param[in] offset  the offset in bytes of the range in the buffer.
+   * @param[in] length  the size in bytes of the range.
+   */
+  void publish(const size_t offset, const size_t length);
+
+  /**
+   * @brief Get the total size of the buffer.
+   *
+   * @returns the total size of the buffer in bytes.
+   */
+  size_t getSize() const;
+
+  /**
+   * @brief Get the number of chunks of the buffer.
+   *
+   * @returns the number of chunks the buffer is sent in.
+   */
+  size_t getNumChunks() const;
+
+  /**
+   * @brief Get the number of chunks sent.
+   *
+   * @returns the number of chunks whose send completed.
+   */
+  size_t getSentChunks() const;
+
+  /**
+   * @brief Check whether the transfer completed.
+   *
+   * Check whether the whole buffer was published and the header and all chunk sends
+   * completed, after which the buffer may be modified or released.
+   *
+   * @returns whether the transfer completed.
+   */
+  bool isCompleted();
+
+  /**
+   * @brief Get the status of the transfer.
+   *
+   * Get the status of the transfer, `UCS_INPROGRESS` until all chunks were sent,
+   * `UCS_OK` if all sends succeeded, or the error of the first send that failed.
+   *
+   * @returns the status of the transfer.
+   */
+  ucs_status_t getStatus();
+};
+
+/**
+ * @brief The receiving end of a progressive transfer.
+ *
+ * Receive a buffer sent by a `ucxx::ProgressiveSender`. The receives of all chunks are
+ * posted as soon as the header announcing the size of the buffer arrives, each chunk
+ * landing directly at its offset in the buffer. The arrival of each chunk may optionally
+ * be observed, otherwise the transfer completes once, when the whole buffer arrived.
+ */
+class ProgressiveReceiver : public Component {
+ private:
+  ucp_tag_t _tag{0};                                  ///< Tag of the transfer
+  char* _buffer{nullptr};                             ///< Buffer to receive into
+  size_t _capacity{0};                                ///< Size of the buffer in bytes
+  std::unique_ptr<char[]> _allocation{nullptr};       ///< Buffer allocated if none given
+  size_t _size{0};                                    ///< Total size of the transfer
+  size_t _chunkSize{0};                               ///< Size of each chunk in bytes
+  size_t _numChunks{0};                               ///< Number of chunks of the transfer
+  ProgressiveChunkCallback _chunkCallback{nullptr};   ///< Called as each chunk arrives
+  std::string _header{};                              ///< Header of the transfer
+  std::string _scratch{};                             ///< Discards chunks not fitting
+  std::vector<std::shared_ptr<Request>> _requests{};  ///< Header and chunk receives
+  std::atomic<size_t> _receivedChunks{0};             ///< Chunk receives completed
+  std::atomic<bool> _ready{false};                    ///< Whether the header was handled
+  std::atomic<bool> _posted{false};                   ///< Whether all chunks were posted
+  std::atomic<ucs_status_t> _headerStatus{UCS_OK};    ///< Status of the header
+  std::mutex _mutex{};                                ///< Mutex to access the requests
+
+  /**
+   * @brief Private constructor of `ucxx::ProgressiveReceiver`.
+   *
+   * This is the internal implementation of `ucxx::ProgressiveReceiver` constructor, made
+   * private not to be called directly. This constructor is made private to ensure all
+   * UCXX objects are shared pointers and the correct lifetime management of each one.
+   *
+   * Instead the user should use one of the following:
+   *
+   * - `ucxx::createProgressiveReceiver()`
+   *
+   * @param[in] endpoint      the endpoint to the sender.
+   * @param[in] buffer        a raw pointer to the buffer to receive into, or `nullptr`.
+   * @param[in] capacity      the size in bytes of `buffer`.
+   * @param[in] tag           the tag of the transfer.
+   * @param[in] chunkCallback function called as each chunk arrives, or `nullptr`.
+   */
+  ProgressiveReceiver(std::shared_ptr<Endpoint> endpoint,
+                      void* buffer,
+                      const size_t capacity,
+                      const ucp_tag_t tag,
+                      ProgressiveChunkCallback chunkCallback);
+
+  /**
+   * @brief Post the receive of the header.
+   */
+  void recvHeader();
+
+  /**
+   * @brief Handle the reception of the header.
+   *
+   * Validate the header and post the receives of all chunks, in order. If no buffer was
+   * given one is allocated to fit the transfer, a failure to allocate it fails the
+   * transfer with `UCS_ERR_NO_MEMORY` while chunks are still received and discarded.
+   *
+   * @param[in] status  the status of the header receive.
+   */
+  void recvChunks(const ucs_status_t status);
+
+  /**
+   * @brief Mark a chunk as received and call the chunk callback.
+   *
+   * @param[in] chunk the index of the chunk received.
+   */
+  void markReceived(const size_t chunk);
+
+ public:
+  ProgressiveReceiver()                                      = delete;
+  ProgressiveReceiver(const ProgressiveReceiver&)            = delete;
+  ProgressiveReceiver& operator=(ProgressiveReceiver const&) = delete;
+  ProgressiveReceiver(ProgressiveReceiver&& o)               = delete;
+  ProgressiveReceiver& operator=(ProgressiveReceiver&& o)    = delete;
+
+  /**
+   * @brief Constructor for `shared_ptr<ucxx::ProgressiveReceiver>`.
+   *
+   * The constructor for a `shared_ptr<ucxx::ProgressiveReceiver>` object, receiving a
+   * buffer sent by a `ucxx::ProgressiveSender` at the remote end of `endpoint`. Once the
+   * header is received the receives of all chunks are posted, and `chunkCallback` is
+   * called with the offset and size of each chunk as it arrives, for consumers that
+   * process the buffer progressively. Consumers that only need the whole buffer wait for
+   * `isCompleted()` instead.
+   *
+   * If `buffer` is `nullptr` a host buffer of the size announced by the sender is
+   * allocated, available via `getBuffer()` once `isReady()` returns `true`.
+   *
+   * @code{.cpp}
+   * // endpoint is `std::shared_ptr<ucxx::Endpoint>`
+   * auto receiver = ucxx::createProgressiveReceiver(endpoint, nullptr, 0, tag);
+   * while (!receiver->isCompleted()) worker->progress();
+   * receiver->checkError();
+   * consume(receiver->getBuffer(), receiver->getSize());
+   * @endcode
+   *
+   * @throws ucxx::Error if the endpoint is not initialized.
+   *
+   * @param[in] endpoint      the endpoint to the sender.
+   * @param[in] buffer        a raw pointer to the buffer to receive into, or `nullptr` to
+   *                          allocate one.
+   * @param[in] capacity      the size in bytes of `buffer`, ignored if `buffer` is
+   *                          `nullptr`.
+   * @param[in] tag           the tag of the transfer.
+   * @param[in] chunkCallback function called as each chunk arrives, possibly out of
+   *                          order and from the thread progressing the worker.
+   *
+   * @returns The `shared_ptr<ucxx::ProgressiveReceiver>` object.
+   */
+  friend std::shared_ptr<ProgressiveReceiver> createProgressiveReceiver(
+    std::shared_ptr<Endpoint> endpoint,
+    void* buffer,
+    const size_t capacity,
+    const ucp_tag_t tag,
+    ProgressiveChunkCallback chunkCallback);
+
+  /**
+   * @brief Check whether the header was received.
+   *
+   * Check whether the header was received and handled, after which the size of the
+   * transfer and the buffer are known if `getStatus()` does not return an error.
+   *
+   * @returns whether the header was received.
+   */
+  bool isReady() const;
+
+  /**
+   * @brief Get the buffer received into.
+   *
+   * @throws ucxx::Error if the header was not received yet.
+   *
+   * @returns a raw pointer to the buffer received into.
+   */
+  void* getBuffer() const;
+
+  /**
+   * @brief Get the total size of the transfer.
+   *
+   * @throws ucxx::Error if the header was not received yet.
+   *
+   * @returns the total size of the transfer in bytes.
+   */
+  size_t getSize() const;
+
+  /**
+   * @brief Get the number of chunks of the transfer.
+   *
+   * @throws ucxx::Error if the header was not received yet.
+   *
+   * @returns the number of chunks the buffer is received in.
+   */
+  size_t getNumChunks() const;
+
+  /**
+   * @brief Get the number of chunks received.
+   *
+   * @returns the number of chunks whose receive completed.
+   */
+  size_t getReceivedChunks() const;
+
+  /**
+   * @brief Check whether the transfer completed.
+   *
+   * Check whether all chunks were received, or the header was rejected.
+   *
+   * @returns whether the transfer completed.
+   */
+  bool isCompleted() const;
+
+  /**
+   * @brief Get the status of the transfer.
+   *
+   * Get the status of the transfer, `UCS_INPROGRESS` until all chunks were received,
+   * `UCS_OK` if all receives succeeded, `UCS_ERR_MESSAGE_TRUNCATED` if the buffer is
+   * smaller than the transfer, or the error of the first receive that failed.
+   *
+   * @returns the status of the transfer.
+   */
+  ucs_status_t getStatus();
+
+  /**
+   * @brief Check whether the transfer failed.
+   *
+   * @throws ucxx::Error if the transfer failed.
+   */
+  void checkError();
+};
+
+}  // namespace ucxx
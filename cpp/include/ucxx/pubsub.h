@@ -0,0 +1,385 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/buffer.h>
+#include <ucxx/component.h>
+#include <ucxx/endpoint.h>
+#include <ucxx/request.h>
+#include <ucxx/worker.h>
+
+namespace ucxx {
+
+const uint64_t PublicationHeaderMagic = 0x7563787870756273;  // "ucxxpubs"
+
+/**
+ * @brief Header preceding each publication payload on the wire.
+ */
+struct PublicationHeader {
+  uint64_t magic{0};     ///< Always `PublicationHeaderMagic`, used to detect canceled receives
+  uint64_t sequence{0};  ///< Sequence number of the publication within its topic
+  uint64_t length{0};    ///< Length of the payload in bytes
+  uint64_t publisher{0};  ///< Random identifier of the publisher
+};
+
+/**
+ * @brief Policy applied to subscribers that reach the maximum lag.
+ */
+enum class SlowSubscriberPolicy {
+  Skip = 0,  ///< Subscriber misses publications until it catches up
+  Drop,      ///< Subscriber is removed from the topic
+};
+
+class Publication {
+ private:
+  PublicationHeader _header{};                ///< The header sent to all subscribers
+  std::atomic<size_t> _pending{0};            ///< Sends not yet completed
+  size_t _fanout{0};                          ///< Number of subscribers the payload was sent to
+  size_t _skipped{0};                         ///< Number of subscribers skipped due to lag
+  std::atomic<ucs_status_t> _status{UCS_OK};  ///< Status of the first send that failed
+  RequestCallbackUserFunction _callback{nullptr};  ///< Completion callback
+  RequestCallbackUserData _callbackData{nullptr};  ///< Completion callback data
+
+  friend class Publisher;
+
+ public:
+  Publication()                   = delete;
+  Publication(const Publication&) = delete;
+  Publication& operator=(Publication const&) = delete;
+  Publication(Publication&& o)               = delete;
+  Publication& operator=(Publication&& o) = delete;
+
+  /**
+   * @brief Constructor of `ucxx::Publication`.
+   *
+   * Construct the aggregated completion of a publication. Not meant to be constructed by
+   * the user, `ucxx::Publisher::publish()` returns it.
+   *
+   * @param[in] header            the header sent to all subscribers.
+   * @param[in] callbackFunction  user-defined callback function to call upon completion.
+   * @param[in] callbackData      user-defined data to pass to the `callbackFunction`.
+   */
+  Publication(const PublicationHeader& header,
+              RequestCallbackUserFunction callbackFunction,
+              RequestCallbackUserData callbackData);
+
+  /**
+   * @brief Mark one send of the publication completed.
+   *
+   * Mark one send of the publication completed, calling the user-defined callback with
+   * the status of the publication when all sends have completed.
+   *
+   * @param[in] status  the status of the send that completed.
+   */
+  void markCompleted(const ucs_status_t status = UCS_OK);
+
+  /**
+   * @brief Check whether all sends of the publication have completed.
+   *
+   * @returns `true` if all sends have completed and the buffer may be released.
+   */
+  bool isCompleted() const;
+
+  /**
+   * @brief Get the status of the publication.
+   *
+   * @returns `UCS_INPROGRESS` while sends are pending, then `UCS_OK` if all sends
+   *          succeeded or the status of the first send that failed otherwise.
+   */
+  ucs_status_t getStatus() const;
+
+  /**
+   * @brief Get the number of subscribers the publication was sent to.
+   *
+   * @returns The number of subscribers the publication was sent to.
+   */
+  size_t getFanout() const;
+
+  /**
+   * @brief Get the number of subscribers skipped due to lag.
+   *
+   * @returns The number of subscribers skipped or dropped due to lag.
+   */
+  size_t getSkipped() const;
+};
+
+class Publisher : public Component {
+ private:
+  struct Subscriber {
+    std::shared_ptr<Endpoint> endpoint{nullptr};  ///< The subscriber endpoint
+    std::shared_ptr<std::atomic<size_t>> inflight{
+      nullptr};  ///< Number of publications still being sent to the subscriber
+  };
+
+  size_t _maxLag{0};  ///< Max inflight publications per subscriber
+  uint64_t _id{0};    ///< Random identifier sent with each publication
+  SlowSubscriberPolicy _policy{SlowSubscriberPolicy::Skip};          ///< Slow subscriber policy
+  std::unordered_map<ucp_tag_t, std::vector<Subscriber>> _topics{};  ///< Subscribers per topic
+  std::unordered_map<ucp_tag_t, uint64_t> _sequence{};  ///< Next sequence number per topic
+  std::mutex _mutex{};                                  ///< Mutex to access topics
+
+  /**
+   * @brief Private constructor of `ucxx::Publisher`.
+   *
+   * This is the internal implementation of `ucxx::Publisher` constructor, made private not
+   * to be called directly. This constructor is made private to ensure all UCXX objects
+   * are shared pointers and the correct lifetime management of each one.
+   *
+   * Instead the user should use one of the following:
+   *
+   * - `ucxx::createPublisher()`
+   *
+   * @param[in] worker  the worker used to publish.
+   * @param[in] maxLag  the maximum number of publications that may be inflight for each
+   *                    subscriber before `policy` applies.
+   * @param[in] policy  the policy to apply to subscribers that reach `maxLag`.
+   */
+  Publisher(std::shared_ptr<Worker> worker, const size_t maxLag, const SlowSubscriberPolicy policy);
+
+ public:
+  Publisher()                 = delete;
+  Publisher(const Publisher&) = delete;
+  Publisher& operator=(Publisher const&) = delete;
+  Publisher(Publisher&& o)               = delete;
+  Publisher& operator=(Publisher&& o) = delete;
+
+  /**
+   * @brief Constructor for `shared_ptr<ucxx::Publisher>`.
+   *
+   * The constructor for a `shared_ptr<ucxx::Publisher>` object, which publishes buffers to
+   * all endpoints subscribed to a topic. A topic is identified by the tag its publications
+   * are sent with, subscribers receive them with a `ucxx::Subscription`.
+   *
+   * To cap the publisher fan-out, subscribers may relay publications to further
+   * subscribers with `ucxx::Subscription::addRelay()`, forming a tree.
+   *
+   * @code{.cpp}
+   * // worker is `std::shared_ptr<ucxx::Worker>`, endpoints are `std::shared_ptr<ucxx::Endpoint>`
+   * auto publisher = ucxx::createPublisher(worker, 8, ucxx::SlowSubscriberPolicy::Skip);
+   * publisher->subscribe(topic, endpoint1);
+   * publisher->subscribe(topic, endpoint2);
+   * auto publication = publisher->publish(topic, buffer, length, releaseCallback, nullptr);
+   * @endcode
+   *
+   * @param[in] worker  the worker used to publish.
+   * @param[in] maxLag  the maximum number of publications that may be inflight for each
+   *                    subscriber before `policy` applies.
+   * @param[in] policy  the policy to apply to subscribers that reach `maxLag`.
+   *
+   * @returns The `shared_ptr<ucxx::Publisher>` object
+   */
+  friend std::shared_ptr<Publisher> createPublisher(std::shared_ptr<Worker> worker,
+                                                    const size_t maxLag,
+                                                    const SlowSubscriberPolicy policy);
+
+  /**
+   * @brief Subscribe an endpoint to a topic.
+   *
+   * @param[in] topic     the topic to subscribe to.
+   * @param[in] endpoint  the endpoint connected to the subscriber.
+   */
+  void subscribe(const ucp_tag_t topic, std::shared_ptr<Endpoint> endpoint);
+
+  /**
+   * @brief Unsubscribe an endpoint from a topic.
+   *
+   * @param[in] topic     the topic to unsubscribe from.
+   * @param[in] endpoint  the endpoint connected to the subscriber.
+   *
+   * @returns `true` if the endpoint was subscribed to the topic, `false` otherwise.
+   */
+  bool unsubscribe(const ucp_tag_t topic, std::shared_ptr<Endpoint> endpoint);
+
+  /**
+   * @brief Get the number of subscribers of a topic.
+   *
+   * @param[in] topic the topic.
+   *
+   * @returns The number of subscribers of the topic.
+   */
+  size_t getSubscriberCount(const ucp_tag_t topic);
+
+  /**
+   * @brief Publish a buffer to all subscribers of a topic.
+   *
+   * Publish a buffer to all subscribers of a topic, without blocking. All sends share the
+   * same buffer, which must remain valid until the publication completes, at which point
+   * `callbackFunction` is called once, allowing the buffer to be released. Each subscriber
+   * is sent a header and the payload, the buffer is registered by the first rendezvous
+   * send and UCX's registration cache serves the remaining subscribers. Subscribers
+   * that already have the maximum lag worth of publications inflight are skipped or
+   * dropped, according to the publisher policy, as are subscribers whose endpoint is not
+   * alive anymore.
+   *
+   * @param[in] topic             the topic to publish to.
+   * @param[in] buffer            a raw pointer to the data to be published.
+   * @param[in] length            the size in bytes of the data to be published.
+   * @param[in] callbackFunction  user-defined callback function to call upon completion.
+   * @param[in] callbackData      user-defined data to pass to the `callbackFunction`.
+   *
+   * @returns The aggregated completion of the publication.
+   */
+  std::shared_ptr<Publication> publish(
+    const ucp_tag_t topic,
+    void* buffer,
+    const size_t length,
+    RequestCallbackUserFunction callbackFunction = nullptr,
+    RequestCallbackUserData callbackData         = nullptr);
+};
+
+class Subscription : public Component {
+ private:
+  ucp_tag_t _topic{0};  ///< The topic subscribed to
+  std::function<void(std::shared_ptr<Buffer>)> _callback{
+    nullptr};  ///< Callback called for each publication received
+  PublicationHeader _header{};                 ///< The header of the publication being received
+  std::shared_ptr<Buffer> _payload{nullptr};   ///< The payload of the publication being received
+  std::shared_ptr<Request> _request{nullptr};  ///< The request currently posted
+  uint64_t _publisher{0};                      ///< Identifier of the upstream publisher
+  std::shared_ptr<Publisher> _relay{nullptr};  ///< Publisher relaying to downstream subscribers
+  std::atomic<size_t> _received{0};            ///< Number of publications received
+  std::atomic<bool> _closed{false};            ///< Whether the subscription was closed
+  std::atomic<ucs_status_t> _status{UCS_OK};   ///< Status of the receive that failed, if any
+  bool _receivingHeader{false};  ///< Whether the request currently posted is for a header
+  bool _advancing{false};        ///< Whether a thread is currently advancing the subscription
+  bool _advancePending{false};   ///< Whether a completion arrived while advancing
+  std::mutex _advanceMutex{};    ///< Mutex to access the advancing state
+  std::mutex _mutex{};           ///< Mutex to access the relay
+
+  /**
+   * @brief Private constructor of `ucxx::Subscription`.
+   *
+   * This is the internal implementation of `ucxx::Subscription` constructor, made private
+   * not to be called directly. This constructor is made private to ensure all UCXX objects
+   * are shared pointers and the correct lifetime management of each one.
+   *
+   * Instead the user should use one of the following:
+   *
+   * - `ucxx::createSubscription()`
+   *
+   * @param[in] worker    the worker to receive publications with.
+   * @param[in] topic     the topic to subscribe to.
+   * @param[in] callback  callback called for each publication received.
+   */
+  Subscription(std::shared_ptr<Worker> worker,
+               const ucp_tag_t topic,
+               std::function<void(std::shared_ptr<Buffer>)> callback);
+
+  /**
+   * @brief Advance the subscription after the posted request completed.
+   *
+   * Advance the subscription after the posted request completed, delivering the payload
+   * if one was received and posting the next receive. Receives completing immediately
+   * while posting are handled iteratively rather than recursively, so that a backlog of
+   * publications does not grow the stack.
+   */
+  void advance();
+
+  /**
+   * @brief Handle the completion of the posted request and post the next one.
+   *
+   * Handle the completion of the posted request and post the next one. A failed receive
+   * stops the subscription, as later messages can't be told apart from headers anymore,
+   * and so does a header sent by a publisher other than the first one.
+   */
+  void step();
+
+  /**
+   * @brief Deliver the payload just received and relay it downstream.
+   */
+  void deliver();
+
+ public:
+  Subscription()                    = delete;
+  Subscription(const Subscription&) = delete;
+  Subscription& operator=(Subscription const&) = delete;
+  Subscription(Subscription&& o)               = delete;
+  Subscription& operator=(Subscription&& o) = delete;
+
+  ~Subscription();
+
+  /**
+   * @brief Constructor for `shared_ptr<ucxx::Subscription>`.
+   *
+   * The constructor for a `shared_ptr<ucxx::Subscription>` object, receiving all
+   * publications of a topic sent to `worker` and calling `callback` for each of them, from
+   * the thread that progresses the worker. Publications are received with worker-wide
+   * tag receives, thus only one subscription per topic may exist on a worker at a time,
+   * and it must have a single upstream publisher. Publications from a second publisher
+   * stop the subscription with `UCS_ERR_ALREADY_EXISTS`.
+   *
+   * @throws ucxx::Error if a subscription to `topic` already exists on `worker`.
+   *
+   * @code{.cpp}
+   * // worker is `std::shared_ptr<ucxx::Worker>`
+   * auto subscription = ucxx::createSubscription(
+   *   worker, topic, [](std::shared_ptr<ucxx::Buffer> payload) { ... });
+   * @endcode
+   *
+   * @param[in] worker    the worker to receive publications with.
+   * @param[in] topic     the topic to subscribe to.
+   * @param[in] callback  callback called for each publication received.
+   *
+   * @returns The `shared_ptr<ucxx::Subscription>` object
+   */
+  friend std::shared_ptr<Subscription> createSubscription(
+    std::shared_ptr<Worker> worker,
+    const ucp_tag_t topic,
+    std::function<void(std::shared_ptr<Buffer>)> callback);
+
+  /**
+   * @brief Relay publications to a downstream subscriber.
+   *
+   * Relay all publications subsequently received to the subscriber connected via
+   * `endpoint`, allowing subscribers to form a tree that caps the fan-out of the original
+   * publisher. Relaying shares the received buffer, no copies are made.
+   *
+   * @param[in] endpoint  the endpoint connected to the downstream subscriber.
+   * @param[in] maxLag    the maximum number of publications that may be inflight for
+   *                      each downstream subscriber.
+   * @param[in] policy    the policy to apply to downstream subscribers that reach `maxLag`,
+   *                      only used when the first relay is added.
+   */
+  void addRelay(std::shared_ptr<Endpoint> endpoint,
+                const size_t maxLag                = 8,
+                const SlowSubscriberPolicy policy = SlowSubscriberPolicy::Skip);
+
+  /**
+   * @brief Get the number of publications received.
+   *
+   * @returns The number of publications received.
+   */
+  size_t getReceivedCount() const;
+
+  /**
+   * @brief Get the status of the subscription.
+   *
+   * Get the status of the subscription. A receive that fails, for example because a
+   * message that is not a publication was sent with the topic's tag, stops the
+   * subscription and is reported here and logged as a warning.
+   *
+   * @returns `UCS_OK` while receiving or after `close()`, or the status of the receive that
+   *          stopped the subscription otherwise.
+   */
+  ucs_status_t getStatus() const;
+
+  /**
+   * @brief Stop receiving publications.
+   *
+   * Stop receiving publications, canceling the receive currently posted.
+   */
+  void close();
+};
+
+}  // namespace ucxx
@@ -0,0 +1,384 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <vector>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/component.h>
+#include <ucxx/endpoint.h>
+#include <ucxx/memory_handle.h>
+#include <ucxx/remote_key.h>
+#include <ucxx/request.h>
+
+namespace ucxx {
+
+/**
+ * @brief Bit set in the tag of pull release notifications.
+ *
+ * Release notifications of a pull transfer are sent with the tag of the transfer with
+ * this bit set, thus tags of pull transfers must not have it set.
+ */
+const ucp_tag_t PullReleaseTagBit = 1ull << 63;
+
+class PullSender : public Component {
+ private:
+  ucp_tag_t _tag{0};                                            ///< Tag of the transfer
+  std::vector<std::shared_ptr<MemoryHandle>> _memoryHandles{};  ///< Registered frames
+  std::string _descriptorHeader{};                              ///< Header of the descriptor
+  std::string _descriptor{};                                    ///< Descriptor of the frames
+  std::string _release{};                                       ///< Release notification
+  std::vector<std::shared_ptr<Request>> _requests{};            ///< Descriptor and release
+  std::atomic<ucs_status_t> _status{UCS_INPROGRESS};            ///< Status of the transfer
+
+  /**
+   * @brief Private constructor of `ucxx::PullSender`.
+   *
+   * This is the internal implementation of `ucxx::PullSender` constructor, made private
+   * not to be called directly. This constructor is made private to ensure all UCXX
+   * objects are shared pointers and the correct lifetime management of each one.
+   *
+   * Instead the user should use one of the following:
+   *
+   * - `ucxx::createPullSender()`
+   *
+   * @param[in] endpoint  the endpoint to the receiver.
+   * @param[in] buffer    a vector of raw pointers to the frames to be pulled.
+   * @param[in] size      a vector of size in bytes of each frame.
+   * @param[in] tag       the tag of the transfer.
+   */
+  PullSender(std::shared_ptr<Endpoint> endpoint,
+             const std::vector<void*>& buffer,
+             const std::vector<size_t>& size,
+             const ucp_tag_t tag);
+
+  /**
+   * @brief Post the release receive and send the descriptor.
+   *
+   * Post the receive of the release notification, and only then send the descriptor so
+   * that the notification may never arrive before its receive is posted.
+   */
+  void post();
+
+  /**
+   * @brief Handle the release notification.
+   *
+   * Validate the release notification and mark the transfer as completed, or as failed
+   * if the receive of the notification failed.
+   *
+   * @param[in] status  the status of the release notification receive.
+   */
+  void markReleased(const ucs_status_t status);
+
+ public:
+  PullSender()                  = delete;
+  PullSender(const PullSender&) = delete;
+  PullSender& operator=(PullSender const&) = delete;
+  PullSender(PullSender&& o)               = delete;
+  PullSender& operator=(PullSender&& o) = delete;
+
+  /**
+   * @brief Destructor of `ucxx::PullSender`.
+   *
+   * Cancels the receive of the release notification and waits for all requests of the
+   * transfer to complete, before deregistering the frames.
+   */
+  ~PullSender();
+
+  /**
+   * @brief Constructor for `shared_ptr<ucxx::PullSender>`.
+   *
+   * The constructor for a `shared_ptr<ucxx::PullSender>` object, registering all frames
+   * and sending only a descriptor containing their remote keys to the remote end of
+   * `endpoint`, where a `ucxx::PullReceiver` fetches them via RMA at its own pace. The
+   * frames must remain valid and unmodified until `isReleased()` returns `true`, after
+   * which the sender may be destroyed and the frames released.
+   *
+   * @code{.cpp}
+   * // endpoint is `std::shared_ptr<ucxx::Endpoint>`
+   * auto sender = ucxx::createPullSender(endpoint, buffers, sizes, tag);
+   * while (!sender->isReleased()) worker->progress();
+   * @endcode
+   *
+   * @throws std::length_error  if the lengths of `buffer` and `size` do not match.
+   * @throws ucxx::Error        if `tag` has `ucxx::PullReleaseTagBit` set.
+   *
+   * @param[in] endpoint  the endpoint to the receiver.
+   * @param[in] buffer    a vector of raw pointers to the frames to be pulled.
+   * @param[in] size      a vector of size in bytes of each frame.
+   * @param[in] tag       the tag of the transfer.
+   *
+   * @returns The `shared_ptr<ucxx::PullSender>` object.
+   */
+  friend std::shared_ptr<PullSender> createPullSender(std::shared_ptr<Endpoint> endpoint,
+                                                      const std::vector<void*>& buffer,
+                                                      const std::vector<size_t>& size,
+                                                      const ucp_tag_t tag);
+
+  /**
+   * @brief Check whether the receiver released the frames.
+   *
+   * Check whether the receiver notified it completed fetching frames, after which the
+   * frames may be modified or released.
+   *
+   * @returns whether the frames were released.
+   */
+  bool isReleased() const;
+
+  /**
+   * @brief Get the status of the transfer.
+   *
+   * Get the status of the transfer, `UCS_INPROGRESS` until the receiver releases the
+   * frames, `UCS_OK` once released or an error if the notification was malformed.
+   *
+   * @returns the status of the transfer.
+   */
+  ucs_status_t getStatus() const;
+};
+
+class PullReceiver : public Component {
+ private:
+  struct Frame {
+    uint64_t address{0};                            ///< Address of the frame in the sender
+    size_t size{0};                                 ///< Size of the frame in bytes
+    std::shared_ptr<RemoteKey> remoteKey{nullptr};  ///< Remote key of the frame
+  };
+
+  struct Fetch {
+    int priority{0};                                ///< Priority, higher is fetched first
+    uint64_t sequence{0};                           ///< Order the fetch was requested in
+    void* buffer{nullptr};                          ///< Local destination of the chunk
+    size_t length{0};                               ///< Size of the chunk in bytes
+    uint64_t address{0};                            ///< Remote address of the chunk
+    std::shared_ptr<RemoteKey> remoteKey{nullptr};  ///< Remote key of the frame
+
+    bool operator<(const Fetch& other) const
+    {
+      return priority != other.priority ? priority < other.priority : sequence > other.sequence;
+    }
+  };
+
+  ucp_tag_t _tag{0};                                    ///< Tag of the transfer
+  size_t _maxInflight{0};                               ///< Maximum number of inflight gets
+  size_t _chunkSize{0};                                 ///< Maximum size of each get in bytes
+  std::string _descriptorHeader{};                      ///< Header of the descriptor
+  std::string _descriptor{};                            ///< Descriptor of the frames
+  std::string _release{};                               ///< Release notification
+  std::vector<Frame> _frames{};                         ///< Frames described by the sender
+  std::priority_queue<Fetch> _queue{};                  ///< Chunks waiting to be fetched
+  uint64_t _sequence{0};                                ///< Number of fetches requested
+  size_t _inflight{0};                                  ///< Number of inflight gets
+  size_t _pending{0};                                   ///< Number of queued or inflight gets
+  bool _scheduling{false};                              ///< Whether gets are being posted
+  bool _released{false};                                ///< Whether the frames were released
+  std::vector<std::shared_ptr<Request>> _requests{};    ///< Inflight requests of the transfer
+  ucs_status_t _fetchStatus{UCS_OK};                    ///< Status of the first failed get
+  std::atomic<bool> _ready{false};                      ///< Whether the descriptor was handled
+  std::atomic<ucs_status_t> _descriptorStatus{UCS_OK};  ///< Status of the descriptor
+  std::mutex _mutex{};                                  ///< Mutex to access the fetch state
+
+  /**
+   * @brief Private constructor of `ucxx::PullReceiver`.
+   *
+   * This is the internal implementation of `ucxx::PullReceiver` constructor, made
+   * private not to be called directly. This constructor is made private to ensure all
+   * UCXX objects are shared pointers and the correct lifetime management of each one.
+   *
+   * Instead the user should use one of the following:
+   *
+   * - `ucxx::createPullReceiver()`
+   *
+   * @param[in] endpoint    the endpoint to the sender.
+   * @param[in] tag         the tag of the transfer.
+   * @param[in] maxInflight the maximum number of RMA gets inflight at any time.
+   * @param[in] chunkSize   the maximum size in bytes of each RMA get.
+   */
+  PullReceiver(std::shared_ptr<Endpoint> endpoint,
+               const ucp_tag_t tag,
+               const size_t maxInflight,
+               const size_t chunkSize);
+
+  /**
+   * @brief Post the receive of the descriptor header.
+   */
+  void recvDescriptorHeader();
+
+  /**
+   * @brief Handle the reception of the descriptor header.
+   *
+   * Validate the descriptor header and post the receive of the descriptor.
+   *
+   * @param[in] status  the status of the descriptor header receive.
+   */
+  void recvDescriptor(const ucs_status_t status);
+
+  /**
+   * @brief Handle the reception of the descriptor.
+   *
+   * Parse the descriptor and unpack the remote keys of all frames, after which the
+   * receiver is ready to fetch frames.
+   *
+   * @param[in] status  the status of the descriptor receive.
+   */
+  void parseDescriptor(const ucs_status_t status);
+
+  /**
+   * @brief Post queued gets.
+   *
+   * Post queued gets in order of priority while fewer than the maximum number of gets
+   * are inflight. Only one thread posts gets at any time, others return immediately
+   * leaving queued gets to be posted by the posting thread.
+   */
+  void scheduleFetches();
+
+  /**
+   * @brief Mark a get as completed and post queued gets.
+   *
+   * @param[in] status  the status of the get.
+   */
+  void markFetched(const ucs_status_t status);
+
+ public:
+  PullReceiver()                    = delete;
+  PullReceiver(const PullReceiver&) = delete;
+  PullReceiver& operator=(PullReceiver const&) = delete;
+  PullReceiver(PullReceiver&& o)               = delete;
+  PullReceiver& operator=(PullReceiver&& o) = delete;
+
+  /**
+   * @brief Destructor of `ucxx::PullReceiver`.
+   *
+   * Cancels the inflight receives of the descriptor and waits for all inflight requests
+   * of the transfer to complete, including gets into user buffers.
+   */
+  ~PullReceiver();
+
+  /**
+   * @brief Constructor for `shared_ptr<ucxx::PullReceiver>`.
+   *
+   * The constructor for a `shared_ptr<ucxx::PullReceiver>` object, receiving the
+   * descriptor of a transfer from a `ucxx::PullSender` at the remote end of `endpoint`.
+   * Once `isReady()` returns `true` the frames may be fetched with `fetch()` in any order
+   * and into any memory, and once the receiver is done `release()` must be called to
+   * notify the sender it may release its frames.
+   *
+   * At most `maxInflight` RMA gets of at most `chunkSize` bytes each are inflight at any
+   * time, bounding the memory and bandwidth the transfer consumes.
+   *
+   * @code{.cpp}
+   * // endpoint is `std::shared_ptr<ucxx::Endpoint>`
+   * auto receiver = ucxx::createPullReceiver(endpoint, tag);
+   * while (!receiver->isReady()) worker->progress();
+   * std::vector<char> frame(receiver->getFrameSize(0));
+   * receiver->fetch(0, frame.data());
+   * while (!receiver->isCompleted()) worker->progress();
+   * receiver->release();
+   * @endcode
+   *
+   * @throws ucxx::Error  if `maxInflight` or `chunkSize` are `0`, or if `tag` has
+   *                      `ucxx::PullReleaseTagBit` set.
+   *
+   * @param[in] endpoint    the endpoint to the sender.
+   * @param[in] tag         the tag of the transfer.
+   * @param[in] maxInflight the maximum number of RMA gets inflight at any time.
+   * @param[in] chunkSize   the maximum size in bytes of each RMA get.
+   *
+   * @returns The `shared_ptr<ucxx::PullReceiver>` object.
+   */
+  friend std::shared_ptr<PullReceiver> createPullReceiver(std::shared_ptr<Endpoint> endpoint,
+                                                          const ucp_tag_t tag,
+                                                          const size_t maxInflight,
+                                                          const size_t chunkSize);
+
+  /**
+   * @brief Check whether the descriptor was received.
+   *
+   * Check whether the descriptor was received and handled, after which frames may be
+   * fetched if `getStatus()` does not return an error.
+   *
+   * @returns whether the descriptor was received.
+   */
+  bool isReady() const;
+
+  /**
+   * @brief Get the number of frames.
+   *
+   * @throws ucxx::Error if the descriptor was not received yet.
+   *
+   * @returns the number of frames of the transfer.
+   */
+  size_t getNumFrames() const;
+
+  /**
+   * @brief Get the size of a frame.
+   *
+   * @throws ucxx::Error if the descriptor was not received yet or the frame does not
+   *                     exist.
+   *
+   * @param[in] frame the index of the frame.
+   *
+   * @returns the size of the frame in bytes.
+   */
+  size_t getFrameSize(const size_t frame) const;
+
+  /**
+   * @brief Fetch a frame.
+   *
+   * Queue RMA gets of all chunks of a frame into `buffer`, which must be at least
+   * `getFrameSize(frame)` bytes and remain valid until `isCompleted()` returns `true`.
+   * Queued chunks are fetched in order of `priority`, higher first, and in the order
+   * they were queued within the same priority. This is a non-blocking operation.
+   *
+   * @throws ucxx::Error if the descriptor was not received yet, the frame does not exist
+   *                     or the frames were already released.
+   *
+   * @param[in] frame     the index of the frame.
+   * @param[in] buffer    the buffer to fetch the frame into.
+   * @param[in] priority  the priority of the fetch.
+   */
+  void fetch(const size_t frame, void* buffer, const int priority = 0);
+
+  /**
+   * @brief Check whether all fetches completed.
+   *
+   * Check whether all fetches requested so far have completed.
+   *
+   * @returns whether all fetches completed.
+   */
+  bool isCompleted();
+
+  /**
+   * @brief Get the status of the transfer.
+   *
+   * Get the status of the transfer, `UCS_INPROGRESS` while the descriptor has not been
+   * received or fetches are pending, `UCS_OK` if all fetches so far succeeded, or an
+   * error if the descriptor was malformed or any fetch failed.
+   *
+   * @returns the status of the transfer.
+   */
+  ucs_status_t getStatus();
+
+  /**
+   * @brief Release the frames.
+   *
+   * Notify the sender that no more frames will be fetched, so it may release them. May
+   * be called without fetching all frames, but no further fetches are allowed.
+   *
+   * @throws ucxx::Error if the descriptor was not received yet, fetches are still
+   *                     pending or the frames were already released.
+   *
+   * @returns the request of the notification.
+   */
+  std::shared_ptr<Request> release();
+};
+
+}  // namespace ucxx
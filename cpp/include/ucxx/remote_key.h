@@ -0,0 +1,146 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/component.h>
+#include <ucxx/endpoint.h>
+#include <ucxx/memory_handle.h>
+
+namespace ucxx {
+
+class RemoteKey : public Component {
+ private:
+  ucp_rkey_h _remoteKey{nullptr};  ///< The unpacked remote key, only valid for remote keys
+  std::string _packedRemoteKey{};  ///< The packed remote key, as produced by `ucp_rkey_pack`
+  uint64_t _memoryBaseAddress{0};  ///< The base address of the memory region
+  size_t _memorySize{0};           ///< The size of the memory region
+
+  /**
+   * @brief Private constructor of `ucxx::RemoteKey` from a local memory handle.
+   *
+   * This is the internal implementation of `ucxx::RemoteKey` constructor from a local
+   * `std::shared_ptr<ucxx::MemoryHandle>`, made private not to be called directly. This
+   * constructor is made private to ensure all UCXX objects are shared pointers and the
+   * correct lifetime management of each one.
+   *
+   * Instead the user should use one of the following:
+   *
+   * - `ucxx::createRemoteKeyFromMemoryHandle()`
+   *
+   * @param[in] memoryHandle  the memory handle mapped by the local context.
+   */
+  explicit RemoteKey(std::shared_ptr<MemoryHandle> memoryHandle);
+
+  /**
+   * @brief Private constructor of `ucxx::RemoteKey` from a serialized remote key.
+   *
+   * This is the internal implementation of `ucxx::RemoteKey` constructor from a remote key
+   * serialized by the remote peer, made private not to be called directly. This
+   * constructor is made private to ensure all UCXX objects are shared pointers and the
+   * correct lifetime management of each one.
+   *
+   * Instead the user should use one of the following:
+   *
+   * - `ucxx::createRemoteKeyFromSerialized()`
+   *
+   * @throws ucxx::Error  if the serialized remote key is malformed.
+   *
+   * @param[in] endpoint            the endpoint connected to the peer that owns the memory.
+   * @param[in] serializedRemoteKey the remote key as returned by `serialize()` on the peer.
+   */
+  RemoteKey(std::shared_ptr<Endpoint> endpoint, const std::string& serializedRemoteKey);
+
+ public:
+  RemoteKey()                 = delete;
+  RemoteKey(const RemoteKey&) = delete;
+  RemoteKey& operator=(RemoteKey const&) = delete;
+  RemoteKey(RemoteKey&& o)               = delete;
+  RemoteKey& operator=(RemoteKey&& o) = delete;
+
+  /**
+   * @brief Constructor for `shared_ptr<ucxx::RemoteKey>` from a local memory handle.
+   *
+   * The constructor for a `shared_ptr<ucxx::RemoteKey>` object that packs the remote key
+   * of a local memory handle, so that it can be serialized and shared with remote peers.
+   *
+   * @code{.cpp}
+   * // memoryHandle is `std::shared_ptr<ucxx::MemoryHandle>`
+   * auto remoteKey = ucxx::createRemoteKeyFromMemoryHandle(memoryHandle);
+   * std::string serialized = remoteKey->serialize();
+   * @endcode
+   *
+   * @param[in] memoryHandle  the memory handle mapped by the local context.
+   *
+   * @returns The `shared_ptr<ucxx::RemoteKey>` object
+   */
+  friend std::shared_ptr<RemoteKey> createRemoteKeyFromMemoryHandle(
+    std::shared_ptr<MemoryHandle> memoryHandle);
+
+  /**
+   * @brief Constructor for `shared_ptr<ucxx::RemoteKey>` from a serialized remote key.
+   *
+   * The constructor for a `shared_ptr<ucxx::RemoteKey>` object that unpacks a remote key
+   * serialized by a remote peer, so that it can be used for RMA operations targeting the
+   * peer's memory via `endpoint`.
+   *
+   * @code{.cpp}
+   * // endpoint is `std::shared_ptr<ucxx::Endpoint>`, serialized is `std::string`
+   * auto remoteKey = ucxx::createRemoteKeyFromSerialized(endpoint, serialized);
+   * @endcode
+   *
+   * @throws ucxx::Error  if the serialized remote key is malformed.
+   *
+   * @param[in] endpoint            the endpoint connected to the peer that owns the memory.
+   * @param[in] serializedRemoteKey the remote key as returned by `serialize()` on the peer.
+   *
+   * @returns The `shared_ptr<ucxx::RemoteKey>` object
+   */
+  friend std::shared_ptr<RemoteKey> createRemoteKeyFromSerialized(
+    std::shared_ptr<Endpoint> endpoint, const std::string& serializedRemoteKey);
+
+  ~RemoteKey();
+
+  /**
+   * @brief Get the underlying `ucp_rkey_h` handle.
+   *
+   * Get the unpacked remote key handle, only valid if the object was created from a
+   * serialized remote key, otherwise `nullptr`.
+   *
+   * @returns The underlying `ucp_rkey_h` handle.
+   */
+  ucp_rkey_h getHandle();
+
+  /**
+   * @brief Get the base address of the memory region the remote key refers to.
+   *
+   * @returns The base address of the memory region.
+   */
+  uint64_t getBaseAddress() const;
+
+  /**
+   * @brief Get the size of the memory region the remote key refers to.
+   *
+   * @returns The size of the memory region in bytes.
+   */
+  size_t getSize() const;
+
+  /**
+   * @brief Serialize the remote key.
+   *
+   * Serialize the remote key, including the base address and size of the memory region,
+   * so that it can be transferred to a remote peer and unpacked with
+   * `ucxx::createRemoteKeyFromSerialized()`.
+   *
+   * @returns The serialized remote key.
+   */
+  std::string serialize() const;
+};
+
+}  // namespace ucxx
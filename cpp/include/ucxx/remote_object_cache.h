@@ -0,0 +1,262 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/buffer.h>
+#include <ucxx/component.h>
+#include <ucxx/endpoint.h>
+#include <ucxx/memory_handle.h>
+#include <ucxx/remote_key.h>
+#include <ucxx/worker.h>
+
+namespace ucxx {
+
+const size_t RemoteObjectCacheMaxPackedRemoteKeySize = 512;
+const size_t RemoteObjectCacheMaxKeySize             = 256;
+
+/**
+ * @brief A bucket of the remote object cache index.
+ *
+ * A bucket of the remote object cache index, as laid out in registered memory and read
+ * by consumers with a single RMA get. Writers follow a sequence lock protocol: before
+ * modifying the bucket `versionBegin` is incremented to an odd value, and after the
+ * modification is complete `versionEnd` and then `versionBegin` are set to the same even
+ * value. A consumer only accepts a bucket where both versions match and are even.
+ */
+struct RemoteObjectCacheBucket {
+  uint64_t versionBegin;     ///< Bucket version, odd while the bucket is being modified
+  uint64_t occupied;         ///< Whether the bucket currently holds an object
+  uint64_t keyHash;          ///< Hash of the key the object was registered with
+  uint64_t keyLength;        ///< Length of the key in bytes
+  char key[RemoteObjectCacheMaxKeySize];  ///< The key the object was registered with
+  uint64_t address;          ///< Address of the object in the producer's memory
+  uint64_t length;           ///< Length of the object in bytes
+  uint64_t remoteKeyLength;  ///< Length of the packed remote key in bytes
+  uint8_t remoteKey[RemoteObjectCacheMaxPackedRemoteKeySize];  ///< The packed remote key
+  uint64_t versionEnd;  ///< Bucket version, matches `versionBegin` once modification ends
+};
+
+class RemoteObjectCache : public Component {
+ private:
+  size_t _numBuckets{0};  ///< The number of buckets in the index
+  std::vector<RemoteObjectCacheBucket> _index{};  ///< The index, exposed as registered memory
+  std::shared_ptr<MemoryHandle> _indexMemoryHandle{nullptr};  ///< The index memory handle
+  std::shared_ptr<RemoteKey> _indexRemoteKey{nullptr};        ///< The index remote key
+  std::vector<std::shared_ptr<MemoryHandle>>
+    _objectMemoryHandles{};  ///< Memory handles of registered objects, one per bucket
+  std::mutex _mutex{};       ///< Mutex to serialize modifications of the index
+
+  /**
+   * @brief Private constructor of `ucxx::RemoteObjectCache`.
+   *
+   * This is the internal implementation of `ucxx::RemoteObjectCache` constructor, made
+   * private not to be called directly. This constructor is made private to ensure all
+   * UCXX objects are shared pointers and the correct lifetime management of each one.
+   *
+   * Instead the user should use one of the following:
+   *
+   * - `ucxx::createRemoteObjectCache()`
+   *
+   * @param[in] worker      the worker whose context maps the index and objects.
+   * @param[in] numBuckets  the number of buckets in the index.
+   */
+  RemoteObjectCache(std::shared_ptr<Worker> worker, const size_t numBuckets);
+
+  /**
+   * @brief Write a bucket under the sequence lock.
+   *
+   * Write all fields of a bucket, except for its versions, with the sequence lock held,
+   * so that concurrent remote readers either observe the previous or the new state.
+   *
+   * @param[in] bucketIndex the index of the bucket to write.
+   * @param[in] bucket      the new state of the bucket.
+   */
+  void writeBucket(const size_t bucketIndex, const RemoteObjectCacheBucket& bucket);
+
+ public:
+  RemoteObjectCache()                         = delete;
+  RemoteObjectCache(const RemoteObjectCache&) = delete;
+  RemoteObjectCache& operator=(RemoteObjectCache const&) = delete;
+  RemoteObjectCache(RemoteObjectCache&& o)               = delete;
+  RemoteObjectCache& operator=(RemoteObjectCache&& o) = delete;
+
+  /**
+   * @brief Constructor for `shared_ptr<ucxx::RemoteObjectCache>`.
+   *
+   * The constructor for a `shared_ptr<ucxx::RemoteObjectCache>` object, the producer side
+   * of a remote object cache. Objects registered with `put()` are served to consumers via
+   * one-sided RMA reads, without any involvement of the producer's worker. The index is a
+   * direct-mapped hash table of `numBuckets` buckets, registering an object whose key maps
+   * to an occupied bucket evicts the previous object.
+   *
+   * Consumers are created with `ucxx::createRemoteObjectCacheClient()`, passing the
+   * descriptor returned by `getDescriptor()`.
+   *
+   * @code{.cpp}
+   * // worker is `std::shared_ptr<ucxx::Worker>`
+   * auto cache = ucxx::createRemoteObjectCache(worker, 1024);
+   * cache->put("result", buffer, length);
+   * std::string descriptor = cache->getDescriptor();  // Send to consumers
+   * @endcode
+   *
+   * @param[in] worker      the worker whose context maps the index and objects.
+   * @param[in] numBuckets  the number of buckets in the index.
+   *
+   * @returns The `shared_ptr<ucxx::RemoteObjectCache>` object
+   */
+  friend std::shared_ptr<RemoteObjectCache> createRemoteObjectCache(std::shared_ptr<Worker> worker,
+                                                                    const size_t numBuckets);
+
+  /**
+   * @brief Register an object under a key.
+   *
+   * Register the object at `buffer` under `key`, mapping the memory so that it can be read
+   * by consumers. If the key's bucket is occupied, the previous object is evicted. The
+   * memory must remain valid and unmodified until the object is evicted with `evict()`,
+   * replaced by another `put()` mapping to the same bucket, or the cache is destroyed.
+   *
+   * @throws ucxx::Error  if `key` exceeds `RemoteObjectCacheMaxKeySize` bytes or the
+   *                      packed remote key of `buffer` exceeds
+   *                      `RemoteObjectCacheMaxPackedRemoteKeySize`.
+   *
+   * @param[in] key     the key to register the object with.
+   * @param[in] buffer  a raw pointer to the object.
+   * @param[in] length  the size in bytes of the object.
+   */
+  void put(const std::string& key, void* buffer, const size_t length);
+
+  /**
+   * @brief Evict the object registered under a key.
+   *
+   * Evict the object registered under `key`, if present, and unmap its memory. After this
+   * call returns the memory may be reused by the application, consumers that had already
+   * resolved the object detect the eviction through the bucket version and discard any
+   * data read.
+   *
+   * @param[in] key the key of the object to evict.
+   *
+   * @returns `true` if an object was evicted, `false` otherwise.
+   */
+  bool evict(const std::string& key);
+
+  /**
+   * @brief Get the descriptor of the cache index.
+   *
+   * Get the descriptor of the cache index, containing the number of buckets and the
+   * serialized remote key of the index, which consumers need to create a
+   * `ucxx::RemoteObjectCacheClient`.
+   *
+   * @returns The serialized descriptor.
+   */
+  std::string getDescriptor() const;
+};
+
+class RemoteObjectCacheClient : public Component {
+ private:
+  size_t _numBuckets{0};                                ///< The number of buckets in the index
+  std::shared_ptr<RemoteKey> _indexRemoteKey{nullptr};  ///< The unpacked index remote key
+  std::unordered_map<size_t, std::pair<uint64_t, std::shared_ptr<RemoteKey>>>
+    _objectRemoteKeys{};  ///< Cached object remote keys and their versions, per bucket
+  std::mutex _objectRemoteKeysMutex{};  ///< Mutex to access `_objectRemoteKeys`
+  size_t _maxRetries{16};  ///< The maximum number of retries upon concurrent modification
+
+  /**
+   * @brief Private constructor of `ucxx::RemoteObjectCacheClient`.
+   *
+   * This is the internal implementation of `ucxx::RemoteObjectCacheClient` constructor,
+   * made private not to be called directly. This constructor is made private to ensure all
+   * UCXX objects are shared pointers and the correct lifetime management of each one.
+   *
+   * Instead the user should use one of the following:
+   *
+   * - `ucxx::createRemoteObjectCacheClient()`
+   *
+   * @throws ucxx::Error  if the descriptor is malformed.
+   *
+   * @param[in] endpoint    the endpoint connected to the producer.
+   * @param[in] descriptor  the descriptor returned by the producer's
+   *                        `ucxx::RemoteObjectCache::getDescriptor()`.
+   * @param[in] maxRetries  the maximum number of retries upon concurrent modification.
+   */
+  RemoteObjectCacheClient(std::shared_ptr<Endpoint> endpoint,
+                          const std::string& descriptor,
+                          const size_t maxRetries);
+
+  /**
+   * @brief Read a bucket or part of it with a blocking RMA get.
+   *
+   * @param[in] buffer        a raw pointer to where the data will be stored.
+   * @param[in] length        the size in bytes to read.
+   * @param[in] remoteAddress the remote address to read from.
+   * @param[in] remoteKey     the remote key of the memory containing `remoteAddress`.
+   *
+   * @returns `true` if the read completed successfully, `false` otherwise.
+   */
+  bool read(void* buffer,
+            const size_t length,
+            const uint64_t remoteAddress,
+            std::shared_ptr<RemoteKey> remoteKey);
+
+ public:
+  RemoteObjectCacheClient()                               = delete;
+  RemoteObjectCacheClient(const RemoteObjectCacheClient&) = delete;
+  RemoteObjectCacheClient& operator=(RemoteObjectCacheClient const&) = delete;
+  RemoteObjectCacheClient(RemoteObjectCacheClient&& o)               = delete;
+  RemoteObjectCacheClient& operator=(RemoteObjectCacheClient&& o) = delete;
+
+  /**
+   * @brief Constructor for `shared_ptr<ucxx::RemoteObjectCacheClient>`.
+   *
+   * The constructor for a `shared_ptr<ucxx::RemoteObjectCacheClient>` object, the consumer
+   * side of a remote object cache. Objects are fetched with one RMA get of the index
+   * bucket and one RMA get of the object itself, followed by a small RMA get of the bucket
+   * version to validate the object was not evicted or replaced while being read.
+   *
+   * @code{.cpp}
+   * // endpoint is `std::shared_ptr<ucxx::Endpoint>`, descriptor is `std::string`
+   * auto client = ucxx::createRemoteObjectCacheClient(endpoint, descriptor);
+   * auto object = client->get("result");
+   * @endcode
+   *
+   * @throws ucxx::Error  if the descriptor is malformed.
+   *
+   * @param[in] endpoint    the endpoint connected to the producer.
+   * @param[in] descriptor  the descriptor returned by the producer's
+   *                        `ucxx::RemoteObjectCache::getDescriptor()`.
+   * @param[in] maxRetries  the maximum number of retries upon concurrent modification.
+   *
+   * @returns The `shared_ptr<ucxx::RemoteObjectCacheClient>` object
+   */
+  friend std::shared_ptr<RemoteObjectCacheClient> createRemoteObjectCacheClient(
+    std::shared_ptr<Endpoint> endpoint, const std::string& descriptor, const size_t maxRetries);
+
+  /**
+   * @brief Fetch an object from the remote cache.
+   *
+   * Fetch the object registered under `key` from the remote cache, blocking until it has
+   * been read and validated. The producer is not involved, progress is made only on the
+   * consumer's worker. If the object is concurrently modified, the read is retried up to
+   * the maximum number of retries specified at construction. May be called concurrently
+   * from multiple threads.
+   *
+   * @param[in] key the key of the object to fetch.
+   *
+   * @returns The object in a `ucxx::HostBuffer`, or `nullptr` if the key is not present or
+   *          could not be read consistently within the maximum number of retries.
+   */
+  std::unique_ptr<Buffer> get(const std::string& key);
+};
+
+}  // namespace ucxx
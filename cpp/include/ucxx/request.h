@@ -7,6 +7,7 @@
 #include <atomic>
 #include <chrono>
 #include <memory>
+#include <new>
 #include <string>
 
 #include <ucp/api/ucp.h>
@@ -14,6 +15,7 @@
 #include <ucxx/component.h>
 #include <ucxx/endpoint.h>
 #include <ucxx/future.h>
+#include <ucxx/inflight_requests.h>
 #include <ucxx/typedefs.h>
 
 #define ucxx_trace_req_f(_owner, _req, _name, _message, ...) \
@@ -27,8 +29,8 @@ class Request : public Component {
   std::string _status_msg{};                          ///< Human-readable status message
   void* _request{nullptr};                            ///< Pointer to UCP request
   std::shared_ptr<Future> _future{nullptr};           ///< Future to notify upon completion
-  std::function<void(std::shared_ptr<void>)> _callback{nullptr};  ///< Completion callback
-  std::shared_ptr<void> _callbackData{nullptr};                   ///< Completion callback data
+  RequestCallbackUserFunction _callback{nullptr};     ///< Completion callback
+  RequestCallbackUserData _callbackData{nullptr};     ///< Completion callback data
   std::shared_ptr<Worker> _worker{
     nullptr};  ///< Worker that generated request (if not from endpoint)
   std::shared_ptr<Endpoint> _endpoint{
@@ -40,6 +42,8 @@ class Request : public Component {
   std::string _operationName{
     "request_undefined"};          ///< Human-readable operation name, mostly used for log messages
   bool _enablePythonFuture{true};  ///< Whether Python future is enabled for this request
+  std::chrono::steady_clock::time_point _submitTime{
+    std::chrono::steady_clock::now()};  ///< Time the request was submitted, for diagnostics
 
   /**
    * @brief Protected constructor of an abstract `ucxx::Request`.
@@ -51,20 +55,57 @@ class Request : public Component {
    * next worker progress iteration), as well as create Python futures that can be later
    * awaited in Python asynchronous code.
    *
-   * @param[in] endpointOrWorker    the parent component, which may either be a
-   *                                `std::shared_ptr<Endpoint>` or
-   *                                `std::shared_ptr<Worker>`.
+   * @param[in] endpoint            the parent endpoint, whose worker is cached by the
+   *                                request.
    * @param[in] delayedSubmission   the object to manage request submission.
    * @param[in] operationName       a human-readable operation name to help identifying
    *                                requests by their types when UCXX logging is enabled.
    * @param[in] enablePythonFuture  whether a python future should be created and
    *                                subsequently notified.
    */
-  Request(std::shared_ptr<Component> endpointOrWorker,
+  Request(std::shared_ptr<Endpoint> endpoint,
           std::shared_ptr<DelayedSubmission> delayedSubmission,
           const std::string operationName,
           const bool enablePythonFuture = false);
 
+  /**
+   * @brief Protected constructor of an abstract `ucxx::Request` not bound to an endpoint.
+   *
+   * Construct an abstract request whose parent is a worker, such as a tag receive matching
+   * messages from any endpoint. See the endpoint constructor for more details.
+   *
+   * @param[in] worker              the parent worker.
+   * @param[in] delayedSubmission   the object to manage request submission.
+   * @param[in] operationName       a human-readable operation name to help identifying
+   *                                requests by their types when UCXX logging is enabled.
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified.
+   */
+  Request(std::shared_ptr<Worker> worker,
+          std::shared_ptr<DelayedSubmission> delayedSubmission,
+          const std::string operationName,
+          const bool enablePythonFuture = false);
+
+  /**
+   * @brief Common implementation of the `ucxx::Request` constructors.
+   *
+   * The typed links to the worker and endpoint are resolved by the caller, so that the
+   * request never needs to determine the type of its parent at runtime.
+   *
+   * @param[in] worker              the worker the request is submitted to.
+   * @param[in] endpoint            the parent endpoint, or `nullptr` for worker requests.
+   * @param[in] delayedSubmission   the object to manage request submission.
+   * @param[in] operationName       a human-readable operation name to help identifying
+   *                                requests by their types when UCXX logging is enabled.
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified.
+   */
+  Request(std::shared_ptr<Worker> worker,
+          std::shared_ptr<Endpoint> endpoint,
+          std::shared_ptr<DelayedSubmission> delayedSubmission,
+          const std::string operationName,
+          const bool enablePythonFuture);
+
   /**
    * @brief Perform initial processing of the request to determine if immediate completion.
    *
@@ -144,6 +185,23 @@ class Request : public Component {
    */
   void checkError();
 
+  /**
+   * @brief Check whether the request completed with an error, without throwing.
+   *
+   * Exception-free variant of `checkError()`, suitable for hot paths where errors such as
+   * cancelation during shutdown are expected outcomes rather than exceptional ones.
+   *
+   * @code{.cpp}
+   * // request is `std::shared_ptr<ucxx::Request>`
+   * ucs_status_t status = request->checkError(std::nothrow);
+   * if (status == UCS_ERR_CANCELED) return;
+   * @endcode
+   *
+   * @returns `UCS_OK` if the request has completed successfully or is in progress, or the
+   *          error status the request completed with otherwise.
+   */
+  ucs_status_t checkError(std::nothrow_t) const noexcept;
+
   /**
    * @brief Check whether the request has already completed.
    *
@@ -192,6 +250,16 @@ class Request : public Component {
    * @returns the formatted string containing the owner type and its handle.
    */
   const std::string& getOwnerString() const;
+
+  /**
+   * @brief Get the description of the request for diagnostics.
+   *
+   * Get the operation, owner, tag, length and submission time of the request, used to
+   * report requests that remain inflight for too long.
+   *
+   * @returns the description of the request.
+   */
+  InflightRequestInfo getInfo() const;
 };
 
 }  // namespace ucxx
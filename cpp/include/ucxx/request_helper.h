@@ -16,4 +16,17 @@ void waitSingleRequest(std::shared_ptr<Worker> worker, std::shared_ptr<Request>
 
 void waitRequests(std::shared_ptr<Worker> worker, std::vector<std::shared_ptr<Request>> requests);
 
+/**
+ * @brief Cancel requests and wait for their completion.
+ *
+ * Cancel all requests that have not completed yet and progress `worker` until all
+ * requests completed, without checking their status. Used by objects owning the buffers
+ * of the requests before releasing them.
+ *
+ * @param[in] worker    the worker the requests were submitted to.
+ * @param[in] requests  the requests to cancel, `nullptr` elements are ignored.
+ */
+void cancelRequests(std::shared_ptr<Worker> worker,
+                    const std::vector<std::shared_ptr<Request>>& requests);
+
 }  // namespace ucxx
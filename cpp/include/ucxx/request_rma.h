@@ -0,0 +1,127 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+#include <memory>
+#include <utility>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/delayed_submission.h>
+#include <ucxx/remote_key.h>
+#include <ucxx/request.h>
+#include <ucxx/typedefs.h>
+
+namespace ucxx {
+
+class RequestRma : public Request {
+ private:
+  uint64_t _remoteAddress{0};               ///< The remote address to read from or write to
+  std::shared_ptr<RemoteKey> _remoteKey{};  ///< The remote key of the remote memory region
+
+  /**
+   * @brief Private constructor of `ucxx::RequestRma`.
+   *
+   * This is the internal implementation of `ucxx::RequestRma` constructor, made private not
+   * to be called directly. This constructor is made private to ensure all UCXX objects
+   * are shared pointers and the correct lifetime management of each one.
+   *
+   * Instead the user should use one of the following:
+   *
+   * - `ucxx::Endpoint::rmaGet()`
+   * - `ucxx::Endpoint::rmaPut()`
+   * - `ucxx::createRequestRma()`
+   *
+   * @throws ucxx::Error  if `remoteKey` was not unpacked from a serialized remote key, or
+   *                      if the requested range is not contained by the remote memory.
+   *
+   * @param[in] endpoint            the endpoint connected to the peer owning the memory.
+   * @param[in] put                 whether this is a put (`true`) or get (`false`) request.
+   * @param[in] buffer              a raw pointer to the local data.
+   * @param[in] length              the size in bytes of the data to be transferred.
+   * @param[in] remoteAddress       the remote address to write to or read from.
+   * @param[in] remoteKey           the remote key of the memory containing `remoteAddress`.
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified.
+   * @param[in] callbackFunction    user-defined callback function to call upon completion.
+   * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
+   */
+  RequestRma(std::shared_ptr<Endpoint> endpoint,
+             bool put,
+             void* buffer,
+             size_t length,
+             uint64_t remoteAddress,
+             std::shared_ptr<RemoteKey> remoteKey,
+             const bool enablePythonFuture                = false,
+             RequestCallbackUserFunction callbackFunction = nullptr,
+             RequestCallbackUserData callbackData         = nullptr);
+
+ public:
+  /**
+   * @brief Constructor for `std::shared_ptr<ucxx::RequestRma>`.
+   *
+   * The constructor for a `std::shared_ptr<ucxx::RequestRma>` object, creating a one-sided
+   * put or get request, returning a pointer to a request object that can be later awaited
+   * and checked for errors. This is a non-blocking operation, and the status of the
+   * transfer must be verified from the resulting request object before the data can be
+   * released (for a put operation) or consumed (for a get operation).
+   *
+   * @throws ucxx::Error  if `remoteKey` was not unpacked from a serialized remote key, or
+   *                      if the requested range is not contained by the remote memory.
+   *
+   * @param[in] endpoint            the endpoint connected to the peer owning the memory.
+   * @param[in] put                 whether this is a put (`true`) or get (`false`) request.
+   * @param[in] buffer              a raw pointer to the local data.
+   * @param[in] length              the size in bytes of the data to be transferred.
+   * @param[in] remoteAddress       the remote address to write to or read from.
+   * @param[in] remoteKey           the remote key of the memory containing `remoteAddress`.
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified.
+   * @param[in] callbackFunction    user-defined callback function to call upon completion.
+   * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
+   *
+   * @returns The `shared_ptr<ucxx::RequestRma>` object
+   */
+  friend std::shared_ptr<RequestRma> createRequestRma(
+    std::shared_ptr<Endpoint> endpoint,
+    bool put,
+    void* buffer,
+    size_t length,
+    uint64_t remoteAddress,
+    std::shared_ptr<RemoteKey> remoteKey,
+    const bool enablePythonFuture,
+    RequestCallbackUserFunction callbackFunction,
+    RequestCallbackUserData callbackData);
+
+  virtual void populateDelayedSubmission();
+
+  /**
+   * @brief Create and submit an RMA request.
+   *
+   * This is the method that should be called to actually submit an RMA request. It is
+   * meant to be called from `populateDelayedSubmission()`, which is decided at the
+   * discretion of `std::shared_ptr<ucxx::Worker>`. See `populateDelayedSubmission()` for
+   * more details.
+   */
+  void request();
+
+  /**
+   * @brief Callback executed by UCX when an RMA request is completed.
+   *
+   * Callback executed by UCX when an RMA request is completed, that will dispatch
+   * `ucxx::Request::callback()`.
+   *
+   * WARNING: This is not intended to be called by the user, but it currently needs to be
+   * a public method so that UCX may access it. In future changes this will be moved to
+   * an internal object and remove this method from the public API.
+   *
+   * @param[in] request the UCX request pointer.
+   * @param[in] status  the completion status of the request.
+   * @param[in] arg     the pointer to the `ucxx::Request` object that created the
+   *                    transfer, effectively `this` pointer as seen by `request()`.
+   */
+  static void rmaCallback(void* request, ucs_status_t status, void* arg);
+};
+
+}  // namespace ucxx
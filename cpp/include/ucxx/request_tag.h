@@ -5,6 +5,7 @@
 #pragma once
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include <ucp/api/ucp.h>
 
@@ -16,7 +17,10 @@ namespace ucxx {
 
 class RequestTag : public Request {
  private:
-  size_t _length{0};  ///< The tag message length in bytes
+  size_t _length{0};                             ///< The tag message length in bytes
+  std::vector<ucp_dt_iov_t> _iov{};              ///< The segments of an IOV send, empty otherwise
+  TagSendMode _sendMode{TagSendMode::Standard};  ///< Completion semantics of a send
+  ucp_tag_message_h _message{nullptr};           ///< The probed message to receive, if any
 
   /**
    * @brief Private constructor of `ucxx::RequestTag`.
@@ -29,15 +33,9 @@ class RequestTag : public Request {
    *
    * - `ucxx::Endpoint::tagRecv()`
    * - `ucxx::Endpoint::tagSend()`
-   * - `ucxx::Worker::tagRecv()`
    * - `ucxx::createRequestTag()`
    *
-   * @throws ucxx::Error  if send is `true` and `endpointOrWorker` is not a
-   *                      `std::shared_ptr<ucxx::Endpoint>`.
-   *
-   * @param[in] endpointOrWorker    the parent component, which may either be a
-   *                                `std::shared_ptr<Endpoint>` or
-   *                                `std::shared_ptr<Worker>`.
+   * @param[in] endpoint            the parent endpoint.
    * @param[in] send                whether this is a send (`true`) or receive (`false`)
    *                                tag request.
    * @param[in] buffer              a raw pointer to the data to be transferred.
@@ -47,15 +45,115 @@ class RequestTag : public Request {
    *                                subsequently notified.
    * @param[in] callbackFunction    user-defined callback function to call upon completion.
    * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
+   * @param[in] sendMode            the completion semantics of a send, ignored by
+   *                                receives.
    */
-  RequestTag(std::shared_ptr<Component> endpointOrWorker,
+  RequestTag(std::shared_ptr<Endpoint> endpoint,
              bool send,
              void* buffer,
              size_t length,
              ucp_tag_t tag,
-             const bool enablePythonFuture                               = false,
-             std::function<void(std::shared_ptr<void>)> callbackFunction = nullptr,
-             std::shared_ptr<void> callbackData                          = nullptr);
+             const bool enablePythonFuture                = false,
+             RequestCallbackUserFunction callbackFunction = nullptr,
+             RequestCallbackUserData callbackData         = nullptr,
+             const TagSendMode sendMode                   = TagSendMode::Standard);
+
+  /**
+   * @brief Private constructor of a worker `ucxx::RequestTag` receive.
+   *
+   * This is the internal implementation of `ucxx::RequestTag` constructor for receives
+   * matching messages from any endpoint of the worker, made private not to be called
+   * directly. This constructor is made private to ensure all UCXX objects are shared
+   * pointers and the correct lifetime management of each one.
+   *
+   * Instead the user should use one of the following:
+   *
+   * - `ucxx::Worker::tagRecv()`
+   * - `ucxx::createRequestTag()`
+   *
+   * @throws ucxx::Error  if send is `true`, sends require an endpoint.
+   *
+   * @param[in] worker              the parent worker.
+   * @param[in] send                must be `false`, only receives are supported.
+   * @param[in] buffer              a raw pointer to the buffer to receive into.
+   * @param[in] length              the size in bytes of the tag message to be received.
+   * @param[in] tag                 the tag to match.
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified.
+   * @param[in] callbackFunction    user-defined callback function to call upon completion.
+   * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
+   * @param[in] sendMode            ignored, only receives are supported.
+   */
+  RequestTag(std::shared_ptr<Worker> worker,
+             bool send,
+             void* buffer,
+             size_t length,
+             ucp_tag_t tag,
+             const bool enablePythonFuture                = false,
+             RequestCallbackUserFunction callbackFunction = nullptr,
+             RequestCallbackUserData callbackData         = nullptr,
+             const TagSendMode sendMode                   = TagSendMode::Standard);
+
+  /**
+   * @brief Private constructor of a probed `ucxx::RequestTag` receive.
+   *
+   * This is the internal implementation of `ucxx::RequestTag` constructor for receives of
+   * a message previously probed and removed from the worker, made private not to be called
+   * directly. This constructor is made private to ensure all UCXX objects are shared
+   * pointers and the correct lifetime management of each one.
+   *
+   * Instead the user should use one of the following:
+   *
+   * - `ucxx::Worker::tagProbeRecv()`
+   * - `ucxx::createRequestTag()`
+   *
+   * @param[in] worker              the parent worker.
+   * @param[in] message             the message handle returned by the probe.
+   * @param[in] buffer              a raw pointer to the buffer to receive into.
+   * @param[in] length              the size in bytes of the probed message.
+   * @param[in] tag                 the tag of the probed message.
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified.
+   * @param[in] callbackFunction    user-defined callback function to call upon completion.
+   * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
+   */
+  RequestTag(std::shared_ptr<Worker> worker,
+             ucp_tag_message_h message,
+             void* buffer,
+             size_t length,
+             ucp_tag_t tag,
+             const bool enablePythonFuture                = false,
+             RequestCallbackUserFunction callbackFunction = nullptr,
+             RequestCallbackUserData callbackData         = nullptr);
+
+  /**
+   * @brief Private constructor of an IOV `ucxx::RequestTag` send.
+   *
+   * This is the internal implementation of `ucxx::RequestTag` IOV send constructor, made
+   * private not to be called directly. This constructor is made private to ensure all UCXX
+   * objects are shared pointers and the correct lifetime management of each one.
+   *
+   * Instead the user should use one of the following:
+   *
+   * - `ucxx::Endpoint::tagSendIov()`
+   * - `ucxx::createRequestTag()`
+   *
+   * @throws ucxx::Error  if `iov` is empty.
+   *
+   * @param[in] endpoint            the parent endpoint.
+   * @param[in] iov                 the segments to be sent as a single tag message.
+   * @param[in] tag                 the tag to match.
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified.
+   * @param[in] callbackFunction    user-defined callback function to call upon completion.
+   * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
+   */
+  RequestTag(std::shared_ptr<Endpoint> endpoint,
+             std::vector<ucp_dt_iov_t> iov,
+             ucp_tag_t tag,
+             const bool enablePythonFuture                = false,
+             RequestCallbackUserFunction callbackFunction = nullptr,
+             RequestCallbackUserData callbackData         = nullptr);
 
  public:
   /**
@@ -67,12 +165,7 @@ class RequestTag : public Request {
    * transfer must be verified from the resulting request object before the data can be
    * released (for a send operation) or consumed (for a receive operation).
    *
-   * @throws ucxx::Error  if send is `true` and `endpointOrWorker` is not a
-   *                      `std::shared_ptr<ucxx::Endpoint>`.
-   *
-   * @param[in] endpointOrWorker    the parent component, which may either be a
-   *                                `std::shared_ptr<Endpoint>` or
-   *                                `std::shared_ptr<Worker>`.
+   * @param[in] endpoint            the parent endpoint.
    * @param[in] send                whether this is a send (`true`) or receive (`false`)
    *                                tag request.
    * @param[in] buffer              a raw pointer to the data to be transferred.
@@ -82,18 +175,117 @@ class RequestTag : public Request {
    *                                subsequently notified.
    * @param[in] callbackFunction    user-defined callback function to call upon completion.
    * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
+   * @param[in] sendMode            the completion semantics of a send, ignored by
+   *                                receives.
    *
    * @returns The `shared_ptr<ucxx::RequestTag>` object
    */
   friend std::shared_ptr<RequestTag> createRequestTag(
-    std::shared_ptr<Component> endpointOrWorker,
+    std::shared_ptr<Endpoint> endpoint,
     bool send,
     void* buffer,
     size_t length,
     ucp_tag_t tag,
     const bool enablePythonFuture,
-    std::function<void(std::shared_ptr<void>)> callbackFunction,
-    std::shared_ptr<void> callbackData);
+    RequestCallbackUserFunction callbackFunction,
+    RequestCallbackUserData callbackData,
+    const TagSendMode sendMode);
+
+  /**
+   * @brief Constructor for a worker `std::shared_ptr<ucxx::RequestTag>` receive.
+   *
+   * The constructor for a `std::shared_ptr<ucxx::RequestTag>` object receiving a tag
+   * message from any endpoint of `worker`. This is a non-blocking operation, and the
+   * status of the transfer must be verified from the resulting request object before the
+   * data can be consumed.
+   *
+   * @throws ucxx::Error  if send is `true`, sends require an endpoint.
+   *
+   * @param[in] worker              the parent worker.
+   * @param[in] send                must be `false`, only receives are supported.
+   * @param[in] buffer              a raw pointer to the buffer to receive into.
+   * @param[in] length              the size in bytes of the tag message to be received.
+   * @param[in] tag                 the tag to match.
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified.
+   * @param[in] callbackFunction    user-defined callback function to call upon completion.
+   * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
+   * @param[in] sendMode            ignored, only receives are supported.
+   *
+   * @returns The `shared_ptr<ucxx::RequestTag>` object
+   */
+  friend std::shared_ptr<RequestTag> createRequestTag(
+    std::shared_ptr<Worker> worker,
+    bool send,
+    void* buffer,
+    size_t length,
+    ucp_tag_t tag,
+    const bool enablePythonFuture,
+    RequestCallbackUserFunction callbackFunction,
+    RequestCallbackUserData callbackData,
+    const TagSendMode sendMode);
+
+  /**
+   * @brief Constructor for a probed `std::shared_ptr<ucxx::RequestTag>` receive.
+   *
+   * The constructor for a `std::shared_ptr<ucxx::RequestTag>` object receiving a message
+   * previously probed and removed from `worker`, see `ucxx::Worker::tagProbeRecv()`. The
+   * message is received even if no other receive could match it, thus `message` must be
+   * received exactly once. This is a non-blocking operation, and the status of the
+   * transfer must be verified from the resulting request object before the data can be
+   * consumed.
+   *
+   * @param[in] worker              the parent worker.
+   * @param[in] message             the message handle returned by the probe.
+   * @param[in] buffer              a raw pointer to the buffer to receive into.
+   * @param[in] length              the size in bytes of the probed message.
+   * @param[in] tag                 the tag of the probed message.
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified.
+   * @param[in] callbackFunction    user-defined callback function to call upon completion.
+   * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
+   *
+   * @returns The `shared_ptr<ucxx::RequestTag>` object
+   */
+  friend std::shared_ptr<RequestTag> createRequestTag(
+    std::shared_ptr<Worker> worker,
+    ucp_tag_message_h message,
+    void* buffer,
+    size_t length,
+    ucp_tag_t tag,
+    const bool enablePythonFuture,
+    RequestCallbackUserFunction callbackFunction,
+    RequestCallbackUserData callbackData);
+
+  /**
+   * @brief Constructor for an IOV `std::shared_ptr<ucxx::RequestTag>` send.
+   *
+   * The constructor for a `std::shared_ptr<ucxx::RequestTag>` object sending the
+   * segments in `iov` as a single tag message, without first copying them into a
+   * contiguous buffer. The message is received by a regular tag receive of the total
+   * length of all segments, where segments are laid out contiguously in order. The
+   * `iov` vector is owned by the request, but the memory of each segment must remain
+   * valid until the request completes.
+   *
+   * @throws ucxx::Error  if `iov` is empty.
+   *
+   * @param[in] endpoint            the parent endpoint.
+   * @param[in] iov                 the segments to be sent as a single tag message.
+   * @param[in] tag                 the tag to match.
+   * @param[in] enablePythonFuture  whether a python future should be created and
+   *                                subsequently notified.
+   * @param[in] callbackFunction    user-defined callback function to call upon completion.
+   * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
+   *
+   * @returns The `shared_ptr<ucxx::RequestTag>` object
+   */
+  friend std::shared_ptr<RequestTag> createRequestTag(
+    std::shared_ptr<Endpoint> endpoint,
+    std::vector<ucp_dt_iov_t> iov,
+    ucp_tag_t tag,
+    const bool enablePythonFuture,
+    RequestCallbackUserFunction callbackFunction,
+    RequestCallbackUserData callbackData);
 
   virtual void populateDelayedSubmission();
 
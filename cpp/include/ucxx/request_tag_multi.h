@@ -4,6 +4,8 @@
  */
 #pragma once
 
+#include <atomic>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -12,8 +14,11 @@
 #include <ucp/api/ucp.h>
 
 #include <ucxx/buffer.h>
+#include <ucxx/codec.h>
+#include <ucxx/dedup.h>
 #include <ucxx/endpoint.h>
 #include <ucxx/future.h>
+#include <ucxx/header.h>
 #include <ucxx/request.h>
 #include <ucxx/request_helper.h>
 
@@ -21,7 +26,7 @@ namespace ucxx {
 
 struct BufferRequest {
   std::shared_ptr<Request> request{nullptr};  ///< The `ucxx::RequestTag` of a header or frame
-  std::shared_ptr<std::string> stringBuffer{nullptr};  ///< Serialized `Header`
+  std::shared_ptr<std::string> stringBuffer{nullptr};  ///< Serialized `Header` or encoded chunk
   Buffer* buffer{nullptr};  ///< Internally allocated buffer to receive a frame
 };
 
@@ -29,14 +34,30 @@ typedef std::shared_ptr<BufferRequest> BufferRequestPtr;
 
 class RequestTagMulti : public std::enable_shared_from_this<RequestTagMulti> {
  private:
+  struct DedupFrame {
+    int action{0};                                      ///< `ucxx::DedupAction` of the frame
+    std::shared_ptr<std::string> fingerprint{nullptr};  ///< Fingerprint received, if reference
+    Buffer* buffer{nullptr};                            ///< Buffer the frame is received into
+  };
+
   std::shared_ptr<Endpoint> _endpoint{nullptr};  ///< Endpoint that generated request
   bool _send{false};       ///< Whether this is a send (`true`) operation or recv (`false`)
   ucp_tag_t _tag{0};       ///< Tag to match
-  size_t _totalFrames{0};  ///< The total number of frames handled by this request
+  size_t _totalFrames{0};  ///< The total number of frame messages (chunks of encoded frames)
+  TagSendMode _sendMode{TagSendMode::Standard};  ///< Completion semantics of frame sends
   std::mutex _completedRequestsMutex;  ///< Mutex to control access to completed requests container
   std::vector<BufferRequest*> _completedRequests{};  ///< Requests that already completed
   ucs_status_t _status{UCS_INPROGRESS};              ///< Status of the multi-buffer request
+  std::atomic<ucs_status_t> _framesStatus{UCS_OK};   ///< Status of the first failed frame
+  std::vector<DedupFrame> _dedupFrames{};            ///< Received frames subject to deduplication
+  bool _dedupSent{false};                            ///< Whether any frame sent is deduplicated
+  uint64_t _dedupEpoch{0};                           ///< Epoch of deduplicated frames sent
+  std::vector<Header> _headers{};                    ///< Headers received
   std::shared_ptr<Future> _future;  ///< Future to be notified when transfer of all frames complete
+  std::recursive_mutex _bufferRequestsMutex{};  ///< Mutex to post and cancel receives
+  std::atomic<bool> _canceled{false};           ///< Whether the request has been canceled
+  std::function<void()> _filledCallback{nullptr};     ///< Called once all requests are posted
+  std::function<void()> _completedCallback{nullptr};  ///< Called once the request completes
 
  public:
   std::vector<BufferRequestPtr> _bufferRequests{};  ///< Container of all requests posted
@@ -60,10 +81,38 @@ class RequestTagMulti : public std::enable_shared_from_this<RequestTagMulti> {
    * @param[in] tag                 the tag to match.
    * @param[in] enablePythonFuture  whether a python future should be created and
    *                                subsequently notified.
+   * @param[in] filledCallback      function called once the receives of all frames have
+   *                                been posted, possibly before the constructor returns.
+   * @param[in] completedCallback   function called once the request completes, possibly
+   *                                before the constructor returns.
    */
   RequestTagMulti(std::shared_ptr<Endpoint> endpoint,
                   const ucp_tag_t tag,
-                  const bool enablePythonFuture);
+                  const bool enablePythonFuture,
+                  std::function<void()> filledCallback    = nullptr,
+                  std::function<void()> completedCallback = nullptr);
+
+  /**
+   * @brief Post a receive of the multi-buffer request.
+   *
+   * Register `bufferRequest` and post its receive with `post`, serialized with `cancel()`
+   * so that it never observes a registered receive that has not been posted yet.
+   *
+   * @param[in] bufferRequest the `ucxx::BufferRequest` to register.
+   * @param[in] post          function posting the receive and returning its request.
+   */
+  void postRecv(BufferRequestPtr bufferRequest,
+                std::function<std::shared_ptr<Request>()> post);
+
+  /**
+   * @brief Complete the request with a status.
+   *
+   * Set the final status of the request, notify the Python future if enabled and call
+   * the completion callback, if any.
+   *
+   * @param[in] status  the final status of the request.
+   */
+  void setCompleted(const ucs_status_t status);
 
   /**
    * @brief Protected constructor of a multi-buffer tag send request.
@@ -86,21 +135,31 @@ class RequestTagMulti : public std::enable_shared_from_this<RequestTagMulti> {
    * @param[in] tag                 the tag to match.
    * @param[in] enablePythonFuture  whether a python future should be created and
    *                                subsequently notified.
+   * @param[in] codecParams         parameters of the codec used to encode host frames.
+   * @param[in] sendMode            the completion semantics of the frame sends.
    */
   RequestTagMulti(std::shared_ptr<Endpoint> endpoint,
                   const std::vector<void*>& buffer,
                   const std::vector<size_t>& size,
                   const std::vector<int>& isCUDA,
                   const ucp_tag_t tag,
-                  const bool enablePythonFuture);
+                  const bool enablePythonFuture,
+                  const CodecParams& codecParams,
+                  const TagSendMode sendMode);
 
   /**
    * @brief Receive all frames.
    *
    * Once the header(s) has(have) been received, receiving frames containing the actual data
-   * is the next step. This method parses the header(s) and creates as many
-   * `ucxx::RequestTag` objects as necessary, each one that will handle a single sending or
-   * receiving a single frame.
+   * is the next step. This method validates the header(s), completing the request with
+   * `UCS_ERR_INVALID_PARAM` without receiving any frames if one is invalid, and creates as
+   * many `ucxx::RequestTag` objects as necessary, each one that will handle a single
+   * sending or receiving a single frame.
+   *
+   * Frames that were encoded by the sender are received as chunks into intermediate
+   * buffers, each chunk being decoded into the frame as soon as it is received. Frames
+   * replaced by a reference to a deduplicated frame receive only its fingerprint, the
+   * frame is resolved from the endpoint cache once all frames completed.
    *
    * Finally, the object is marked as filled, meaning that all requests were already
    * scheduled and are waiting for completion.
@@ -114,23 +173,98 @@ class RequestTagMulti : public std::enable_shared_from_this<RequestTagMulti> {
    *
    * Create the request to receive a message with header, setting
    * `ucxx::RequestTagMulti::callback` as the user-defined callback of `ucxx::RequestTag` to
-   * handle the next request.
+   * handle the next request. With `extension`, receive instead the extension of the last
+   * header received, handled by `ucxx::RequestTagMulti::extensionCallback`.
    *
    * @throws std::runtime_error if called by a send request.
+   *
+   * @param[in] extension whether to receive the extension of the last header received.
+   */
+  void recvHeader(const bool extension = false);
+
+  /**
+   * @brief Callback to complete the last header with its extension.
+   *
+   * Deserialize the extension of the last header received and submit the request to
+   * receive the next header or the frames. Completes the request with
+   * `UCS_ERR_INVALID_PARAM` if the extension is not supported.
+   *
+   * @param[in] status the status of the header extension request that completed.
    */
-  void recvHeader();
+  void extensionCallback(ucs_status_t status);
 
   /**
    * @brief Send all header(s) and frame(s).
    *
    * Build header request(s) and send them, followed by requests to send all frame(s).
    *
+   * Host frames eligible for encoding according to `codecParams` are split in chunks,
+   * each chunk is encoded and sent before the next one is encoded, thus overlapping the
+   * encoding of a chunk with the transfer of the previous one.
+   *
+   * If deduplication is enabled on the endpoint, eligible host frames already cached by
+   * the receiver are replaced by a message containing only their fingerprint.
+   *
    * @throws std::length_error  if the lengths of `buffer`, `size` and `isCUDA` do not
    *                            match.
+   * @throws ucxx::Error        if `codecParams` are invalid.
    */
   void send(const std::vector<void*>& buffer,
             const std::vector<size_t>& size,
-            const std::vector<int>& isCUDA);
+            const std::vector<int>& isCUDA,
+            const CodecParams& codecParams);
+
+  /**
+   * @brief Receive all chunks of an encoded frame.
+   *
+   * Post requests to receive each of the encoded chunks of a frame, which are decoded by
+   * `decodeChunk()` upon completion into the host buffer of the frame.
+   *
+   * @param[in] buffer    the host buffer where the frame is decoded to.
+   * @param[in] chunkSize the size in bytes of each decoded chunk, except for the last.
+   */
+  void recvEncodedFrame(Buffer* buffer, const size_t chunkSize);
+
+  /**
+   * @brief Encode and send all chunks of a frame.
+   *
+   * Split the frame in chunks, encoding and posting the send of each chunk one at a time.
+   *
+   * @param[in] buffer      pointer to the frame to send.
+   * @param[in] size        the size in bytes of the frame.
+   * @param[in] codecParams parameters of the codec used to encode the frame.
+   */
+  void sendEncodedFrame(void* buffer, const size_t size, const CodecParams& codecParams);
+
+  /**
+   * @brief Decode a received chunk and mark it as completed.
+   *
+   * Decode a chunk of an encoded frame into its final location in `buffer`, release the
+   * intermediate buffer it was received into and mark the request as completed. Failure
+   * to receive or decode the chunk causes the multi-buffer request to complete with an
+   * error.
+   *
+   * @param[in] status  the status of the request that received the chunk.
+   * @param[in] request the `ucxx::BufferRequest` object containing the chunk.
+   * @param[in] buffer  the buffer where the decoded frame is stored.
+   * @param[in] offset  the offset in bytes of the chunk in the decoded frame.
+   * @param[in] length  the size in bytes of the decoded chunk.
+   */
+  void decodeChunk(ucs_status_t status,
+                   std::shared_ptr<void> request,
+                   Buffer* buffer,
+                   const size_t offset,
+                   const size_t length);
+
+  /**
+   * @brief Apply deduplication to received frames.
+   *
+   * Resolve frames replaced by references from the endpoint cache and store deduplicated
+   * frames in it, must be called only once all frames have completed.
+   *
+   * @returns `UCS_OK` if all references were resolved, `UCS_ERR_NO_ELEM` otherwise.
+   */
+  ucs_status_t applyDedup();
 
  public:
   /**
@@ -153,14 +287,19 @@ class RequestTagMulti : public std::enable_shared_from_this<RequestTagMulti> {
    * ensure the transfer has completed. Requires UCXX to be compiled with
    * `UCXX_ENABLE_PYTHON=1`.
    *
+   * Host frames may be encoded before transfer by specifying a codec in `codecParams`,
+   * see `ucxx::CodecParams` for details. The receiver decodes frames transparently.
+   * Host frames are also deduplicated if enabled with `ucxx::Endpoint::enableDedup()`.
+   *
    * @throws  std::runtime_error  if sizes of `buffer`, `size` and `isCUDA` do not match.
+   * @throws  ucxx::Error         if `codecParams` are invalid.
    *
    * @param[in] endpoint            the `std::shared_ptr<Endpoint>` parent component
    * @param[in] tag                 the tag to match.
    * @param[in] enablePythonFuture  whether a python future should be created and
    *                                subsequently notified.
-   * @param[in] callbackFunction    user-defined callback function to call upon completion.
-   * @param[in] callbackData        user-defined data to pass to the `callbackFunction`.
+   * @param[in] codecParams         parameters of the codec used to encode host frames.
+   * @param[in] sendMode            the completion semantics of the frame sends.
    *
    * @returns Request to be subsequently checked for the completion and its state.
    */
@@ -170,7 +309,9 @@ class RequestTagMulti : public std::enable_shared_from_this<RequestTagMulti> {
     const std::vector<size_t>& size,
     const std::vector<int>& isCUDA,
     const ucp_tag_t tag,
-    const bool enablePythonFuture);
+    const bool enablePythonFuture,
+    const CodecParams& codecParams,
+    const TagSendMode sendMode);
 
   /**
    * @brief Enqueue a multi-buffer tag receive operation.
@@ -198,6 +339,8 @@ class RequestTagMulti : public std::enable_shared_from_this<RequestTagMulti> {
   friend std::shared_ptr<RequestTagMulti> createRequestTagMultiRecv(
     std::shared_ptr<Endpoint> endpoint, const ucp_tag_t tag, const bool enablePythonFuture);
 
+  friend class TagMultiRecvStream;
+
   /**
    * @brief `ucxx::RequestTagMulti` destructor.
    *
@@ -214,11 +357,13 @@ class RequestTagMulti : public std::enable_shared_from_this<RequestTagMulti> {
    *
    * When this method is called, the request that completed will be pushed into a container
    * which will be later used to evaluate if all frames completed and set the final status
-   * of the multi-transfer request and the Python future, if enabled.
+   * of the multi-transfer request and the Python future, if enabled. The multi-transfer
+   * request completes with the status of the first request that failed, if any.
    *
+   * @param[in] status  the status of the request that completed.
    * @param[in] request the `ucxx::BufferRequest` object containing a single tag .
    */
-  void markCompleted(std::shared_ptr<void> request);
+  void markCompleted(ucs_status_t status, std::shared_ptr<void> request);
 
   /**
    * @brief Callback to submit request to receive new header or frames.
@@ -232,8 +377,23 @@ class RequestTagMulti : public std::enable_shared_from_this<RequestTagMulti> {
    * next incoming message(s) is(are) frame(s).
    *
    * @throws std::runtime_error if called by a send request.
+   *
+   * @param[in] status the status of the header request that completed, ignored if no
+   *                   requests have been posted yet.
+   */
+  void callback(ucs_status_t status = UCS_OK);
+
+  /**
+   * @brief Cancel a multi-buffer tag receive request waiting for its header.
+   *
+   * Cancel the receive of the header the request is waiting for, or of the next header
+   * of a multi-header transfer if posted after this call, completing the request with
+   * `UCS_ERR_CANCELED`. Once all headers have been received the frames are already on
+   * their way, and the request is left to complete normally.
+   *
+   * @throws std::runtime_error if called by a send request.
    */
-  void callback();
+  void cancel();
 
   /**
    * @brief Return the status of the request.
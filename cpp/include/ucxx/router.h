@@ -0,0 +1,271 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <ucxx/bootstrap.h>
+#include <ucxx/context.h>
+#include <ucxx/endpoint.h>
+#include <ucxx/typedefs.h>
+#include <ucxx/worker.h>
+
+namespace ucxx {
+
+/**
+ * @brief Locality of a peer relative to this process.
+ */
+enum class Locality {
+  IntraNode = 0,  ///< Peer runs on the same host, reached through shared memory transports
+  InterNode,      ///< Peer runs on another host, reached through network transports
+};
+
+/**
+ * @brief Parameters of a locality-aware router.
+ *
+ * Parameters of the context/worker pairs of a `ucxx::Router`. The UCX configuration of
+ * each pair only needs to be tuned for its own class of peers, for example restricting
+ * `TLS` or setting shared memory or network-specific thresholds.
+ */
+struct RouterParams {
+  ConfigMap intraNodeConfig{{"TLS", "sm,self"}};        ///< UCX configuration, intra-node pair
+  ConfigMap interNodeConfig{{"TLS", "^sm"}};            ///< UCX configuration, inter-node pair
+  uint64_t featureFlags{Context::defaultFeatureFlags};  ///< Feature flags of both contexts
+  bool enableDelayedSubmission{false};                  ///< Delayed submission on both workers
+  std::string hostId{};                                 ///< Host identifier, detected if empty
+};
+
+/**
+ * @brief Statistics of the endpoints of one locality of a router.
+ */
+struct RouterLocalityStats {
+  size_t endpoints{0};       ///< Number of endpoints created
+  size_t aliveEndpoints{0};  ///< Number of endpoints still referenced and alive
+};
+
+/**
+ * @brief Statistics of a locality-aware router.
+ */
+struct RouterStats {
+  RouterLocalityStats intraNode{};  ///< Statistics of endpoints to co-located peers
+  RouterLocalityStats interNode{};  ///< Statistics of endpoints to remote peers
+};
+
+/**
+ * @brief Router of endpoints between intra-node and inter-node context/worker pairs.
+ *
+ * With a single context and worker, co-located and remote peers share the same UCX
+ * configuration and the same progress thread, thus tuning transports for one class of
+ * peers penalizes the other. A router keeps two context/worker pairs, one tuned for
+ * shared memory transports and one for network transports, and publishes a router
+ * address made of the host identifier and the worker addresses of both pairs. When
+ * connecting to a peer, the router compares the host identifier in the peer's router
+ * address with its own and creates the endpoint from the worker of the matching pair.
+ *
+ * The host identifier is derived from the hostname and the boot identifier of the
+ * kernel, and may be overridden with `RouterParams::hostId`, for example when peers in
+ * different containers of the same host cannot share memory.
+ *
+ * @code{.cpp}
+ * ucxx::Router router;
+ * ucxx::FileBootstrapBackend backend("/shared/bootstrap", "job-1234.0");
+ * auto endpoints = ucxx::bootstrapRouterEndpoints(router, backend, rank, worldSize);
+ * router.startProgressThreads();
+ * @endcode
+ */
+class Router {
+ private:
+  RouterParams _params{};                               ///< Router parameters
+  std::string _hostId{};                                ///< Identifier of this host
+  std::array<std::shared_ptr<Context>, 2> _contexts{};  ///< Context by locality
+  std::array<std::shared_ptr<Worker>, 2> _workers{};    ///< Worker by locality
+  std::array<std::vector<std::weak_ptr<Endpoint>>, 2>
+    _endpoints{};                          ///< Endpoints by locality
+  std::array<size_t, 2> _endpointCount{};  ///< Number of endpoints created by locality
+  std::mutex _mutex{};                     ///< Mutex to access endpoints
+  bool _progressThreads{false};            ///< Whether progress threads were started
+
+  /**
+   * @brief Parsed router address of a peer.
+   */
+  struct PeerAddress {
+    std::string hostId{};                        ///< Host identifier of the peer
+    std::array<std::string, 2> workerAddress{};  ///< Worker address of the peer by locality
+  };
+
+  /**
+   * @brief Parse the router address of a peer.
+   *
+   * @throws ucxx::Error if `address` is malformed.
+   *
+   * @param[in] address the router address obtained from `getAddress()` on the peer.
+   *
+   * @returns the parsed router address.
+   */
+  static PeerAddress parseAddress(const std::string& address);
+
+ public:
+  /**
+   * @brief Constructor of a locality-aware router.
+   *
+   * Construct a router, creating the intra-node and inter-node context/worker pairs.
+   *
+   * @throws ucxx::Error if either context or worker could not be created.
+   *
+   * @param[in] params  the router parameters.
+   */
+  explicit Router(const RouterParams& params = {});
+
+  Router(const Router&)            = delete;
+  Router& operator=(Router const&) = delete;
+  Router(Router&& o)               = delete;
+  Router& operator=(Router&& o)    = delete;
+
+  /**
+   * @brief Destructor of a locality-aware router, stopping progress threads if running.
+   */
+  ~Router();
+
+  /**
+   * @brief Get the identifier of the local host.
+   *
+   * Get an identifier of the local host derived from its hostname and the boot
+   * identifier of the running kernel, processes returning the same identifier can reach
+   * each other through shared memory.
+   *
+   * @returns the identifier of the local host.
+   */
+  static std::string getLocalHostId();
+
+  /**
+   * @brief Get the host identifier of this router.
+   *
+   * @returns the host identifier published in the router address.
+   */
+  const std::string& getHostId() const;
+
+  /**
+   * @brief Get the context of a locality.
+   *
+   * @param[in] locality  the locality.
+   *
+   * @returns the context of the context/worker pair of `locality`.
+   */
+  std::shared_ptr<Context> getContext(const Locality locality) const;
+
+  /**
+   * @brief Get the worker of a locality.
+   *
+   * @param[in] locality  the locality.
+   *
+   * @returns the worker of the context/worker pair of `locality`.
+   */
+  std::shared_ptr<Worker> getWorker(const Locality locality) const;
+
+  /**
+   * @brief Get the router address.
+   *
+   * Get the router address to be exchanged with peers, for example through a
+   * `ucxx::BootstrapBackend`, made of the host identifier and the worker addresses of
+   * both pairs.
+   *
+   * @returns the serialized router address.
+   */
+  std::string getAddress() const;
+
+  /**
+   * @brief Get the locality of a peer.
+   *
+   * @throws ucxx::Error if `peerAddress` is malformed.
+   *
+   * @param[in] peerAddress the router address obtained from `getAddress()` on the peer.
+   *
+   * @returns `ucxx::Locality::IntraNode` if the peer has the same host identifier,
+   *          `ucxx::Locality::InterNode` otherwise.
+   */
+  Locality getLocality(const std::string& peerAddress) const;
+
+  /**
+   * @brief Create an endpoint to a peer.
+   *
+   * Create an endpoint to a peer from the worker of the pair matching the locality of
+   * the peer, connecting to the worker of the same pair of the peer.
+   *
+   * @throws ucxx::Error if `peerAddress` is malformed or the endpoint could not be
+   *                     created.
+   *
+   * @param[in] peerAddress           the router address obtained from `getAddress()` on
+   *                                  the peer.
+   * @param[in] endpointErrorHandling whether to enable endpoint error handling.
+   *
+   * @returns the endpoint to the peer.
+   */
+  std::shared_ptr<Endpoint> createEndpoint(const std::string& peerAddress,
+                                           const bool endpointErrorHandling = true);
+
+  /**
+   * @brief Progress both workers once.
+   *
+   * Progress the workers of both pairs, for use when no progress threads are running.
+   *
+   * @returns `true` if any communication was progressed, `false` otherwise.
+   */
+  bool progress();
+
+  /**
+   * @brief Start a progress thread for each worker.
+   *
+   * Start one progress thread per worker, so that intra-node and inter-node traffic are
+   * progressed independently.
+   *
+   * @param[in] pollingMode whether the threads progress in polling mode.
+   */
+  void startProgressThreads(const bool pollingMode = false);
+
+  /**
+   * @brief Stop the progress threads of both workers.
+   */
+  void stopProgressThreads();
+
+  /**
+   * @brief Get the router statistics.
+   *
+   * @returns the statistics of the endpoints of both localities.
+   */
+  RouterStats getStats();
+};
+
+/**
+ * @brief Connect a router to all ranks of a job.
+ *
+ * Publish the router address through `backend`, fetch the router addresses of all ranks
+ * and create an endpoint to each other rank from the pair matching its locality.
+ *
+ * @throws ucxx::Error if not all addresses were fetched within `timeout`.
+ *
+ * @param[in] router                the router to publish and create endpoints from.
+ * @param[in] backend               the bootstrap backend.
+ * @param[in] rank                  the rank of this process.
+ * @param[in] worldSize             the number of ranks.
+ * @param[in] timeout               the maximum time to wait for all ranks.
+ * @param[in] endpointErrorHandling whether to enable endpoint error handling.
+ *
+ * @returns the endpoints to all ranks indexed by rank, `nullptr` at index `rank`.
+ */
+std::vector<std::shared_ptr<Endpoint>> bootstrapRouterEndpoints(
+  Router& router,
+  BootstrapBackend& backend,
+  const size_t rank,
+  const size_t worldSize,
+  const std::chrono::milliseconds timeout = std::chrono::seconds(60),
+  const bool endpointErrorHandling        = true);
+
+}  // namespace ucxx
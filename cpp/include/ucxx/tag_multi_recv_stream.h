@@ -0,0 +1,206 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#pragma once
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/component.h>
+#include <ucxx/endpoint.h>
+#include <ucxx/future.h>
+#include <ucxx/request_tag_multi.h>
+
+namespace ucxx {
+
+/**
+ * @brief A user-defined function called with each message received by a stream.
+ */
+typedef std::function<void(std::shared_ptr<RequestTagMulti>)> TagMultiRecvStreamCallback;
+
+/**
+ * @brief A persistent multi-buffer tag receive stream.
+ *
+ * A stream keeps a multi-buffer tag receive posted on an endpoint and tag at all times.
+ * As soon as the receives of all frames of a message have been posted, the receive of the
+ * next message's header is posted, so that headers are matched by a posted receive
+ * instead of being queued as unexpected messages and copied out of the unexpected queue.
+ *
+ * Messages are delivered in the order they were sent, either to a callback, called from
+ * the thread progressing the worker, or to a queue drained with `pop()`. Each delivered
+ * message is a completed `ucxx::RequestTagMulti` whose status must be checked before
+ * consuming its buffers. A message whose header fails to be received stops the stream,
+ * as no subsequent header is posted.
+ */
+class TagMultiRecvStream : public Component {
+ private:
+  ucp_tag_t _tag{0};                                       ///< Tag to match
+  TagMultiRecvStreamCallback _callback{nullptr};           ///< Callback to deliver messages to
+  std::mutex _mutex{};                                     ///< Mutex to access the state below
+  std::deque<std::shared_ptr<RequestTagMulti>> _posted{};  ///< Posted messages, in order
+  std::deque<std::shared_ptr<RequestTagMulti>> _queue{};   ///< Messages not yet popped
+  size_t _pendingArms{0};                                  ///< Header receives to be posted
+  bool _arming{false};                                     ///< Whether a thread is posting
+  bool _delivering{false};                                 ///< Whether a thread is delivering
+  size_t _received{0};                                     ///< Number of messages delivered
+  std::atomic<bool> _closed{false};                        ///< Whether the stream was closed
+  std::shared_ptr<Future> _future{nullptr};                ///< Notified when messages are queued
+
+  /**
+   * @brief Private constructor of `ucxx::TagMultiRecvStream`.
+   *
+   * This is the internal implementation of `ucxx::TagMultiRecvStream` constructor, made
+   * private not to be called directly. This constructor is made private to ensure all
+   * UCXX objects are shared pointers and the correct lifetime management of each one.
+   *
+   * Instead the user should use one of the following:
+   *
+   * - `ucxx::createTagMultiRecvStream()`
+   *
+   * @param[in] endpoint  the endpoint to receive messages from.
+   * @param[in] tag       the tag to match.
+   * @param[in] callback  function messages are delivered to, or `nullptr` to queue them.
+   */
+  TagMultiRecvStream(std::shared_ptr<Endpoint> endpoint,
+                     const ucp_tag_t tag,
+                     TagMultiRecvStreamCallback callback);
+
+  /**
+   * @brief Post the receive of the next message.
+   *
+   * Post the receive of the next message's header. Called when the stream is created and
+   * each time all frames of the last message posted have been posted, re-entrant calls
+   * are deferred to the thread already posting, preserving the order of messages.
+   */
+  void arm();
+
+  /**
+   * @brief Deliver completed messages.
+   *
+   * Deliver, in order, all messages that completed before the oldest message that is
+   * still in progress.
+   */
+  void deliver();
+
+ public:
+  TagMultiRecvStream()                                     = delete;
+  TagMultiRecvStream(const TagMultiRecvStream&)            = delete;
+  TagMultiRecvStream& operator=(TagMultiRecvStream const&) = delete;
+  TagMultiRecvStream(TagMultiRecvStream&& o)               = delete;
+  TagMultiRecvStream& operator=(TagMultiRecvStream&& o)    = delete;
+
+  /**
+   * @brief Constructor of `shared_ptr<ucxx::TagMultiRecvStream>`.
+   *
+   * Create a multi-buffer tag receive stream on an endpoint and post the receive of the
+   * first message. Only one stream, and no other multi-buffer tag receive, should be
+   * used at a time for the same endpoint and tag.
+   *
+   * @code{.cpp}
+   * // endpoint is `std::shared_ptr<ucxx::Endpoint>`
+   * auto stream = ucxx::createTagMultiRecvStream(endpoint, tag);
+   * while (auto message = stream->pop()) {
+   *   message->checkError();
+   *   // Consume `message->_bufferRequests`
+   * }
+   * @endcode
+   *
+   * @throws ucxx::Error if the endpoint is not initialized.
+   *
+   * @param[in] endpoint  the endpoint to receive messages from.
+   * @param[in] tag       the tag to match.
+   * @param[in] callback  function messages are delivered to, or `nullptr` to queue them
+   *                      for `pop()`.
+   *
+   * @returns The `shared_ptr<ucxx::TagMultiRecvStream>` object.
+   */
+  friend std::shared_ptr<TagMultiRecvStream> createTagMultiRecvStream(
+    std::shared_ptr<Endpoint> endpoint, const ucp_tag_t tag, TagMultiRecvStreamCallback callback);
+
+  /**
+   * @brief Destructor of `ucxx::TagMultiRecvStream`, closing the stream.
+   */
+  ~TagMultiRecvStream();
+
+  /**
+   * @brief Get the endpoint the stream receives from.
+   *
+   * @returns the endpoint the stream receives from.
+   */
+  std::shared_ptr<Endpoint> getEndpoint() const;
+
+  /**
+   * @brief Get the tag the stream matches.
+   *
+   * @returns the tag the stream matches.
+   */
+  ucp_tag_t getTag() const;
+
+  /**
+   * @brief Pop the oldest message delivered to the queue.
+   *
+   * Pop the oldest message that was delivered and not yet popped, always `nullptr` if the
+   * stream was created with a callback. The worker must be progressed for messages to be
+   * delivered.
+   *
+   * @returns the oldest completed message, or `nullptr` if none.
+   */
+  std::shared_ptr<RequestTagMulti> pop();
+
+  /**
+   * @brief Get the number of messages delivered to the queue and not yet popped.
+   *
+   * @returns the number of messages available to `pop()`.
+   */
+  size_t getQueuedCount();
+
+  /**
+   * @brief Get a future notified when a message is available to `pop()`.
+   *
+   * Get the handle of a future notified as soon as a message is delivered to the queue or
+   * the stream is closed, allowing a consumer to wait for messages without polling
+   * `pop()`. The same future is returned until it is notified, after which a new one is
+   * acquired by the next call. Requires a worker supporting futures, such as the Python
+   * worker.
+   *
+   * @throws std::runtime_error if the worker does not support futures.
+   *
+   * @returns the handle of the future, or `nullptr` if a message is already available or
+   *          the stream was closed, in which case there is nothing to wait for.
+   */
+  void* getFuture();
+
+  /**
+   * @brief Get the number of messages delivered.
+   *
+   * @returns the number of messages delivered to the callback or to the queue.
+   */
+  size_t getReceivedCount();
+
+  /**
+   * @brief Check whether the stream was closed.
+   *
+   * @returns `true` if the stream was closed, `false` otherwise.
+   */
+  bool isClosed() const;
+
+  /**
+   * @brief Close the stream.
+   *
+   * Stop posting receives and cancel the receive of the next message's header. Messages
+   * whose frames are already being received still complete and are delivered, messages
+   * canceled are not. Closing a stream that was already closed is a no-op.
+   *
+   * As for any `ucxx::RequestTagMulti`, the stream must not be destroyed while the frames
+   * of a message are still being received.
+   */
+  void close();
+};
+
+}  // namespace ucxx
@@ -4,9 +4,15 @@
  */
 #pragma once
 
+#include <cstddef>
 #include <functional>
+#include <memory>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
+#include <utility>
+
+#include <ucp/api/ucp.h>
 
 namespace ucxx {
 
@@ -32,4 +38,101 @@ typedef enum {
 
 typedef std::unordered_map<std::string, std::string> ConfigMap;
 
+/**
+ * @brief A user-defined function to execute upon completion of a `ucxx::Request`.
+ *
+ * Wraps either a function receiving only the user-defined data registered alongside it,
+ * `void(std::shared_ptr<void>)`, or a status-aware function also receiving the final
+ * status of the request, `void(ucs_status_t, std::shared_ptr<void>)`. Both are accepted
+ * by every submission API, the status is simply not passed to the former.
+ */
+class RequestCallbackUserFunction {
+ private:
+  std::function<void(ucs_status_t, std::shared_ptr<void>)> _function{
+    nullptr};  ///< The wrapped function, adapted to receive the status
+
+ public:
+  RequestCallbackUserFunction() = default;
+
+  /**
+   * @brief Construct an empty user-defined function.
+   */
+  RequestCallbackUserFunction(std::nullptr_t) {}
+
+  /**
+   * @brief Wrap a user-defined function.
+   *
+   * Wrap a callable receiving `(ucs_status_t, std::shared_ptr<void>)` or
+   * `(std::shared_ptr<void>)`. Empty callables, such as a default-constructed
+   * `std::function`, result in an empty user-defined function.
+   *
+   * @param[in] function  the callable to wrap.
+   */
+  template <typename Function,
+            typename = std::enable_if_t<
+              !std::is_same_v<std::decay_t<Function>, RequestCallbackUserFunction> &&
+              (std::is_invocable_v<Function&, ucs_status_t, std::shared_ptr<void>> ||
+               std::is_invocable_v<Function&, std::shared_ptr<void>>)>>
+  RequestCallbackUserFunction(Function function)
+  {
+    if constexpr (std::is_constructible_v<bool, const Function&>) {
+      if (!static_cast<bool>(function)) return;
+    }
+
+    if constexpr (std::is_invocable_v<Function&, ucs_status_t, std::shared_ptr<void>>) {
+      _function = std::move(function);
+    } else {
+      _function = [function = std::move(function)](ucs_status_t,
+                                                   std::shared_ptr<void> data) mutable {
+        function(std::move(data));
+      };
+    }
+  }
+
+  /**
+   * @brief Call the user-defined function.
+   *
+   * @param[in] status  the final status of the request.
+   * @param[in] data    the user-defined data registered alongside the function.
+   */
+  void operator()(ucs_status_t status, std::shared_ptr<void> data) const
+  {
+    _function(status, std::move(data));
+  }
+
+  /**
+   * @brief Check whether a user-defined function is set.
+   *
+   * @returns `true` if a function is set, `false` otherwise.
+   */
+  explicit operator bool() const noexcept { return static_cast<bool>(_function); }
+
+  /**
+   * @brief Get a pointer to the wrapped target, as `std::function::target()`.
+   *
+   * @returns the pointer to the wrapped target if of type `T`, `nullptr` otherwise.
+   */
+  template <typename T>
+  const T* target() const noexcept
+  {
+    return _function.template target<T>();
+  }
+};
+
+/**
+ * @brief Data for the user-defined function passed to `ucxx::RequestCallbackUserFunction`.
+ */
+typedef std::shared_ptr<void> RequestCallbackUserData;
+
+/**
+ * @brief Completion semantics of tag send operations.
+ *
+ * A `Standard` send completes as soon as the send buffer may be reused, which does not
+ * imply the message was received. A `Sync` send, submitted with `ucp_tag_send_sync_nbx`,
+ * completes only after the message was matched by a receive at the remote end, allowing
+ * the sender to know the message was delivered without an application-level
+ * acknowledgement.
+ */
+enum class TagSendMode { Standard = 0, Sync };
+
 }  // namespace ucxx
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <cstdio>
+#include <functional>
 #include <string>
 
 namespace ucxx {
@@ -34,6 +35,20 @@ FILE* createTextFileDescriptor();
  */
 std::string decodeTextFileDescriptor(FILE* textFileDescriptor);
 
+/**
+ * @brief Capture text printed to a file descriptor.
+ *
+ * Call `print` with an in-memory file descriptor and return the text written to it,
+ * avoiding the filesystem I/O of `createTextFileDescriptor()`.
+ *
+ * @throws std::ios_base::failure if creating the in-memory file descriptor fails.
+ *
+ * @param[in] print function writing text to the file descriptor it is passed.
+ *
+ * @returns The string with a copy of the text written by `print`.
+ */
+std::string captureTextFileDescriptor(std::function<void(FILE*)> print);
+
 }  // namespace utils
 
 }  // namespace ucxx
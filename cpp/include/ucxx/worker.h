@@ -4,12 +4,23 @@
  */
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
 #include <functional>
+#include <future>
 #include <memory>
 #include <mutex>
+#include <new>
 #include <queue>
+#include <shared_mutex>
 #include <string>
 #include <thread>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <ucp/api/ucp.h>
 
@@ -17,8 +28,10 @@
 #include <ucxx/constructors.h>
 #include <ucxx/context.h>
 #include <ucxx/delayed_submission.h>
+#include <ucxx/expected.h>
 #include <ucxx/future.h>
 #include <ucxx/inflight_requests.h>
+#include <ucxx/io_uring.h>
 #include <ucxx/notifier.h>
 #include <ucxx/worker_progress_thread.h>
 
@@ -28,9 +41,56 @@ class Address;
 class Endpoint;
 class Listener;
 
+/**
+ * @brief Backend used to wait for worker events in blocking progress mode.
+ */
+enum class ProgressBackend {
+  Epoll = 0,  ///< Wait with `epoll_wait`
+  IoUring,    ///< Wait with io_uring, also executing file I/O submitted to the worker
+};
+
+/**
+ * @brief Pool of futures acquired by a single thread.
+ *
+ * Each thread submitting requests acquires futures from its own pool, so that threads
+ * do not contend with each other for futures. The mutex is only contended when the pool
+ * is being refilled by another thread. A pool is marked as exited when its thread exits,
+ * and released by the next refill of the worker's pools.
+ */
+struct FuturesPool {
+  std::mutex mutex{};                             ///< Mutex to access the futures
+  std::queue<std::shared_ptr<Future>> futures{};  ///< Fresh futures ready to be acquired
+  std::atomic<bool> exited{false};                ///< Whether the owning thread exited
+};
+
+/**
+ * @brief Report of unexpected tag messages drained by a worker.
+ */
+struct WorkerDrainReport {
+  size_t messages{0};                   ///< Number of unexpected tag messages drained
+  size_t bytes{0};                      ///< Total size of the messages drained
+  size_t canceled{0};                   ///< Receives canceled when the time bound elapsed
+  bool skipped{false};                  ///< Whether draining was skipped altogether
+  bool timedOut{false};                 ///< Whether the time bound elapsed
+  std::chrono::nanoseconds elapsed{0};  ///< Time spent draining
+};
+
+/**
+ * @brief Parameters controlling the teardown of a worker.
+ */
+struct WorkerTeardownParams {
+  bool drainTagRecv{true};  ///< Whether to drain unexpected tag messages before destroying
+  std::chrono::milliseconds drainTimeout{
+    std::chrono::seconds(1)};        ///< Maximum time spent draining unexpected tag messages
+  size_t maxInflightReceives{1024};  ///< Maximum number of drain receives posted in parallel
+  std::function<void(const WorkerDrainReport&)> reportCallback{
+    nullptr};  ///< Callback receiving the drain report when the worker is destroyed
+};
+
 class Worker : public Component {
  private:
   ucp_worker_h _handle{nullptr};        ///< The UCP worker handle
+  bool _enableWakeup{false};            ///< Whether the context supports `UCP_FEATURE_WAKEUP`
   int _epollFileDescriptor{-1};         ///< The epoll file descriptor
   int _workerFileDescriptor{-1};        ///< The worker file descriptor
   std::mutex _inflightRequestsMutex{};  ///< Mutex to access the inflight requests pool
@@ -46,25 +106,31 @@ class Worker : public Component {
   void* _progressThreadStartCallbackArg{
     nullptr};  ///< The argument to be passed to the progress thread start callback
   std::shared_ptr<DelayedSubmissionCollection> _delayedSubmissionCollection{
-    nullptr};  ///< Collection of enqueued delayed submissions
+    nullptr};                                  ///< Collection of enqueued delayed submissions
+  WorkerTeardownParams _teardownParams{};      ///< Parameters controlling the worker teardown
+  std::unique_ptr<IoUring> _ioUring{nullptr};  ///< The io_uring used as progress backend
+  std::vector<std::pair<void*, std::shared_ptr<std::vector<char>>>>
+    _drainCanceled{};  ///< Canceled drain receives not yet completed, with their buffers
+
+  std::mutex _endpointInflightRequestsMutex{};           ///< Mutex to access endpoints' requests
+  std::vector<std::weak_ptr<InflightRequests>>
+    _endpointInflightRequests{};  ///< Inflight requests of endpoints created from the worker
+  size_t _endpointInflightRequestsPruneSize{64};         ///< Size to prune expired endpoints at
+  std::mutex _inflightWatchdogControlMutex{};            ///< Serializes watchdog start and stop
+  std::mutex _inflightWatchdogMutex{};                   ///< Mutex to access the watchdog state
+  std::condition_variable _inflightWatchdogCondition{};  ///< Wakes the watchdog up to stop it
+  bool _inflightWatchdogStop{false};                     ///< Whether the watchdog should stop
+  std::thread _inflightWatchdogThread{};                 ///< The inflight requests watchdog
 
  protected:
   bool _enableFuture{
     false};  ///< Boolean identifying whether the worker was created with future capability
-  std::mutex _futuresPoolMutex{};  ///< Mutex to access the futures pool
-  std::queue<std::shared_ptr<Future>>
-    _futuresPool{};  ///< Futures pool to prevent running out of fresh futures
+  std::shared_mutex _futuresPoolsMutex{};  ///< Mutex to access the per-thread futures pools
+  std::unordered_map<std::thread::id, std::shared_ptr<FuturesPool>>
+    _futuresPools{};  ///< Per-thread futures pools to prevent running out of fresh futures
   std::shared_ptr<Notifier> _notifier{nullptr};  ///< Notifier object
 
  private:
-  /**
-   * @brief Drain the worker for uncaught tag messages received.
-   *
-   * Called by the destructor, any uncaught tag messages received will be drained so as
-   * not to generate UCX warnings.
-   */
-  void drainWorkerTagRecv();
-
   /**
    * @brief Stop the progress thread if running without raising warnings.
    *
@@ -83,6 +149,36 @@ class Worker : public Component {
    */
   void registerInflightRequest(std::shared_ptr<Request> request);
 
+  /**
+   * @brief Get the description of pending inflight requests older than a minimum age.
+   *
+   * Get the description of inflight requests submitted by the worker and by all endpoints
+   * created from it that have been pending for at least `minAge`, in no particular order.
+   *
+   * @param[in] minAge  the minimum age of requests to describe.
+   *
+   * @returns the description of the requests.
+   */
+  std::vector<InflightRequestInfo> collectInflightRequestsInfo(
+    const std::chrono::milliseconds minAge);
+
+  /**
+   * @brief Format a report of the oldest inflight requests.
+   *
+   * Format a report of the `maxRequests` oldest requests in `info`, grouped by owner and
+   * tag, each group with its number of requests, operations, total length and the age of
+   * its oldest request. Groups are listed from the oldest request to the newest.
+   *
+   * @param[in] info        the description of the inflight requests to report.
+   * @param[in] maxRequests the maximum number of requests to report, `0` for all.
+   * @param[in] minAge      the minimum age used to select `info`, to print in the header.
+   *
+   * @returns the formatted report.
+   */
+  std::string formatInflightRequestsReport(std::vector<InflightRequestInfo> info,
+                                           const size_t maxRequests,
+                                           const std::chrono::milliseconds minAge);
+
   /**
    * @brief Progress the worker until all communication events are completed.
    *
@@ -144,9 +240,49 @@ class Worker : public Component {
 
   /**
    * @brief `ucxx::Worker` destructor.
+   *
+   * Cancel inflight requests, stop the progress and notifier threads, drain unexpected tag
+   * messages as configured with `setTeardownParams()` and destroy the UCP worker.
    */
   virtual ~Worker();
 
+  /**
+   * @brief Set the parameters controlling the worker teardown.
+   *
+   * Set the parameters used when the worker is destroyed. Draining unexpected tag messages
+   * prevents UCX warnings about unreleased messages, but may take long if the worker holds
+   * many of them. Draining is bounded by `drainTimeout` and may be skipped altogether, in
+   * which case UCX releases the messages when the worker is destroyed.
+   *
+   * @code{.cpp}
+   * // worker is `std::shared_ptr<ucxx::Worker>`
+   * worker->setTeardownParams({.drainTagRecv = true,
+   *                            .drainTimeout = std::chrono::milliseconds(100),
+   *                            .reportCallback = [](const ucxx::WorkerDrainReport& report) {
+   *                              std::cout << report.messages << std::endl;
+   *                            }});
+   * @endcode
+   *
+   * @param[in] params  the teardown parameters.
+   */
+  void setTeardownParams(const WorkerTeardownParams& params);
+
+  /**
+   * @brief Drain the worker for uncaught tag messages received.
+   *
+   * Receive and discard all uncaught tag messages, posting up to `maxInflightReceives`
+   * receives in parallel into a scratch buffer allocated for each call. Draining stops
+   * once `drainTimeout` elapses, even if peers keep sending messages, and receives still
+   * inflight at that point are canceled, as they may still write to the
+   * scratch buffer it is kept alive until they complete, which is checked by subsequent
+   * calls, or until the worker is destroyed. Called by the destructor unless
+   * `drainTagRecv` is `false`, may also be called explicitly, for example before
+   * destroying the worker, but not concurrently with other calls.
+   *
+   * @returns The report of the messages drained.
+   */
+  WorkerDrainReport drainWorkerTagRecv();
+
   /**
    * @brief Get the underlying `ucp_worker_h` handle.
    *
@@ -199,10 +335,29 @@ class Worker : public Component {
    * // All events have been progressed.
    * @endcode
    *
+   * With `ucxx::ProgressBackend::IoUring` the worker waits for events through an io_uring
+   * instead of epoll, which also executes file I/O submitted with `submitFileRead()` and
+   * `submitFileWrite()`, batching wakeups and file I/O in the same system calls. If
+   * io_uring is not available, see `ucxx::IoUring::isAvailable()`, a warning is logged and
+   * epoll is used instead. The backend is chosen by the first successful call only,
+   * subsequent calls return immediately, while a failed call may be retried.
+   *
+   * @throws ucxx::Error            if the context was created without `UCP_FEATURE_WAKEUP`,
+   *                                for example with `ucxx::ContextProfile::PollingOnly`.
    * @throws std::ios_base::failure if creating any of the file descriptors or setting their
    *                                statuses.
+   *
+   * @param[in] backend the backend used to wait for worker events.
    */
-  void initBlockingProgressMode();
+  void initBlockingProgressMode(const ProgressBackend backend = ProgressBackend::Epoll);
+
+  /**
+   * @brief Get the backend used to wait for worker events.
+   *
+   * @returns the backend used in blocking progress mode, `ucxx::ProgressBackend::Epoll` if
+   *          blocking progress mode is not initialized.
+   */
+  ProgressBackend getProgressBackend() const;
 
   /**
    * @brief Arm the UCP worker.
@@ -216,6 +371,16 @@ class Worker : public Component {
    */
   bool arm();
 
+  /**
+   * @brief Arm the UCP worker, without throwing.
+   *
+   * Exception-free variant of `arm()`.
+   *
+   * @returns `UCS_OK` if worker was armed successfully, `UCS_ERR_BUSY` if there are
+   *          unprocessed events, or the status of the failure otherwise.
+   */
+  ucs_status_t arm(std::nothrow_t) noexcept;
+
   /**
    * @brief Progress worker event while in blocking progress mode.
    *
@@ -281,6 +446,15 @@ class Worker : public Component {
    */
   void signal();
 
+  /**
+   * @brief Signal the worker that an event happened, without throwing.
+   *
+   * Exception-free variant of `signal()`.
+   *
+   * @returns `UCS_OK` if the worker was signaled, or the status of the failure otherwise.
+   */
+  ucs_status_t signal(std::nothrow_t) noexcept;
+
   /**
    * @brief Block until an event has happened, then progresses.
    *
@@ -304,6 +478,22 @@ class Worker : public Component {
    */
   bool waitProgress();
 
+  /**
+   * @brief Block until an event has happened, then progresses, without throwing.
+   *
+   * Exception-free variant of `waitProgress()`.
+   *
+   * @code{.cpp}
+   * // worker is `std::shared_ptr<ucxx::Worker>`
+   * auto progressed = worker->waitProgress(std::nothrow);
+   * if (!progressed) return progressed.getStatus();
+   * @endcode
+   *
+   * @returns `true` if any communication was progressed, `false` otherwise, or the status
+   *          of the failure.
+   */
+  Expected<bool> waitProgress(std::nothrow_t) noexcept;
+
   /**
    * @brief Progress the worker only once.
    *
@@ -353,6 +543,184 @@ class Worker : public Component {
    */
   void registerDelayedSubmission(DelayedSubmissionCallbackType callback);
 
+  /**
+   * @brief Register delayed submission of an operation returning a result.
+   *
+   * Register an arbitrary operation, such as creating or closing an endpoint, for delayed
+   * submission, returning a future to its result. When the `ucxx::Worker` is created with
+   * `enableDelayedSubmission=true`, the operation is executed by the worker progress
+   * thread, otherwise it is executed immediately and the future is ready upon return.
+   * Exceptions raised by the operation are rethrown by `std::future::get()`.
+   *
+   * Note that when delayed submission is enabled the progress thread must be running for
+   * the operation to ever be executed.
+   *
+   * @code{.cpp}
+   * // worker is `std::shared_ptr<ucxx::Worker>`
+   * auto future = worker->registerDelayedSubmissionFuture<int>([]() { return 42; });
+   * int result  = future.get();
+   * @endcode
+   *
+   * @param[in] callback the operation to execute during the worker thread loop.
+   *
+   * @returns The future to the result of `callback`.
+   */
+  template <typename T>
+  std::future<T> registerDelayedSubmissionFuture(std::function<T()> callback)
+  {
+    auto promise = std::make_shared<std::promise<T>>();
+    auto future  = promise->get_future();
+
+    registerDelayedSubmission([promise, callback]() {
+      try {
+        if constexpr (std::is_void_v<T>) {
+          callback();
+          promise->set_value();
+        } else {
+          promise->set_value(callback());
+        }
+      } catch (...) {
+        promise->set_exception(std::current_exception());
+      }
+    });
+
+    return future;
+  }
+
+  /**
+   * @brief Inquire if worker has been created with delayed submission enabled.
+   *
+   * Check whether the worker has been created with delayed submission enabled.
+   *
+   * @returns `true` if delayed submission is enabled, `false` otherwise.
+   */
+  bool isDelayedSubmissionEnabled() const;
+
+  /**
+   * @brief Set the delayed submission policy.
+   *
+   * With `ucxx::DelayedSubmissionPolicy::Always`, the default, every request is delayed to
+   * the next iteration of the progress thread. With `ucxx::DelayedSubmissionPolicy::Adaptive`
+   * a request is submitted immediately by the calling thread if it already holds the
+   * worker, such as completion callbacks running while the worker is progressed, or if
+   * `isDirectSubmissionAllowed()`, no thread is progressing the worker nor executing
+   * submissions, and no submission is pending, and is delayed otherwise. The worker is
+   * not held while the progress thread blocks waiting for events, so immediate submission
+   * removes the latency of waking the progress thread on quiet workers, while submissions
+   * contending with progress keep being offloaded.
+   *
+   * @throws ucxx::Error if the worker was created with delayed submission disabled.
+   *
+   * @param[in] policy  the policy deciding when requests are delayed.
+   */
+  void setDelayedSubmissionPolicy(const DelayedSubmissionPolicy policy);
+
+  /**
+   * @brief Get the delayed submission policy.
+   *
+   * @throws ucxx::Error if the worker was created with delayed submission disabled.
+   *
+   * @returns the policy deciding when requests are delayed.
+   */
+  DelayedSubmissionPolicy getDelayedSubmissionPolicy() const;
+
+  /**
+   * @brief Get the statistics of delayed submissions.
+   *
+   * Get the number of requests submitted immediately and of requests delayed to the
+   * progress thread, both zero if delayed submission is disabled.
+   *
+   * @returns the statistics of delayed submissions.
+   */
+  DelayedSubmissionStats getDelayedSubmissionStats() const;
+
+  /**
+   * @brief Check whether the calling thread may submit requests immediately.
+   *
+   * Check whether the calling thread holds no resource the progress thread may wait for,
+   * in which case `ucxx::DelayedSubmissionPolicy::Adaptive` may submit requests
+   * immediately. Always `true` for C++ workers, overridden by Python workers to refuse
+   * immediate submission from threads holding the GIL.
+   *
+   * @returns `true` if the calling thread may submit requests immediately.
+   */
+  virtual bool isDirectSubmissionAllowed();
+
+  /**
+   * @brief Register the inflight requests of an endpoint.
+   *
+   * Register the inflight requests container of an endpoint created from this worker, so
+   * that its requests are included in inflight requests reports. Called by
+   * `ucxx::Endpoint` when created, only a weak reference is kept.
+   *
+   * @param[in] inflightRequests the inflight requests of the endpoint.
+   */
+  void registerEndpointInflightRequests(std::shared_ptr<InflightRequests> inflightRequests);
+
+  /**
+   * @brief Get the description of the oldest inflight requests.
+   *
+   * Get the description of inflight requests submitted by the worker and by all endpoints
+   * created from it that are still pending, sorted from the oldest to the newest. Each
+   * description holds the operation, owner, tag, length and submission time of the request.
+   *
+   * @code{.cpp}
+   * // `worker` is `std::shared_ptr<ucxx::Worker>`
+   * for (const auto& info : worker->getInflightRequestsInfo(10)) {
+   *   auto age = std::chrono::steady_clock::now() - info.submitTime;
+   *   // Inspect `info.ownerString`, `info.tag` and `age`
+   * }
+   * @endcode
+   *
+   * @param[in] maxRequests the maximum number of requests to return, `0` for all.
+   * @param[in] minAge      the minimum age of requests to return.
+   *
+   * @returns the description of the oldest inflight requests.
+   */
+  std::vector<InflightRequestInfo> getInflightRequestsInfo(
+    const size_t maxRequests = 0, const std::chrono::milliseconds minAge = {});
+
+  /**
+   * @brief Get a report of the oldest inflight requests.
+   *
+   * Get a human-readable report of the `maxRequests` oldest pending inflight requests,
+   * grouped by owner (endpoint or worker) and tag, with the number of requests, their
+   * operations and total length, and the age of the oldest request in each group. Meant
+   * to identify which peers and tags a stalled application is waiting for.
+   *
+   * @param[in] maxRequests the maximum number of requests to report, `0` for all.
+   * @param[in] minAge      the minimum age of requests to report.
+   *
+   * @returns the report, which only contains a header if no requests are pending.
+   */
+  std::string getInflightRequestsReport(const size_t maxRequests              = 10,
+                                        const std::chrono::milliseconds minAge = {});
+
+  /**
+   * @brief Start the inflight requests watchdog.
+   *
+   * Start a thread that wakes up every `interval` and logs a warning with the report of the
+   * `maxRequests` oldest requests pending for longer than `threshold`, if any. The watchdog
+   * does not progress the worker, it keeps reporting requests even if progress is stalled.
+   *
+   * @throws ucxx::Error if `threshold` is not positive or the watchdog is already running.
+   *
+   * @param[in] threshold   the age after which requests are reported.
+   * @param[in] interval    the time between checks, `threshold` if not positive.
+   * @param[in] maxRequests the maximum number of requests reported at each check.
+   */
+  void startInflightRequestsWatchdog(const std::chrono::milliseconds threshold,
+                                     const std::chrono::milliseconds interval = {},
+                                     const size_t maxRequests                 = 10);
+
+  /**
+   * @brief Stop the inflight requests watchdog.
+   *
+   * Stop the inflight requests watchdog and wait for its thread to exit, no-op if not
+   * running. Called automatically when the worker is destroyed.
+   */
+  void stopInflightRequestsWatchdog();
+
   /**
    * @brief Inquire if worker has been created with future support.
    *
@@ -367,9 +735,9 @@ class Worker : public Component {
    *
    * To avoid taking blocking resources (such as the Python GIL) for every new future
    * required by each `ucxx::Request`, the `ucxx::Worker` maintains a pool of futures
-   * that can be acquired when a new `ucxx::Request` is created. Currently the pool has
-   * a maximum size of 100 objects, and will refill once it goes under 50, otherwise
-   * calling this functions results in a no-op.
+   * per submitting thread that can be acquired when a new `ucxx::Request` is created.
+   * Currently each pool has a maximum size of 100 objects, and will refill once it goes
+   * under 50, otherwise calling this functions results in a no-op.
    *
    * @throws std::runtime_error if future support is not implemented.
    */
@@ -378,9 +746,9 @@ class Worker : public Component {
   /**
    * @brief Get a future from the pool.
    *
-   * Get a future from the pool. If the pool is empty,
-   * `ucxx::Worker::populateFuturesPool()` is called and a warning is raised, since
-   * that likely means the user is missing to call the aforementioned method regularly.
+   * Get a future from the pool of the calling thread. If the pool is empty, it is
+   * refilled and a warning is raised, since that likely means the user is missing to
+   * call `ucxx::Worker::populateFuturesPool()` regularly.
    *
    * @throws std::runtime_error if future support is not implemented.
    *
@@ -445,13 +813,19 @@ class Worker : public Component {
    * Spawns a new thread that will take care of continuously progressing the worker. The
    * thread can progress the worker in blocking mode, using `progressWorkerEvent()` only
    * when worker events happen, or in polling mode by continuously calling `progress()`
-   * (incurs in high CPU utilization).
+   * (incurs in high CPU utilization). If the context was created without
+   * `UCP_FEATURE_WAKEUP`, for example with `ucxx::ContextProfile::PollingOnly`, the thread
+   * always progresses the worker in polling mode.
    *
    * @param[in] pollingMode   use polling mode if `true`, or blocking mode if `false`.
    * @param[in] epollTimeout  timeout in ms when waiting for worker event, or -1 to block
    *                          indefinitely, only applicable if `pollingMode==true`.
+   * @param[in] backend       the backend used to wait for worker events in blocking mode,
+   *                          see `initBlockingProgressMode()`.
    */
-  void startProgressThread(const bool pollingMode = false, const int epollTimeout = 1);
+  void startProgressThread(const bool pollingMode        = false,
+                           const int epollTimeout        = 1,
+                           const ProgressBackend backend = ProgressBackend::Epoll);
 
   /**
    * @brief Stop the progress thread.
@@ -463,6 +837,58 @@ class Worker : public Component {
    */
   void stopProgressThread();
 
+  /**
+   * @brief Submit a file read.
+   *
+   * Read `length` bytes at `offset` of `fd` into `buffer`, for example to feed a
+   * file-to-network pipeline. When blocking progress uses `ucxx::ProgressBackend::IoUring`
+   * the read is prepared on the worker's io_uring and submitted by the next wait of the
+   * thread progressing the worker, together with all other file I/O prepared meanwhile,
+   * and `callback` is executed by that thread upon completion. Only the first operation
+   * prepared after each submission signals the worker to wake the thread up. Otherwise the
+   * read is executed synchronously with `pread` and `callback` is executed before this
+   * method returns.
+   *
+   * @code{.cpp}
+   * // worker is `std::shared_ptr<ucxx::Worker>`, endpoint is `std::shared_ptr<ucxx::Endpoint>`
+   * worker->startProgressThread(false, 1, ucxx::ProgressBackend::IoUring);
+   * worker->submitFileRead(fd, buffer, length, 0, [&](ssize_t result) {
+   *   if (result > 0) endpoint->tagSend(buffer, result, tag);
+   * });
+   * @endcode
+   *
+   * @throws ucxx::NoResourceError  if the io_uring submission queue is full.
+   * @throws ucxx::Error            if signaling the worker failed.
+   *
+   * @param[in] fd        the file descriptor to read from.
+   * @param[in] buffer    the buffer to read into, must remain valid until completion.
+   * @param[in] length    the number of bytes to read.
+   * @param[in] offset    the offset in the file to read from.
+   * @param[in] callback  the callback executed upon completion with the number of bytes
+   *                      read, or `-errno` if the read failed.
+   */
+  void submitFileRead(
+    int fd, void* buffer, const size_t length, const off_t offset, FileIOCallback callback);
+
+  /**
+   * @brief Submit a file write.
+   *
+   * Write `length` bytes from `buffer` to `fd` at `offset`, for example to persist data
+   * received from the network, see `submitFileRead()` for details on execution.
+   *
+   * @throws ucxx::NoResourceError  if the io_uring submission queue is full.
+   * @throws ucxx::Error            if signaling the worker failed.
+   *
+   * @param[in] fd        the file descriptor to write to.
+   * @param[in] buffer    the buffer to write from, must remain valid until completion.
+   * @param[in] length    the number of bytes to write.
+   * @param[in] offset    the offset in the file to write to.
+   * @param[in] callback  the callback executed upon completion with the number of bytes
+   *                      written, or `-errno` if the write failed.
+   */
+  void submitFileWrite(
+    int fd, const void* buffer, const size_t length, const off_t offset, FileIOCallback callback);
+
   /**
    * @brief Cancel inflight requests.
    *
@@ -521,6 +947,64 @@ class Worker : public Component {
    */
   bool tagProbe(ucp_tag_t tag);
 
+  /**
+   * @brief Check for uncaught tag messages and get the length of the first one.
+   *
+   * Checks the worker for any uncaught tag messages like `tagProbe(ucp_tag_t)`, and
+   * additionally returns the length of the first message matching `tag`, which remains
+   * uncaught. A tag receive posted afterwards is not guaranteed to match the probed
+   * message, another message for `tag` may arrive or another receive may be posted in
+   * between, use `tagProbeRecv()` to receive messages whose length is not known in
+   * advance.
+   *
+   * @param[in]  tag    the tag to match.
+   * @param[out] length the length in bytes of the first message matching `tag`, left
+   *                    unmodified if no message was matched.
+   *
+   * @returns `true` if any uncaught messages were received, `false` otherwise.
+   */
+  bool tagProbe(ucp_tag_t tag, size_t& length);
+
+  /**
+   * @brief Probe for an uncaught tag message and receive it.
+   *
+   * Checks the worker for an uncaught tag message matching `tag`, if one is found it is
+   * removed from the worker and received into the buffer returned by `allocate`, called
+   * with the length of the message. The message is received through its handle, thus no
+   * other receive can match it in the meantime, allowing receiving messages whose length
+   * is not known in advance.
+   *
+   * @code{.cpp}
+   * // `worker` is `std::shared_ptr<ucxx::Worker>`
+   * std::vector<char> buffer;
+   * auto allocate = [&buffer](size_t length) {
+   *   buffer.resize(length);
+   *   return buffer.data();
+   * };
+   *
+   * std::shared_ptr<ucxx::Request> request;
+   * while (!(request = worker->tagProbeRecv(tag, allocate)))
+   *   worker->progress();
+   * @endcode
+   *
+   * @param[in] tag               the tag to match.
+   * @param[in] allocate          returns the buffer where the message of the length given
+   *                              as argument will be stored, must not throw.
+   * @param[in] enableFuture      whether a future should be created and subsequently
+   *                              notified.
+   * @param[in] callbackFunction  user-defined callback function to call upon completion.
+   * @param[in] callbackData      user-defined data to pass to the `callbackFunction`.
+   *
+   * @returns Request to be subsequently checked for the completion and its state, or
+   *          `nullptr` if no message matching `tag` was found.
+   */
+  std::shared_ptr<Request> tagProbeRecv(
+    ucp_tag_t tag,
+    std::function<void*(size_t)> allocate,
+    const bool enableFuture                      = false,
+    RequestCallbackUserFunction callbackFunction = nullptr,
+    RequestCallbackUserData callbackData         = nullptr);
+
   /**
    * @brief Enqueue a tag receive operation.
    *
@@ -548,9 +1032,9 @@ class Worker : public Component {
     void* buffer,
     size_t length,
     ucp_tag_t tag,
-    const bool enableFuture                                     = false,
-    std::function<void(std::shared_ptr<void>)> callbackFunction = nullptr,
-    std::shared_ptr<void> callbackData                          = nullptr);
+    const bool enableFuture                      = false,
+    RequestCallbackUserFunction callbackFunction = nullptr,
+    RequestCallbackUserData callbackData         = nullptr);
 
   /**
    * @brief Get the address of the UCX worker object.
@@ -624,6 +1108,81 @@ class Worker : public Component {
   std::shared_ptr<Endpoint> createEndpointFromWorkerAddress(std::shared_ptr<Address> address,
                                                             bool endpointErrorHandling = true);
 
+  /**
+   * @brief Create endpoint to worker listening on specific IP and port, without throwing.
+   *
+   * Exception-free variant of `createEndpointFromHostname()`.
+   *
+   * @param[in] ipAddress string containing the IP address of the remote worker.
+   * @param[in] port port number where the remote worker is listening at.
+   * @param[in] endpointErrorHandling enable endpoint error handling if `true`,
+   *                                  disable otherwise.
+   *
+   * @returns The `shared_ptr<ucxx::Endpoint>` object or the status of the failure.
+   */
+  Expected<std::shared_ptr<Endpoint>> createEndpointFromHostname(
+    std::nothrow_t,
+    std::string ipAddress,
+    uint16_t port,
+    bool endpointErrorHandling = true) noexcept;
+
+  /**
+   * @brief Create endpoint to worker located at UCX address, without throwing.
+   *
+   * Exception-free variant of `createEndpointFromWorkerAddress()`.
+   *
+   * @param[in] address address of the remote UCX worker.
+   * @param[in] endpointErrorHandling enable endpoint error handling if `true`,
+   *                                  disable otherwise.
+   *
+   * @returns The `shared_ptr<ucxx::Endpoint>` object or the status of the failure.
+   */
+  Expected<std::shared_ptr<Endpoint>> createEndpointFromWorkerAddress(
+    std::nothrow_t, std::shared_ptr<Address> address, bool endpointErrorHandling = true) noexcept;
+
+  /**
+   * @brief Create endpoint to worker listening on specific IP and port asynchronously.
+   *
+   * Equivalent to `createEndpointFromHostname()`, but the endpoint is created by the
+   * worker progress thread when delayed submission is enabled, preventing the caller
+   * thread from contending with the progress thread for the UCX spinlock. When delayed
+   * submission is disabled the endpoint is created immediately.
+   *
+   * @code{.cpp}
+   * // `worker` is `std::shared_ptr<ucxx::Worker>`
+   * auto future = worker->createEndpointFromHostnameAsync("10.10.10.10", 12345);
+   * auto ep     = future.get();
+   * @endcode
+   *
+   * @param[in] ipAddress string containing the IP address of the remote worker.
+   * @param[in] port port number where the remote worker is listening at.
+   * @param[in] endpointErrorHandling enable endpoint error handling if `true`,
+   *                                  disable otherwise.
+   *
+   * @returns The future to the `shared_ptr<ucxx::Endpoint>` object, rethrowing any
+   *          exception `createEndpointFromHostname()` would throw.
+   */
+  std::future<std::shared_ptr<Endpoint>> createEndpointFromHostnameAsync(
+    std::string ipAddress, uint16_t port, bool endpointErrorHandling = true);
+
+  /**
+   * @brief Create endpoint to worker located at UCX address asynchronously.
+   *
+   * Equivalent to `createEndpointFromWorkerAddress()`, but the endpoint is created by the
+   * worker progress thread when delayed submission is enabled, preventing the caller
+   * thread from contending with the progress thread for the UCX spinlock. When delayed
+   * submission is disabled the endpoint is created immediately.
+   *
+   * @param[in] address address of the remote UCX worker.
+   * @param[in] endpointErrorHandling enable endpoint error handling if `true`,
+   *                                  disable otherwise.
+   *
+   * @returns The future to the `shared_ptr<ucxx::Endpoint>` object, rethrowing any
+   *          exception `createEndpointFromWorkerAddress()` would throw.
+   */
+  std::future<std::shared_ptr<Endpoint>> createEndpointFromWorkerAddressAsync(
+    std::shared_ptr<Address> address, bool endpointErrorHandling = true);
+
   /**
    * @brief Listen for remote connections on given port.
    *
@@ -4,6 +4,7 @@
  */
 #pragma once
 
+#include <atomic>
 #include <condition_variable>
 #include <memory>
 #include <mutex>
@@ -23,7 +24,7 @@ class Notifier : public ::ucxx::Notifier {
   std::vector<std::pair<std::shared_ptr<::ucxx::Future>, ucs_status_t>>
     _notifierThreadFutureStatus{};               ///< Container with futures and statuses to set
   bool _notifierThreadFutureStatusReady{false};  ///< Whether a future is scheduled for notification
-  RequestNotifierThreadState _notifierThreadFutureStatusFinished{
+  std::atomic<RequestNotifierThreadState> _notifierThreadFutureStatusFinished{
     RequestNotifierThreadState::NotRunning};  ///< State of the notifier thread
   std::condition_variable
     _notifierThreadConditionVariable{};  ///< Condition variable used to wait for event
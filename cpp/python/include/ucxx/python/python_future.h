@@ -4,6 +4,7 @@
  */
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <memory>
 
@@ -21,7 +22,7 @@ namespace python {
 
 class Future : public ::ucxx::Future {
  private:
-  PyObject* _handle{create_python_future()};  ///< The handle to the Python future
+  std::atomic<PyObject*> _handle{create_python_future()};  ///< The handle to the Python future
 
   /**
    * @brief Construct a future that may be notified from a notifier thread.
@@ -107,7 +108,9 @@ class Future : public ::ucxx::Future {
    *
    * Get the underlying `PyObject*` handle releasing ownership. This should be used when
    * the future needs to be permanently transferred to Python code. After calling this
-   * method the object becomes invalid for any other uses.
+   * method the object becomes invalid for any other uses. Ownership is released
+   * atomically, if multiple threads race to release the future only one of them acquires
+   * the reference.
    *
    * @throws std::runtime_error if the object is invalid or has been already released.
    *
@@ -8,6 +8,7 @@
 #include <memory>
 #include <mutex>
 #include <queue>
+#include <shared_mutex>
 #include <thread>
 
 #include <ucp/api/ucp.h>
@@ -41,6 +42,29 @@ class Worker : public ::ucxx::Worker {
          const bool enableDelayedSubmission = false,
          const bool enableFuture            = false);
 
+  /**
+   * @brief Get the futures pool of the calling thread.
+   *
+   * Get the futures pool of the calling thread, registering and filling a new pool if
+   * the thread has not acquired futures from this worker before.
+   *
+   * @returns The futures pool of the calling thread.
+   */
+  std::shared_ptr<FuturesPool> getThreadFuturesPool();
+
+  /**
+   * @brief Refill a futures pool.
+   *
+   * Refill `pool` up to its maximum size if it went under half of it. Python futures are
+   * created with the calling thread attached to the interpreter but without holding the
+   * pool mutex, thus the thread acquiring futures from `pool` is never blocked by the
+   * interpreter.
+   *
+   * @param[in] pool  the pool to refill.
+   * @param[in] force refill even if the pool did not go under half of its maximum size.
+   */
+  void fillFuturesPool(FuturesPool& pool, const bool force = false);
+
  public:
   Worker()              = delete;
   Worker(const Worker&) = delete;
@@ -77,18 +101,22 @@ class Worker : public ::ucxx::Worker {
    * @brief Populate the Python future pool.
    *
    * To avoid taking the Python GIL for every new future required by each `ucxx::Request`,
-   * the `ucxx::python::Worker` maintains a pool of futures that can be acquired when a new
-   * `ucxx::Request` is created. Currently the pool has a maximum size of 100 objects, and
-   * will refill once it goes under 50, otherwise calling this functions results in a no-op.
+   * the `ucxx::python::Worker` maintains a pool of futures per submitting thread that can
+   * be acquired when a new `ucxx::Request` is created. This method refills the pools of
+   * all threads that acquired futures from this worker. Currently each pool has a maximum
+   * size of 100 objects, and will refill once it goes under 50, otherwise calling this
+   * functions results in a no-op.
    */
   void populateFuturesPool() override;
 
   /**
    * @brief Get a Python future from the pool.
    *
-   * Get a Python future from the pool. If the pool is empty,
-   * `ucxx::python::Worker::populateFuturesPool()` is called and a warning is raised, since
-   * that likely means the user is missing to call the aforementioned method regularly.
+   * Get a Python future from the pool of the calling thread. Threads acquire futures
+   * from their own pools and thus do not contend with each other, allowing requests to be
+   * submitted in parallel on free-threaded Python builds. If the pool is empty it is
+   * refilled and a warning is raised, since that likely means the user is missing to call
+   * `ucxx::python::Worker::populateFuturesPool()` regularly.
    *
    * @returns The `shared_ptr<ucxx::python::Future>` object
    */
@@ -126,6 +154,16 @@ class Worker : public ::ucxx::Worker {
    * Signals the notifier to terminate, awakening the `waitRequestNotifier()` blocking call.
    */
   void stopRequestNotifierThread() override;
+
+  /**
+   * @brief Check whether the calling thread may submit requests immediately.
+   *
+   * Refuse immediate submission from threads holding the GIL, the progress thread may
+   * need the GIL to complete requests while the submitting thread waits for the worker.
+   *
+   * @returns `true` if the calling thread does not hold the GIL, `false` otherwise.
+   */
+  bool isDirectSubmissionAllowed() override;
 };
 
 }  // namespace python
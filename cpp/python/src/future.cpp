@@ -2,6 +2,9 @@
  * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
  * SPDX-License-Identifier: BSD-3-Clause
  */
+#include <atomic>
+#include <cstring>
+
 #include <ucxx/log.h>
 
 #include <Python.h>
@@ -10,21 +13,38 @@ namespace ucxx {
 
 namespace python {
 
-PyObject* asyncio_str           = NULL;
-PyObject* future_str            = NULL;
-PyObject* asyncio_future_object = NULL;
+// Lazily-initialized Python objects and method pointers, shared by all threads. They
+// are published atomically, as without the GIL multiple threads may initialize them
+// concurrently.
+static std::atomic<PyObject*> asyncio_str{NULL};
+static std::atomic<PyObject*> future_str{NULL};
+static std::atomic<PyObject*> asyncio_future_object{NULL};
+static std::atomic<PyCFunction> future_set_result_method{NULL};
+static std::atomic<PyCFunction> future_set_exception_method{NULL};
+
+/**
+ * Publish a new reference to `object` in `target` unless another thread already did, in
+ * which case the new reference is dropped. Must be called with an attached thread state.
+ */
+static PyObject* publish_object(std::atomic<PyObject*>& target, PyObject* object)
+{
+  PyObject* expected = NULL;
+  if (object == NULL || target.compare_exchange_strong(expected, object)) return object;
+  Py_DECREF(object);
+  return expected;
+}
 
 static int intern_strings(void)
 {
-  asyncio_str = PyUnicode_InternFromString("asyncio");
-  if (asyncio_str == NULL) { return -1; }
-  future_str = PyUnicode_InternFromString("Future");
-  if (future_str == NULL) { return -1; }
+  if (publish_object(asyncio_str, PyUnicode_InternFromString("asyncio")) == NULL) { return -1; }
+  if (publish_object(future_str, PyUnicode_InternFromString("Future")) == NULL) { return -1; }
   return 0;
 }
 
 static int init_ucxx_python()
 {
+  if (asyncio_str.load() != NULL && future_str.load() != NULL) return 0;
+
   if (intern_strings() < 0) goto err;
 
   return 0;
@@ -37,8 +57,9 @@ err:
 static PyObject* get_asyncio_future_object()
 {
   PyObject* asyncio_module = NULL;
+  PyObject* future_object  = asyncio_future_object.load();
 
-  if (asyncio_future_object) return asyncio_future_object;
+  if (future_object) return future_object;
 
   PyGILState_STATE state = PyGILState_Ensure();
 
@@ -47,20 +68,21 @@ static PyObject* get_asyncio_future_object()
     goto finish;
   }
 
-  asyncio_module = PyImport_Import(asyncio_str);
+  asyncio_module = PyImport_Import(asyncio_str.load());
   if (PyErr_Occurred()) ucxx_trace_req("Python error here");
   if (PyErr_Occurred()) PyErr_Print();
   if (asyncio_module == NULL) goto finish;
 
-  asyncio_future_object = PyObject_GetAttr(asyncio_module, future_str);
+  future_object =
+    publish_object(asyncio_future_object, PyObject_GetAttr(asyncio_module, future_str.load()));
   if (PyErr_Occurred()) ucxx_trace_req("Python error here");
   if (PyErr_Occurred()) PyErr_Print();
   Py_DECREF(asyncio_module);
-  if (asyncio_future_object == NULL) { goto finish; }
+  if (future_object == NULL) { goto finish; }
 
 finish:
   PyGILState_Release(state);
-  return asyncio_future_object;
+  return future_object;
 }
 
 PyObject* create_python_future()
@@ -80,8 +102,8 @@ PyObject* create_python_future()
   if (!PyCallable_Check(future_object)) {
     PyErr_Format(PyExc_RuntimeError,
                  "%s.%s is not callable.",
-                 PyUnicode_1BYTE_DATA(asyncio_str),
-                 PyUnicode_1BYTE_DATA(future_str));
+                 PyUnicode_1BYTE_DATA(asyncio_str.load()),
+                 PyUnicode_1BYTE_DATA(future_str.load()));
     goto finish;
   }
 
@@ -94,9 +116,11 @@ finish:
   return result;
 }
 
-static PyCFunction get_future_method(const char* method_name)
+static PyCFunction get_future_method(const char* method_name, std::atomic<PyCFunction>& cache)
 {
-  PyCFunction result = NULL;
+  PyCFunction result = cache.load();
+
+  if (result) return result;
 
   PyGILState_STATE state = PyGILState_Ensure();
 
@@ -105,15 +129,18 @@ static PyCFunction get_future_method(const char* method_name)
   if (PyErr_Occurred()) PyErr_Print();
   PyMethodDef* m = reinterpret_cast<PyTypeObject*>(future_object)->tp_methods;
 
-  for (; m != NULL; ++m) {
-    if (m->ml_name && !strcmp(m->ml_name, method_name)) {
+  for (; m != NULL && m->ml_name != NULL; ++m) {
+    if (!strcmp(m->ml_name, method_name)) {
       result = m->ml_meth;
       break;
     }
   }
 
   if (!result)
-    PyErr_Format(PyExc_RuntimeError, "Unable to load function pointer for `Future.set_result`.");
+    PyErr_Format(
+      PyExc_RuntimeError, "Unable to load function pointer for `Future.%s`.", method_name);
+  else
+    cache.store(result);
 
   PyGILState_Release(state);
   return result;
@@ -125,7 +152,7 @@ PyObject* future_set_result(PyObject* future, PyObject* value)
 
   PyGILState_STATE state = PyGILState_Ensure();
 
-  PyCFunction f = get_future_method("set_result");
+  PyCFunction f = get_future_method("set_result", future_set_result_method);
   result        = f(future, value);
   if (PyErr_Occurred()) ucxx_trace_req("Python error here");
   if (PyErr_Occurred()) PyErr_Print();
@@ -152,7 +179,7 @@ PyObject* future_set_exception(PyObject* future, PyObject* exception, const char
   formed_exception = PyObject_Call(exception, message_tuple, NULL);
   if (formed_exception == NULL) goto err;
 
-  f = get_future_method("set_exception");
+  f = get_future_method("set_exception", future_set_exception_method);
 
   result = f(future, formed_exception);
   goto finish;
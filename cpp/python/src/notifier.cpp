@@ -99,10 +99,12 @@ RequestNotifierWaitState Notifier::waitRequestNotifier(uint64_t period)
 {
   ucxx_trace_req("Notifier::waitRequestNotifier()");
 
-  if (_notifierThreadFutureStatusFinished == RequestNotifierThreadState::Stopping) {
-    _notifierThreadFutureStatusFinished = RequestNotifierThreadState::Running;
+  // The state may be changed concurrently by `stopRequestNotifierThread()`, only one
+  // caller observes the transition from stopping.
+  auto stopping = RequestNotifierThreadState::Stopping;
+  if (_notifierThreadFutureStatusFinished.compare_exchange_strong(
+        stopping, RequestNotifierThreadState::Running))
     return RequestNotifierWaitState::Shutdown;
-  }
 
   return (period > 0) ? waitRequestNotifierWithTimeout(period)
                       : waitRequestNotifierWithoutTimeout();
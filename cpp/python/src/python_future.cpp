@@ -26,52 +26,60 @@ std::shared_ptr<::ucxx::Future> createFuture(std::shared_ptr<::ucxx::Notifier> n
 
 Future::~Future()
 {
-  // TODO: check it is truly safe to require the GIL here. Segfaults can occur
-  // if `Py_XDECREF` is called but the thread doesn't currently own the GIL.
+  // Released futures are owned by Python, only take a thread state when a reference
+  // remains to be dropped. A thread state must be attached for `Py_DECREF`, both with
+  // and without the GIL.
+  PyObject* handle = _handle.exchange(nullptr);
+  if (handle == nullptr) return;
+
   PyGILState_STATE state = PyGILState_Ensure();
-  Py_XDECREF(_handle);
+  Py_DECREF(handle);
   PyGILState_Release(state);
 }
 
 void Future::set(ucs_status_t status)
 {
-  if (_handle == nullptr) throw std::runtime_error("Invalid object or already released");
+  PyObject* handle = _handle.load();
+  if (handle == nullptr) throw std::runtime_error("Invalid object or already released");
 
   ucxx_trace_req(
-    "Future::set() this: %p, _handle: %p, status: %s", this, _handle, ucs_status_string(status));
+    "Future::set() this: %p, _handle: %p, status: %s", this, handle, ucs_status_string(status));
   if (status == UCS_OK)
-    future_set_result(_handle, Py_True);
+    future_set_result(handle, Py_True);
   else
     future_set_exception(
-      _handle, get_python_exception_from_ucs_status(status), ucs_status_string(status));
+      handle, get_python_exception_from_ucs_status(status), ucs_status_string(status));
 }
 
 void Future::notify(ucs_status_t status)
 {
-  if (_handle == nullptr) throw std::runtime_error("Invalid object or already released");
+  PyObject* handle = _handle.load();
+  if (handle == nullptr) throw std::runtime_error("Invalid object or already released");
 
   auto s = shared_from_this();
 
   ucxx_trace_req("Future::notify() this: %p, shared.get(): %p, handle: %p, notifier: %p",
                  this,
                  s.get(),
-                 _handle,
+                 handle,
                  _notifier.get());
   _notifier->scheduleFutureNotify(shared_from_this(), status);
 }
 
 void* Future::getHandle()
 {
-  if (_handle == nullptr) throw std::runtime_error("Invalid object or already released");
+  PyObject* handle = _handle.load();
+  if (handle == nullptr) throw std::runtime_error("Invalid object or already released");
 
-  return _handle;
+  return handle;
 }
 
 void* Future::release()
 {
-  if (_handle == nullptr) throw std::runtime_error("Invalid object or already released");
+  PyObject* handle = _handle.exchange(nullptr);
+  if (handle == nullptr) throw std::runtime_error("Invalid object or already released");
 
-  return std::exchange(_handle, nullptr);
+  return handle;
 }
 
 }  // namespace python
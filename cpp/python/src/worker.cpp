@@ -2,10 +2,15 @@
  * SPDX-FileCopyrightText: Copyright (c) 2023, NVIDIA CORPORATION & AFFILIATES.
  * SPDX-License-Identifier: BSD-3-Clause
  */
+#include <algorithm>
 #include <functional>
 #include <ios>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include <Python.h>
 
@@ -19,6 +24,27 @@ namespace ucxx {
 
 namespace python {
 
+namespace {
+
+/**
+ * Futures pools registered by the calling thread, marked as exited when the thread exits
+ * so that workers release them instead of refilling them. Pools are not released here,
+ * destroying their Python futures may not be safe while the thread is being torn down.
+ */
+struct ThreadFuturesPools {
+  std::vector<std::weak_ptr<FuturesPool>> pools{};
+
+  ~ThreadFuturesPools()
+  {
+    for (auto& weakPool : pools)
+      if (auto pool = weakPool.lock()) pool->exited = true;
+  }
+};
+
+thread_local ThreadFuturesPools threadFuturesPools{};
+
+}  // namespace
+
 Worker::Worker(std::shared_ptr<Context> context,
                const bool enableDelayedSubmission,
                const bool enableFuture)
@@ -35,18 +61,95 @@ std::shared_ptr<::ucxx::Worker> createWorker(std::shared_ptr<Context> context,
     new ::ucxx::python::Worker(context, enableDelayedSubmission, enableFuture));
 }
 
+std::shared_ptr<FuturesPool> Worker::getThreadFuturesPool()
+{
+  // Cache the pool of the last worker used by this thread, avoiding contention on the
+  // pools mutex. An expired pool means the worker it belonged to was destroyed.
+  thread_local const Worker* cachedWorker{nullptr};
+  thread_local std::weak_ptr<FuturesPool> cachedPool{};
+
+  if (cachedWorker == this) {
+    if (auto pool = cachedPool.lock()) return pool;
+  }
+
+  const auto threadId = std::this_thread::get_id();
+  std::shared_ptr<FuturesPool> pool{nullptr};
+  {
+    std::shared_lock<std::shared_mutex> lock(_futuresPoolsMutex);
+    auto it = _futuresPools.find(threadId);
+    if (it != _futuresPools.end()) pool = it->second;
+  }
+  // The pool of an exited thread whose id was reused is not pruned yet, replace it.
+  if (pool == nullptr || pool->exited) {
+    {
+      std::unique_lock<std::shared_mutex> lock(_futuresPoolsMutex);
+      auto& threadPool = _futuresPools[threadId];
+      if (threadPool == nullptr || threadPool->exited)
+        threadPool = std::make_shared<FuturesPool>();
+      pool = threadPool;
+    }
+    auto& pools = threadFuturesPools.pools;
+    pools.erase(std::remove_if(pools.begin(),
+                               pools.end(),
+                               [](const auto& weakPool) { return weakPool.expired(); }),
+                pools.end());
+    pools.push_back(pool);
+    // First use by this thread, fill the pool before the notifier thread is aware of it.
+    fillFuturesPool(*pool);
+  }
+
+  cachedWorker = this;
+  cachedPool   = pool;
+  return pool;
+}
+
+void Worker::fillFuturesPool(FuturesPool& pool, const bool force)
+{
+  size_t missing = 0;
+  {
+    std::lock_guard<std::mutex> lock(pool.mutex);
+    // If the pool goes under half expected size, fill it up again.
+    if (!force && pool.futures.size() >= 50) return;
+    missing = pool.futures.size() < 100 ? 100 - pool.futures.size() : 0;
+  }
+  if (missing == 0) return;
+
+  std::vector<std::shared_ptr<::ucxx::Future>> futures;
+  futures.reserve(missing);
+  {
+    PyGILState_STATE state = PyGILState_Ensure();
+    for (size_t i = 0; i < missing; ++i)
+      futures.push_back(createFuture(_notifier));
+    PyGILState_Release(state);
+  }
+
+  std::lock_guard<std::mutex> lock(pool.mutex);
+  for (auto& future : futures)
+    pool.futures.push(std::move(future));
+}
+
 void Worker::populateFuturesPool()
 {
   if (_enableFuture) {
     ucxx_trace_req("populateFuturesPool: %p %p", this, shared_from_this().get());
-    // If the pool goes under half expected size, fill it up again.
-    if (_futuresPool.size() < 50) {
-      std::lock_guard<std::mutex> lock(_futuresPoolMutex);
-      PyGILState_STATE state = PyGILState_Ensure();
-      while (_futuresPool.size() < 100)
-        _futuresPool.emplace(createFuture(_notifier));
-      PyGILState_Release(state);
+    std::vector<std::shared_ptr<FuturesPool>> pools;
+    std::vector<std::shared_ptr<FuturesPool>> exitedPools;
+    {
+      std::unique_lock<std::shared_mutex> lock(_futuresPoolsMutex);
+      for (auto it = _futuresPools.begin(); it != _futuresPools.end();) {
+        if (it->second->exited) {
+          exitedPools.push_back(std::move(it->second));
+          it = _futuresPools.erase(it);
+        } else {
+          pools.push_back(it->second);
+          ++it;
+        }
+      }
     }
+    for (auto& pool : pools)
+      fillFuturesPool(*pool);
+    // Futures of exited threads are destroyed here, outside the pools mutex.
+    exitedPools.clear();
   } else {
     throw std::runtime_error(
       "Worker future support disabled, please set enableFuture=true when creating the "
@@ -57,22 +160,26 @@ void Worker::populateFuturesPool()
 std::shared_ptr<::ucxx::Future> Worker::getFuture()
 {
   if (_enableFuture) {
-    if (_futuresPool.size() == 0) {
+    auto pool = getThreadFuturesPool();
+
+    std::shared_ptr<::ucxx::Future> ret{nullptr};
+    while (ret == nullptr) {
+      {
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        if (!pool->futures.empty()) {
+          ret = std::move(pool->futures.front());
+          pool->futures.pop();
+          break;
+        }
+      }
       ucxx_warn(
         "No Futures available during getFuture(), make sure the Notifier is running "
         "running and calling populateFuturesPool() periodically. Filling futures pool "
         "now, but this may be inefficient.");
-      populateFuturesPool();
-    }
-
-    std::shared_ptr<::ucxx::Future> ret{nullptr};
-    {
-      std::lock_guard<std::mutex> lock(_futuresPoolMutex);
-      ret = _futuresPool.front();
-      _futuresPool.pop();
+      fillFuturesPool(*pool, true);
     }
     ucxx_trace_req("getFuture: %p %p", ret.get(), ret->getHandle());
-    return std::dynamic_pointer_cast<::ucxx::Future>(ret);
+    return ret;
   } else {
     throw std::runtime_error(
       "Worker future support disabled, please set enableFuture=true when creating the "
@@ -114,6 +221,8 @@ void Worker::stopRequestNotifierThread()
   }
 }
 
+bool Worker::isDirectSubmissionAllowed() { return !PyGILState_Check(); }
+
 }  // namespace python
 
 }  // namespace ucxx
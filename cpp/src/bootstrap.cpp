@@ -0,0 +1,371 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/address.h>
+#include <ucxx/bootstrap.h>
+#include <ucxx/exception.h>
+#include <ucxx/log.h>
+
+namespace ucxx {
+
+namespace {
+
+/**
+ * The address table sent by the listener coordinator is laid out as the number of
+ * addresses followed by the size and contents of each address, sizes as `uint64_t`.
+ */
+std::string serializeAddresses(const std::vector<std::string>& addresses)
+{
+  std::string serialized;
+  const uint64_t count = addresses.size();
+  serialized.append(reinterpret_cast<const char*>(&count), sizeof(count));
+  for (const auto& address : addresses) {
+    const uint64_t size = address.size();
+    serialized.append(reinterpret_cast<const char*>(&size), sizeof(size));
+    serialized.append(address);
+  }
+  return serialized;
+}
+
+std::vector<std::string> deserializeAddresses(const std::string& serialized,
+                                              const size_t worldSize)
+{
+  auto malformed = []() { throw ucxx::Error("Bootstrap address table is malformed"); };
+
+  size_t offset = 0;
+  auto readSize = [&serialized, &offset, &malformed]() {
+    uint64_t size = 0;
+    if (serialized.size() - offset < sizeof(size)) malformed();
+    std::memcpy(&size, serialized.data() + offset, sizeof(size));
+    offset += sizeof(size);
+    return size;
+  };
+
+  if (readSize() != worldSize) malformed();
+
+  std::vector<std::string> addresses(worldSize);
+  for (auto& address : addresses) {
+    const uint64_t size = readSize();
+    if (serialized.size() - offset < size) malformed();
+    address = serialized.substr(offset, size);
+    offset += size;
+  }
+  return addresses;
+}
+
+/**
+ * Files of the shared-file backend are laid out as `FileBootstrapMagic`, the rank and the
+ * size of the job identifier, all as `uint64_t`, followed by the job identifier and the
+ * address.
+ */
+constexpr uint64_t FileBootstrapMagic = 0x75637878'62737472ull;
+
+void throwTimeout(const size_t worldSize)
+{
+  throw ucxx::Error("Bootstrap timed out fetching addresses of " + std::to_string(worldSize) +
+                    " ranks");
+}
+
+}  // namespace
+
+void InProcessBootstrapBackend::publish(const size_t rank, const std::string& address)
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!_addresses.emplace(rank, address).second)
+      throw ucxx::Error("Bootstrap rank " + std::to_string(rank) + " already published");
+  }
+  _cv.notify_all();
+}
+
+std::vector<std::string> InProcessBootstrapBackend::fetchAll(
+  const size_t worldSize, const std::chrono::milliseconds timeout)
+{
+  std::unique_lock<std::mutex> lock(_mutex);
+  auto published = [this, worldSize]() {
+    for (size_t rank = 0; rank < worldSize; ++rank)
+      if (_addresses.find(rank) == _addresses.end()) return false;
+    return true;
+  };
+  if (!_cv.wait_for(lock, timeout, published)) throwTimeout(worldSize);
+
+  std::vector<std::string> addresses;
+  for (size_t rank = 0; rank < worldSize; ++rank)
+    addresses.push_back(_addresses[rank]);
+  return addresses;
+}
+
+FileBootstrapBackend::FileBootstrapBackend(const std::string& directory, const std::string& jobId)
+  : _directory(directory), _jobId(jobId)
+{
+  if (_jobId.empty() || _jobId.find('/') != std::string::npos)
+    throw ucxx::Error("Bootstrap job identifier must be non-empty and contain no '/'");
+}
+
+FileBootstrapBackend::~FileBootstrapBackend()
+{
+  for (const auto rank : _published)
+    if (std::remove(getPath(rank).c_str()) != 0)
+      ucxx_debug("FileBootstrapBackend failed removing %s: %s",
+                 getPath(rank).c_str(),
+                 std::strerror(errno));
+}
+
+std::string FileBootstrapBackend::getPath(const size_t rank) const
+{
+  return _directory + "/" + _jobId + "." + std::to_string(rank) + ".address";
+}
+
+bool FileBootstrapBackend::readAddress(const size_t rank, std::string& address) const
+{
+  std::ifstream file(getPath(rank), std::ios::binary);
+  if (!file.is_open()) return false;
+  const std::string contents{std::istreambuf_iterator<char>(file),
+                             std::istreambuf_iterator<char>()};
+
+  uint64_t header[3];
+  if (contents.size() < sizeof(header)) return false;
+  std::memcpy(header, contents.data(), sizeof(header));
+  if (header[0] != FileBootstrapMagic || header[1] != rank || header[2] != _jobId.size() ||
+      contents.size() - sizeof(header) < _jobId.size() ||
+      contents.compare(sizeof(header), _jobId.size(), _jobId) != 0) {
+    ucxx_debug("FileBootstrapBackend rejected stale address of rank %lu at %s",
+               rank,
+               getPath(rank).c_str());
+    return false;
+  }
+
+  address = contents.substr(sizeof(header) + _jobId.size());
+  return true;
+}
+
+void FileBootstrapBackend::publish(const size_t rank, const std::string& address)
+{
+  const std::string path          = getPath(rank);
+  const std::string temporaryPath = path + ".tmp";
+
+  {
+    const uint64_t header[3] = {FileBootstrapMagic, rank, _jobId.size()};
+    std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(header), sizeof(header));
+    file.write(_jobId.data(), _jobId.size());
+    file.write(address.data(), address.size());
+    if (!file) throw ucxx::Error("Failed writing bootstrap address to " + temporaryPath);
+  }
+
+  // Renaming is atomic, readers either observe the complete address or none at all.
+  if (std::rename(temporaryPath.c_str(), path.c_str()) != 0)
+    throw ucxx::Error("Failed publishing bootstrap address to " + path + ": " +
+                      std::strerror(errno));
+  _published.push_back(rank);
+
+  ucxx_debug("FileBootstrapBackend published rank %lu to %s", rank, path.c_str());
+}
+
+std::vector<std::string> FileBootstrapBackend::fetchAll(const size_t worldSize,
+                                                        const std::chrono::milliseconds timeout)
+{
+  const auto deadline = std::chrono::steady_clock::now() + timeout;
+
+  std::vector<std::string> addresses(worldSize);
+  for (size_t rank = 0; rank < worldSize; ++rank) {
+    auto backoff = std::chrono::microseconds(100);
+    while (!readAddress(rank, addresses[rank])) {
+      if (std::chrono::steady_clock::now() > deadline) throwTimeout(worldSize);
+      std::this_thread::sleep_for(backoff);
+      backoff = std::min(2 * backoff, std::chrono::microseconds(100000));
+    }
+  }
+  return addresses;
+}
+
+ListenerBootstrapBackend::ListenerBootstrapBackend(std::shared_ptr<Context> context,
+                                                   const size_t rank,
+                                                   const std::string& rootHostname,
+                                                   const uint16_t port)
+  : _rank(rank), _rootHostname(rootHostname), _port(port)
+{
+  _worker = context->createWorker();
+  if (_rank == 0) {
+    _listener = _worker->createListener(port, listenerCallback, this);
+    _port     = _listener->getPort();
+  }
+}
+
+void ListenerBootstrapBackend::listenerCallback(ucp_conn_request_h connRequest, void* arg)
+{
+  auto backend = reinterpret_cast<ListenerBootstrapBackend*>(arg);
+  backend->_endpoints.push_back(backend->_listener->createEndpointFromConnRequest(connRequest));
+}
+
+uint16_t ListenerBootstrapBackend::getPort() const { return _port; }
+
+ucs_status_t ListenerBootstrapBackend::wait(std::shared_ptr<Request> request,
+                                            const std::chrono::steady_clock::time_point deadline)
+{
+  while (!request->isCompleted()) {
+    if (std::chrono::steady_clock::now() > deadline)
+      throw ucxx::Error("Bootstrap timed out waiting for coordinator");
+    _worker->progress();
+  }
+  return request->getStatus();
+}
+
+void ListenerBootstrapBackend::publish(const size_t rank, const std::string& address)
+{
+  if (rank != _rank)
+    throw ucxx::Error("Bootstrap backend of rank " + std::to_string(_rank) +
+                      " cannot publish rank " + std::to_string(rank));
+  _address = address;
+}
+
+std::vector<std::string> ListenerBootstrapBackend::fetchAll(const size_t worldSize,
+                                                            const std::chrono::milliseconds timeout)
+{
+  if (_address.empty()) throw ucxx::Error("Bootstrap address must be published before fetching");
+
+  const auto deadline = std::chrono::steady_clock::now() + timeout;
+  return _rank == 0 ? fetchAllRoot(worldSize, deadline) : fetchAllNonRoot(worldSize, deadline);
+}
+
+std::vector<std::string> ListenerBootstrapBackend::fetchAllRoot(
+  const size_t worldSize, const std::chrono::steady_clock::time_point deadline)
+{
+  for (;;) {
+    // Connections of failed attempts are retried by other ranks, their endpoints must not
+    // be counted nor received from.
+    _endpoints.erase(std::remove_if(_endpoints.begin(),
+                                    _endpoints.end(),
+                                    [](const std::shared_ptr<Endpoint>& endpoint) {
+                                      return !endpoint->isAlive();
+                                    }),
+                     _endpoints.end());
+    if (_endpoints.size() >= worldSize - 1) break;
+
+    if (std::chrono::steady_clock::now() > deadline) throwTimeout(worldSize);
+    _worker->progress();
+  }
+
+  // Stream messages are received per endpoint, the rank of each connection is only known
+  // once its header, containing the rank and the size of its address, is received.
+  std::vector<std::array<uint64_t, 2>> headers(_endpoints.size());
+  std::vector<std::shared_ptr<Request>> requests;
+  for (size_t i = 0; i < _endpoints.size(); ++i)
+    requests.push_back(_endpoints[i]->streamRecv(headers[i].data(), sizeof(headers[i]), false));
+  for (auto& request : requests)
+    if (wait(request, deadline) != UCS_OK) throw ucxx::Error("Bootstrap failed receiving header");
+
+  std::vector<std::string> addresses(worldSize);
+  std::vector<bool> received(worldSize, false);
+  addresses[0] = _address;
+  received[0]  = true;
+
+  requests.clear();
+  for (size_t i = 0; i < _endpoints.size(); ++i) {
+    const size_t rank = headers[i][0];
+    if (rank >= worldSize || received[rank])
+      throw ucxx::Error("Bootstrap received invalid rank " + std::to_string(rank));
+    received[rank] = true;
+    addresses[rank].resize(headers[i][1]);
+    requests.push_back(
+      _endpoints[i]->streamRecv(&addresses[rank].front(), addresses[rank].size(), false));
+  }
+  for (auto& request : requests)
+    if (wait(request, deadline) != UCS_OK) throw ucxx::Error("Bootstrap failed receiving address");
+
+  const std::string table = serializeAddresses(addresses);
+  uint64_t tableSize      = table.size();
+
+  requests.clear();
+  for (auto& endpoint : _endpoints) {
+    requests.push_back(endpoint->streamSend(&tableSize, sizeof(tableSize), false));
+    requests.push_back(endpoint->streamSend(const_cast<char*>(table.data()), table.size(), false));
+  }
+  for (auto& request : requests)
+    if (wait(request, deadline) != UCS_OK) throw ucxx::Error("Bootstrap failed sending table");
+
+  ucxx_debug("ListenerBootstrapBackend gathered addresses of %lu ranks", worldSize);
+
+  return addresses;
+}
+
+std::vector<std::string> ListenerBootstrapBackend::fetchAllNonRoot(
+  const size_t worldSize, const std::chrono::steady_clock::time_point deadline)
+{
+  std::array<uint64_t, 2> header{_rank, _address.size()};
+
+  // The coordinator may not be listening yet, connection attempts are retried until the
+  // header and address are successfully sent.
+  for (auto backoff = std::chrono::milliseconds(1);;
+       backoff = std::min(2 * backoff, std::chrono::milliseconds(100))) {
+    auto endpoint       = _worker->createEndpointFromHostname(_rootHostname, _port);
+    auto headerRequest  = endpoint->streamSend(header.data(), sizeof(header), false);
+    auto addressRequest = endpoint->streamSend(&_address.front(), _address.size(), false);
+    if (wait(headerRequest, deadline) == UCS_OK && wait(addressRequest, deadline) == UCS_OK) {
+      _endpoints = {endpoint};
+      break;
+    }
+
+    ucxx_debug("ListenerBootstrapBackend rank %lu failed connecting to %s:%u, retrying",
+               _rank,
+               _rootHostname.c_str(),
+               _port);
+    if (std::chrono::steady_clock::now() > deadline) throwTimeout(worldSize);
+    std::this_thread::sleep_for(backoff);
+  }
+
+  uint64_t tableSize = 0;
+  if (wait(_endpoints[0]->streamRecv(&tableSize, sizeof(tableSize), false), deadline) != UCS_OK)
+    throw ucxx::Error("Bootstrap failed receiving table");
+
+  std::string table(tableSize, '\0');
+  if (wait(_endpoints[0]->streamRecv(&table.front(), table.size(), false), deadline) != UCS_OK)
+    throw ucxx::Error("Bootstrap failed receiving table");
+
+  return deserializeAddresses(table, worldSize);
+}
+
+std::vector<std::shared_ptr<Endpoint>> bootstrapEndpoints(std::shared_ptr<Worker> worker,
+                                                          BootstrapBackend& backend,
+                                                          const size_t rank,
+                                                          const size_t worldSize,
+                                                          const std::chrono::milliseconds timeout,
+                                                          const bool endpointErrorHandling)
+{
+  if (rank >= worldSize)
+    throw ucxx::Error("Bootstrap rank " + std::to_string(rank) + " out of range for " +
+                      std::to_string(worldSize) + " ranks");
+
+  backend.publish(rank, worker->getAddress()->getString());
+  auto addresses = backend.fetchAll(worldSize, timeout);
+
+  std::vector<std::shared_ptr<Endpoint>> endpoints(worldSize);
+  for (size_t peer = 0; peer < worldSize; ++peer) {
+    if (peer == rank) continue;
+    endpoints[peer] = worker->createEndpointFromWorkerAddress(
+      createAddressFromString(addresses[peer]), endpointErrorHandling);
+  }
+
+  ucxx_debug("Bootstrap rank %lu connected to %lu ranks", rank, worldSize - 1);
+
+  return endpoints;
+}
+
+}  // namespace ucxx
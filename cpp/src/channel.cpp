@@ -0,0 +1,229 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/channel.h>
+#include <ucxx/exception.h>
+#include <ucxx/log.h>
+
+namespace ucxx {
+
+namespace {
+
+/**
+ * Bind (`open == true`) channel `id` on `worker` to `endpoint` or release it, returning
+ * `false` if binding an identifier already bound to another endpoint of the worker.
+ */
+bool updateWorkerChannels(ucp_worker_h worker,
+                          const uint64_t id,
+                          ucp_ep_h endpoint,
+                          const bool open)
+{
+  // Number of open channels per identifier, by the endpoint the identifier is bound to
+  static std::mutex mutex;
+  static std::map<std::pair<ucp_worker_h, uint64_t>, std::pair<ucp_ep_h, size_t>> channels;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  auto& channel = channels[{worker, id}];
+  if (open) {
+    if (channel.second > 0 && channel.first != endpoint) return false;
+    channel.first = endpoint;
+    ++channel.second;
+  } else if (--channel.second == 0) {
+    channels.erase({worker, id});
+  }
+  return true;
+}
+
+}  // namespace
+
+Channel::Channel(std::shared_ptr<Endpoint> endpoint, const uint64_t id) : _id(id)
+{
+  if (endpoint == nullptr || endpoint->getHandle() == nullptr)
+    throw ucxx::Error("Endpoint not initialized");
+  if (id > MaxChannelId) throw ucxx::Error("Channel identifier larger than MaxChannelId");
+  // Receives match on the worker, the same identifier over another endpoint would match
+  // messages of both peers.
+  if (!updateWorkerChannels(endpoint->getWorker()->getHandle(), id, endpoint->getHandle(), true))
+    throw ucxx::Error("Channel identifier already open over another endpoint of the worker");
+
+  setParent(endpoint);
+  ucxx_trace("Channel created: %p, endpoint: %p, id: %lu", this, endpoint.get(), _id);
+}
+
+std::shared_ptr<Channel> createChannel(std::shared_ptr<Endpoint> endpoint, const uint64_t id)
+{
+  return std::shared_ptr<Channel>(new Channel(endpoint, id));
+}
+
+Channel::~Channel()
+{
+  size_t canceled = close();
+  ucxx_trace("Channel destroyed: %p, id: %lu, canceled %lu requests", this, _id, canceled);
+}
+
+uint64_t Channel::getId() const { return _id; }
+
+std::shared_ptr<Endpoint> Channel::getEndpoint() const
+{
+  return std::static_pointer_cast<Endpoint>(_parent);
+}
+
+ucp_tag_t Channel::getEndpointTag(const ucp_tag_t tag) const
+{
+  if (tag > MaxChannelTag) throw ucxx::Error("Channel tag larger than MaxChannelTag");
+  return ChannelTagBit | (_id << ChannelTagBits) | tag;
+}
+
+std::shared_ptr<Request> Channel::submit(
+  const bool isSend,
+  const size_t length,
+  RequestCallbackUserFunction callbackFunction,
+  RequestCallbackUserData callbackData,
+  std::function<std::shared_ptr<Request>(RequestCallbackUserFunction)> submit)
+{
+  if (_closed) throw ucxx::NotConnectedError("Channel closed");
+
+  uint64_t operation;
+  std::vector<std::shared_ptr<Request>> completed;
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    operation = _nextOperation++;
+    // Release completed requests outside of their callbacks
+    std::swap(completed, _completed);
+  }
+
+  auto channel  = weak_from_this();
+  auto callback = [channel, operation, callbackFunction, callbackData](ucs_status_t status,
+                                                                       std::shared_ptr<void>) {
+    if (auto c = channel.lock()) std::static_pointer_cast<Channel>(c)->markCompleted(operation);
+    if (callbackFunction) callbackFunction(status, callbackData);
+  };
+
+  auto request = submit(callback);
+
+  bool cancel = false;
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (isSend) {
+      ++_stats.sendCount;
+      _stats.sendBytes += length;
+    } else {
+      ++_stats.recvCount;
+      _stats.recvBytes += length;
+    }
+
+    if (_completedEarly.erase(operation) == 0) {
+      // The channel may have been closed after submission, in which case the request
+      // was not seen by `close()` and is canceled here instead.
+      if (_closed) {
+        cancel = true;
+        ++_stats.canceled;
+      } else {
+        _inflightRequests.emplace(operation, request);
+      }
+    }
+  }
+  if (cancel) request->cancel();
+
+  return request;
+}
+
+void Channel::markCompleted(const uint64_t operation)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  ++_stats.completed;
+
+  auto search = _inflightRequests.find(operation);
+  if (search != _inflightRequests.end()) {
+    _completed.push_back(std::move(search->second));
+    _inflightRequests.erase(search);
+  } else if (!_closed) {
+    // Completed before `submit()` registered it
+    _completedEarly.insert(operation);
+  }
+}
+
+std::shared_ptr<Request> Channel::tagSend(
+  void* buffer,
+  size_t length,
+  ucp_tag_t tag,
+  const bool enablePythonFuture,
+  RequestCallbackUserFunction callbackFunction,
+  RequestCallbackUserData callbackData)
+{
+  auto endpoint    = getEndpoint();
+  auto endpointTag = getEndpointTag(tag);
+  return submit(true, length, callbackFunction, callbackData, [&](auto callback) {
+    return endpoint->tagSend(buffer, length, endpointTag, enablePythonFuture, callback);
+  });
+}
+
+std::shared_ptr<Request> Channel::tagRecv(
+  void* buffer,
+  size_t length,
+  ucp_tag_t tag,
+  const bool enablePythonFuture,
+  RequestCallbackUserFunction callbackFunction,
+  RequestCallbackUserData callbackData)
+{
+  auto endpoint    = getEndpoint();
+  auto endpointTag = getEndpointTag(tag);
+  return submit(false, length, callbackFunction, callbackData, [&](auto callback) {
+    return endpoint->tagRecv(buffer, length, endpointTag, enablePythonFuture, callback);
+  });
+}
+
+ChannelStats Channel::getStats()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  auto stats     = _stats;
+  stats.inflight = _inflightRequests.size();
+  return stats;
+}
+
+size_t Channel::getInflightCount()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _inflightRequests.size();
+}
+
+bool Channel::isClosed() const { return _closed; }
+
+size_t Channel::close()
+{
+  if (_closed.exchange(true)) return 0;
+
+  updateWorkerChannels(getEndpoint()->getWorker()->getHandle(), _id, nullptr, false);
+
+  std::unordered_map<uint64_t, std::shared_ptr<Request>> inflightRequests;
+  std::vector<std::shared_ptr<Request>> completed;
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::swap(inflightRequests, _inflightRequests);
+    std::swap(completed, _completed);
+    _completedEarly.clear();
+    _stats.canceled += inflightRequests.size();
+  }
+
+  // Cancel outside the lock, cancelation may execute completion callbacks immediately
+  for (auto& r : inflightRequests)
+    r.second->cancel();
+
+  ucxx_debug("Channel %p closed, id: %lu, canceled %lu requests",
+             this,
+             _id,
+             inflightRequests.size());
+  return inflightRequests.size();
+}
+
+}  // namespace ucxx
@@ -0,0 +1,295 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <ucxx/codec.h>
+#include <ucxx/copy_engine.h>
+#include <ucxx/exception.h>
+
+namespace ucxx {
+
+namespace {
+
+constexpr size_t LzMinMatch  = 4;
+constexpr size_t LzHashBits  = 12;
+constexpr size_t LzMaxOffset = 65535;
+
+/**
+ * Byte-shuffle transposes `size / elementSize` elements so that the n-th byte of all
+ * elements is stored contiguously, which typically exposes long runs in numerical data.
+ * Trailing bytes not forming a complete element are copied unmodified. The loops are kept
+ * free of branches and aliasing so that the compiler can vectorize them.
+ */
+void shuffle(const uint8_t* __restrict__ input,
+             uint8_t* __restrict__ output,
+             const size_t size,
+             const size_t elementSize)
+{
+  const size_t elements = size / elementSize;
+  for (size_t byte = 0; byte < elementSize; ++byte)
+    for (size_t element = 0; element < elements; ++element)
+      output[byte * elements + element] = input[element * elementSize + byte];
+
+  const size_t tail = elements * elementSize;
+  std::memcpy(output + tail, input + tail, size - tail);
+}
+
+void unshuffle(const uint8_t* __restrict__ input,
+               uint8_t* __restrict__ output,
+               const size_t size,
+               const size_t elementSize)
+{
+  const size_t elements = size / elementSize;
+  for (size_t byte = 0; byte < elementSize; ++byte)
+    for (size_t element = 0; element < elements; ++element)
+      output[element * elementSize + byte] = input[byte * elements + element];
+
+  const size_t tail = elements * elementSize;
+  std::memcpy(output + tail, input + tail, size - tail);
+}
+
+uint32_t read32(const uint8_t* data)
+{
+  uint32_t value;
+  std::memcpy(&value, data, sizeof(value));
+  return value;
+}
+
+uint32_t lzHash(const uint32_t sequence)
+{
+  return (sequence * 2654435761u) >> (32 - LzHashBits);
+}
+
+bool lzWriteLength(uint8_t*& output, const uint8_t* outputEnd, size_t length)
+{
+  for (; length >= 255; length -= 255) {
+    if (output >= outputEnd) return false;
+    *output++ = 255;
+  }
+  if (output >= outputEnd) return false;
+  *output++ = static_cast<uint8_t>(length);
+  return true;
+}
+
+/**
+ * Write a sequence in a format similar to that of LZ4 blocks: a token with literal and
+ * match lengths in the high and low nibbles respectively, extra literal length bytes, the
+ * literals, a 16-bit little-endian offset and extra match length bytes. The last sequence
+ * of a block contains only literals, and is written with `matchLength == 0`.
+ */
+bool lzWriteSequence(uint8_t*& output,
+                     const uint8_t* outputEnd,
+                     const uint8_t* literals,
+                     const size_t literalLength,
+                     const size_t offset,
+                     const size_t matchLength)
+{
+  if (output >= outputEnd) return false;
+  uint8_t* token = output++;
+  *token         = static_cast<uint8_t>(std::min<size_t>(literalLength, 15) << 4);
+
+  if (literalLength >= 15 && !lzWriteLength(output, outputEnd, literalLength - 15)) return false;
+  if (static_cast<size_t>(outputEnd - output) < literalLength) return false;
+  std::memcpy(output, literals, literalLength);
+  output += literalLength;
+
+  if (matchLength == 0) return true;
+
+  if (outputEnd - output < 2) return false;
+  *output++ = static_cast<uint8_t>(offset & 0xff);
+  *output++ = static_cast<uint8_t>(offset >> 8);
+
+  const size_t extraMatchLength = matchLength - LzMinMatch;
+  *token |= static_cast<uint8_t>(std::min<size_t>(extraMatchLength, 15));
+  if (extraMatchLength >= 15 && !lzWriteLength(output, outputEnd, extraMatchLength - 15))
+    return false;
+
+  return true;
+}
+
+/**
+ * Compress `size` bytes from `input` into at most `capacity` bytes of `output`, returning
+ * the compressed size or `0` if the compressed data does not fit.
+ */
+size_t lzCompress(const uint8_t* input, const size_t size, uint8_t* output, const size_t capacity)
+{
+  uint8_t* current         = output;
+  const uint8_t* outputEnd = output + capacity;
+  std::vector<uint32_t> table(1 << LzHashBits, 0);
+
+  size_t anchor = 0;
+  size_t pos    = 0;
+  if (size >= LzMinMatch) {
+    const size_t limit = size - LzMinMatch;
+    while (pos <= limit) {
+      const uint32_t sequence = read32(input + pos);
+      const uint32_t hash     = lzHash(sequence);
+      const size_t candidate  = table[hash];
+      table[hash]             = static_cast<uint32_t>(pos);
+
+      if (candidate < pos && pos - candidate <= LzMaxOffset &&
+          read32(input + candidate) == sequence) {
+        size_t matchLength = LzMinMatch;
+        while (pos + matchLength < size &&
+               input[candidate + matchLength] == input[pos + matchLength])
+          ++matchLength;
+
+        if (!lzWriteSequence(
+              current, outputEnd, input + anchor, pos - anchor, pos - candidate, matchLength))
+          return 0;
+
+        pos += matchLength;
+        anchor = pos;
+      } else {
+        ++pos;
+      }
+    }
+  }
+
+  if (!lzWriteSequence(current, outputEnd, input + anchor, size - anchor, 0, 0)) return 0;
+
+  return current - output;
+}
+
+void lzDecompress(const uint8_t* input, const size_t size, uint8_t* output, const size_t outputSize)
+{
+  const uint8_t* inputEnd = input + size;
+  size_t pos              = 0;
+
+  auto malformed  = []() { throw ucxx::Error("Malformed LZ-compressed chunk"); };
+  auto readLength = [&input, inputEnd, &malformed](size_t length) {
+    if (length == 15) {
+      uint8_t extra;
+      do {
+        if (input >= inputEnd) malformed();
+        extra = *input++;
+        length += extra;
+      } while (extra == 255);
+    }
+    return length;
+  };
+
+  while (input < inputEnd) {
+    const uint8_t token = *input++;
+
+    const size_t literalLength = readLength(token >> 4);
+    if (static_cast<size_t>(inputEnd - input) < literalLength || outputSize - pos < literalLength)
+      malformed();
+    std::memcpy(output + pos, input, literalLength);
+    input += literalLength;
+    pos += literalLength;
+
+    if (input == inputEnd) break;
+
+    if (inputEnd - input < 2) malformed();
+    const size_t offset = input[0] | (static_cast<size_t>(input[1]) << 8);
+    input += 2;
+
+    const size_t matchLength = readLength(token & 15) + LzMinMatch;
+    if (offset == 0 || offset > pos || outputSize - pos < matchLength) malformed();
+
+    // Matches may overlap with the output being written, thus must be copied bytewise.
+    const uint8_t* match = output + pos - offset;
+    for (size_t i = 0; i < matchLength; ++i)
+      output[pos + i] = match[i];
+    pos += matchLength;
+  }
+
+  if (pos != outputSize) malformed();
+}
+
+}  // namespace
+
+void codecValidateParams(const CodecParams& params)
+{
+  if (params.codec < CodecType::Raw || params.codec >= CodecType::Invalid)
+    throw ucxx::Error("Invalid codec");
+  if (params.chunkSize == 0 || params.chunkSize > std::numeric_limits<uint32_t>::max())
+    throw ucxx::Error("Codec chunk size must be between 1 and " +
+                      std::to_string(std::numeric_limits<uint32_t>::max()));
+  if (params.elementSize == 0 || params.elementSize > std::numeric_limits<uint8_t>::max())
+    throw ucxx::Error("Codec element size must be between 1 and " +
+                      std::to_string(std::numeric_limits<uint8_t>::max()));
+  if (!(params.maxRatio > 0.0)) throw ucxx::Error("Codec maximum ratio must be positive");
+}
+
+size_t codecMaxEncodedSize(const size_t decodedSize)
+{
+  // Chunks that do not compress are sent raw, thus never grow beyond the header.
+  return sizeof(CodecChunkHeader) + decodedSize;
+}
+
+std::string codecEncode(const CodecParams& params, const void* data, const size_t size)
+{
+  CodecChunkHeader header{.codec       = static_cast<uint32_t>(params.codec),
+                          .elementSize = static_cast<uint32_t>(params.elementSize),
+                          .decodedSize = size,
+                          .encodedSize = 0};
+
+  std::string encoded(codecMaxEncodedSize(size), '\0');
+  auto input    = reinterpret_cast<const uint8_t*>(data);
+  auto payload  = reinterpret_cast<uint8_t*>(&encoded[sizeof(header)]);
+  auto capacity = static_cast<size_t>(static_cast<double>(size) * std::min(params.maxRatio, 1.0));
+
+  if (params.codec == CodecType::Lz) {
+    header.encodedSize = lzCompress(input, size, payload, capacity);
+  } else if (params.codec == CodecType::ShuffleLz) {
+    std::vector<uint8_t> shuffled(size);
+    shuffle(input, shuffled.data(), size, params.elementSize);
+    header.encodedSize = lzCompress(shuffled.data(), size, payload, capacity);
+  }
+
+  if (header.encodedSize == 0) {
+    header.codec       = static_cast<uint32_t>(CodecType::Raw);
+    header.encodedSize = size;
+    copyMemory(payload, input, size);
+  }
+
+  std::memcpy(&encoded[0], &header, sizeof(header));
+  encoded.resize(sizeof(header) + header.encodedSize);
+  return encoded;
+}
+
+void codecDecode(const void* encoded,
+                 const size_t encodedSize,
+                 void* output,
+                 const size_t outputSize)
+{
+  CodecChunkHeader header;
+  if (encodedSize < sizeof(header)) throw ucxx::Error("Encoded chunk is truncated");
+  std::memcpy(&header, encoded, sizeof(header));
+
+  if (header.decodedSize != outputSize)
+    throw ucxx::Error("Encoded chunk decodes to " + std::to_string(header.decodedSize) +
+                      " bytes, expected " + std::to_string(outputSize));
+  if (header.encodedSize > encodedSize - sizeof(header))
+    throw ucxx::Error("Encoded chunk is truncated");
+
+  auto payload = reinterpret_cast<const uint8_t*>(encoded) + sizeof(header);
+  auto decoded = reinterpret_cast<uint8_t*>(output);
+
+  switch (static_cast<CodecType>(header.codec)) {
+    case CodecType::Raw:
+      if (header.encodedSize != outputSize) throw ucxx::Error("Malformed raw chunk");
+      copyMemory(decoded, payload, outputSize);
+      break;
+    case CodecType::Lz: lzDecompress(payload, header.encodedSize, decoded, outputSize); break;
+    case CodecType::ShuffleLz: {
+      if (header.elementSize == 0) throw ucxx::Error("Malformed byte-shuffled chunk");
+      std::vector<uint8_t> shuffled(outputSize);
+      lzDecompress(payload, header.encodedSize, shuffled.data(), outputSize);
+      unshuffle(shuffled.data(), decoded, outputSize, header.elementSize);
+      break;
+    }
+    default: throw ucxx::Error("Unknown codec " + std::to_string(header.codec));
+  }
+}
+
+}  // namespace ucxx
@@ -38,32 +38,38 @@ ucp_config_t* Config::readUCXConfig(ConfigMap userOptions)
 
 ConfigMap Config::ucxConfigToMap()
 {
-  if (_configMap.empty()) {
-    FILE* textFileDescriptor = utils::createTextFileDescriptor();
+  std::istringstream text{utils::captureTextFileDescriptor([this](FILE* textFileDescriptor) {
     ucp_config_print(_handle, textFileDescriptor, NULL, UCS_CONFIG_PRINT_CONFIG);
-    std::istringstream text{utils::decodeTextFileDescriptor(textFileDescriptor)};
-
-    std::string delim = "=";
-    std::string line;
-    while (std::getline(text, line)) {
-      size_t split  = line.find(delim);
-      std::string k = line.substr(4, split - 4);  // 4 to strip "UCX_" prefix
-      std::string v = line.substr(split + delim.length(), std::string::npos);
-      _configMap[k] = v;
-    }
+  })};
+
+  ConfigMap configMap;
+  const std::string prefix = "UCX_";
+  const std::string delim  = "=";
+  std::string line;
+  while (std::getline(text, line)) {
+    size_t split = line.find(delim);
+    if (split == std::string::npos || line.compare(0, prefix.length(), prefix) != 0) continue;
+
+    std::string k = line.substr(prefix.length(), split - prefix.length());
+    std::string v = line.substr(split + delim.length(), std::string::npos);
+    configMap[k]  = v;
   }
 
-  return _configMap;
+  return configMap;
 }
 
-Config::Config(ConfigMap userOptions) { readUCXConfig(userOptions); }
+Config::Config(ConfigMap userOptions)
+{
+  readUCXConfig(userOptions);
+  _configMap = ucxConfigToMap();
+}
 
 Config::~Config()
 {
   if (this->_handle != nullptr) ucp_config_release(this->_handle);
 }
 
-ConfigMap Config::get() { return ucxConfigToMap(); }
+ConfigMap Config::get() const { return _configMap; }
 
 ucp_config_t* Config::getHandle() { return _handle; }
 
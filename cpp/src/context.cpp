@@ -4,11 +4,16 @@
  */
 #include <cstring>
 #include <iostream>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <utility>
 
 #include <ucxx/context.h>
+#include <ucxx/exception.h>
 #include <ucxx/log.h>
+#include <ucxx/memory_handle.h>
 #include <ucxx/utils/file_descriptor.h>
 #include <ucxx/utils/ucx.h>
 
@@ -28,39 +33,55 @@ Context::Context(const ConfigMap ucxConfig, const uint64_t featureFlags)
   utils::ucsErrorThrow(ucp_init(&params, this->_config.getHandle(), &this->_handle));
   ucxx_trace("Context created: %p", this->_handle);
 
-  // UCX supports CUDA if TLS is "all", or one of {"cuda",
-  // "cuda_copy", "cuda_ipc"} is in the active transports.
-  // If the transport list is negated ("^" at start), then it is to be
-  // interpreted as all \ given
+  computeCapabilities();
+
+  auto configMap = this->_config.get();
+  ucxx_info("UCP initiated using config: ");
+  for (const auto& kv : configMap)
+    ucxx_info("  %s: %s", kv.first.c_str(), kv.second.c_str());
+}
+
+void Context::computeCapabilities()
+{
   auto configMap = this->_config.get();
   auto tls       = configMap.find("TLS");
-  if (tls != configMap.end()) {
+  if (tls != configMap.end() && !tls->second.empty()) {
     auto tls_value = tls->second;
-    if (!tls_value.empty() && tls_value[0] == '^') {
-      this->_cudaSupport  = true;
-      std::size_t current = 1;  // Skip the ^
-      do {
-        // UCX_TLS lists disabled transports, if this contains either
-        // "cuda" or "cuda_copy", then there is no cuda support (just
-        // disabling "cuda_ipc" is fine)
-        auto next  = tls_value.find_first_of(',', current);
-        auto field = tls_value.substr(current, next - current);
-        current    = next + 1;
-        if (field == "cuda" || field == "cuda_copy") {
-          this->_cudaSupport = false;
-          break;
-        }
-      } while (current != std::string::npos + 1);
-    } else {
-      // UCX_TLS lists enabled transports, all, or anything with cuda
-      // enables cuda support
-      this->_cudaSupport = tls_value == "all" || tls_value.find("cuda") != std::string::npos;
+
+    // If the transport list is negated ("^" at start), then it is to be interpreted as
+    // all \ given
+    std::size_t current               = 0;
+    _capabilities.transportsExcluded = tls_value[0] == '^';
+    if (_capabilities.transportsExcluded) current = 1;  // Skip the ^
+    do {
+      auto next = tls_value.find_first_of(',', current);
+      _capabilities.transports.push_back(tls_value.substr(current, next - current));
+      current = next + 1;
+    } while (current != std::string::npos + 1);
+
+    // UCX supports CUDA if TLS is "all", or one of {"cuda", "cuda_copy", "cuda_ipc"} is
+    // in the active transports. If UCX_TLS lists disabled transports and contains either
+    // "cuda" or "cuda_copy", then there is no cuda support (just disabling "cuda_ipc" is
+    // fine).
+    _capabilities.cudaSupport = _capabilities.transportsExcluded;
+    for (const auto& field : _capabilities.transports) {
+      if (_capabilities.transportsExcluded && (field == "cuda" || field == "cuda_copy")) {
+        _capabilities.cudaSupport = false;
+        break;
+      } else if (!_capabilities.transportsExcluded &&
+                 (field == "all" || field.find("cuda") != std::string::npos)) {
+        _capabilities.cudaSupport = true;
+        break;
+      }
     }
   }
 
-  ucxx_info("UCP initiated using config: ");
-  for (const auto& kv : configMap)
-    ucxx_info("  %s: %s", kv.first.c_str(), kv.second.c_str());
+  ucp_context_attr_t attr{};
+  attr.field_mask = UCP_ATTR_FIELD_MEMORY_TYPES;
+  if (ucp_context_query(this->_handle, &attr) == UCS_OK)
+    _capabilities.memoryTypes = attr.memory_types;
+  else
+    ucxx_warn("Failed querying memory types supported by context %p", this->_handle);
 }
 
 std::shared_ptr<Context> createContext(const ConfigMap ucxConfig, const uint64_t featureFlags)
@@ -68,6 +89,45 @@ std::shared_ptr<Context> createContext(const ConfigMap ucxConfig, const uint64_t
   return std::shared_ptr<Context>(new Context(ucxConfig, featureFlags));
 }
 
+std::shared_ptr<Context> createContextFromProfile(const ConfigMap ucxConfig,
+                                                  const ContextProfile profile)
+{
+  return createContext(ucxConfig, Context::getProfileFeatureFlags(profile));
+}
+
+std::shared_ptr<Context> createSharedContext(const ConfigMap ucxConfig,
+                                             const uint64_t featureFlags)
+{
+  // `ConfigMap` is unordered, an ordered copy makes equal configurations compare equal.
+  using SharedContextKey = std::pair<std::map<std::string, std::string>, uint64_t>;
+
+  static std::mutex mutex;
+  static std::map<SharedContextKey, std::weak_ptr<Context>> contexts;
+
+  SharedContextKey key{{ucxConfig.begin(), ucxConfig.end()}, featureFlags};
+
+  std::lock_guard<std::mutex> lock(mutex);
+  auto context = contexts[key].lock();
+  if (context == nullptr) {
+    context       = createContext(ucxConfig, featureFlags);
+    contexts[key] = context;
+    ucxx_debug("Shared context created: %p", context->getHandle());
+  }
+  return context;
+}
+
+uint64_t Context::getProfileFeatureFlags(const ContextProfile profile)
+{
+  switch (profile) {
+    case ContextProfile::Full: return defaultFeatureFlags;
+    case ContextProfile::TagOnly: return UCP_FEATURE_TAG | UCP_FEATURE_WAKEUP;
+    case ContextProfile::StreamOnly: return UCP_FEATURE_STREAM | UCP_FEATURE_WAKEUP;
+    case ContextProfile::Rma: return UCP_FEATURE_RMA | UCP_FEATURE_TAG | UCP_FEATURE_WAKEUP;
+    case ContextProfile::PollingOnly: return defaultFeatureFlags & ~UCP_FEATURE_WAKEUP;
+    default: throw ucxx::Error("Unknown context profile");
+  }
+}
+
 Context::~Context()
 {
   if (this->_handle != nullptr) ucp_cleanup(this->_handle);
@@ -87,6 +147,8 @@ std::string Context::getInfo()
 
 uint64_t Context::getFeatureFlags() const { return _featureFlags; }
 
+const ContextCapabilities& Context::getCapabilities() const { return _capabilities; }
+
 std::shared_ptr<Worker> Context::createWorker(const bool enableDelayedSubmission)
 {
   auto context = std::dynamic_pointer_cast<Context>(shared_from_this());
@@ -94,4 +156,10 @@ std::shared_ptr<Worker> Context::createWorker(const bool enableDelayedSubmission
   return worker;
 }
 
+std::shared_ptr<MemoryHandle> Context::createMemoryHandle(const size_t size, void* buffer)
+{
+  auto context = std::dynamic_pointer_cast<Context>(shared_from_this());
+  return ucxx::createMemoryHandle(context, size, buffer);
+}
+
 }  // namespace ucxx
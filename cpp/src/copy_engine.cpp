@@ -0,0 +1,277 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <pthread.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <ucxx/copy_engine.h>
+#include <ucxx/log.h>
+
+namespace ucxx {
+
+namespace {
+
+constexpr uintptr_t PageSize = 4096;
+
+// Flags of `get_mempolicy`, defined locally to avoid a dependency on libnuma headers
+constexpr unsigned long MpolFNode = 1;
+constexpr unsigned long MpolFAddr = 2;
+
+/**
+ * Parse a Linux CPU list, such as `0-3,8,10-11`, into the list of CPUs it contains.
+ */
+std::vector<int> parseCpuList(const std::string& cpuList)
+{
+  std::vector<int> cpus;
+  std::stringstream ranges(cpuList);
+  std::string range;
+  while (std::getline(ranges, range, ',')) {
+    if (range.empty() || range == "\n") continue;
+    auto dash = range.find('-');
+    try {
+      int first = std::stoi(range.substr(0, dash));
+      int last  = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+      for (int cpu = first; cpu <= last; ++cpu)
+        cpus.push_back(cpu);
+    } catch (const std::exception&) {
+      return {};
+    }
+  }
+  return cpus;
+}
+
+/**
+ * Get the CPUs of each NUMA node from sysfs, stopping at the first node missing. Returns
+ * an empty list if the system exposes no NUMA topology.
+ */
+std::vector<std::vector<int>> getNumaNodeCpus()
+{
+  std::vector<std::vector<int>> nodeCpus;
+  for (size_t node = 0;; ++node) {
+    std::ifstream file("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+    if (!file) break;
+    std::string cpuList;
+    std::getline(file, cpuList);
+    nodeCpus.push_back(parseCpuList(cpuList));
+  }
+  return nodeCpus;
+}
+
+}  // namespace
+
+/**
+ * @brief A copy split in chunks, living on the stack of the caller of `copy()`.
+ */
+struct CopyEngine::Job {
+  size_t remaining{0};           ///< Number of chunks not yet copied
+  std::mutex mutex{};            ///< Mutex to access `remaining`
+  std::condition_variable cv{};  ///< Notifies the caller when `remaining` reaches zero
+};
+
+CopyEngine::CopyEngine(const CopyEngineParams& params) : _params(params)
+{
+  if (_params.minChunkSize == 0) _params.minChunkSize = PageSize;
+
+  if (_params.numaAware) {
+    _nodeCpus = getNumaNodeCpus();
+    // A single node gains nothing from pinning, and empty CPU lists can't be pinned to
+    bool valid = std::all_of(
+      _nodeCpus.begin(), _nodeCpus.end(), [](const auto& cpus) { return !cpus.empty(); });
+    if (_nodeCpus.size() < 2 || !valid) _nodeCpus.clear();
+  }
+
+  _pools.resize(std::max(_nodeCpus.size(), static_cast<size_t>(1)));
+
+  ucxx_trace("CopyEngine created: %p, threads: %lu, inline threshold: %lu, NUMA nodes: %lu",
+             this,
+             _params.numThreads,
+             _params.inlineThreshold,
+             _pools.size());
+}
+
+CopyEngine::~CopyEngine()
+{
+  for (auto& pool : _pools) {
+    if (pool == nullptr) continue;
+    {
+      std::lock_guard<std::mutex> lock(pool->mutex);
+      pool->stop = true;
+    }
+    pool->cv.notify_all();
+    for (auto& thread : pool->threads)
+      thread.join();
+  }
+
+  ucxx_trace("CopyEngine destroyed: %p", this);
+}
+
+CopyEngine::Pool& CopyEngine::getPool(const size_t node)
+{
+  std::lock_guard<std::mutex> lock(_poolsMutex);
+  auto& pool = _pools[node];
+  if (pool == nullptr) {
+    pool = std::make_unique<Pool>();
+    std::vector<int> cpus = _nodeCpus.empty() ? std::vector<int>{} : _nodeCpus[node];
+    for (size_t i = 0; i < _params.numThreads; ++i)
+      pool->threads.emplace_back(CopyEngine::runHelper, std::ref(*pool), cpus);
+    ucxx_debug(
+      "CopyEngine %p started %lu helpers for NUMA node %lu", this, _params.numThreads, node);
+  }
+  return *pool;
+}
+
+size_t CopyEngine::getPoolIndex(const void* address) const
+{
+  if (_nodeCpus.empty()) return 0;
+
+  int node = -1;
+  if (syscall(SYS_get_mempolicy, &node, nullptr, 0, address, MpolFNode | MpolFAddr) != 0 ||
+      node < 0 || static_cast<size_t>(node) >= _nodeCpus.size())
+    return 0;
+  return node;
+}
+
+void CopyEngine::copyChunk(const Chunk& chunk)
+{
+  std::memcpy(chunk.dst, chunk.src, chunk.size);
+
+  // Notify while holding the lock, the job is destroyed as soon as the caller observes
+  // `remaining` reaching zero.
+  std::lock_guard<std::mutex> lock(chunk.job->mutex);
+  if (--chunk.job->remaining == 0) chunk.job->cv.notify_one();
+}
+
+void CopyEngine::runHelper(Pool& pool, std::vector<int> cpus)
+{
+  if (!cpus.empty()) {
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    for (const auto cpu : cpus)
+      if (cpu < CPU_SETSIZE) CPU_SET(cpu, &cpuSet);
+    if (pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet) != 0)
+      ucxx_debug("CopyEngine helper failed to set CPU affinity, running unpinned");
+  }
+
+  while (true) {
+    Chunk chunk;
+    {
+      std::unique_lock<std::mutex> lock(pool.mutex);
+      pool.cv.wait(lock, [&pool] { return pool.stop || !pool.chunks.empty(); });
+      if (pool.chunks.empty()) return;
+      chunk = pool.chunks.front();
+      pool.chunks.pop_front();
+    }
+    copyChunk(chunk);
+  }
+}
+
+void CopyEngine::copy(void* dst, const void* src, const size_t size)
+{
+  const size_t maxChunks = std::min(_params.numThreads + 1, size / _params.minChunkSize);
+  if (size < _params.inlineThreshold || _params.numThreads == 0 || maxChunks < 2) {
+    std::memcpy(dst, src, size);
+    ++_inlineCopies;
+    _bytes += size;
+    return;
+  }
+
+  // Chunk boundaries are page-aligned in the destination, so that no page is written by
+  // more than one thread and each chunk can be assigned to the node of its pages.
+  const size_t chunkSize = (size / maxChunks + PageSize - 1) / PageSize * PageSize;
+  const auto dstAddress  = reinterpret_cast<uintptr_t>(dst);
+  std::vector<Chunk> chunks;
+  Job job;
+  for (size_t offset = 0; offset < size;) {
+    size_t end = (dstAddress + offset + chunkSize + PageSize - 1) / PageSize * PageSize;
+    end        = std::min(end - dstAddress, size);
+    chunks.push_back({static_cast<char*>(dst) + offset,
+                      static_cast<const char*>(src) + offset,
+                      end - offset,
+                      &job});
+    offset = end;
+  }
+  job.remaining = chunks.size();
+
+  // The first chunk is copied by the caller, the others are queued to the pool local to
+  // their destination.
+  std::vector<Pool*> pools;
+  for (size_t i = 1; i < chunks.size(); ++i) {
+    auto& pool = getPool(getPoolIndex(chunks[i].dst));
+    {
+      std::lock_guard<std::mutex> lock(pool.mutex);
+      pool.chunks.push_back(chunks[i]);
+    }
+    pool.cv.notify_one();
+    if (std::find(pools.begin(), pools.end(), &pool) == pools.end()) pools.push_back(&pool);
+  }
+
+  copyChunk(chunks[0]);
+
+  // Help copying chunks still queued rather than idling, possibly of other callers.
+  for (auto pool : pools) {
+    while (true) {
+      Chunk chunk;
+      {
+        std::lock_guard<std::mutex> lock(pool->mutex);
+        if (pool->chunks.empty()) break;
+        chunk = pool->chunks.front();
+        pool->chunks.pop_front();
+      }
+      copyChunk(chunk);
+    }
+  }
+
+  {
+    std::unique_lock<std::mutex> lock(job.mutex);
+    job.cv.wait(lock, [&job] { return job.remaining == 0; });
+  }
+
+  ++_parallelCopies;
+  _chunks += chunks.size();
+  _bytes += size;
+}
+
+const CopyEngineParams& CopyEngine::getParams() const { return _params; }
+
+size_t CopyEngine::getNumaNodeCount() const { return _pools.size(); }
+
+CopyEngineStats CopyEngine::getStats() const
+{
+  return CopyEngineStats{.inlineCopies   = _inlineCopies,
+                         .parallelCopies = _parallelCopies,
+                         .chunks         = _chunks,
+                         .bytes          = _bytes};
+}
+
+CopyEngine& getDefaultCopyEngine()
+{
+  // Helpers only pay off if they run on other CPUs than the caller
+  static CopyEngine copyEngine{[]() {
+    CopyEngineParams params{};
+    const size_t numCpus = std::max(std::thread::hardware_concurrency(), 1u);
+    params.numThreads    = std::min(params.numThreads, numCpus - 1);
+    return params;
+  }()};
+  return copyEngine;
+}
+
+void copyMemory(void* dst, const void* src, const size_t size)
+{
+  getDefaultCopyEngine().copy(dst, src, size);
+}
+
+}  // namespace ucxx
@@ -0,0 +1,256 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <ucxx/copy_engine.h>
+#include <ucxx/dedup.h>
+
+namespace ucxx {
+
+namespace {
+
+constexpr uint64_t Prime1 = 11400714785074694791ull;
+constexpr uint64_t Prime2 = 14029467366897019727ull;
+constexpr uint64_t Prime3 = 1609587929392839161ull;
+constexpr uint64_t Prime4 = 9650029242287828579ull;
+constexpr uint64_t Prime5 = 2870177450012600261ull;
+
+uint64_t rotl(const uint64_t value, const int bits)
+{
+  return (value << bits) | (value >> (64 - bits));
+}
+
+uint64_t read64(const uint8_t* data)
+{
+  uint64_t value;
+  std::memcpy(&value, data, sizeof(value));
+  return value;
+}
+
+uint32_t read32(const uint8_t* data)
+{
+  uint32_t value;
+  std::memcpy(&value, data, sizeof(value));
+  return value;
+}
+
+uint64_t xxhRound(uint64_t accumulator, const uint64_t input)
+{
+  accumulator += input * Prime2;
+  accumulator = rotl(accumulator, 31);
+  return accumulator * Prime1;
+}
+
+uint64_t mergeRound(uint64_t accumulator, const uint64_t value)
+{
+  accumulator ^= xxhRound(0, value);
+  return accumulator * Prime1 + Prime4;
+}
+
+}  // namespace
+
+double DedupStats::hitRate() const
+{
+  return frames == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(frames);
+}
+
+uint64_t dedupFingerprint(const void* data, const size_t size)
+{
+  auto input     = reinterpret_cast<const uint8_t*>(data);
+  const auto end = input + size;
+  uint64_t hash  = 0;
+
+  if (size >= 32) {
+    // Four independent accumulators, each consuming one 8-byte lane of every 32-byte stripe.
+    uint64_t lanes[4] = {Prime1 + Prime2, Prime2, 0, -Prime1};
+    for (; end - input >= 32; input += 32)
+      for (size_t lane = 0; lane < 4; ++lane)
+        lanes[lane] = xxhRound(lanes[lane], read64(input + lane * 8));
+
+    hash = rotl(lanes[0], 1) + rotl(lanes[1], 7) + rotl(lanes[2], 12) + rotl(lanes[3], 18);
+    for (size_t lane = 0; lane < 4; ++lane)
+      hash = mergeRound(hash, lanes[lane]);
+  } else {
+    hash = Prime5;
+  }
+
+  hash += size;
+
+  for (; end - input >= 8; input += 8)
+    hash = rotl(hash ^ xxhRound(0, read64(input)), 27) * Prime1 + Prime4;
+  if (end - input >= 4) {
+    hash = rotl(hash ^ (static_cast<uint64_t>(read32(input)) * Prime1), 23) * Prime2 + Prime3;
+    input += 4;
+  }
+  for (; input < end; ++input)
+    hash = rotl(hash ^ (*input * Prime5), 11) * Prime1;
+
+  hash ^= hash >> 33;
+  hash *= Prime2;
+  hash ^= hash >> 29;
+  hash *= Prime3;
+  hash ^= hash >> 32;
+  return hash;
+}
+
+DedupCache::DedupCache(const DedupParams& params, const bool storeData)
+  : _params(params), _storeData(storeData)
+{
+}
+
+const DedupParams& DedupCache::getParams() const { return _params; }
+
+std::list<DedupCache::Entry>::iterator DedupCache::find(const uint64_t fingerprint,
+                                                        const size_t size)
+{
+  auto it = _index.find(fingerprint);
+  if (it == _index.end() || it->second->size != size) return _lru.end();
+  return it->second;
+}
+
+void DedupCache::insert(const uint64_t fingerprint, const size_t size, const void* data)
+{
+  // Frames that can never fit are skipped identically by sender and receiver.
+  if (size > _params.maxBytes || _params.maxEntries == 0) return;
+
+  auto it = _index.find(fingerprint);
+  if (it != _index.end() && it->second->size == size) {
+    _lru.splice(_lru.begin(), _lru, it->second);
+    return;
+  } else if (it != _index.end()) {
+    _bytes -= it->second->size;
+    _lru.erase(it->second);
+    _index.erase(it);
+  }
+
+  Entry entry{.fingerprint = fingerprint, .size = size};
+  if (_storeData)
+    entry.data = std::make_shared<std::string>(reinterpret_cast<const char*>(data), size);
+  _lru.push_front(std::move(entry));
+  _index[fingerprint] = _lru.begin();
+  _bytes += size;
+
+  while (_lru.size() > _params.maxEntries || _bytes > _params.maxBytes) {
+    _bytes -= _lru.back().size;
+    _index.erase(_lru.back().fingerprint);
+    _lru.pop_back();
+  }
+}
+
+void DedupCache::clear()
+{
+  _lru.clear();
+  _index.clear();
+  _bytes = 0;
+}
+
+std::vector<int> DedupCache::planSend(const std::vector<uint64_t>& fingerprint,
+                                      const std::vector<size_t>& size,
+                                      const std::vector<int>& eligible,
+                                      uint64_t& epoch)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  epoch = _epoch;
+  std::vector<int> action(size.size(), static_cast<int>(DedupAction::None));
+
+  // References are decided against the cache state prior to this transfer, which is the
+  // state the receiver resolves them against.
+  for (size_t i = 0; i < size.size(); ++i) {
+    if (!eligible[i]) continue;
+
+    ++_stats.frames;
+    if (find(fingerprint[i], size[i]) != _lru.end()) {
+      action[i] = static_cast<int>(DedupAction::Reference);
+      ++_stats.hits;
+      _stats.bytesSaved += size[i] - sizeof(uint64_t);
+    } else {
+      action[i] = static_cast<int>(DedupAction::Store);
+    }
+  }
+
+  for (size_t i = 0; i < size.size(); ++i)
+    if (action[i] != static_cast<int>(DedupAction::None))
+      insert(fingerprint[i], size[i], nullptr);
+
+  return action;
+}
+
+void DedupCache::invalidate(const uint64_t epoch)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  // Multiple failed transfers of the same epoch invalidate the cache only once.
+  if (epoch != _epoch) return;
+
+  clear();
+  ++_epoch;
+}
+
+bool DedupCache::applyRecv(const std::vector<int>& action,
+                           const std::vector<uint64_t>& fingerprint,
+                           const std::vector<size_t>& size,
+                           const std::vector<void*>& data,
+                           const uint64_t epoch)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  if (epoch > _epoch) {
+    clear();
+    _epoch = epoch;
+  } else if (epoch < _epoch) {
+    // The sender invalidated that epoch, the frames it referenced may be gone.
+    _stats.frames += std::count_if(action.begin(), action.end(), [](int a) {
+      return a != static_cast<int>(DedupAction::None);
+    });
+    return std::none_of(action.begin(), action.end(), [](int a) {
+      return a == static_cast<int>(DedupAction::Reference);
+    });
+  }
+
+  std::vector<uint64_t> frameFingerprint(fingerprint);
+  std::vector<int> store(action.size(), 0);
+  bool resolved = true;
+
+  for (size_t i = 0; i < action.size(); ++i) {
+    if (action[i] == static_cast<int>(DedupAction::None)) continue;
+
+    ++_stats.frames;
+    if (action[i] == static_cast<int>(DedupAction::Reference)) {
+      auto it = find(fingerprint[i], size[i]);
+      if (it == _lru.end()) {
+        resolved = false;
+        continue;
+      }
+      copyMemory(data[i], it->data->data(), size[i]);
+      ++_stats.hits;
+      _stats.bytesSaved += size[i] - sizeof(uint64_t);
+    } else {
+      frameFingerprint[i] = dedupFingerprint(data[i], size[i]);
+    }
+    store[i] = 1;
+  }
+
+  for (size_t i = 0; i < action.size(); ++i)
+    if (store[i]) insert(frameFingerprint[i], size[i], data[i]);
+
+  return resolved;
+}
+
+DedupStats DedupCache::getStats()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _stats;
+}
+
+}  // namespace ucxx
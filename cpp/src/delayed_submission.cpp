@@ -13,6 +13,54 @@
 
 namespace ucxx {
 
+namespace {
+
+// The collection whose worker lock is held by the calling thread, if any
+thread_local const DelayedSubmissionCollection* lockedCollection = nullptr;
+
+}  // namespace
+
+DelayedSubmissionCollection::WorkerLock::WorkerLock(DelayedSubmissionCollection* collection,
+                                                    const bool tryLock)
+{
+  if (collection == nullptr) return;
+  if (lockedCollection == collection) {
+    _locked = true;
+    return;
+  }
+
+  // Counted before reading the policy, `trySubmit()` either sees this thread or this
+  // thread sees the policy that submits immediately and locks.
+  ++collection->_unlocked;
+  if (collection->_policy != DelayedSubmissionPolicy::Adaptive) {
+    _unlocked = collection;
+    _locked   = true;
+    return;
+  }
+  --collection->_unlocked;
+
+  _lock = tryLock ? std::unique_lock<std::mutex>(collection->_workerMutex, std::try_to_lock)
+                  : std::unique_lock<std::mutex>(collection->_workerMutex);
+  if (!_lock.owns_lock()) return;
+
+  _previous        = lockedCollection;
+  lockedCollection = collection;
+  _locked          = true;
+}
+
+DelayedSubmissionCollection::WorkerLock::~WorkerLock()
+{
+  if (_unlocked != nullptr) --_unlocked->_unlocked;
+  if (_lock.owns_lock()) lockedCollection = _previous;
+}
+
+bool DelayedSubmissionCollection::WorkerLock::isLocked() const { return _locked; }
+
+bool DelayedSubmissionCollection::WorkerLock::isReentrant() const
+{
+  return _locked && !_lock.owns_lock() && _unlocked == nullptr;
+}
+
 DelayedSubmission::DelayedSubmission(const bool send,
                                      void* buffer,
                                      const size_t length,
@@ -23,6 +71,9 @@ DelayedSubmission::DelayedSubmission(const bool send,
 
 void DelayedSubmissionCollection::process()
 {
+  // Held while submitting, so that immediate submissions can't overtake pending ones
+  WorkerLock workerLock(this);
+
   if (_collection.size() > 0) {
     ucxx_trace_req("Submitting %lu requests", _collection.size());
 
@@ -52,8 +103,42 @@ void DelayedSubmissionCollection::registerRequest(DelayedSubmissionCallbackType
     std::lock_guard<std::mutex> lock(_mutex);
     _collection.push_back(r);
   }
+  ++_delayed;
   ucxx_trace_req("Registered submit request: %p",
                  callback.target<void (*)(std::shared_ptr<void>)>());
 }
 
+bool DelayedSubmissionCollection::trySubmit(const DelayedSubmissionCallbackType& callback)
+{
+  if (_policy != DelayedSubmissionPolicy::Adaptive) return false;
+
+  // Submissions from the thread holding the worker, such as those issued by completion
+  // callbacks of the progress thread, are executed in place.
+  WorkerLock workerLock(this, true);
+  if (!workerLock.isLocked()) return false;
+  if (!workerLock.isReentrant()) {
+    if (_unlocked > 0) return false;
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!_collection.empty()) return false;
+  }
+
+  ucxx_trace_req("Submitting request immediately: %p",
+                 callback.target<void (*)(std::shared_ptr<void>)>());
+  callback();
+  ++_direct;
+  return true;
+}
+
+void DelayedSubmissionCollection::setPolicy(const DelayedSubmissionPolicy policy)
+{
+  _policy = policy;
+}
+
+DelayedSubmissionPolicy DelayedSubmissionCollection::getPolicy() const { return _policy; }
+
+DelayedSubmissionStats DelayedSubmissionCollection::getStats() const
+{
+  return DelayedSubmissionStats{.direct = _direct, .delayed = _delayed};
+}
+
 }  // namespace ucxx
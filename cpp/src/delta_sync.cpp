@@ -0,0 +1,346 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/delta_sync.h>
+#include <ucxx/exception.h>
+#include <ucxx/log.h>
+#include <ucxx/request_helper.h>
+
+namespace ucxx {
+
+namespace {
+
+/**
+ * The descriptor of a round is laid out as the round number and the number of extents,
+ * followed by the offset and length of each extent, all as `uint64_t`.
+ */
+struct DeltaSyncExtent {
+  uint64_t offset;
+  uint64_t length;
+};
+
+std::shared_ptr<Context> getContext(std::shared_ptr<Endpoint> endpoint)
+{
+  auto worker = endpoint->getWorker();
+  return std::static_pointer_cast<Context>(worker->getParent());
+}
+
+void validateParams(std::shared_ptr<Endpoint> endpoint,
+                    void* buffer,
+                    const size_t size,
+                    const size_t blockSize)
+{
+  if (endpoint == nullptr || endpoint->getHandle() == nullptr)
+    throw ucxx::Error("Endpoint not initialized");
+  if (buffer == nullptr || size == 0) throw ucxx::Error("Delta sync buffer must not be empty");
+  if (blockSize == 0) throw ucxx::Error("Delta sync block size must be at least 1");
+}
+
+}  // namespace
+
+size_t deltaSyncMaxDescriptorSize(const size_t numBlocks)
+{
+  return 2 * sizeof(uint64_t) + (numBlocks + 1) / 2 * sizeof(DeltaSyncExtent);
+}
+
+DeltaSyncSender::DeltaSyncSender(std::shared_ptr<Endpoint> endpoint,
+                                 void* buffer,
+                                 const size_t size,
+                                 const size_t blockSize,
+                                 const ucp_tag_t tag)
+  : _buffer(buffer), _size(size), _blockSize(blockSize), _tag(tag)
+{
+  validateParams(endpoint, buffer, size, blockSize);
+
+  _snapshot = createMemoryHandle(getContext(endpoint), size, nullptr);
+
+  ucxx_trace("DeltaSyncSender created: %p, buffer: %p, size: %lu, block size: %lu",
+             this,
+             _buffer,
+             _size,
+             _blockSize);
+
+  setParent(endpoint);
+}
+
+std::shared_ptr<DeltaSyncSender> createDeltaSyncSender(std::shared_ptr<Endpoint> endpoint,
+                                                       void* buffer,
+                                                       const size_t size,
+                                                       const size_t blockSize,
+                                                       const ucp_tag_t tag)
+{
+  return std::shared_ptr<DeltaSyncSender>(
+    new DeltaSyncSender(endpoint, buffer, size, blockSize, tag));
+}
+
+DeltaSyncSender::~DeltaSyncSender()
+{
+  cancelRequests(std::static_pointer_cast<Endpoint>(_parent)->getWorker(), _requests);
+  ucxx_trace("DeltaSyncSender destroyed: %p", this);
+}
+
+DeltaSyncStats DeltaSyncSender::sync()
+{
+  if (!isCompleted()) throw ucxx::Error("Previous delta sync round is still in progress");
+
+  // The receiver may hold any part of a failed round, only a full resend restores it.
+  if (std::any_of(_requests.begin(), _requests.end(), [](auto& request) {
+        return request->getStatus() != UCS_OK;
+      })) {
+    ucxx_debug("DeltaSyncSender %p round %lu failed, resending entire buffer", this, _stats.rounds);
+    _snapshotValid = false;
+  }
+
+  auto endpoint = std::static_pointer_cast<Endpoint>(_parent);
+  auto source   = reinterpret_cast<const char*>(_buffer);
+  auto snapshot = reinterpret_cast<char*>(_snapshot->getBaseAddress());
+
+  DeltaSyncStats stats{.rounds = 1};
+  std::vector<DeltaSyncExtent> extents;
+
+  // `memcmp` is vectorized by the C library, comparing against the snapshot detects all
+  // changes without the false negatives of block hashes and at a similar cost.
+  for (size_t offset = 0; offset < _size; offset += _blockSize) {
+    const size_t length = std::min(_blockSize, _size - offset);
+    if (_snapshotValid && std::memcmp(source + offset, snapshot + offset, length) == 0) continue;
+
+    std::memcpy(snapshot + offset, source + offset, length);
+    if (!extents.empty() && extents.back().offset + extents.back().length == offset)
+      extents.back().length += length;
+    else
+      extents.push_back(DeltaSyncExtent{.offset = offset, .length = length});
+
+    ++stats.dirtyBlocks;
+    stats.bytesSent += length;
+  }
+  _snapshotValid = true;
+
+  stats.extents    = extents.size();
+  stats.bytesSaved = _size - stats.bytesSent;
+
+  const uint64_t header[2] = {++_stats.rounds, extents.size()};
+  _descriptor.resize(sizeof(header) + extents.size() * sizeof(DeltaSyncExtent));
+  std::memcpy(&_descriptor[0], header, sizeof(header));
+  if (!extents.empty())
+    std::memcpy(&_descriptor[sizeof(header)],
+                extents.data(),
+                extents.size() * sizeof(DeltaSyncExtent));
+
+  // Extents are sent from the snapshot, so that the user buffer may be modified while
+  // the round is in progress.
+  _requests.clear();
+  _requests.push_back(endpoint->tagSend(&_descriptor.front(), _descriptor.size(), _tag, false));
+  for (const auto& extent : extents)
+    _requests.push_back(endpoint->tagSend(snapshot + extent.offset, extent.length, _tag, false));
+
+  _stats.dirtyBlocks += stats.dirtyBlocks;
+  _stats.extents += stats.extents;
+  _stats.bytesSent += stats.bytesSent;
+  _stats.bytesSaved += stats.bytesSaved;
+
+  ucxx_trace_req("DeltaSyncSender %p round %lu, dirty blocks: %lu, extents: %lu, bytes saved: %lu",
+                 this,
+                 _stats.rounds,
+                 stats.dirtyBlocks,
+                 stats.extents,
+                 stats.bytesSaved);
+
+  return stats;
+}
+
+bool DeltaSyncSender::isCompleted()
+{
+  return std::all_of(
+    _requests.begin(), _requests.end(), [](auto& request) { return request->isCompleted(); });
+}
+
+DeltaSyncStats DeltaSyncSender::getStats() const { return _stats; }
+
+DeltaSyncReceiver::DeltaSyncReceiver(std::shared_ptr<Endpoint> endpoint,
+                                     void* buffer,
+                                     const size_t size,
+                                     const size_t blockSize,
+                                     const ucp_tag_t tag)
+  : _buffer(buffer), _size(size), _blockSize(blockSize), _tag(tag)
+{
+  validateParams(endpoint, buffer, size, blockSize);
+
+  _replica = createMemoryHandle(getContext(endpoint), size, buffer);
+  _descriptor.resize(deltaSyncMaxDescriptorSize((size + blockSize - 1) / blockSize));
+
+  ucxx_trace("DeltaSyncReceiver created: %p, buffer: %p, size: %lu, block size: %lu",
+             this,
+             _buffer,
+             _size,
+             _blockSize);
+
+  setParent(endpoint);
+}
+
+std::shared_ptr<DeltaSyncReceiver> createDeltaSyncReceiver(std::shared_ptr<Endpoint> endpoint,
+                                                           void* buffer,
+                                                           const size_t size,
+                                                           const size_t blockSize,
+                                                           const ucp_tag_t tag)
+{
+  return std::shared_ptr<DeltaSyncReceiver>(
+    new DeltaSyncReceiver(endpoint, buffer, size, blockSize, tag));
+}
+
+DeltaSyncReceiver::~DeltaSyncReceiver()
+{
+  // Callbacks cannot post new receives once the last reference is gone, so requests may be
+  // read without locking.
+  cancelRequests(std::static_pointer_cast<Endpoint>(_parent)->getWorker(), _requests);
+  ucxx_trace("DeltaSyncReceiver destroyed: %p", this);
+}
+
+void DeltaSyncReceiver::receive()
+{
+  if (!isCompleted()) throw ucxx::Error("Previous delta sync round is still in progress");
+
+  auto endpoint = std::static_pointer_cast<Endpoint>(_parent);
+  auto weak     = std::weak_ptr<DeltaSyncReceiver>(
+    std::static_pointer_cast<DeltaSyncReceiver>(shared_from_this()));
+
+  ++_round;
+  _roundStats  = DeltaSyncStats{.rounds = 1};
+  _roundStatus = UCS_OK;
+  _pending     = 1;
+  _status      = UCS_INPROGRESS;
+  std::fill(_descriptor.begin(), _descriptor.end(), 0);
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _requests.clear();
+  }
+
+  // Post outside the lock, the descriptor may complete immediately and post extents.
+  auto request = endpoint->tagRecv(&_descriptor.front(),
+                                   _descriptor.size(),
+                                   _tag,
+                                   false,
+                                   [weak](ucs_status_t status, std::shared_ptr<void>) {
+                                     if (auto receiver = weak.lock()) receiver->recvExtents(status);
+                                   });
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  _requests.push_back(request);
+}
+
+void DeltaSyncReceiver::recvExtents(const ucs_status_t status)
+{
+  auto endpoint = std::static_pointer_cast<Endpoint>(_parent);
+  auto weak     = std::weak_ptr<DeltaSyncReceiver>(
+    std::static_pointer_cast<DeltaSyncReceiver>(shared_from_this()));
+
+  uint64_t header[2];
+  std::memcpy(header, _descriptor.data(), sizeof(header));
+  const uint64_t round      = header[0];
+  const uint64_t numExtents = header[1];
+
+  std::vector<DeltaSyncExtent> extents;
+  if (status != UCS_OK) {
+    ucxx_debug("DeltaSyncReceiver %p failed receiving descriptor for round %lu: %s",
+               this,
+               _round,
+               ucs_status_string(status));
+    _roundStatus = status;
+  } else if (round != _round ||
+             numExtents > (_descriptor.size() - sizeof(header)) / sizeof(DeltaSyncExtent)) {
+    ucxx_debug("DeltaSyncReceiver %p received malformed descriptor for round %lu", this, _round);
+    _roundStatus = UCS_ERR_IO_ERROR;
+  } else {
+    extents.resize(numExtents);
+    if (numExtents > 0)
+      std::memcpy(
+        extents.data(), &_descriptor[sizeof(header)], numExtents * sizeof(DeltaSyncExtent));
+
+    for (const auto& extent : extents) {
+      if (extent.offset > _size || extent.length > _size - extent.offset) {
+        ucxx_debug(
+          "DeltaSyncReceiver %p received out of bounds extent for round %lu", this, _round);
+        _roundStatus = UCS_ERR_IO_ERROR;
+        extents.clear();
+        break;
+      }
+    }
+  }
+
+  for (const auto& extent : extents) {
+    _roundStats.bytesSent += extent.length;
+    _roundStats.dirtyBlocks += (extent.length + _blockSize - 1) / _blockSize;
+  }
+  _roundStats.extents    = extents.size();
+  _roundStats.bytesSaved = _size - _roundStats.bytesSent;
+
+  // Account for all extents before posting, the descriptor completion is only marked once
+  // all are posted, preventing the round from completing prematurely.
+  _pending += extents.size();
+  std::vector<std::shared_ptr<Request>> requests;
+  for (const auto& extent : extents)
+    requests.push_back(
+      endpoint->tagRecv(reinterpret_cast<char*>(_buffer) + extent.offset,
+                        extent.length,
+                        _tag,
+                        false,
+                        [weak](ucs_status_t status, std::shared_ptr<void>) {
+                          if (auto receiver = weak.lock()) receiver->markCompleted(status);
+                        }));
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _requests.insert(_requests.end(), requests.begin(), requests.end());
+  }
+
+  markCompleted();
+}
+
+void DeltaSyncReceiver::markCompleted(const ucs_status_t status)
+{
+  if (status != UCS_OK) {
+    ucs_status_t expected = UCS_OK;
+    _roundStatus.compare_exchange_strong(expected, status);
+  }
+  if (--_pending > 0) return;
+
+  const ucs_status_t roundStatus = _roundStatus;
+  if (roundStatus == UCS_OK) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    ++_stats.rounds;
+    _stats.dirtyBlocks += _roundStats.dirtyBlocks;
+    _stats.extents += _roundStats.extents;
+    _stats.bytesSent += _roundStats.bytesSent;
+    _stats.bytesSaved += _roundStats.bytesSaved;
+  }
+
+  ucxx_trace_req("DeltaSyncReceiver %p round %lu completed with status %d (%s), bytes saved: %lu",
+                 this,
+                 _round,
+                 roundStatus,
+                 ucs_status_string(roundStatus),
+                 _roundStats.bytesSaved);
+
+  _status = roundStatus;
+}
+
+bool DeltaSyncReceiver::isCompleted() const { return _status != UCS_INPROGRESS; }
+
+ucs_status_t DeltaSyncReceiver::getStatus() const { return _status; }
+
+DeltaSyncStats DeltaSyncReceiver::getStats()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _stats;
+}
+
+}  // namespace ucxx
@@ -2,7 +2,9 @@
  * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
  * SPDX-License-Identifier: BSD-3-Clause
  */
+#include <future>
 #include <memory>
+#include <new>
 #include <sstream>
 #include <string>
 #include <utility>
@@ -14,6 +16,7 @@
 #include <ucxx/endpoint.h>
 #include <ucxx/exception.h>
 #include <ucxx/listener.h>
+#include <ucxx/request_rma.h>
 #include <ucxx/request_stream.h>
 #include <ucxx/request_tag.h>
 #include <ucxx/typedefs.h>
@@ -30,82 +33,141 @@ void EpParamsDeleter::operator()(ucp_ep_params_t* ptr)
 }
 
 Endpoint::Endpoint(std::shared_ptr<Component> workerOrListener,
-                   std::unique_ptr<ucp_ep_params_t, EpParamsDeleter> params,
+                   std::shared_ptr<Worker> worker,
                    bool endpointErrorHandling)
-  : _endpointErrorHandling{endpointErrorHandling}
+  : _endpointErrorHandling{endpointErrorHandling}, _worker{worker}
 {
-  auto worker = Endpoint::getWorker(workerOrListener);
-
-  if (worker == nullptr || worker->getHandle() == nullptr)
-    throw ucxx::Error("Worker not initialized");
-
   setParent(workerOrListener);
 
-  _callbackData = std::make_unique<ErrorCallbackData>(
+  _callbackData                 = std::make_unique<ErrorCallbackData>(
     (ErrorCallbackData){.status = UCS_OK, .inflightRequests = _inflightRequests, .worker = worker});
+}
+
+Expected<std::shared_ptr<Endpoint>> Endpoint::create(
+  std::shared_ptr<Component> workerOrListener,
+  std::shared_ptr<Worker> worker,
+  std::unique_ptr<ucp_ep_params_t, EpParamsDeleter> params,
+  bool endpointErrorHandling) noexcept
+{
+  if (worker == nullptr || worker->getHandle() == nullptr)
+    return {UCS_ERR_INVALID_PARAM, "Worker not initialized"};
+
+  std::shared_ptr<Endpoint> endpoint{nullptr};
+  try {
+    endpoint = std::shared_ptr<Endpoint>(
+      new Endpoint(workerOrListener, worker, endpointErrorHandling));
+    worker->registerEndpointInflightRequests(endpoint->_inflightRequests);
+  } catch (...) {
+    return Expected<std::shared_ptr<Endpoint>>::fromCurrentException();
+  }
 
   params->err_mode =
     (endpointErrorHandling ? UCP_ERR_HANDLING_MODE_PEER : UCP_ERR_HANDLING_MODE_NONE);
   params->err_handler.cb  = Endpoint::errorCallback;
-  params->err_handler.arg = _callbackData.get();
+  params->err_handler.arg = endpoint->_callbackData.get();
+
+  ucs_status_t status = ucp_ep_create(worker->getHandle(), params.get(), &endpoint->_handle);
+  if (status != UCS_OK) return status;
+  ucxx_trace("Endpoint created: %p", endpoint->_handle);
 
-  utils::ucsErrorThrow(ucp_ep_create(worker->getHandle(), params.get(), &_handle));
-  ucxx_trace("Endpoint created: %p", _handle);
+  return endpoint;
 }
 
-std::shared_ptr<Endpoint> createEndpointFromHostname(std::shared_ptr<Worker> worker,
-                                                     std::string ipAddress,
-                                                     uint16_t port,
-                                                     bool endpointErrorHandling)
+Expected<std::shared_ptr<Endpoint>> createEndpointFromHostname(std::nothrow_t,
+                                                               std::shared_ptr<Worker> worker,
+                                                               std::string ipAddress,
+                                                               uint16_t port,
+                                                               bool endpointErrorHandling) noexcept
 {
   if (worker == nullptr || worker->getHandle() == nullptr)
-    throw ucxx::Error("Worker not initialized");
+    return {UCS_ERR_INVALID_PARAM, "Worker not initialized"};
 
-  auto params = std::unique_ptr<ucp_ep_params_t, EpParamsDeleter>(new ucp_ep_params_t);
+  auto params =
+    std::unique_ptr<ucp_ep_params_t, EpParamsDeleter>(new (std::nothrow) ucp_ep_params_t);
+  if (params == nullptr) return UCS_ERR_NO_MEMORY;
 
   struct hostent* hostname = gethostbyname(ipAddress.c_str());
-  if (hostname == nullptr) throw ucxx::Error(std::string("Invalid IP address or hostname"));
+  if (hostname == nullptr) return {UCS_ERR_INVALID_ADDR, "Invalid IP address or hostname"};
 
   params->field_mask = UCP_EP_PARAM_FIELD_FLAGS | UCP_EP_PARAM_FIELD_SOCK_ADDR |
                        UCP_EP_PARAM_FIELD_ERR_HANDLING_MODE | UCP_EP_PARAM_FIELD_ERR_HANDLER;
   params->flags = UCP_EP_PARAMS_FLAGS_CLIENT_SERVER;
-  if (ucxx::utils::sockaddr_set(&params->sockaddr, hostname->h_name, port)) throw std::bad_alloc();
+  if (ucxx::utils::sockaddr_set(&params->sockaddr, hostname->h_name, port)) {
+    params->field_mask &= ~UCP_EP_PARAM_FIELD_SOCK_ADDR;
+    return UCS_ERR_NO_MEMORY;
+  }
 
-  return std::shared_ptr<Endpoint>(new Endpoint(worker, std::move(params), endpointErrorHandling));
+  return Endpoint::create(worker, worker, std::move(params), endpointErrorHandling);
 }
 
-std::shared_ptr<Endpoint> createEndpointFromConnRequest(std::shared_ptr<Listener> listener,
-                                                        ucp_conn_request_h connRequest,
-                                                        bool endpointErrorHandling)
+Expected<std::shared_ptr<Endpoint>> createEndpointFromConnRequest(
+  std::nothrow_t,
+  std::shared_ptr<Listener> listener,
+  ucp_conn_request_h connRequest,
+  bool endpointErrorHandling) noexcept
 {
   if (listener == nullptr || listener->getHandle() == nullptr)
-    throw ucxx::Error("Worker not initialized");
+    return {UCS_ERR_INVALID_PARAM, "Worker not initialized"};
+
+  auto params =
+    std::unique_ptr<ucp_ep_params_t, EpParamsDeleter>(new (std::nothrow) ucp_ep_params_t);
+  if (params == nullptr) return UCS_ERR_NO_MEMORY;
 
-  auto params        = std::unique_ptr<ucp_ep_params_t, EpParamsDeleter>(new ucp_ep_params_t);
   params->field_mask = UCP_EP_PARAM_FIELD_FLAGS | UCP_EP_PARAM_FIELD_CONN_REQUEST |
                        UCP_EP_PARAM_FIELD_ERR_HANDLING_MODE | UCP_EP_PARAM_FIELD_ERR_HANDLER;
   params->flags        = UCP_EP_PARAMS_FLAGS_NO_LOOPBACK;
   params->conn_request = connRequest;
 
-  return std::shared_ptr<Endpoint>(
-    new Endpoint(listener, std::move(params), endpointErrorHandling));
+  return Endpoint::create(
+    listener, listener->getWorker(), std::move(params), endpointErrorHandling);
 }
 
-std::shared_ptr<Endpoint> createEndpointFromWorkerAddress(std::shared_ptr<Worker> worker,
-                                                          std::shared_ptr<Address> address,
-                                                          bool endpointErrorHandling)
+Expected<std::shared_ptr<Endpoint>> createEndpointFromWorkerAddress(
+  std::nothrow_t,
+  std::shared_ptr<Worker> worker,
+  std::shared_ptr<Address> address,
+  bool endpointErrorHandling) noexcept
 {
   if (worker == nullptr || worker->getHandle() == nullptr)
-    throw ucxx::Error("Worker not initialized");
+    return {UCS_ERR_INVALID_PARAM, "Worker not initialized"};
   if (address == nullptr || address->getHandle() == nullptr || address->getLength() == 0)
-    throw ucxx::Error("Address not initialized");
+    return {UCS_ERR_INVALID_ADDR, "Address not initialized"};
+
+  auto params =
+    std::unique_ptr<ucp_ep_params_t, EpParamsDeleter>(new (std::nothrow) ucp_ep_params_t);
+  if (params == nullptr) return UCS_ERR_NO_MEMORY;
 
-  auto params        = std::unique_ptr<ucp_ep_params_t, EpParamsDeleter>(new ucp_ep_params_t);
   params->field_mask = UCP_EP_PARAM_FIELD_REMOTE_ADDRESS | UCP_EP_PARAM_FIELD_ERR_HANDLING_MODE |
                        UCP_EP_PARAM_FIELD_ERR_HANDLER;
   params->address = address->getHandle();
 
-  return std::shared_ptr<Endpoint>(new Endpoint(worker, std::move(params), endpointErrorHandling));
+  return Endpoint::create(worker, worker, std::move(params), endpointErrorHandling);
+}
+
+std::shared_ptr<Endpoint> createEndpointFromHostname(std::shared_ptr<Worker> worker,
+                                                     std::string ipAddress,
+                                                     uint16_t port,
+                                                     bool endpointErrorHandling)
+{
+  return createEndpointFromHostname(
+           std::nothrow, worker, std::move(ipAddress), port, endpointErrorHandling)
+    .getValue();
+}
+
+std::shared_ptr<Endpoint> createEndpointFromConnRequest(std::shared_ptr<Listener> listener,
+                                                        ucp_conn_request_h connRequest,
+                                                        bool endpointErrorHandling)
+{
+  return createEndpointFromConnRequest(std::nothrow, listener, connRequest, endpointErrorHandling)
+    .getValue();
+}
+
+std::shared_ptr<Endpoint> createEndpointFromWorkerAddress(std::shared_ptr<Worker> worker,
+                                                          std::shared_ptr<Address> address,
+                                                          bool endpointErrorHandling)
+{
+  return createEndpointFromWorkerAddress(std::nothrow, worker, address, endpointErrorHandling)
+    .getValue();
 }
 
 Endpoint::~Endpoint()
@@ -114,29 +176,26 @@ Endpoint::~Endpoint()
   ucxx_trace("Endpoint destroyed: %p", _originalHandle);
 }
 
-void Endpoint::close()
+ucs_status_ptr_t Endpoint::closeSubmit(ucp_request_param_t* param)
 {
-  if (_handle == nullptr) return;
-
   size_t canceled = cancelInflightRequests();
   ucxx_debug("Endpoint %p canceled %lu requests", _handle, canceled);
 
   // Close the endpoint
-  unsigned closeMode = UCP_EP_CLOSE_MODE_FORCE;
+  uint32_t closeFlags = UCP_EP_CLOSE_FLAG_FORCE;
   if (_endpointErrorHandling && _callbackData->status != UCS_OK) {
     // We force close endpoint if endpoint error handling is enabled and
     // the endpoint status is not UCS_OK
-    closeMode = UCP_EP_CLOSE_MODE_FORCE;
-  }
-  ucs_status_ptr_t status = ucp_ep_close_nb(_handle, closeMode);
-  if (UCS_PTR_IS_PTR(status)) {
-    auto worker = Endpoint::getWorker(_parent);
-    while (ucp_request_check_status(status) == UCS_INPROGRESS)
-      worker->progress();
-    ucp_request_free(status);
-  } else if (UCS_PTR_STATUS(status) != UCS_OK) {
-    ucxx_error("Error while closing endpoint: %s", ucs_status_string(UCS_PTR_STATUS(status)));
+    closeFlags = UCP_EP_CLOSE_FLAG_FORCE;
   }
+  param->op_attr_mask |= UCP_OP_ATTR_FIELD_FLAGS;
+  param->flags = closeFlags;
+
+  return ucp_ep_close_nbx(_handle, param);
+}
+
+void Endpoint::closeCompleted()
+{
   ucxx_trace("Endpoint closed: %p", _handle);
 
   if (_callbackData->closeCallback) {
@@ -149,6 +208,89 @@ void Endpoint::close()
   std::swap(_handle, _originalHandle);
 }
 
+void Endpoint::close()
+{
+  if (_handle == nullptr) return;
+
+  ucp_request_param_t param = {.op_attr_mask = 0};
+  ucs_status_ptr_t status   = closeSubmit(&param);
+  if (UCS_PTR_IS_PTR(status)) {
+    while (ucp_request_check_status(status) == UCS_INPROGRESS)
+      _worker->progress();
+    ucp_request_free(status);
+  } else if (UCS_PTR_STATUS(status) != UCS_OK) {
+    ucxx_error("Error while closing endpoint: %s", ucs_status_string(UCS_PTR_STATUS(status)));
+  }
+
+  closeCompleted();
+}
+
+namespace {
+
+struct EndpointCloseData {
+  std::shared_ptr<Endpoint> endpoint{nullptr};          ///< Endpoint kept alive until closed
+  std::shared_ptr<std::promise<void>> promise{nullptr};  ///< Promise set once closed
+};
+
+}  // namespace
+
+void Endpoint::closeAsyncCallback(void* request, ucs_status_t status, void* arg)
+{
+  std::unique_ptr<EndpointCloseData> closeData(reinterpret_cast<EndpointCloseData*>(arg));
+
+  ucp_request_free(request);
+  if (status != UCS_OK)
+    ucxx_error("Error while closing endpoint: %s", ucs_status_string(status));
+
+  try {
+    closeData->endpoint->closeCompleted();
+    closeData->promise->set_value();
+  } catch (...) {
+    closeData->promise->set_exception(std::current_exception());
+  }
+}
+
+std::future<void> Endpoint::closeAsync()
+{
+  auto endpoint = std::static_pointer_cast<Endpoint>(shared_from_this());
+  auto promise  = std::make_shared<std::promise<void>>();
+  auto future   = promise->get_future();
+
+  // Closing completes from the request callback rather than progressing the worker, which
+  // would nest progress within the delayed submissions processed by the progress thread.
+  _worker->registerDelayedSubmission([endpoint, promise]() {
+    try {
+      if (endpoint->_handle == nullptr) {
+        promise->set_value();
+        return;
+      }
+
+      auto closeData = std::make_unique<EndpointCloseData>(EndpointCloseData{endpoint, promise});
+      ucp_request_param_t param = {
+        .op_attr_mask = UCP_OP_ATTR_FIELD_CALLBACK | UCP_OP_ATTR_FIELD_USER_DATA,
+        .user_data    = closeData.get()};
+      param.cb.send = closeAsyncCallback;
+
+      ucs_status_ptr_t status = endpoint->closeSubmit(&param);
+      if (UCS_PTR_IS_PTR(status)) {
+        // Ownership of the close data is passed to the callback
+        closeData.release();
+        return;
+      } else if (UCS_PTR_STATUS(status) != UCS_OK) {
+        ucxx_error("Error while closing endpoint: %s",
+                   ucs_status_string(UCS_PTR_STATUS(status)));
+      }
+
+      endpoint->closeCompleted();
+      promise->set_value();
+    } catch (...) {
+      promise->set_exception(std::current_exception());
+    }
+  });
+
+  return future;
+}
+
 ucp_ep_h Endpoint::getHandle() { return _handle; }
 
 bool Endpoint::isAlive() const
@@ -199,22 +341,32 @@ void Endpoint::removeInflightRequest(const Request* const request)
 
 size_t Endpoint::cancelInflightRequests() { return _inflightRequests->cancelAll(); }
 
+template <typename CreateRequest>
+Expected<std::shared_ptr<Request>> Endpoint::submitRequest(CreateRequest createRequest) noexcept
+{
+  if (_handle == nullptr) return {UCS_ERR_NOT_CONNECTED, "Endpoint not initialized"};
+  if (_worker->getHandle() == nullptr) return {UCS_ERR_INVALID_PARAM, "Worker not initialized"};
+
+  try {
+    auto endpoint = std::static_pointer_cast<Endpoint>(shared_from_this());
+    return registerInflightRequest(createRequest(std::move(endpoint)));
+  } catch (...) {
+    return Expected<std::shared_ptr<Request>>::fromCurrentException();
+  }
+}
+
 std::shared_ptr<Request> Endpoint::streamSend(void* buffer,
                                               size_t length,
                                               const bool enablePythonFuture)
 {
-  auto endpoint = std::dynamic_pointer_cast<Endpoint>(shared_from_this());
-  return registerInflightRequest(
-    createRequestStream(endpoint, true, buffer, length, enablePythonFuture));
+  return streamSend(std::nothrow, buffer, length, enablePythonFuture).getValue();
 }
 
 std::shared_ptr<Request> Endpoint::streamRecv(void* buffer,
                                               size_t length,
                                               const bool enablePythonFuture)
 {
-  auto endpoint = std::dynamic_pointer_cast<Endpoint>(shared_from_this());
-  return registerInflightRequest(
-    createRequestStream(endpoint, false, buffer, length, enablePythonFuture));
+  return streamRecv(std::nothrow, buffer, length, enablePythonFuture).getValue();
 }
 
 std::shared_ptr<Request> Endpoint::tagSend(
@@ -222,12 +374,19 @@ std::shared_ptr<Request> Endpoint::tagSend(
   size_t length,
   ucp_tag_t tag,
   const bool enablePythonFuture,
-  std::function<void(std::shared_ptr<void>)> callbackFunction,
-  std::shared_ptr<void> callbackData)
+  RequestCallbackUserFunction callbackFunction,
+  RequestCallbackUserData callbackData,
+  const TagSendMode sendMode)
 {
-  auto endpoint = std::dynamic_pointer_cast<Endpoint>(shared_from_this());
-  return registerInflightRequest(createRequestTag(
-    endpoint, true, buffer, length, tag, enablePythonFuture, callbackFunction, callbackData));
+  return tagSend(std::nothrow,
+                 buffer,
+                 length,
+                 tag,
+                 enablePythonFuture,
+                 std::move(callbackFunction),
+                 std::move(callbackData),
+                 sendMode)
+    .getValue();
 }
 
 std::shared_ptr<Request> Endpoint::tagRecv(
@@ -235,39 +394,186 @@ std::shared_ptr<Request> Endpoint::tagRecv(
   size_t length,
   ucp_tag_t tag,
   const bool enablePythonFuture,
-  std::function<void(std::shared_ptr<void>)> callbackFunction,
-  std::shared_ptr<void> callbackData)
+  RequestCallbackUserFunction callbackFunction,
+  RequestCallbackUserData callbackData)
+{
+  return tagRecv(std::nothrow,
+                 buffer,
+                 length,
+                 tag,
+                 enablePythonFuture,
+                 std::move(callbackFunction),
+                 std::move(callbackData))
+    .getValue();
+}
+
+std::shared_ptr<Request> Endpoint::tagSendIov(
+  std::vector<ucp_dt_iov_t> iov,
+  ucp_tag_t tag,
+  const bool enablePythonFuture,
+  RequestCallbackUserFunction callbackFunction,
+  RequestCallbackUserData callbackData)
+{
+  return submitRequest([&](std::shared_ptr<Endpoint> endpoint) {
+           return createRequestTag(endpoint,
+                                   std::move(iov),
+                                   tag,
+                                   enablePythonFuture,
+                                   std::move(callbackFunction),
+                                   std::move(callbackData));
+         })
+    .getValue();
+}
+
+Expected<std::shared_ptr<Request>> Endpoint::streamSend(std::nothrow_t,
+                                                        void* buffer,
+                                                        size_t length,
+                                                        const bool enablePythonFuture) noexcept
+{
+  return submitRequest([&](std::shared_ptr<Endpoint> endpoint) {
+    return createRequestStream(endpoint, true, buffer, length, enablePythonFuture);
+  });
+}
+
+Expected<std::shared_ptr<Request>> Endpoint::streamRecv(std::nothrow_t,
+                                                        void* buffer,
+                                                        size_t length,
+                                                        const bool enablePythonFuture) noexcept
+{
+  return submitRequest([&](std::shared_ptr<Endpoint> endpoint) {
+    return createRequestStream(endpoint, false, buffer, length, enablePythonFuture);
+  });
+}
+
+Expected<std::shared_ptr<Request>> Endpoint::tagSend(
+  std::nothrow_t,
+  void* buffer,
+  size_t length,
+  ucp_tag_t tag,
+  const bool enablePythonFuture,
+  RequestCallbackUserFunction callbackFunction,
+  RequestCallbackUserData callbackData,
+  const TagSendMode sendMode) noexcept
+{
+  return submitRequest([&](std::shared_ptr<Endpoint> endpoint) {
+    return createRequestTag(endpoint,
+                            true,
+                            buffer,
+                            length,
+                            tag,
+                            enablePythonFuture,
+                            callbackFunction,
+                            callbackData,
+                            sendMode);
+  });
+}
+
+Expected<std::shared_ptr<Request>> Endpoint::tagRecv(
+  std::nothrow_t,
+  void* buffer,
+  size_t length,
+  ucp_tag_t tag,
+  const bool enablePythonFuture,
+  RequestCallbackUserFunction callbackFunction,
+  RequestCallbackUserData callbackData) noexcept
+{
+  return submitRequest([&](std::shared_ptr<Endpoint> endpoint) {
+    return createRequestTag(endpoint,
+                            false,
+                            buffer,
+                            length,
+                            tag,
+                            enablePythonFuture,
+                            callbackFunction,
+                            callbackData,
+                            TagSendMode::Standard);
+  });
+}
+
+std::shared_ptr<Request> Endpoint::rmaPut(
+  void* buffer,
+  size_t length,
+  uint64_t remoteAddress,
+  std::shared_ptr<RemoteKey> remoteKey,
+  const bool enablePythonFuture,
+  RequestCallbackUserFunction callbackFunction,
+  RequestCallbackUserData callbackData)
+{
+  auto endpoint = std::static_pointer_cast<Endpoint>(shared_from_this());
+  return registerInflightRequest(createRequestRma(endpoint,
+                                                  true,
+                                                  buffer,
+                                                  length,
+                                                  remoteAddress,
+                                                  remoteKey,
+                                                  enablePythonFuture,
+                                                  callbackFunction,
+                                                  callbackData));
+}
+
+std::shared_ptr<Request> Endpoint::rmaGet(
+  void* buffer,
+  size_t length,
+  uint64_t remoteAddress,
+  std::shared_ptr<RemoteKey> remoteKey,
+  const bool enablePythonFuture,
+  RequestCallbackUserFunction callbackFunction,
+  RequestCallbackUserData callbackData)
 {
-  auto endpoint = std::dynamic_pointer_cast<Endpoint>(shared_from_this());
-  return registerInflightRequest(createRequestTag(
-    endpoint, false, buffer, length, tag, enablePythonFuture, callbackFunction, callbackData));
+  auto endpoint = std::static_pointer_cast<Endpoint>(shared_from_this());
+  return registerInflightRequest(createRequestRma(endpoint,
+                                                  false,
+                                                  buffer,
+                                                  length,
+                                                  remoteAddress,
+                                                  remoteKey,
+                                                  enablePythonFuture,
+                                                  callbackFunction,
+                                                  callbackData));
 }
 
 std::shared_ptr<RequestTagMulti> Endpoint::tagMultiSend(const std::vector<void*>& buffer,
                                                         const std::vector<size_t>& size,
                                                         const std::vector<int>& isCUDA,
                                                         const ucp_tag_t tag,
-                                                        const bool enablePythonFuture)
+                                                        const bool enablePythonFuture,
+                                                        const CodecParams& codecParams,
+                                                        const TagSendMode sendMode)
 {
-  auto endpoint = std::dynamic_pointer_cast<Endpoint>(shared_from_this());
-  return createRequestTagMultiSend(endpoint, buffer, size, isCUDA, tag, enablePythonFuture);
+  auto endpoint = std::static_pointer_cast<Endpoint>(shared_from_this());
+  return createRequestTagMultiSend(
+    endpoint, buffer, size, isCUDA, tag, enablePythonFuture, codecParams, sendMode);
 }
 
 std::shared_ptr<RequestTagMulti> Endpoint::tagMultiRecv(const ucp_tag_t tag,
                                                         const bool enablePythonFuture)
 {
-  auto endpoint = std::dynamic_pointer_cast<Endpoint>(shared_from_this());
+  auto endpoint = std::static_pointer_cast<Endpoint>(shared_from_this());
   return createRequestTagMultiRecv(endpoint, tag, enablePythonFuture);
 }
 
+void Endpoint::enableDedup(const DedupParams& params)
+{
+  // A reference must always be smaller than the frame it replaces.
+  if (params.minFrameSize <= sizeof(uint64_t))
+    throw ucxx::Error("Dedup minimum frame size must be larger than " +
+                      std::to_string(sizeof(uint64_t)) + " bytes");
+
+  _dedupSendCache = std::make_shared<DedupCache>(params, false);
+  _dedupRecvCache = std::make_shared<DedupCache>(params, true);
+}
+
+std::shared_ptr<DedupCache> Endpoint::getDedupSendCache() { return _dedupSendCache; }
+
+std::shared_ptr<DedupCache> Endpoint::getDedupRecvCache() { return _dedupRecvCache; }
+
+std::shared_ptr<Worker> Endpoint::getWorker() const { return _worker; }
+
 std::shared_ptr<Worker> Endpoint::getWorker(std::shared_ptr<Component> workerOrListener)
 {
-  auto worker = std::dynamic_pointer_cast<Worker>(workerOrListener);
-  if (worker == nullptr) {
-    auto listener = std::dynamic_pointer_cast<Listener>(workerOrListener);
-    worker        = std::dynamic_pointer_cast<Worker>(listener->getParent());
-  }
-  return worker;
+  if (auto worker = std::dynamic_pointer_cast<Worker>(workerOrListener)) return worker;
+  auto listener = std::dynamic_pointer_cast<Listener>(workerOrListener);
+  return listener == nullptr ? nullptr : listener->getWorker();
 }
 
 void Endpoint::errorCallback(void* arg, ucp_ep_h ep, ucs_status_t status)
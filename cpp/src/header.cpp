@@ -3,6 +3,7 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 #include <algorithm>
+#include <cstdint>
 #include <iostream>
 #include <iterator>
 #include <memory>
@@ -10,29 +11,70 @@
 #include <string>
 #include <vector>
 
+#include <ucxx/codec.h>
+#include <ucxx/dedup.h>
 #include <ucxx/header.h>
 
 namespace ucxx {
 
-Header::Header(bool next, size_t nframes, int* isCUDA, size_t* size) : next{next}, nframes{nframes}
+Header::Header(bool next,
+               size_t nframes,
+               int* isCUDA,
+               size_t* size,
+               int* codec,
+               size_t chunkSize,
+               int* dedup,
+               uint64_t dedupEpoch)
+  : next{next}, extended{false}, nframes{nframes}, chunkSize{chunkSize}, dedupEpoch{dedupEpoch}
 {
   std::copy(isCUDA, isCUDA + nframes, this->isCUDA.begin());
   std::copy(size, size + nframes, this->size.begin());
+  if (codec != nullptr)
+    std::copy(codec, codec + nframes, this->codec.begin());
+  else
+    std::fill(this->codec.begin(), this->codec.begin() + nframes, static_cast<int>(CodecType::Raw));
+  if (dedup != nullptr)
+    std::copy(dedup, dedup + nframes, this->dedup.begin());
+  else
+    std::fill(
+      this->dedup.begin(), this->dedup.begin() + nframes, static_cast<int>(DedupAction::None));
   if (nframes < HeaderFramesSize) {
     std::fill(this->isCUDA.begin() + nframes, this->isCUDA.begin() + HeaderFramesSize, false);
     std::fill(this->size.begin() + nframes, this->size.begin() + HeaderFramesSize, 0);
+    std::fill(this->codec.begin() + nframes,
+              this->codec.begin() + HeaderFramesSize,
+              static_cast<int>(CodecType::Raw));
+    std::fill(this->dedup.begin() + nframes,
+              this->dedup.begin() + HeaderFramesSize,
+              static_cast<int>(DedupAction::None));
   }
+
+  for (size_t i = 0; i < nframes; ++i)
+    extended |= this->codec[i] != static_cast<int>(CodecType::Raw) ||
+                this->dedup[i] != static_cast<int>(DedupAction::None);
 }
 
 Header::Header(std::string serializedHeader) { deserialize(serializedHeader); }
 
-size_t Header::dataSize() { return sizeof(next) + sizeof(nframes) + sizeof(isCUDA) + sizeof(size); }
+size_t Header::dataSize()
+{
+  return sizeof(uint8_t) + sizeof(nframes) + sizeof(isCUDA) + sizeof(size);
+}
+
+size_t Header::extensionDataSize()
+{
+  return sizeof(HeaderExtensionVersion) + sizeof(codec) + sizeof(chunkSize) + sizeof(dedup) +
+         sizeof(dedupEpoch);
+}
 
 const std::string Header::serialize() const
 {
   std::stringstream ss;
 
-  ss.write((char const*)&next, sizeof(next));
+  // Written in place of the `next` flag of headers predating extensions, which read
+  // headers that are not extended unchanged.
+  const uint8_t flags = (next ? HeaderFlagNext : 0) | (extended ? HeaderFlagExtended : 0);
+  ss.write((char const*)&flags, sizeof(flags));
   ss.write((char const*)&nframes, sizeof(nframes));
   for (size_t i = 0; i < HeaderFramesSize; ++i)
     ss.write((char const*)&isCUDA[i], sizeof(isCUDA[i]));
@@ -42,25 +84,96 @@ const std::string Header::serialize() const
   return ss.str();
 }
 
+const std::string Header::serializeExtension() const
+{
+  std::stringstream ss;
+
+  ss.write((char const*)&HeaderExtensionVersion, sizeof(HeaderExtensionVersion));
+  for (size_t i = 0; i < HeaderFramesSize; ++i)
+    ss.write((char const*)&codec[i], sizeof(codec[i]));
+  ss.write((char const*)&chunkSize, sizeof(chunkSize));
+  for (size_t i = 0; i < HeaderFramesSize; ++i)
+    ss.write((char const*)&dedup[i], sizeof(dedup[i]));
+  ss.write((char const*)&dedupEpoch, sizeof(dedupEpoch));
+
+  return ss.str();
+}
+
 void Header::deserialize(const std::string& serializedHeader)
 {
   std::stringstream ss{serializedHeader};
 
-  ss.read(reinterpret_cast<char*>(&next), sizeof(next));
+  uint8_t flags = 0;
+  ss.read(reinterpret_cast<char*>(&flags), sizeof(flags));
+  next     = flags & HeaderFlagNext;
+  extended = flags & HeaderFlagExtended;
   ss.read(reinterpret_cast<char*>(&nframes), sizeof(nframes));
   for (size_t i = 0; i < HeaderFramesSize; ++i)
     ss.read(reinterpret_cast<char*>(&isCUDA[i]), sizeof(isCUDA[i]));
   for (size_t i = 0; i < HeaderFramesSize; ++i)
     ss.read(reinterpret_cast<char*>(&size[i]), sizeof(size[i]));
+
+  // Filled by `deserializeExtension()` if the header is extended
+  codec.fill(static_cast<int>(CodecType::Raw));
+  chunkSize = 0;
+  dedup.fill(static_cast<int>(DedupAction::None));
+  dedupEpoch = 0;
+}
+
+bool Header::deserializeExtension(const std::string& serializedExtension)
+{
+  if (serializedExtension.size() != extensionDataSize()) return false;
+
+  std::stringstream ss{serializedExtension};
+
+  uint32_t version = 0;
+  ss.read(reinterpret_cast<char*>(&version), sizeof(version));
+  if (version != HeaderExtensionVersion) return false;
+
+  for (size_t i = 0; i < HeaderFramesSize; ++i)
+    ss.read(reinterpret_cast<char*>(&codec[i]), sizeof(codec[i]));
+  ss.read(reinterpret_cast<char*>(&chunkSize), sizeof(chunkSize));
+  for (size_t i = 0; i < HeaderFramesSize; ++i)
+    ss.read(reinterpret_cast<char*>(&dedup[i]), sizeof(dedup[i]));
+  ss.read(reinterpret_cast<char*>(&dedupEpoch), sizeof(dedupEpoch));
+
+  return true;
+}
+
+bool Header::isValid() const
+{
+  if (nframes > HeaderFramesSize) return false;
+
+  for (size_t i = 0; i < nframes; ++i) {
+    if (codec[i] < static_cast<int>(CodecType::Raw) ||
+        codec[i] >= static_cast<int>(CodecType::Invalid))
+      return false;
+    if (dedup[i] < static_cast<int>(DedupAction::None) ||
+        dedup[i] >= static_cast<int>(DedupAction::Invalid))
+      return false;
+    // Encoded host frames are split in chunks of `chunkSize` bytes
+    if (codec[i] != static_cast<int>(CodecType::Raw) && !isCUDA[i] && chunkSize == 0)
+      return false;
+  }
+
+  return true;
 }
 
 std::vector<Header> Header::buildHeaders(const std::vector<size_t>& size,
-                                         const std::vector<int>& isCUDA)
+                                         const std::vector<int>& isCUDA,
+                                         const std::vector<int>& codec,
+                                         const size_t chunkSize,
+                                         const std::vector<int>& dedup,
+                                         const uint64_t dedupEpoch)
 {
   const size_t totalFrames = size.size();
 
   if (isCUDA.size() != totalFrames)
     throw std::length_error("size and isCUDA must have the same length");
+  if (!codec.empty() && codec.size() != totalFrames)
+    throw std::length_error("codec must be empty or have the same length as size");
+  if (!dedup.empty() && dedup.size() != totalFrames)
+    throw std::length_error("dedup must be empty or have the same length as size");
 
   const size_t totalHeaders = (totalFrames + HeaderFramesSize - 1) / HeaderFramesSize;
 
@@ -75,7 +188,11 @@ std::vector<Header> Header::buildHeaders(const std::vector<size_t>& size,
     headers.push_back(Header(hasNext,
                              headerFrames,
                              const_cast<int*>(reinterpret_cast<const int*>(&isCUDA[idx])),
-                             const_cast<size_t*>(reinterpret_cast<const size_t*>(&size[idx]))));
+                             const_cast<size_t*>(reinterpret_cast<const size_t*>(&size[idx])),
+                             codec.empty() ? nullptr : const_cast<int*>(&codec[idx]),
+                             chunkSize,
+                             dedup.empty() ? nullptr : const_cast<int*>(&dedup[idx]),
+                             dedupEpoch));
   }
 
   return headers;
@@ -3,6 +3,7 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 #include <memory>
+#include <vector>
 
 #include <ucxx/inflight_requests.h>
 #include <ucxx/log.h>
@@ -14,6 +15,17 @@ InflightRequests::~InflightRequests() { cancelAll(); }
 
 size_t InflightRequests::size() { return _inflightRequests->size(); }
 
+std::vector<InflightRequestInfo> InflightRequests::getInfo()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  std::vector<InflightRequestInfo> info;
+  info.reserve(_inflightRequests->size());
+  for (const auto& r : *_inflightRequests)
+    if (r.second != nullptr && !r.second->isCompleted()) info.push_back(r.second->getInfo());
+  return info;
+}
+
 void InflightRequests::insert(std::shared_ptr<Request> request)
 {
   std::lock_guard<std::mutex> lock(_mutex);
@@ -0,0 +1,230 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <poll.h>
+
+#include <cerrno>
+#include <cstring>
+#include <ios>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#if UCXX_ENABLE_IO_URING
+#include <liburing.h>
+#endif
+
+#include <ucxx/exception.h>
+#include <ucxx/io_uring.h>
+#include <ucxx/log.h>
+
+namespace ucxx {
+
+#if UCXX_ENABLE_IO_URING
+
+struct IoUring::Impl {
+  struct io_uring ring {};                         ///< The io_uring
+  std::mutex submissionMutex{};                    ///< Mutex to access the submission queue
+  std::unordered_set<FileIOCallback*> inflight{};  ///< Callbacks of inflight file I/O
+  bool pollPending{false};                         ///< Whether a poll on the fd is pending
+  bool pollMultishot{true};                        ///< Whether multishot polls are supported
+
+  /**
+   * @brief Get a submission queue entry, flushing the queue if full.
+   *
+   * Must be called with `submissionMutex` locked.
+   */
+  struct io_uring_sqe* getSqe()
+  {
+    struct io_uring_sqe* sqe = io_uring_get_sqe(&ring);
+    if (sqe == nullptr && io_uring_submit(&ring) >= 0) sqe = io_uring_get_sqe(&ring);
+    if (sqe == nullptr) throw ucxx::NoResourceError("io_uring submission queue is full");
+    return sqe;
+  }
+};
+
+IoUring::IoUring(const unsigned entries) : _impl(std::make_unique<Impl>())
+{
+  if (!isAvailable()) throw ucxx::UnsupportedError("io_uring is not available");
+
+  int ret = io_uring_queue_init(entries, &_impl->ring, 0);
+  if (ret < 0)
+    throw std::ios_base::failure(std::string("io_uring_queue_init() failed: ") +
+                                 std::strerror(-ret));
+  ucxx_trace("IoUring created: %p, entries: %u", this, entries);
+}
+
+IoUring::~IoUring()
+{
+  // Exiting the queue waits for or cancels inflight operations, their callbacks are
+  // never executed.
+  io_uring_queue_exit(&_impl->ring);
+  for (auto callback : _impl->inflight)
+    delete callback;
+  ucxx_trace("IoUring destroyed: %p, dropped %lu inflight operations",
+             this,
+             _impl->inflight.size());
+}
+
+bool IoUring::isAvailable()
+{
+  static const bool available = []() {
+    struct io_uring ring;
+    if (io_uring_queue_init(2, &ring, 0) < 0) return false;
+    // Waiting with a timeout must not consume submission queue entries, allowing other
+    // threads to submit while the waiter is blocked.
+    const bool supported = ring.features & IORING_FEAT_EXT_ARG;
+    io_uring_queue_exit(&ring);
+    return supported;
+  }();
+  return available;
+}
+
+size_t IoUring::prepareRead(
+  int fd, void* buffer, const size_t length, const off_t offset, FileIOCallback callback)
+{
+  auto data = std::make_unique<FileIOCallback>(std::move(callback));
+
+  std::lock_guard<std::mutex> lock(_impl->submissionMutex);
+  struct io_uring_sqe* sqe = _impl->getSqe();
+  io_uring_prep_read(sqe, fd, buffer, length, offset);
+  io_uring_sqe_set_data(sqe, data.get());
+  _impl->inflight.insert(data.release());
+  return io_uring_sq_ready(&_impl->ring);
+}
+
+size_t IoUring::prepareWrite(
+  int fd, const void* buffer, const size_t length, const off_t offset, FileIOCallback callback)
+{
+  auto data = std::make_unique<FileIOCallback>(std::move(callback));
+
+  std::lock_guard<std::mutex> lock(_impl->submissionMutex);
+  struct io_uring_sqe* sqe = _impl->getSqe();
+  io_uring_prep_write(sqe, fd, buffer, length, offset);
+  io_uring_sqe_set_data(sqe, data.get());
+  _impl->inflight.insert(data.release());
+  return io_uring_sq_ready(&_impl->ring);
+}
+
+size_t IoUring::submit()
+{
+  std::lock_guard<std::mutex> lock(_impl->submissionMutex);
+  int ret = io_uring_submit(&_impl->ring);
+  if (ret < 0)
+    throw std::ios_base::failure(std::string("io_uring_submit() failed: ") + std::strerror(-ret));
+  return ret;
+}
+
+bool IoUring::wait(int fd, const int timeout)
+{
+  {
+    std::lock_guard<std::mutex> lock(_impl->submissionMutex);
+    // A multishot poll remains armed across wakeups, such that waiting for the next
+    // event requires no submission, only the wait itself.
+    if (!_impl->pollPending) {
+      struct io_uring_sqe* sqe = _impl->getSqe();
+      if (_impl->pollMultishot)
+        io_uring_prep_poll_multishot(sqe, fd, POLLIN);
+      else
+        io_uring_prep_poll_add(sqe, fd, POLLIN);
+      io_uring_sqe_set_data(sqe, nullptr);
+      _impl->pollPending = true;
+    }
+    if (io_uring_sq_ready(&_impl->ring) > 0) {
+      int ret = io_uring_submit(&_impl->ring);
+      if (ret < 0)
+        throw std::ios_base::failure(std::string("io_uring_submit() failed: ") +
+                                     std::strerror(-ret));
+    }
+  }
+
+  struct io_uring_cqe* cqe = nullptr;
+  int ret;
+  if (timeout < 0) {
+    ret = io_uring_wait_cqe(&_impl->ring, &cqe);
+  } else {
+    struct __kernel_timespec ts = {.tv_sec  = timeout / 1000,
+                                   .tv_nsec = static_cast<long long>(timeout % 1000) * 1000000};
+    ret = io_uring_wait_cqe_timeout(&_impl->ring, &cqe, &ts);
+  }
+  if (ret == -ETIME || ret == -EINTR || ret == -EAGAIN) return false;
+  if (ret < 0)
+    throw std::ios_base::failure(std::string("io_uring_wait_cqe() failed: ") +
+                                 std::strerror(-ret));
+
+  // Process all completions available, not only the one that woke the waiter.
+  bool readable = false;
+  std::vector<std::pair<FileIOCallback*, ssize_t>> completed;
+  unsigned head;
+  unsigned count = 0;
+  io_uring_for_each_cqe(&_impl->ring, head, cqe)
+  {
+    ++count;
+    auto callback = reinterpret_cast<FileIOCallback*>(io_uring_cqe_get_data(cqe));
+    if (callback != nullptr) {
+      completed.emplace_back(callback, cqe->res);
+      continue;
+    }
+
+    if (cqe->res == -EINVAL && _impl->pollMultishot) {
+      ucxx_debug("IoUring %p multishot poll not supported, falling back to oneshot", this);
+      _impl->pollMultishot = false;
+    } else {
+      readable = true;
+    }
+    if (!(cqe->flags & IORING_CQE_F_MORE)) _impl->pollPending = false;
+  }
+  io_uring_cq_advance(&_impl->ring, count);
+
+  if (!completed.empty()) {
+    {
+      std::lock_guard<std::mutex> lock(_impl->submissionMutex);
+      for (const auto& c : completed)
+        _impl->inflight.erase(c.first);
+    }
+    for (const auto& c : completed) {
+      std::unique_ptr<FileIOCallback> callback(c.first);
+      if (*callback) (*callback)(c.second);
+    }
+  }
+
+  return readable;
+}
+
+#else
+
+struct IoUring::Impl {};
+
+IoUring::IoUring(const unsigned entries)
+{
+  throw ucxx::UnsupportedError(
+    "io_uring support not enabled, please compile with -DUCXX_ENABLE_IO_URING=1");
+}
+
+IoUring::~IoUring() {}
+
+bool IoUring::isAvailable() { return false; }
+
+size_t IoUring::prepareRead(
+  int fd, void* buffer, const size_t length, const off_t offset, FileIOCallback callback)
+{
+  return 0;
+}
+
+size_t IoUring::prepareWrite(
+  int fd, const void* buffer, const size_t length, const off_t offset, FileIOCallback callback)
+{
+  return 0;
+}
+
+size_t IoUring::submit() { return 0; }
+
+bool IoUring::wait(int fd, const int timeout) { return false; }
+
+#endif
+
+}  // namespace ucxx
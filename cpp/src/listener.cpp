@@ -2,7 +2,9 @@
  * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
  * SPDX-License-Identifier: BSD-3-Clause
  */
+#include <future>
 #include <memory>
+#include <new>
 #include <netinet/in.h>
 #include <string>
 #include <ucp/api/ucp.h>
@@ -53,7 +55,8 @@ Listener::Listener(std::shared_ptr<Worker> worker,
   ucxx::utils::sockaddr_get_ip_port_str(&attr.sockaddr, ipString, portString, INET6_ADDRSTRLEN);
 
   _ip   = std::string(ipString);
-  _port = (uint16_t)atoi(portString);
+  _port   = (uint16_t)atoi(portString);
+  _worker = worker;
 
   setParent(worker);
 }
@@ -71,13 +74,33 @@ std::shared_ptr<Listener> createListener(std::shared_ptr<Worker> worker,
 std::shared_ptr<Endpoint> Listener::createEndpointFromConnRequest(ucp_conn_request_h connRequest,
                                                                   bool endpointErrorHandling)
 {
-  auto listener = std::dynamic_pointer_cast<Listener>(shared_from_this());
+  auto listener = std::static_pointer_cast<Listener>(shared_from_this());
   auto endpoint = ucxx::createEndpointFromConnRequest(listener, connRequest, endpointErrorHandling);
   return endpoint;
 }
 
+Expected<std::shared_ptr<Endpoint>> Listener::createEndpointFromConnRequest(
+  std::nothrow_t, ucp_conn_request_h connRequest, bool endpointErrorHandling) noexcept
+{
+  auto listener = std::static_pointer_cast<Listener>(weak_from_this().lock());
+  return ucxx::createEndpointFromConnRequest(
+    std::nothrow, listener, connRequest, endpointErrorHandling);
+}
+
+std::future<std::shared_ptr<Endpoint>> Listener::createEndpointFromConnRequestAsync(
+  ucp_conn_request_h connRequest, bool endpointErrorHandling)
+{
+  auto listener = std::static_pointer_cast<Listener>(shared_from_this());
+  return _worker->registerDelayedSubmissionFuture<std::shared_ptr<Endpoint>>(
+    [listener, connRequest, endpointErrorHandling]() {
+      return ucxx::createEndpointFromConnRequest(listener, connRequest, endpointErrorHandling);
+    });
+}
+
 ucp_listener_h Listener::getHandle() { return _handle.get(); }
 
+std::shared_ptr<Worker> Listener::getWorker() const { return _worker; }
+
 uint16_t Listener::getPort() { return _port; }
 
 std::string Listener::getIp() { return _ip; }
@@ -0,0 +1,65 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <memory>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/exception.h>
+#include <ucxx/log.h>
+#include <ucxx/memory_handle.h>
+#include <ucxx/utils/ucx.h>
+
+namespace ucxx {
+
+MemoryHandle::MemoryHandle(std::shared_ptr<Context> context, const size_t size, void* buffer)
+{
+  if (context == nullptr || context->getHandle() == nullptr)
+    throw ucxx::Error("Context not initialized");
+
+  ucp_mem_map_params_t params = {
+    .field_mask = UCP_MEM_MAP_PARAM_FIELD_ADDRESS | UCP_MEM_MAP_PARAM_FIELD_LENGTH |
+                  UCP_MEM_MAP_PARAM_FIELD_FLAGS,
+    .address = buffer,
+    .length  = size,
+    .flags   = buffer == nullptr ? static_cast<unsigned>(UCP_MEM_MAP_ALLOCATE) : 0u};
+
+  utils::ucsErrorThrow(ucp_mem_map(context->getHandle(), &params, &_handle));
+
+  ucp_mem_attr_t attr = {.field_mask = UCP_MEM_ATTR_FIELD_ADDRESS | UCP_MEM_ATTR_FIELD_LENGTH};
+
+  utils::ucsErrorThrow(ucp_mem_query(_handle, &attr));
+
+  _baseAddress = reinterpret_cast<uint64_t>(attr.address);
+  _size        = attr.length;
+
+  ucxx_trace("MemoryHandle created: %p, base address: 0x%lx, size: %lu",
+             _handle,
+             _baseAddress,
+             _size);
+
+  setParent(context);
+}
+
+std::shared_ptr<MemoryHandle> createMemoryHandle(std::shared_ptr<Context> context,
+                                                 const size_t size,
+                                                 void* buffer)
+{
+  return std::shared_ptr<MemoryHandle>(new MemoryHandle(context, size, buffer));
+}
+
+MemoryHandle::~MemoryHandle()
+{
+  auto context = std::dynamic_pointer_cast<Context>(getParent());
+  ucp_mem_unmap(context->getHandle(), _handle);
+  ucxx_trace("MemoryHandle destroyed: %p", _handle);
+}
+
+ucp_mem_h MemoryHandle::getHandle() { return _handle; }
+
+size_t MemoryHandle::getSize() const { return _size; }
+
+uint64_t MemoryHandle::getBaseAddress() { return _baseAddress; }
+
+}  // namespace ucxx
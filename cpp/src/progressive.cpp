@@ -0,0 +1,377 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string>
+#include <vector>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/exception.h>
+#include <ucxx/log.h>
+#include <ucxx/progressive.h>
+#include <ucxx/utils/ucx.h>
+
+namespace ucxx {
+
+namespace {
+
+/**
+ * The header is laid out as `ProgressiveMagic`, the total size of the buffer and the size
+ * of each chunk, all as `uint64_t`. Chunks follow in order with the same tag, the last
+ * one possibly shorter than the chunk size.
+ */
+constexpr uint64_t ProgressiveMagic = 0x75637878'70726f67ull;
+
+size_t countChunks(const size_t size, const size_t chunkSize)
+{
+  return chunkSize == 0 ? 0 : (size + chunkSize - 1) / chunkSize;
+}
+
+void validateEndpoint(std::shared_ptr<Endpoint> endpoint)
+{
+  if (endpoint == nullptr || endpoint->getHandle() == nullptr)
+    throw ucxx::Error("Endpoint not initialized");
+}
+
+}  // namespace
+
+ProgressiveSender::ProgressiveSender(std::shared_ptr<Endpoint> endpoint,
+                                     void* buffer,
+                                     const size_t size,
+                                     const ucp_tag_t tag,
+                                     const size_t chunkSize)
+  : _tag(tag),
+    _buffer(reinterpret_cast<char*>(buffer)),
+    _size(size),
+    _chunkSize(chunkSize),
+    _numChunks(countChunks(size, chunkSize))
+{
+  validateEndpoint(endpoint);
+  if (chunkSize == 0) throw ucxx::Error("Progressive chunk size must be at least 1");
+
+  _published.resize(_numChunks, 0);
+
+  const uint64_t header[3] = {ProgressiveMagic, _size, _chunkSize};
+  _header.assign(reinterpret_cast<const char*>(header), sizeof(header));
+
+  ucxx_trace("ProgressiveSender created: %p, size: %lu, chunk size: %lu, chunks: %lu",
+             this,
+             _size,
+             _chunkSize,
+             _numChunks);
+
+  setParent(endpoint);
+}
+
+std::shared_ptr<ProgressiveSender> createProgressiveSender(std::shared_ptr<Endpoint> endpoint,
+                                                           void* buffer,
+                                                           const size_t size,
+                                                           const ucp_tag_t tag,
+                                                           const size_t chunkSize)
+{
+  auto sender = std::shared_ptr<ProgressiveSender>(
+    new ProgressiveSender(endpoint, buffer, size, tag, chunkSize));
+  sender->sendHeader();
+  return sender;
+}
+
+void ProgressiveSender::sendHeader()
+{
+  auto endpoint = std::static_pointer_cast<Endpoint>(_parent);
+  auto request  = endpoint->tagSend(&_header.front(), _header.size(), _tag, false);
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  _requests.push_back(request);
+}
+
+size_t ProgressiveSender::getChunkLength(const size_t chunk) const
+{
+  return std::min(_chunkSize, _size - chunk * _chunkSize);
+}
+
+void ProgressiveSender::publish(const size_t offset, const size_t length)
+{
+  if (offset > _size || length > _size - offset)
+    throw ucxx::Error("Progressive range exceeds the buffer");
+  if (length == 0) return;
+
+  const size_t first = offset / _chunkSize;
+  const size_t last  = (offset + length - 1) / _chunkSize;
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    // Validate all chunks before updating any, a rejected range leaves no trace.
+    auto overlap = [this, offset, length](const size_t chunk) {
+      const size_t begin = std::max(offset, chunk * _chunkSize);
+      const size_t end   = std::min(offset + length, chunk * _chunkSize + getChunkLength(chunk));
+      return end - begin;
+    };
+    for (size_t chunk = first; chunk <= last; ++chunk)
+      if (_published[chunk] + overlap(chunk) > getChunkLength(chunk))
+        throw ucxx::Error("Progressive range overlaps a range already published");
+    for (size_t chunk = first; chunk <= last; ++chunk)
+      _published[chunk] += overlap(chunk);
+
+    while (_readyChunks < _numChunks && _published[_readyChunks] == getChunkLength(_readyChunks))
+      ++_readyChunks;
+  }
+
+  postChunks();
+}
+
+void ProgressiveSender::postChunks()
+{
+  auto endpoint = std::static_pointer_cast<Endpoint>(_parent);
+  auto weak     = weak_from_this();
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_posting) return;
+    _posting = true;
+  }
+
+  // Chunks are matched by the receiver in the order they are sent, thus only one thread
+  // posts at a time, chunks made ready by other threads are left to this loop.
+  while (true) {
+    size_t chunk;
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      if (_nextChunk >= _readyChunks) {
+        _posting = false;
+        return;
+      }
+      chunk = _nextChunk++;
+    }
+
+    ucxx_trace_req("ProgressiveSender %p sending chunk %lu/%lu", this, chunk + 1, _numChunks);
+
+    auto sent    = [weak](ucs_status_t, std::shared_ptr<void>) {
+      if (auto s = weak.lock()) ++std::static_pointer_cast<ProgressiveSender>(s)->_sentChunks;
+    };
+    auto request =
+      endpoint->tagSend(_buffer + chunk * _chunkSize, getChunkLength(chunk), _tag, false, sent);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _requests.push_back(request);
+  }
+}
+
+size_t ProgressiveSender::getSize() const { return _size; }
+
+size_t ProgressiveSender::getNumChunks() const { return _numChunks; }
+
+size_t ProgressiveSender::getSentChunks() const { return _sentChunks; }
+
+bool ProgressiveSender::isCompleted()
+{
+  if (_sentChunks < _numChunks) return false;
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  return std::all_of(_requests.begin(), _requests.end(), [](const auto& request) {
+    return request->isCompleted();
+  });
+}
+
+ucs_status_t ProgressiveSender::getStatus()
+{
+  if (!isCompleted()) return UCS_INPROGRESS;
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  for (const auto& request : _requests) {
+    const ucs_status_t status = request->getStatus();
+    if (status != UCS_OK) return status;
+  }
+  return UCS_OK;
+}
+
+ProgressiveReceiver::ProgressiveReceiver(std::shared_ptr<Endpoint> endpoint,
+                                         void* buffer,
+                                         const size_t capacity,
+                                         const ucp_tag_t tag,
+                                         ProgressiveChunkCallback chunkCallback)
+  : _tag(tag),
+    _buffer(reinterpret_cast<char*>(buffer)),
+    _capacity(buffer == nullptr ? 0 : capacity),
+    _chunkCallback(chunkCallback)
+{
+  validateEndpoint(endpoint);
+
+  ucxx_trace("ProgressiveReceiver created: %p, buffer: %p, capacity: %lu",
+             this,
+             _buffer,
+             _capacity);
+
+  setParent(endpoint);
+}
+
+std::shared_ptr<ProgressiveReceiver> createProgressiveReceiver(
+  std::shared_ptr<Endpoint> endpoint,
+  void* buffer,
+  const size_t capacity,
+  const ucp_tag_t tag,
+  ProgressiveChunkCallback chunkCallback)
+{
+  auto receiver = std::shared_ptr<ProgressiveReceiver>(
+    new ProgressiveReceiver(endpoint, buffer, capacity, tag, chunkCallback));
+  receiver->recvHeader();
+  return receiver;
+}
+
+void ProgressiveReceiver::recvHeader()
+{
+  auto endpoint = std::static_pointer_cast<Endpoint>(_parent);
+  auto weak     = weak_from_this();
+
+  _header.assign(3 * sizeof(uint64_t), 0);
+  auto received = [weak](ucs_status_t status, std::shared_ptr<void>) {
+    if (auto s = weak.lock()) std::static_pointer_cast<ProgressiveReceiver>(s)->recvChunks(status);
+  };
+  auto request = endpoint->tagRecv(&_header.front(), _header.size(), _tag, false, received);
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  _requests.push_back(request);
+}
+
+void ProgressiveReceiver::recvChunks(const ucs_status_t status)
+{
+  auto endpoint = std::static_pointer_cast<Endpoint>(_parent);
+  auto weak     = weak_from_this();
+
+  if (status != UCS_OK) {
+    ucxx_debug(
+      "ProgressiveReceiver %p failed receiving header: %s", this, ucs_status_string(status));
+    _headerStatus = status;
+    _ready        = true;
+    _posted       = true;
+    return;
+  }
+
+  uint64_t header[3];
+  std::memcpy(header, _header.data(), sizeof(header));
+
+  if (header[0] != ProgressiveMagic || (header[1] > 0 && header[2] == 0)) {
+    ucxx_debug("ProgressiveReceiver %p received malformed header", this);
+    _headerStatus = UCS_ERR_IO_ERROR;
+    _ready        = true;
+    _posted       = true;
+    return;
+  }
+
+  _size      = header[1];
+  _chunkSize = header[2];
+  _numChunks = countChunks(_size, _chunkSize);
+
+  // The size comes from the remote end, a failure to allocate it must not escape the
+  // request callback, the transfer fails instead and its chunks are discarded below.
+  if (_buffer == nullptr) {
+    try {
+      _allocation.reset(new char[_size]);
+      _buffer   = _allocation.get();
+      _capacity = _size;
+    } catch (const std::bad_alloc&) {
+      ucxx_debug("ProgressiveReceiver %p failed allocating %lu bytes", this, _size);
+      _headerStatus = UCS_ERR_NO_MEMORY;
+    }
+  }
+
+  // Chunks that don't fit are still received, truncated into a scratch buffer, so that
+  // they are not left unmatched to be received by later transfers with the same tag.
+  const bool truncated = _size > _capacity;
+  if (truncated) {
+    ucxx_debug("ProgressiveReceiver %p buffer of %lu bytes can't fit transfer of %lu bytes",
+               this,
+               _capacity,
+               _size);
+    if (_headerStatus == UCS_OK) _headerStatus = UCS_ERR_MESSAGE_TRUNCATED;
+    _scratch.assign(1, 0);
+  }
+
+  _ready = true;
+
+  for (size_t chunk = 0; chunk < _numChunks; ++chunk) {
+    const size_t offset = chunk * _chunkSize;
+    const size_t length = std::min(_chunkSize, _size - offset);
+    auto received       = [weak, chunk](ucs_status_t, std::shared_ptr<void>) {
+      if (auto s = weak.lock())
+        std::static_pointer_cast<ProgressiveReceiver>(s)->markReceived(chunk);
+    };
+    auto request = endpoint->tagRecv(truncated ? &_scratch.front() : _buffer + offset,
+                                     truncated ? _scratch.size() : length,
+                                     _tag,
+                                     false,
+                                     received);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    _requests.push_back(request);
+  }
+
+  _posted = true;
+}
+
+void ProgressiveReceiver::markReceived(const size_t chunk)
+{
+  const size_t offset = chunk * _chunkSize;
+  const size_t length = std::min(_chunkSize, _size - offset);
+
+  ucxx_trace_req(
+    "ProgressiveReceiver %p received chunk %lu/%lu", this, chunk + 1, _numChunks);
+
+  // The transfer is only completed once the callback of its last chunk returned
+  if (_chunkCallback && _headerStatus == UCS_OK) _chunkCallback(offset, length);
+  ++_receivedChunks;
+}
+
+bool ProgressiveReceiver::isReady() const { return _ready; }
+
+void* ProgressiveReceiver::getBuffer() const
+{
+  if (!_ready) throw ucxx::Error("Progressive header not received yet");
+  return _buffer;
+}
+
+size_t ProgressiveReceiver::getSize() const
+{
+  if (!_ready) throw ucxx::Error("Progressive header not received yet");
+  return _size;
+}
+
+size_t ProgressiveReceiver::getNumChunks() const
+{
+  if (!_ready) throw ucxx::Error("Progressive header not received yet");
+  return _numChunks;
+}
+
+size_t ProgressiveReceiver::getReceivedChunks() const { return _receivedChunks; }
+
+bool ProgressiveReceiver::isCompleted() const
+{
+  return _posted && _receivedChunks == _numChunks;
+}
+
+ucs_status_t ProgressiveReceiver::getStatus()
+{
+  if (!isCompleted()) return UCS_INPROGRESS;
+  if (_headerStatus != UCS_OK) return _headerStatus;
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  for (const auto& request : _requests) {
+    const ucs_status_t status = request->getStatus();
+    if (status != UCS_OK) return status;
+  }
+  return UCS_OK;
+}
+
+void ProgressiveReceiver::checkError()
+{
+  const ucs_status_t status = getStatus();
+  if (status != UCS_OK && status != UCS_INPROGRESS) utils::ucsErrorThrow(status);
+}
+
+}  // namespace ucxx
@@ -0,0 +1,327 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/exception.h>
+#include <ucxx/log.h>
+#include <ucxx/pubsub.h>
+
+namespace ucxx {
+
+namespace {
+
+/**
+ * Register (`subscribe == true`) or unregister the subscription to `topic` on `worker`,
+ * returning `false` if registering a topic that already has a subscription.
+ */
+bool updateWorkerSubscriptions(ucp_worker_h worker, const ucp_tag_t topic, const bool subscribe)
+{
+  static std::mutex mutex;
+  static std::set<std::pair<ucp_worker_h, ucp_tag_t>> subscriptions;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  if (subscribe) return subscriptions.emplace(worker, topic).second;
+  subscriptions.erase({worker, topic});
+  return true;
+}
+
+}  // namespace
+
+Publication::Publication(const PublicationHeader& header,
+                         RequestCallbackUserFunction callbackFunction,
+                         RequestCallbackUserData callbackData)
+  : _header(header), _callback(callbackFunction), _callbackData(callbackData)
+{
+}
+
+void Publication::markCompleted(const ucs_status_t status)
+{
+  if (status != UCS_OK) {
+    ucs_status_t expected = UCS_OK;
+    _status.compare_exchange_strong(expected, status);
+  }
+
+  if (--_pending == 0) {
+    ucxx_trace_req("Publication %p sequence %lu completed, fanout: %lu, skipped: %lu, status: %s",
+                   this,
+                   _header.sequence,
+                   _fanout,
+                   _skipped,
+                   ucs_status_string(_status));
+    if (_callback) _callback(_status, _callbackData);
+    _callback     = nullptr;
+    _callbackData = nullptr;
+  }
+}
+
+bool Publication::isCompleted() const { return _pending == 0; }
+
+ucs_status_t Publication::getStatus() const
+{
+  return isCompleted() ? _status.load() : UCS_INPROGRESS;
+}
+
+size_t Publication::getFanout() const { return _fanout; }
+
+size_t Publication::getSkipped() const { return _skipped; }
+
+Publisher::Publisher(std::shared_ptr<Worker> worker,
+                     const size_t maxLag,
+                     const SlowSubscriberPolicy policy)
+  : _maxLag(maxLag), _policy(policy)
+{
+  if (worker == nullptr || worker->getHandle() == nullptr)
+    throw ucxx::Error("Worker not initialized");
+  if (maxLag == 0) throw ucxx::Error("Maximum subscriber lag must be at least 1");
+
+  std::random_device random;
+  _id = (static_cast<uint64_t>(random()) << 32) | random();
+
+  setParent(worker);
+}
+
+std::shared_ptr<Publisher> createPublisher(std::shared_ptr<Worker> worker,
+                                           const size_t maxLag,
+                                           const SlowSubscriberPolicy policy)
+{
+  return std::shared_ptr<Publisher>(new Publisher(worker, maxLag, policy));
+}
+
+void Publisher::subscribe(const ucp_tag_t topic, std::shared_ptr<Endpoint> endpoint)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  _topics[topic].push_back(
+    Subscriber{.endpoint = endpoint, .inflight = std::make_shared<std::atomic<size_t>>(0)});
+}
+
+bool Publisher::unsubscribe(const ucp_tag_t topic, std::shared_ptr<Endpoint> endpoint)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  auto& subscribers = _topics[topic];
+  auto it           = std::find_if(subscribers.begin(), subscribers.end(), [&endpoint](auto& s) {
+    return s.endpoint == endpoint;
+  });
+  if (it == subscribers.end()) return false;
+
+  subscribers.erase(it);
+  return true;
+}
+
+size_t Publisher::getSubscriberCount(const ucp_tag_t topic)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  auto it = _topics.find(topic);
+  return it == _topics.end() ? 0 : it->second.size();
+}
+
+std::shared_ptr<Publication> Publisher::publish(
+  const ucp_tag_t topic,
+  void* buffer,
+  const size_t length,
+  RequestCallbackUserFunction callbackFunction,
+  RequestCallbackUserData callbackData)
+{
+  std::vector<Subscriber> targets;
+  std::shared_ptr<Publication> publication;
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto& subscribers = _topics[topic];
+
+    publication = std::make_shared<Publication>(
+      PublicationHeader{.magic     = PublicationHeaderMagic,
+                        .sequence  = _sequence[topic]++,
+                        .length    = length,
+                        .publisher = _id},
+      callbackFunction,
+      callbackData);
+
+    for (auto it = subscribers.begin(); it != subscribers.end();) {
+      bool slow = *it->inflight >= _maxLag;
+      if (!it->endpoint->isAlive() || (slow && _policy == SlowSubscriberPolicy::Drop)) {
+        ucxx_debug("Publisher %p dropping subscriber endpoint %p from topic 0x%lx",
+                   this,
+                   it->endpoint->getHandle(),
+                   topic);
+        ++publication->_skipped;
+        it = subscribers.erase(it);
+      } else if (slow) {
+        ++publication->_skipped;
+        ++it;
+      } else {
+        targets.push_back(*it++);
+      }
+    }
+  }
+
+  publication->_fanout = targets.size();
+
+  // Each subscriber requires two sends (header and payload), the additional count ensures
+  // the publication can't complete before all sends are submitted.
+  publication->_pending = 2 * targets.size() + 1;
+
+  auto headerCompleted = [publication](ucs_status_t status, std::shared_ptr<void>) {
+    publication->markCompleted(status);
+  };
+  for (auto& target : targets) {
+    auto inflight = target.inflight;
+    ++*inflight;
+    auto payloadCompleted = [publication, inflight](ucs_status_t status, std::shared_ptr<void>) {
+      --*inflight;
+      publication->markCompleted(status);
+    };
+
+    target.endpoint->tagSend(
+      &publication->_header, sizeof(PublicationHeader), topic, false, headerCompleted);
+    target.endpoint->tagSend(buffer, length, topic, false, payloadCompleted);
+  }
+
+  publication->markCompleted();
+
+  return publication;
+}
+
+Subscription::Subscription(std::shared_ptr<Worker> worker,
+                           const ucp_tag_t topic,
+                           std::function<void(std::shared_ptr<Buffer>)> callback)
+  : _topic(topic), _callback(callback)
+{
+  if (worker == nullptr || worker->getHandle() == nullptr)
+    throw ucxx::Error("Worker not initialized");
+  if (!updateWorkerSubscriptions(worker->getHandle(), topic, true))
+    throw ucxx::Error("Worker already has a subscription to topic " + std::to_string(topic));
+
+  setParent(worker);
+}
+
+std::shared_ptr<Subscription> createSubscription(
+  std::shared_ptr<Worker> worker,
+  const ucp_tag_t topic,
+  std::function<void(std::shared_ptr<Buffer>)> callback)
+{
+  auto subscription = std::shared_ptr<Subscription>(new Subscription(worker, topic, callback));
+  subscription->advance();
+  return subscription;
+}
+
+Subscription::~Subscription()
+{
+  close();
+  updateWorkerSubscriptions(std::static_pointer_cast<Worker>(_parent)->getHandle(), _topic, false);
+}
+
+void Subscription::advance()
+{
+  {
+    std::lock_guard<std::mutex> lock(_advanceMutex);
+    if (_advancing) {
+      _advancePending = true;
+      return;
+    }
+    _advancing = true;
+  }
+
+  while (true) {
+    step();
+
+    std::lock_guard<std::mutex> lock(_advanceMutex);
+    if (!_advancePending) {
+      _advancing = false;
+      return;
+    }
+    _advancePending = false;
+  }
+}
+
+void Subscription::step()
+{
+  if (_closed) return;
+
+  if (_request != nullptr) {
+    ucs_status_t status = _request->getStatus();
+    if (status == UCS_OK && _receivingHeader && _header.magic != PublicationHeaderMagic)
+      status = UCS_ERR_IO_ERROR;
+    if (status == UCS_OK && _receivingHeader) {
+      // Headers and payloads of concurrent publishers would be matched with each other.
+      if (_publisher == 0) _publisher = _header.publisher;
+      if (_header.publisher != _publisher) status = UCS_ERR_ALREADY_EXISTS;
+    }
+
+    if (status != UCS_OK) {
+      // Canceled receives are expected once closed, concurrently with this check.
+      if (_closed.exchange(true)) return;
+      ucxx_warn("Subscription %p to topic 0x%lx stopped, failed receiving %s: %s",
+                this,
+                _topic,
+                _receivingHeader ? "header" : "payload",
+                ucs_status_string(status));
+      _status = status;
+      return;
+    }
+
+    if (!_receivingHeader) deliver();
+  }
+
+  auto worker = std::static_pointer_cast<Worker>(_parent);
+  auto weak =
+    std::weak_ptr<Subscription>(std::static_pointer_cast<Subscription>(shared_from_this()));
+  auto completed = [weak](ucs_status_t, std::shared_ptr<void>) {
+    if (auto subscription = weak.lock()) subscription->advance();
+  };
+
+  // The state must be updated before posting, the request may complete immediately.
+  _receivingHeader = _request == nullptr || !_receivingHeader;
+  if (_receivingHeader) {
+    _header  = PublicationHeader{};
+    _request = worker->tagRecv(&_header, sizeof(PublicationHeader), _topic, false, completed);
+  } else {
+    _payload = std::shared_ptr<Buffer>(allocateBuffer(BufferType::Host, _header.length));
+    _request = worker->tagRecv(_payload->data(), _header.length, _topic, false, completed);
+  }
+}
+
+void Subscription::deliver()
+{
+  auto payload = std::move(_payload);
+  ++_received;
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_relay) _relay->publish(_topic, payload->data(), payload->getSize(), nullptr, payload);
+  }
+
+  if (_callback) _callback(payload);
+}
+
+void Subscription::addRelay(std::shared_ptr<Endpoint> endpoint,
+                            const size_t maxLag,
+                            const SlowSubscriberPolicy policy)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (_relay == nullptr)
+    _relay = createPublisher(std::static_pointer_cast<Worker>(_parent), maxLag, policy);
+  _relay->subscribe(_topic, endpoint);
+}
+
+size_t Subscription::getReceivedCount() const { return _received; }
+
+ucs_status_t Subscription::getStatus() const { return _status; }
+
+void Subscription::close()
+{
+  if (_closed.exchange(true)) return;
+
+  if (_request != nullptr && !_request->isCompleted()) _request->cancel();
+}
+
+}  // namespace ucxx
@@ -0,0 +1,420 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/exception.h>
+#include <ucxx/log.h>
+#include <ucxx/pull.h>
+#include <ucxx/request_helper.h>
+
+namespace ucxx {
+
+namespace {
+
+/**
+ * The descriptor header is laid out as `PullMagic`, the number of frames and the size of
+ * the descriptor, all as `uint64_t`. The descriptor contains for each frame its address,
+ * size and the size of its serialized remote key, all as `uint64_t`, followed by the
+ * serialized remote key itself. The release notification is `PullMagic` alone.
+ */
+constexpr uint64_t PullMagic = 0x75637878'70756c6cull;
+
+struct PullFrameDescriptor {
+  uint64_t address;
+  uint64_t size;
+  uint64_t remoteKeyLength;
+};
+
+std::shared_ptr<Context> getContext(std::shared_ptr<Endpoint> endpoint)
+{
+  auto worker = endpoint->getWorker();
+  return std::dynamic_pointer_cast<Context>(worker->getParent());
+}
+
+void validateParams(std::shared_ptr<Endpoint> endpoint, const ucp_tag_t tag)
+{
+  if (endpoint == nullptr || endpoint->getHandle() == nullptr)
+    throw ucxx::Error("Endpoint not initialized");
+  if (tag & PullReleaseTagBit) throw ucxx::Error("Pull tag must not have PullReleaseTagBit set");
+}
+
+}  // namespace
+
+PullSender::PullSender(std::shared_ptr<Endpoint> endpoint,
+                       const std::vector<void*>& buffer,
+                       const std::vector<size_t>& size,
+                       const ucp_tag_t tag)
+  : _tag(tag)
+{
+  validateParams(endpoint, tag);
+  if (size.size() != buffer.size())
+    throw std::length_error("buffer and size must have the same length");
+
+  auto context = getContext(endpoint);
+
+  for (size_t i = 0; i < buffer.size(); ++i) {
+    std::string remoteKey;
+    if (size[i] > 0) {
+      _memoryHandles.push_back(createMemoryHandle(context, size[i], buffer[i]));
+      remoteKey = createRemoteKeyFromMemoryHandle(_memoryHandles.back())->serialize();
+    }
+
+    PullFrameDescriptor frame{.address         = reinterpret_cast<uint64_t>(buffer[i]),
+                              .size            = size[i],
+                              .remoteKeyLength = remoteKey.size()};
+    _descriptor.append(reinterpret_cast<const char*>(&frame), sizeof(frame));
+    _descriptor.append(remoteKey);
+  }
+
+  const uint64_t header[3] = {PullMagic, buffer.size(), _descriptor.size()};
+  _descriptorHeader.assign(reinterpret_cast<const char*>(header), sizeof(header));
+
+  ucxx_trace("PullSender created: %p, frames: %lu, descriptor size: %lu",
+             this,
+             buffer.size(),
+             _descriptor.size());
+
+  setParent(endpoint);
+}
+
+std::shared_ptr<PullSender> createPullSender(std::shared_ptr<Endpoint> endpoint,
+                                             const std::vector<void*>& buffer,
+                                             const std::vector<size_t>& size,
+                                             const ucp_tag_t tag)
+{
+  auto sender = std::shared_ptr<PullSender>(new PullSender(endpoint, buffer, size, tag));
+  sender->post();
+  return sender;
+}
+
+PullSender::~PullSender()
+{
+  cancelRequests(std::static_pointer_cast<Endpoint>(_parent)->getWorker(), _requests);
+  ucxx_trace("PullSender destroyed: %p", this);
+}
+
+void PullSender::post()
+{
+  auto endpoint = std::static_pointer_cast<Endpoint>(_parent);
+  auto weak     = std::weak_ptr<PullSender>(
+    std::static_pointer_cast<PullSender>(shared_from_this()));
+
+  _release.assign(sizeof(uint64_t), 0);
+  _requests.push_back(endpoint->tagRecv(&_release.front(),
+                                        _release.size(),
+                                        _tag | PullReleaseTagBit,
+                                        false,
+                                        [weak](ucs_status_t status, std::shared_ptr<void>) {
+                                          if (auto sender = weak.lock())
+                                            sender->markReleased(status);
+                                        }));
+
+  _requests.push_back(
+    endpoint->tagSend(&_descriptorHeader.front(), _descriptorHeader.size(), _tag, false));
+  _requests.push_back(endpoint->tagSend(_descriptor.data(), _descriptor.size(), _tag, false));
+}
+
+void PullSender::markReleased(const ucs_status_t releaseStatus)
+{
+  uint64_t magic = 0;
+  std::memcpy(&magic, _release.data(), sizeof(magic));
+
+  const ucs_status_t status =
+    releaseStatus != UCS_OK ? releaseStatus : magic == PullMagic ? UCS_OK : UCS_ERR_IO_ERROR;
+
+  ucxx_trace_req(
+    "PullSender %p released with status %d (%s)", this, status, ucs_status_string(status));
+
+  _status = status;
+}
+
+bool PullSender::isReleased() const { return _status != UCS_INPROGRESS; }
+
+ucs_status_t PullSender::getStatus() const { return _status; }
+
+PullReceiver::PullReceiver(std::shared_ptr<Endpoint> endpoint,
+                           const ucp_tag_t tag,
+                           const size_t maxInflight,
+                           const size_t chunkSize)
+  : _tag(tag), _maxInflight(maxInflight), _chunkSize(chunkSize)
+{
+  validateParams(endpoint, tag);
+  if (maxInflight == 0) throw ucxx::Error("Pull maximum inflight gets must be at least 1");
+  if (chunkSize == 0) throw ucxx::Error("Pull chunk size must be at least 1");
+
+  ucxx_trace("PullReceiver created: %p, max inflight: %lu, chunk size: %lu",
+             this,
+             _maxInflight,
+             _chunkSize);
+
+  setParent(endpoint);
+}
+
+std::shared_ptr<PullReceiver> createPullReceiver(std::shared_ptr<Endpoint> endpoint,
+                                                 const ucp_tag_t tag,
+                                                 const size_t maxInflight,
+                                                 const size_t chunkSize)
+{
+  auto receiver =
+    std::shared_ptr<PullReceiver>(new PullReceiver(endpoint, tag, maxInflight, chunkSize));
+  receiver->recvDescriptorHeader();
+  return receiver;
+}
+
+PullReceiver::~PullReceiver()
+{
+  // Callbacks cannot post new requests once the last reference is gone, so requests may
+  // be read without locking.
+  cancelRequests(std::static_pointer_cast<Endpoint>(_parent)->getWorker(), _requests);
+  ucxx_trace("PullReceiver destroyed: %p", this);
+}
+
+void PullReceiver::recvDescriptorHeader()
+{
+  auto endpoint = std::static_pointer_cast<Endpoint>(_parent);
+  auto weak     = std::weak_ptr<PullReceiver>(
+    std::static_pointer_cast<PullReceiver>(shared_from_this()));
+
+  _descriptorHeader.assign(3 * sizeof(uint64_t), 0);
+  auto request = endpoint->tagRecv(&_descriptorHeader.front(),
+                                   _descriptorHeader.size(),
+                                   _tag,
+                                   false,
+                                   [weak](ucs_status_t status, std::shared_ptr<void>) {
+                                     if (auto receiver = weak.lock())
+                                       receiver->recvDescriptor(status);
+                                   });
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  _requests.push_back(request);
+}
+
+void PullReceiver::recvDescriptor(const ucs_status_t status)
+{
+  auto endpoint = std::static_pointer_cast<Endpoint>(_parent);
+  auto weak     = std::weak_ptr<PullReceiver>(
+    std::static_pointer_cast<PullReceiver>(shared_from_this()));
+
+  if (status != UCS_OK) {
+    ucxx_debug("PullReceiver %p failed receiving descriptor header: %s",
+               this,
+               ucs_status_string(status));
+    _descriptorStatus = status;
+    _ready            = true;
+    return;
+  }
+
+  uint64_t header[3];
+  std::memcpy(header, _descriptorHeader.data(), sizeof(header));
+
+  if (header[0] != PullMagic || header[1] > header[2] / sizeof(PullFrameDescriptor)) {
+    ucxx_debug("PullReceiver %p received malformed descriptor header", this);
+    _descriptorStatus = UCS_ERR_IO_ERROR;
+    _ready            = true;
+    return;
+  }
+
+  _frames.resize(header[1]);
+  _descriptor.assign(header[2], 0);
+  auto request = endpoint->tagRecv(_descriptor.data(),
+                                   _descriptor.size(),
+                                   _tag,
+                                   false,
+                                   [weak](ucs_status_t status, std::shared_ptr<void>) {
+                                     if (auto receiver = weak.lock())
+                                       receiver->parseDescriptor(status);
+                                   });
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  _requests.push_back(request);
+}
+
+void PullReceiver::parseDescriptor(const ucs_status_t status)
+{
+  auto endpoint = std::static_pointer_cast<Endpoint>(_parent);
+
+  if (status != UCS_OK) {
+    ucxx_debug("PullReceiver %p failed receiving descriptor: %s", this, ucs_status_string(status));
+    _frames.clear();
+    _descriptorStatus = status;
+    _ready            = true;
+    return;
+  }
+
+  size_t offset = 0;
+  try {
+    for (auto& frame : _frames) {
+      PullFrameDescriptor frameDescriptor;
+      if (_descriptor.size() - offset < sizeof(frameDescriptor))
+        throw ucxx::Error("Pull descriptor is truncated");
+      std::memcpy(&frameDescriptor, _descriptor.data() + offset, sizeof(frameDescriptor));
+      offset += sizeof(frameDescriptor);
+
+      if (_descriptor.size() - offset < frameDescriptor.remoteKeyLength)
+        throw ucxx::Error("Pull descriptor is truncated");
+      if (frameDescriptor.size > 0 && frameDescriptor.remoteKeyLength == 0)
+        throw ucxx::Error("Pull descriptor frame has no remote key");
+
+      frame.address = frameDescriptor.address;
+      frame.size    = frameDescriptor.size;
+      if (frameDescriptor.remoteKeyLength > 0)
+        frame.remoteKey = createRemoteKeyFromSerialized(
+          endpoint, _descriptor.substr(offset, frameDescriptor.remoteKeyLength));
+      offset += frameDescriptor.remoteKeyLength;
+    }
+  } catch (const ucxx::Error& e) {
+    ucxx_debug("PullReceiver %p received malformed descriptor: %s", this, e.what());
+    _frames.clear();
+    _descriptorStatus = UCS_ERR_IO_ERROR;
+  }
+
+  ucxx_trace_req("PullReceiver %p received descriptor, frames: %lu", this, _frames.size());
+
+  _ready = true;
+}
+
+void PullReceiver::scheduleFetches()
+{
+  auto endpoint = std::static_pointer_cast<Endpoint>(_parent);
+  auto weak     = std::weak_ptr<PullReceiver>(
+    std::static_pointer_cast<PullReceiver>(shared_from_this()));
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_scheduling) return;
+    _scheduling = true;
+  }
+
+  // Gets completing immediately, or on another thread, return early from their own call
+  // and leave the remaining queued gets to this loop, bounding the recursion depth.
+  while (true) {
+    Fetch fetch;
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      if (_inflight >= _maxInflight || _queue.empty()) {
+        _scheduling = false;
+        return;
+      }
+      fetch = _queue.top();
+      _queue.pop();
+      ++_inflight;
+    }
+
+    auto request = endpoint->rmaGet(fetch.buffer,
+                                    fetch.length,
+                                    fetch.address,
+                                    fetch.remoteKey,
+                                    false,
+                                    [weak](ucs_status_t status, std::shared_ptr<void>) {
+                                      if (auto receiver = weak.lock())
+                                        receiver->markFetched(status);
+                                    });
+
+    // Completed requests are pruned as gets are posted, their status is kept by
+    // `markFetched()`, bounding the requests held to those inflight.
+    std::lock_guard<std::mutex> lock(_mutex);
+    _requests.erase(std::remove_if(_requests.begin(),
+                                   _requests.end(),
+                                   [](auto& request) { return request->isCompleted(); }),
+                    _requests.end());
+    if (!request->isCompleted()) _requests.push_back(request);
+  }
+}
+
+void PullReceiver::markFetched(const ucs_status_t status)
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_fetchStatus == UCS_OK) _fetchStatus = status;
+    --_inflight;
+    --_pending;
+  }
+  scheduleFetches();
+}
+
+bool PullReceiver::isReady() const { return _ready; }
+
+size_t PullReceiver::getNumFrames() const
+{
+  if (!_ready) throw ucxx::Error("Pull descriptor not received yet");
+  return _frames.size();
+}
+
+size_t PullReceiver::getFrameSize(const size_t frame) const
+{
+  if (frame >= getNumFrames())
+    throw ucxx::Error("Pull frame " + std::to_string(frame) + " does not exist");
+  return _frames[frame].size;
+}
+
+void PullReceiver::fetch(const size_t frame, void* buffer, const int priority)
+{
+  const size_t size = getFrameSize(frame);
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_released) throw ucxx::Error("Pull frames already released");
+
+    const auto& remoteFrame = _frames[frame];
+    for (size_t offset = 0; offset < size; offset += _chunkSize) {
+      _queue.push(Fetch{.priority  = priority,
+                        .sequence  = _sequence++,
+                        .buffer    = reinterpret_cast<char*>(buffer) + offset,
+                        .length    = std::min(_chunkSize, size - offset),
+                        .address   = remoteFrame.address + offset,
+                        .remoteKey = remoteFrame.remoteKey});
+      ++_pending;
+    }
+  }
+
+  scheduleFetches();
+}
+
+bool PullReceiver::isCompleted()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _pending == 0;
+}
+
+ucs_status_t PullReceiver::getStatus()
+{
+  if (!_ready) return UCS_INPROGRESS;
+  if (_descriptorStatus != UCS_OK) return _descriptorStatus;
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _pending > 0 ? UCS_INPROGRESS : _fetchStatus;
+}
+
+std::shared_ptr<Request> PullReceiver::release()
+{
+  if (!_ready) throw ucxx::Error("Pull descriptor not received yet");
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_released) throw ucxx::Error("Pull frames already released");
+    if (_pending > 0) throw ucxx::Error("Pull fetches still pending");
+    _released = true;
+  }
+
+  auto endpoint = std::static_pointer_cast<Endpoint>(_parent);
+
+  _release.assign(reinterpret_cast<const char*>(&PullMagic), sizeof(PullMagic));
+  auto request =
+    endpoint->tagSend(&_release.front(), _release.size(), _tag | PullReleaseTagBit, false);
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  _requests.push_back(request);
+  return request;
+}
+
+}  // namespace ucxx
@@ -0,0 +1,95 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <cstring>
+#include <memory>
+#include <string>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/log.h>
+#include <ucxx/remote_key.h>
+#include <ucxx/utils/ucx.h>
+
+namespace ucxx {
+
+RemoteKey::RemoteKey(std::shared_ptr<MemoryHandle> memoryHandle)
+  : _memoryBaseAddress{memoryHandle->getBaseAddress()}, _memorySize{memoryHandle->getSize()}
+{
+  auto context = std::dynamic_pointer_cast<Context>(memoryHandle->getParent());
+
+  void* packedRemoteKey;
+  size_t packedRemoteKeySize;
+  utils::ucsErrorThrow(ucp_rkey_pack(
+    context->getHandle(), memoryHandle->getHandle(), &packedRemoteKey, &packedRemoteKeySize));
+  _packedRemoteKey = std::string(static_cast<char*>(packedRemoteKey), packedRemoteKeySize);
+  ucp_rkey_buffer_release(packedRemoteKey);
+
+  ucxx_trace("RemoteKey created from memory handle: %p, base address: 0x%lx, size: %lu",
+             memoryHandle->getHandle(),
+             _memoryBaseAddress,
+             _memorySize);
+
+  setParent(memoryHandle);
+}
+
+RemoteKey::RemoteKey(std::shared_ptr<Endpoint> endpoint, const std::string& serializedRemoteKey)
+{
+  if (endpoint == nullptr || endpoint->getHandle() == nullptr)
+    throw ucxx::Error("Endpoint not initialized");
+
+  constexpr size_t headerSize = sizeof(_memoryBaseAddress) + sizeof(_memorySize);
+  if (serializedRemoteKey.size() <= headerSize)
+    throw ucxx::Error("Serialized remote key is malformed");
+
+  std::memcpy(&_memoryBaseAddress, serializedRemoteKey.data(), sizeof(_memoryBaseAddress));
+  std::memcpy(&_memorySize,
+              serializedRemoteKey.data() + sizeof(_memoryBaseAddress),
+              sizeof(_memorySize));
+  _packedRemoteKey = serializedRemoteKey.substr(headerSize);
+
+  utils::ucsErrorThrow(
+    ucp_ep_rkey_unpack(endpoint->getHandle(), _packedRemoteKey.data(), &_remoteKey));
+
+  ucxx_trace("RemoteKey unpacked: %p, base address: 0x%lx, size: %lu",
+             _remoteKey,
+             _memoryBaseAddress,
+             _memorySize);
+
+  setParent(endpoint);
+}
+
+std::shared_ptr<RemoteKey> createRemoteKeyFromMemoryHandle(
+  std::shared_ptr<MemoryHandle> memoryHandle)
+{
+  return std::shared_ptr<RemoteKey>(new RemoteKey(memoryHandle));
+}
+
+std::shared_ptr<RemoteKey> createRemoteKeyFromSerialized(std::shared_ptr<Endpoint> endpoint,
+                                                         const std::string& serializedRemoteKey)
+{
+  return std::shared_ptr<RemoteKey>(new RemoteKey(endpoint, serializedRemoteKey));
+}
+
+RemoteKey::~RemoteKey()
+{
+  if (_remoteKey != nullptr) ucp_rkey_destroy(_remoteKey);
+  ucxx_trace("RemoteKey destroyed: %p", this);
+}
+
+ucp_rkey_h RemoteKey::getHandle() { return _remoteKey; }
+
+uint64_t RemoteKey::getBaseAddress() const { return _memoryBaseAddress; }
+
+size_t RemoteKey::getSize() const { return _memorySize; }
+
+std::string RemoteKey::serialize() const
+{
+  std::string serialized(sizeof(_memoryBaseAddress) + sizeof(_memorySize), '\0');
+  std::memcpy(serialized.data(), &_memoryBaseAddress, sizeof(_memoryBaseAddress));
+  std::memcpy(serialized.data() + sizeof(_memoryBaseAddress), &_memorySize, sizeof(_memorySize));
+  return serialized + _packedRemoteKey;
+}
+
+}  // namespace ucxx
@@ -0,0 +1,278 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/log.h>
+#include <ucxx/remote_object_cache.h>
+
+namespace ucxx {
+
+namespace {
+
+// FNV-1a is used instead of `std::hash` so that the hash of a key is guaranteed to match
+// between producer and consumer processes, even if built with different standard libraries.
+uint64_t hashKey(const std::string& key)
+{
+  uint64_t hash = 14695981039346656037ull;
+  for (const auto c : key) {
+    hash ^= static_cast<uint8_t>(c);
+    hash *= 1099511628211ull;
+  }
+  return hash;
+}
+
+// The full key is compared, the hash only selects the bucket and quickly rejects misses.
+bool matchesKey(const RemoteObjectCacheBucket& bucket,
+                const std::string& key,
+                const uint64_t keyHash)
+{
+  return bucket.occupied && bucket.keyHash == keyHash && bucket.keyLength == key.size() &&
+         std::memcmp(bucket.key, key.data(), key.size()) == 0;
+}
+
+}  // namespace
+
+RemoteObjectCache::RemoteObjectCache(std::shared_ptr<Worker> worker, const size_t numBuckets)
+  : _numBuckets(numBuckets), _index(numBuckets), _objectMemoryHandles(numBuckets)
+{
+  if (worker == nullptr || worker->getHandle() == nullptr)
+    throw ucxx::Error("Worker not initialized");
+  if (numBuckets == 0) throw ucxx::Error("Remote object cache requires at least one bucket");
+
+  std::memset(_index.data(), 0, _index.size() * sizeof(RemoteObjectCacheBucket));
+
+  auto context       = std::dynamic_pointer_cast<Context>(worker->getParent());
+  _indexMemoryHandle = createMemoryHandle(
+    context, _index.size() * sizeof(RemoteObjectCacheBucket), _index.data());
+  _indexRemoteKey    = createRemoteKeyFromMemoryHandle(_indexMemoryHandle);
+
+  ucxx_trace("RemoteObjectCache created: %p, buckets: %lu", this, _numBuckets);
+
+  setParent(worker);
+}
+
+std::shared_ptr<RemoteObjectCache> createRemoteObjectCache(std::shared_ptr<Worker> worker,
+                                                           const size_t numBuckets)
+{
+  return std::shared_ptr<RemoteObjectCache>(new RemoteObjectCache(worker, numBuckets));
+}
+
+void RemoteObjectCache::writeBucket(const size_t bucketIndex, const RemoteObjectCacheBucket& bucket)
+{
+  auto& target           = _index[bucketIndex];
+  const uint64_t version = target.versionBegin;
+
+  // Readers may observe the bucket at any point via RMA, the fences ensure the odd
+  // version is visible before the fields change and the even versions only after.
+  target.versionBegin = version + 1;
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  target.occupied        = bucket.occupied;
+  target.keyHash         = bucket.keyHash;
+  target.keyLength       = bucket.keyLength;
+  std::memcpy(target.key, bucket.key, bucket.keyLength);
+  target.address         = bucket.address;
+  target.length          = bucket.length;
+  target.remoteKeyLength = bucket.remoteKeyLength;
+  std::memcpy(target.remoteKey, bucket.remoteKey, bucket.remoteKeyLength);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  target.versionEnd = version + 2;
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  target.versionBegin = version + 2;
+}
+
+void RemoteObjectCache::put(const std::string& key, void* buffer, const size_t length)
+{
+  if (key.size() > RemoteObjectCacheMaxKeySize)
+    throw ucxx::Error("Key size " + std::to_string(key.size()) +
+                      " exceeds the maximum supported by the remote object cache (" +
+                      std::to_string(RemoteObjectCacheMaxKeySize) + ")");
+
+  auto context             = std::dynamic_pointer_cast<Context>(_parent->getParent());
+  auto memoryHandle        = createMemoryHandle(context, length, buffer);
+  auto serializedRemoteKey = createRemoteKeyFromMemoryHandle(memoryHandle)->serialize();
+
+  if (serializedRemoteKey.size() > RemoteObjectCacheMaxPackedRemoteKeySize)
+    throw ucxx::Error("Remote key size " + std::to_string(serializedRemoteKey.size()) +
+                      " exceeds the maximum supported by the remote object cache (" +
+                      std::to_string(RemoteObjectCacheMaxPackedRemoteKeySize) + ")");
+
+  const uint64_t keyHash   = hashKey(key);
+  const size_t bucketIndex = keyHash % _numBuckets;
+
+  RemoteObjectCacheBucket bucket{};
+  bucket.occupied        = 1;
+  bucket.keyHash         = keyHash;
+  bucket.keyLength       = key.size();
+  std::memcpy(bucket.key, key.data(), key.size());
+  bucket.address         = reinterpret_cast<uint64_t>(buffer);
+  bucket.length          = length;
+  bucket.remoteKeyLength = serializedRemoteKey.size();
+  std::memcpy(bucket.remoteKey, serializedRemoteKey.data(), serializedRemoteKey.size());
+
+  std::shared_ptr<MemoryHandle> evicted{nullptr};
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    writeBucket(bucketIndex, bucket);
+    evicted = std::exchange(_objectMemoryHandles[bucketIndex], memoryHandle);
+  }
+
+  ucxx_trace("RemoteObjectCache %p put key hash 0x%lx in bucket %lu, buffer %p, size %lu%s",
+             this,
+             keyHash,
+             bucketIndex,
+             buffer,
+             length,
+             evicted ? ", evicted previous object" : "");
+}
+
+bool RemoteObjectCache::evict(const std::string& key)
+{
+  const uint64_t keyHash   = hashKey(key);
+  const size_t bucketIndex = keyHash % _numBuckets;
+
+  std::shared_ptr<MemoryHandle> evicted{nullptr};
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!matchesKey(_index[bucketIndex], key, keyHash)) return false;
+
+    writeBucket(bucketIndex, RemoteObjectCacheBucket{});
+    evicted = std::exchange(_objectMemoryHandles[bucketIndex], nullptr);
+  }
+
+  ucxx_trace("RemoteObjectCache %p evicted key hash 0x%lx from bucket %lu",
+             this,
+             keyHash,
+             bucketIndex);
+  return true;
+}
+
+std::string RemoteObjectCache::getDescriptor() const
+{
+  const uint64_t numBuckets = _numBuckets;
+  std::string descriptor(sizeof(numBuckets), '\0');
+  std::memcpy(descriptor.data(), &numBuckets, sizeof(numBuckets));
+  return descriptor + _indexRemoteKey->serialize();
+}
+
+RemoteObjectCacheClient::RemoteObjectCacheClient(std::shared_ptr<Endpoint> endpoint,
+                                                 const std::string& descriptor,
+                                                 const size_t maxRetries)
+  : _maxRetries(maxRetries)
+{
+  uint64_t numBuckets = 0;
+  if (descriptor.size() <= sizeof(numBuckets))
+    throw ucxx::Error("Remote object cache descriptor is malformed");
+
+  std::memcpy(&numBuckets, descriptor.data(), sizeof(numBuckets));
+  _numBuckets     = numBuckets;
+  _indexRemoteKey = createRemoteKeyFromSerialized(endpoint, descriptor.substr(sizeof(numBuckets)));
+
+  if (_numBuckets == 0 ||
+      _indexRemoteKey->getSize() < _numBuckets * sizeof(RemoteObjectCacheBucket))
+    throw ucxx::Error("Remote object cache descriptor is malformed");
+
+  setParent(endpoint);
+}
+
+std::shared_ptr<RemoteObjectCacheClient> createRemoteObjectCacheClient(
+  std::shared_ptr<Endpoint> endpoint, const std::string& descriptor, const size_t maxRetries)
+{
+  return std::shared_ptr<RemoteObjectCacheClient>(
+    new RemoteObjectCacheClient(endpoint, descriptor, maxRetries));
+}
+
+bool RemoteObjectCacheClient::read(void* buffer,
+                                   const size_t length,
+                                   const uint64_t remoteAddress,
+                                   std::shared_ptr<RemoteKey> remoteKey)
+{
+  auto endpoint = std::static_pointer_cast<Endpoint>(_parent);
+  auto worker   = endpoint->getWorker();
+
+  auto request = endpoint->rmaGet(buffer, length, remoteAddress, remoteKey);
+  while (!request->isCompleted())
+    worker->progress();
+
+  return request->getStatus() == UCS_OK;
+}
+
+std::unique_ptr<Buffer> RemoteObjectCacheClient::get(const std::string& key)
+{
+  auto endpoint = std::static_pointer_cast<Endpoint>(_parent);
+
+  const uint64_t keyHash   = hashKey(key);
+  const size_t bucketIndex = keyHash % _numBuckets;
+
+  const uint64_t bucketAddress =
+    _indexRemoteKey->getBaseAddress() + bucketIndex * sizeof(RemoteObjectCacheBucket);
+
+  auto bucket = std::make_unique<RemoteObjectCacheBucket>();
+
+  for (size_t attempt = 0; attempt <= _maxRetries; ++attempt) {
+    if (!read(bucket.get(), sizeof(RemoteObjectCacheBucket), bucketAddress, _indexRemoteKey))
+      continue;
+
+    // Bucket being modified by the producer, retry.
+    const uint64_t version = bucket->versionBegin;
+    if (version != bucket->versionEnd || version % 2 != 0) continue;
+
+    // Whether the bucket has not been modified since it was read.
+    auto isUnchanged = [&]() {
+      uint64_t currentVersion = 0;
+      return read(&currentVersion, sizeof(currentVersion), bucketAddress, _indexRemoteKey) &&
+             currentVersion == version;
+    };
+
+    // The bucket is not read atomically, a mismatching key may be torn by a concurrent
+    // write and is only reported as a miss if the bucket has not been modified.
+    if (bucket->keyLength > RemoteObjectCacheMaxKeySize ||
+        bucket->remoteKeyLength > RemoteObjectCacheMaxPackedRemoteKeySize ||
+        !matchesKey(*bucket, key, keyHash)) {
+      if (!isUnchanged()) continue;
+      return nullptr;
+    }
+
+    std::shared_ptr<RemoteKey> remoteKey{nullptr};
+    {
+      std::lock_guard<std::mutex> lock(_objectRemoteKeysMutex);
+      auto& cachedRemoteKey = _objectRemoteKeys[bucketIndex];
+      if (cachedRemoteKey.second == nullptr || cachedRemoteKey.first != version) {
+        cachedRemoteKey = std::make_pair(
+          version,
+          createRemoteKeyFromSerialized(
+            endpoint,
+            std::string(reinterpret_cast<char*>(bucket->remoteKey), bucket->remoteKeyLength)));
+      }
+      remoteKey = cachedRemoteKey.second;
+    }
+
+    auto object = std::make_unique<HostBuffer>(bucket->length);
+    if (!read(object->data(), bucket->length, bucket->address, remoteKey)) continue;
+
+    // The object may have been evicted or replaced while being read, in which case the
+    // data may be torn and must be discarded.
+    if (!isUnchanged()) continue;
+
+    return object;
+  }
+
+  ucxx_debug("RemoteObjectCacheClient %p failed to read key hash 0x%lx consistently after %lu "
+             "retries",
+             this,
+             keyHash,
+             _maxRetries);
+  return nullptr;
+}
+
+}  // namespace ucxx
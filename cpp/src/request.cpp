@@ -4,8 +4,10 @@
  */
 #include <chrono>
 #include <memory>
+#include <new>
 #include <sstream>
 #include <string>
+#include <utility>
 
 #include <ucp/api/ucp.h>
 
@@ -16,18 +18,37 @@
 
 namespace ucxx {
 
-Request::Request(std::shared_ptr<Component> endpointOrWorker,
+Request::Request(std::shared_ptr<Endpoint> endpoint,
                  std::shared_ptr<DelayedSubmission> delayedSubmission,
                  const std::string operationName,
                  const bool enablePythonFuture)
-  : _delayedSubmission(delayedSubmission),
+  : Request(endpoint ? endpoint->getWorker() : nullptr,
+            endpoint,
+            delayedSubmission,
+            operationName,
+            enablePythonFuture)
+{
+}
+
+Request::Request(std::shared_ptr<Worker> worker,
+                 std::shared_ptr<DelayedSubmission> delayedSubmission,
+                 const std::string operationName,
+                 const bool enablePythonFuture)
+  : Request(worker, nullptr, delayedSubmission, operationName, enablePythonFuture)
+{
+}
+
+Request::Request(std::shared_ptr<Worker> worker,
+                 std::shared_ptr<Endpoint> endpoint,
+                 std::shared_ptr<DelayedSubmission> delayedSubmission,
+                 const std::string operationName,
+                 const bool enablePythonFuture)
+  : _worker(std::move(worker)),
+    _endpoint(std::move(endpoint)),
+    _delayedSubmission(delayedSubmission),
     _operationName(operationName),
     _enablePythonFuture(enablePythonFuture)
 {
-  _endpoint = std::dynamic_pointer_cast<Endpoint>(endpointOrWorker);
-  _worker   = _endpoint ? Endpoint::getWorker(_endpoint->getParent())
-                        : std::dynamic_pointer_cast<Worker>(endpointOrWorker);
-
   if (_worker == nullptr || _worker->getHandle() == nullptr)
     throw ucxx::Error("Worker not initialized");
   if (_endpoint != nullptr && _endpoint->getHandle() == nullptr)
@@ -87,11 +108,19 @@ ucs_status_t Request::getStatus() { return _status; }
 void* Request::getFuture() { return _future ? _future->getHandle() : nullptr; }
 
 void Request::checkError()
+{
+  auto status = checkError(std::nothrow);
+  if (status == UCS_OK) return;
+
+  utils::ucsErrorThrow(status, status == UCS_ERR_MESSAGE_TRUNCATED ? _status_msg : std::string());
+}
+
+ucs_status_t Request::checkError(std::nothrow_t) const noexcept
 {
   // Only load the atomic variable once
   auto status = _status.load();
 
-  utils::ucsErrorThrow(status, status == UCS_ERR_MESSAGE_TRUNCATED ? _status_msg : std::string());
+  return status == UCS_INPROGRESS ? UCS_OK : status;
 }
 
 bool Request::isCompleted() { return _status != UCS_INPROGRESS; }
@@ -105,7 +134,7 @@ void Request::callback(void* request, ucs_status_t status)
                    _operationName.c_str(),
                    "callback %p",
                    _callback.target<void (*)(void)>());
-  if (_callback) _callback(_callbackData);
+  if (_callback) _callback(_status, _callbackData);
 
   ucp_request_free(request);
   ucxx_trace("Request completed: %p, handle: %p", this, request);
@@ -138,13 +167,6 @@ void Request::process()
                    status,
                    ucs_status_string(status));
 
-  ucxx_trace_req_f(_ownerString.c_str(),
-                   _request,
-                   _operationName.c_str(),
-                   "callback %p",
-                   _callback.target<void (*)(void)>());
-  if (_callback) _callback(_callbackData);
-
   if (status != UCS_OK) {
     ucxx_error(
       "error on %s with status %d (%s)", _operationName.c_str(), status, ucs_status_string(status));
@@ -153,7 +175,16 @@ void Request::process()
       _ownerString.c_str(), _request, _operationName.c_str(), "completed immediately");
   }
 
+  // The status is set before the user callback runs, as in `callback()`, so that the
+  // callback observes the final status whether the request completed immediately or not.
   setStatus(status);
+
+  ucxx_trace_req_f(_ownerString.c_str(),
+                   _request,
+                   _operationName.c_str(),
+                   "callback %p",
+                   _callback.target<void (*)(void)>());
+  if (_callback) _callback(_status, _callbackData);
 }
 
 void Request::setStatus(ucs_status_t status)
@@ -184,4 +215,14 @@ void Request::setStatus(ucs_status_t status)
 
 const std::string& Request::getOwnerString() const { return _ownerString; }
 
+InflightRequestInfo Request::getInfo() const
+{
+  return InflightRequestInfo{.request       = this,
+                             .operationName = _operationName,
+                             .ownerString   = _ownerString,
+                             .tag           = _delayedSubmission->_tag,
+                             .length        = _delayedSubmission->_length,
+                             .submitTime    = _submitTime};
+}
+
 }  // namespace ucxx
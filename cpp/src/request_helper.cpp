@@ -24,4 +24,15 @@ void waitRequests(std::shared_ptr<Worker> worker, std::vector<std::shared_ptr<Re
     waitSingleRequest(worker, r);
 }
 
+void cancelRequests(std::shared_ptr<Worker> worker,
+                    const std::vector<std::shared_ptr<Request>>& requests)
+{
+  for (auto& r : requests)
+    if (r != nullptr && !r->isCompleted()) r->cancel();
+
+  for (auto& r : requests)
+    while (r != nullptr && !r->isCompleted())
+      worker->progress();
+}
+
 }  // namespace ucxx
@@ -0,0 +1,129 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <memory>
+#include <string>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/delayed_submission.h>
+#include <ucxx/request_rma.h>
+
+namespace ucxx {
+
+std::shared_ptr<RequestRma> createRequestRma(
+  std::shared_ptr<Endpoint> endpoint,
+  bool put,
+  void* buffer,
+  size_t length,
+  uint64_t remoteAddress,
+  std::shared_ptr<RemoteKey> remoteKey,
+  const bool enablePythonFuture                = false,
+  RequestCallbackUserFunction callbackFunction = nullptr,
+  RequestCallbackUserData callbackData         = nullptr)
+{
+  return std::shared_ptr<RequestRma>(new RequestRma(endpoint,
+                                                    put,
+                                                    buffer,
+                                                    length,
+                                                    remoteAddress,
+                                                    remoteKey,
+                                                    enablePythonFuture,
+                                                    callbackFunction,
+                                                    callbackData));
+}
+
+RequestRma::RequestRma(std::shared_ptr<Endpoint> endpoint,
+                       bool put,
+                       void* buffer,
+                       size_t length,
+                       uint64_t remoteAddress,
+                       std::shared_ptr<RemoteKey> remoteKey,
+                       const bool enablePythonFuture,
+                       RequestCallbackUserFunction callbackFunction,
+                       RequestCallbackUserData callbackData)
+  : Request(endpoint,
+            std::make_shared<DelayedSubmission>(put, buffer, length),
+            std::string(put ? "rmaPut" : "rmaGet"),
+            enablePythonFuture),
+    _remoteAddress(remoteAddress),
+    _remoteKey(remoteKey)
+{
+  if (_remoteKey == nullptr || _remoteKey->getHandle() == nullptr)
+    throw ucxx::Error("An unpacked remote key is required for RMA operations");
+  if (remoteAddress < _remoteKey->getBaseAddress() ||
+      remoteAddress + length > _remoteKey->getBaseAddress() + _remoteKey->getSize())
+    throw ucxx::Error("RMA operation exceeds the bounds of the remote memory region");
+
+  _callback     = callbackFunction;
+  _callbackData = callbackData;
+
+  // A delayed notification request is not populated immediately, instead it is
+  // delayed to allow the worker progress thread to set its status, and more
+  // importantly the Python future later on, so that we don't need the GIL here.
+  _worker->registerDelayedSubmission(
+    std::bind(std::mem_fn(&Request::populateDelayedSubmission), this));
+}
+
+void RequestRma::rmaCallback(void* request, ucs_status_t status, void* arg)
+{
+  Request* req = reinterpret_cast<Request*>(arg);
+  ucxx_trace_req_f(req->getOwnerString().c_str(), request, "rma", "rmaCallback");
+  return req->callback(request, status);
+}
+
+void RequestRma::request()
+{
+  ucp_request_param_t param = {.op_attr_mask = UCP_OP_ATTR_FIELD_CALLBACK |
+                                               UCP_OP_ATTR_FIELD_DATATYPE |
+                                               UCP_OP_ATTR_FIELD_USER_DATA,
+                               .datatype  = ucp_dt_make_contig(1),
+                               .user_data = this};
+
+  param.cb.send = rmaCallback;
+  if (_delayedSubmission->_send) {
+    _request = ucp_put_nbx(_endpoint->getHandle(),
+                           _delayedSubmission->_buffer,
+                           _delayedSubmission->_length,
+                           _remoteAddress,
+                           _remoteKey->getHandle(),
+                           &param);
+  } else {
+    _request = ucp_get_nbx(_endpoint->getHandle(),
+                           _delayedSubmission->_buffer,
+                           _delayedSubmission->_length,
+                           _remoteAddress,
+                           _remoteKey->getHandle(),
+                           &param);
+  }
+}
+
+void RequestRma::populateDelayedSubmission()
+{
+  request();
+
+  if (_enablePythonFuture)
+    ucxx_trace_req_f(_ownerString.c_str(),
+                     _request,
+                     _operationName.c_str(),
+                     "remote address 0x%lx, buffer %p, size %lu, future %p, future handle %p, "
+                     "populateDelayedSubmission",
+                     _remoteAddress,
+                     _delayedSubmission->_buffer,
+                     _delayedSubmission->_length,
+                     _future.get(),
+                     _future->getHandle());
+  else
+    ucxx_trace_req_f(_ownerString.c_str(),
+                     _request,
+                     _operationName.c_str(),
+                     "remote address 0x%lx, buffer %p, size %lu, populateDelayedSubmission",
+                     _remoteAddress,
+                     _delayedSubmission->_buffer,
+                     _delayedSubmission->_length);
+
+  process();
+}
+
+}  // namespace ucxx
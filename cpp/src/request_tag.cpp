@@ -5,50 +5,123 @@
 #include <cstdio>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <ucp/api/ucp.h>
 
 #include <ucxx/delayed_submission.h>
+#include <ucxx/endpoint.h>
 #include <ucxx/request_tag.h>
 
 namespace ucxx {
 
+namespace {
+
+size_t getIovLength(const std::vector<ucp_dt_iov_t>& iov)
+{
+  if (iov.empty()) throw ucxx::Error("At least one IOV segment is required");
+
+  size_t length = 0;
+  for (const auto& segment : iov)
+    length += segment.length;
+  return length;
+}
+
+std::string getOperationName(const bool send, const TagSendMode sendMode)
+{
+  if (!send) return "tagRecv";
+  return sendMode == TagSendMode::Sync ? "tagSendSync" : "tagSend";
+}
+
+}  // namespace
+
+std::shared_ptr<RequestTag> createRequestTag(
+  std::shared_ptr<Endpoint> endpoint,
+  bool send,
+  void* buffer,
+  size_t length,
+  ucp_tag_t tag,
+  const bool enablePythonFuture                = false,
+  RequestCallbackUserFunction callbackFunction = nullptr,
+  RequestCallbackUserData callbackData         = nullptr,
+  const TagSendMode sendMode                   = TagSendMode::Standard)
+{
+  return std::shared_ptr<RequestTag>(new RequestTag(endpoint,
+                                                    send,
+                                                    buffer,
+                                                    length,
+                                                    tag,
+                                                    enablePythonFuture,
+                                                    callbackFunction,
+                                                    callbackData,
+                                                    sendMode));
+}
+
 std::shared_ptr<RequestTag> createRequestTag(
-  std::shared_ptr<Component> endpointOrWorker,
+  std::shared_ptr<Worker> worker,
   bool send,
   void* buffer,
   size_t length,
   ucp_tag_t tag,
-  const bool enablePythonFuture                               = false,
-  std::function<void(std::shared_ptr<void>)> callbackFunction = nullptr,
-  std::shared_ptr<void> callbackData                          = nullptr)
+  const bool enablePythonFuture                = false,
+  RequestCallbackUserFunction callbackFunction = nullptr,
+  RequestCallbackUserData callbackData         = nullptr,
+  const TagSendMode sendMode                   = TagSendMode::Standard)
 {
-  return std::shared_ptr<RequestTag>(new RequestTag(endpointOrWorker,
+  return std::shared_ptr<RequestTag>(new RequestTag(worker,
                                                     send,
                                                     buffer,
                                                     length,
                                                     tag,
                                                     enablePythonFuture,
                                                     callbackFunction,
-                                                    callbackData));
+                                                    callbackData,
+                                                    sendMode));
+}
+
+std::shared_ptr<RequestTag> createRequestTag(
+  std::shared_ptr<Worker> worker,
+  ucp_tag_message_h message,
+  void* buffer,
+  size_t length,
+  ucp_tag_t tag,
+  const bool enablePythonFuture                = false,
+  RequestCallbackUserFunction callbackFunction = nullptr,
+  RequestCallbackUserData callbackData         = nullptr)
+{
+  return std::shared_ptr<RequestTag>(new RequestTag(
+    worker, message, buffer, length, tag, enablePythonFuture, callbackFunction, callbackData));
 }
 
-RequestTag::RequestTag(std::shared_ptr<Component> endpointOrWorker,
+std::shared_ptr<RequestTag> createRequestTag(
+  std::shared_ptr<Endpoint> endpoint,
+  std::vector<ucp_dt_iov_t> iov,
+  ucp_tag_t tag,
+  const bool enablePythonFuture                = false,
+  RequestCallbackUserFunction callbackFunction = nullptr,
+  RequestCallbackUserData callbackData         = nullptr)
+{
+  return std::shared_ptr<RequestTag>(new RequestTag(
+    endpoint, std::move(iov), tag, enablePythonFuture, callbackFunction, callbackData));
+}
+
+RequestTag::RequestTag(std::shared_ptr<Endpoint> endpoint,
                        bool send,
                        void* buffer,
                        size_t length,
                        ucp_tag_t tag,
                        const bool enablePythonFuture,
-                       std::function<void(std::shared_ptr<void>)> callbackFunction,
-                       std::shared_ptr<void> callbackData)
-  : Request(endpointOrWorker,
+                       RequestCallbackUserFunction callbackFunction,
+                       RequestCallbackUserData callbackData,
+                       const TagSendMode sendMode)
+  : Request(endpoint,
             std::make_shared<DelayedSubmission>(send, buffer, length, tag),
-            std::string(send ? "tagSend" : "tagRecv"),
+            getOperationName(send, sendMode),
             enablePythonFuture),
-    _length(length)
+    _length(length),
+    _sendMode(sendMode)
 {
-  if (send && _endpoint == nullptr)
-    throw ucxx::Error("An endpoint is required to send tag messages");
   _callback     = callbackFunction;
   _callbackData = callbackData;
 
@@ -59,6 +132,72 @@ RequestTag::RequestTag(std::shared_ptr<Component> endpointOrWorker,
     std::bind(std::mem_fn(&Request::populateDelayedSubmission), this));
 }
 
+RequestTag::RequestTag(std::shared_ptr<Worker> worker,
+                       bool send,
+                       void* buffer,
+                       size_t length,
+                       ucp_tag_t tag,
+                       const bool enablePythonFuture,
+                       RequestCallbackUserFunction callbackFunction,
+                       RequestCallbackUserData callbackData,
+                       const TagSendMode sendMode)
+  : Request(worker,
+            std::make_shared<DelayedSubmission>(send, buffer, length, tag),
+            getOperationName(send, sendMode),
+            enablePythonFuture),
+    _length(length),
+    _sendMode(sendMode)
+{
+  if (send) throw ucxx::Error("An endpoint is required to send tag messages");
+  _callback     = callbackFunction;
+  _callbackData = callbackData;
+
+  _worker->registerDelayedSubmission(
+    std::bind(std::mem_fn(&Request::populateDelayedSubmission), this));
+}
+
+RequestTag::RequestTag(std::shared_ptr<Worker> worker,
+                       ucp_tag_message_h message,
+                       void* buffer,
+                       size_t length,
+                       ucp_tag_t tag,
+                       const bool enablePythonFuture,
+                       RequestCallbackUserFunction callbackFunction,
+                       RequestCallbackUserData callbackData)
+  : Request(worker,
+            std::make_shared<DelayedSubmission>(false, buffer, length, tag),
+            std::string("tagRecv"),
+            enablePythonFuture),
+    _length(length),
+    _message(message)
+{
+  _callback     = callbackFunction;
+  _callbackData = callbackData;
+
+  _worker->registerDelayedSubmission(
+    std::bind(std::mem_fn(&Request::populateDelayedSubmission), this));
+}
+
+RequestTag::RequestTag(std::shared_ptr<Endpoint> endpoint,
+                       std::vector<ucp_dt_iov_t> iov,
+                       ucp_tag_t tag,
+                       const bool enablePythonFuture,
+                       RequestCallbackUserFunction callbackFunction,
+                       RequestCallbackUserData callbackData)
+  : Request(endpoint,
+            std::make_shared<DelayedSubmission>(true, nullptr, getIovLength(iov), tag),
+            std::string("tagSendIov"),
+            enablePythonFuture),
+    _length(_delayedSubmission->_length),
+    _iov(std::move(iov))
+{
+  _callback     = callbackFunction;
+  _callbackData = callbackData;
+
+  _worker->registerDelayedSubmission(
+    std::bind(std::mem_fn(&Request::populateDelayedSubmission), this));
+}
+
 void RequestTag::callback(void* request, ucs_status_t status, const ucp_tag_recv_info_t* info)
 {
   if (status != UCS_ERR_CANCELED && info->length != _length) {
@@ -101,13 +240,29 @@ void RequestTag::request()
                                .datatype  = ucp_dt_make_contig(1),
                                .user_data = this};
 
-  if (_delayedSubmission->_send) {
+  // A synchronous send completes only once matched by the remote end
+  auto tagSend = _sendMode == TagSendMode::Sync ? ucp_tag_send_sync_nbx : ucp_tag_send_nbx;
+
+  if (_delayedSubmission->_send && !_iov.empty()) {
+    param.cb.send  = tagSendCallback;
+    param.datatype = ucp_dt_make_iov();
+    _request       = tagSend(
+      _endpoint->getHandle(), _iov.data(), _iov.size(), _delayedSubmission->_tag, &param);
+  } else if (_delayedSubmission->_send) {
     param.cb.send = tagSendCallback;
-    _request      = ucp_tag_send_nbx(_endpoint->getHandle(),
-                                _delayedSubmission->_buffer,
-                                _delayedSubmission->_length,
-                                _delayedSubmission->_tag,
-                                &param);
+    _request      = tagSend(_endpoint->getHandle(),
+                       _delayedSubmission->_buffer,
+                       _delayedSubmission->_length,
+                       _delayedSubmission->_tag,
+                       &param);
+  } else if (_message != nullptr) {
+    // The probed message was removed from the worker and cannot be matched by other receives
+    param.cb.recv = tagRecvCallback;
+    _request      = ucp_tag_msg_recv_nbx(_worker->getHandle(),
+                                    _delayedSubmission->_buffer,
+                                    _delayedSubmission->_length,
+                                    _message,
+                                    &param);
   } else {
     param.cb.recv = tagRecvCallback;
     _request      = ucp_tag_recv_nbx(_worker->getHandle(),
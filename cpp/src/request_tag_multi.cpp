@@ -2,6 +2,8 @@
  * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
  * SPDX-License-Identifier: BSD-3-Clause
  */
+#include <algorithm>
+#include <cstring>
 #include <functional>
 #include <memory>
 #include <mutex>
@@ -9,6 +11,8 @@
 #include <vector>
 
 #include <ucxx/buffer.h>
+#include <ucxx/codec.h>
+#include <ucxx/dedup.h>
 #include <ucxx/endpoint.h>
 #include <ucxx/header.h>
 #include <ucxx/request.h>
@@ -19,14 +23,29 @@
 
 namespace ucxx {
 
+namespace {
+
+size_t getNumChunks(const size_t size, const size_t chunkSize)
+{
+  return (size + chunkSize - 1) / chunkSize;
+}
+
+}  // namespace
+
 RequestTagMulti::RequestTagMulti(std::shared_ptr<Endpoint> endpoint,
                                  const ucp_tag_t tag,
-                                 const bool enablePythonFuture)
-  : _endpoint(endpoint), _send(false), _tag(tag)
+                                 const bool enablePythonFuture,
+                                 std::function<void()> filledCallback,
+                                 std::function<void()> completedCallback)
+  : _endpoint(endpoint),
+    _send(false),
+    _tag(tag),
+    _filledCallback(filledCallback),
+    _completedCallback(completedCallback)
 {
   ucxx_trace_req("RequestTagMulti::RequestTagMulti [recv]: %p, tag: %lx", this, _tag);
 
-  auto worker = Endpoint::getWorker(endpoint->getParent());
+  auto worker = endpoint->getWorker();
   if (enablePythonFuture) _future = worker->getFuture();
 
   ucxx_debug("RequestTagMulti created: %p", this);
@@ -38,19 +57,21 @@ RequestTagMulti::RequestTagMulti(std::shared_ptr<Endpoint> endpoint,
                                  const std::vector<size_t>& size,
                                  const std::vector<int>& isCUDA,
                                  const ucp_tag_t tag,
-                                 const bool enablePythonFuture)
-  : _endpoint(endpoint), _send(true), _tag(tag)
+                                 const bool enablePythonFuture,
+                                 const CodecParams& codecParams,
+                                 const TagSendMode sendMode)
+  : _endpoint(endpoint), _send(true), _tag(tag), _sendMode(sendMode)
 {
   ucxx_trace_req("RequestTagMulti::RequestTagMulti [send]: %p, tag: %lx", this, _tag);
 
   if (size.size() != buffer.size() || isCUDA.size() != buffer.size())
     throw std::runtime_error("All input vectors should be of equal size");
 
-  auto worker = Endpoint::getWorker(endpoint->getParent());
+  auto worker = endpoint->getWorker();
   if (enablePythonFuture) _future = worker->getFuture();
 
   ucxx_trace("RequestTagMulti created: %p", this);
-  send(buffer, size, isCUDA);
+  send(buffer, size, isCUDA, codecParams);
 }
 
 RequestTagMulti::~RequestTagMulti()
@@ -77,11 +98,13 @@ std::shared_ptr<RequestTagMulti> createRequestTagMultiSend(std::shared_ptr<Endpo
                                                            const std::vector<size_t>& size,
                                                            const std::vector<int>& isCUDA,
                                                            const ucp_tag_t tag,
-                                                           const bool enablePythonFuture)
+                                                           const bool enablePythonFuture,
+                                                           const CodecParams& codecParams,
+                                                           const TagSendMode sendMode)
 {
   ucxx_trace_req("RequestTagMulti::tagMultiSend");
-  return std::shared_ptr<RequestTagMulti>(
-    new RequestTagMulti(endpoint, buffer, size, isCUDA, tag, enablePythonFuture));
+  return std::shared_ptr<RequestTagMulti>(new RequestTagMulti(
+    endpoint, buffer, size, isCUDA, tag, enablePythonFuture, codecParams, sendMode));
 }
 
 std::shared_ptr<RequestTagMulti> createRequestTagMultiRecv(std::shared_ptr<Endpoint> endpoint,
@@ -98,37 +121,70 @@ void RequestTagMulti::recvFrames()
 {
   if (_send) throw std::runtime_error("Send requests cannot call recvFrames()");
 
-  std::vector<Header> headers;
+  // Held until filled, so that `cancel()` never mistakes a frame for a pending header.
+  std::unique_lock<std::recursive_mutex> lock(_bufferRequestsMutex);
+  const auto& headers = _headers;
 
-  ucxx_trace_req("RequestTagMulti::recvFrames request: %p, tag: %lx, _bufferRequests.size(): %lu",
+  ucxx_trace_req("RequestTagMulti::recvFrames request: %p, tag: %lx, headers: %lu",
                  this,
                  _tag,
-                 _bufferRequests.size());
-
-  for (auto& br : _bufferRequests) {
-    ucxx_trace_req(
-      "RequestTagMulti::recvFrames request: %p, tag: %lx, *br->stringBuffer.size(): %lu",
-      this,
-      _tag,
-      br->stringBuffer->size());
-    headers.push_back(Header(*br->stringBuffer));
+                 headers.size());
+
+  // Headers come from the peer, frames are never posted for headers that can't be received.
+  if (!std::all_of(headers.cbegin(), headers.cend(), [](const auto& h) { return h.isValid(); })) {
+    ucxx_debug("RequestTagMulti::recvFrames request: %p, tag: %lx, invalid header", this, _tag);
+    lock.unlock();
+    setCompleted(UCS_ERR_INVALID_PARAM);
+    return;
   }
 
+  // All frame messages must be accounted for before posting, otherwise requests completing
+  // immediately could mark the multi-buffer request completed prematurely.
+  for (auto& h : headers)
+    for (size_t i = 0; i < h.nframes; ++i)
+      _totalFrames += h.codec[i] == static_cast<int>(CodecType::Raw) || h.isCUDA[i]
+                        ? 1
+                        : getNumChunks(h.size[i], h.chunkSize);
+
   for (auto& h : headers) {
-    _totalFrames += h.nframes;
     for (size_t i = 0; i < h.nframes; ++i) {
+      const auto bufferType = h.isCUDA[i] ? ucxx::BufferType::RMM : ucxx::BufferType::Host;
+      auto buf              = allocateBuffer(bufferType, h.size[i]);
+
+      // Deduplicated frames are recorded before posting, all of them must be known by the
+      // time the last request completes.
+      if (h.dedup[i] != static_cast<int>(DedupAction::None))
+        _dedupFrames.push_back(DedupFrame{.action = h.dedup[i], .buffer = buf});
+
+      if (h.codec[i] != static_cast<int>(CodecType::Raw) && !h.isCUDA[i]) {
+        recvEncodedFrame(buf, h.chunkSize);
+        continue;
+      }
+
       auto bufferRequest = std::make_shared<BufferRequest>();
-      _bufferRequests.push_back(bufferRequest);
-      const auto bufferType  = h.isCUDA[i] ? ucxx::BufferType::RMM : ucxx::BufferType::Host;
-      auto buf               = allocateBuffer(bufferType, h.size[i]);
-      bufferRequest->request = _endpoint->tagRecv(
-        buf->data(),
-        buf->getSize(),
-        _tag,
-        false,
-        std::bind(std::mem_fn(&RequestTagMulti::markCompleted), this, std::placeholders::_1),
-        bufferRequest);
+
+      void* data    = buf->data();
+      size_t length = buf->getSize();
+      if (h.dedup[i] == static_cast<int>(DedupAction::Reference)) {
+        bufferRequest->stringBuffer     = std::make_shared<std::string>(sizeof(uint64_t), 0);
+        _dedupFrames.back().fingerprint = bufferRequest->stringBuffer;
+        data                            = &bufferRequest->stringBuffer->front();
+        length                          = bufferRequest->stringBuffer->size();
+      }
+
       bufferRequest->buffer = buf;
+      postRecv(bufferRequest, [&]() {
+        return _endpoint->tagRecv(
+          data,
+          length,
+          _tag,
+          false,
+          std::bind(std::mem_fn(&RequestTagMulti::markCompleted),
+                    this,
+                    std::placeholders::_1,
+                    std::placeholders::_2),
+          bufferRequest);
+      });
       ucxx_trace_req("RequestTagMulti::recvFrames request: %p, tag: %lx, buffer: %p",
                      this,
                      _tag,
@@ -142,48 +198,222 @@ void RequestTagMulti::recvFrames()
                  _tag,
                  _bufferRequests.size(),
                  _isFilled);
+
+  lock.unlock();
+  if (_filledCallback) _filledCallback();
 };
 
-void RequestTagMulti::markCompleted(std::shared_ptr<void> request)
+void RequestTagMulti::recvEncodedFrame(Buffer* buffer, const size_t chunkSize)
 {
-  ucxx_trace_req("RequestTagMulti::markCompleted request: %p, tag: %lx", this, _tag);
-  std::lock_guard<std::mutex> lock(_completedRequestsMutex);
-
-  /* TODO: Move away from std::shared_ptr<void> to avoid casting void* to
-   * BufferRequest*, or remove pointer holding entirely here since it
-   * is not currently used for anything besides counting completed transfers.
-   */
-  _completedRequests.push_back(reinterpret_cast<BufferRequest*>(request.get()));
-
-  if (_completedRequests.size() == _totalFrames) {
-    // TODO: Actually handle errors
-    _status = UCS_OK;
-    if (_future) _future->notify(UCS_OK);
+  const size_t size      = buffer->getSize();
+  const size_t numChunks = getNumChunks(size, chunkSize);
+
+  for (size_t chunk = 0; chunk < numChunks; ++chunk) {
+    const size_t offset = chunk * chunkSize;
+    const size_t length = std::min(chunkSize, size - offset);
+
+    auto bufferRequest          = std::make_shared<BufferRequest>();
+    bufferRequest->stringBuffer = std::make_shared<std::string>(codecMaxEncodedSize(length), 0);
+
+    // The frame is exposed only once, by the request of its last chunk.
+    if (chunk == numChunks - 1) bufferRequest->buffer = buffer;
+
+    postRecv(bufferRequest, [&]() {
+      return _endpoint->tagRecv(
+        &bufferRequest->stringBuffer->front(),
+        bufferRequest->stringBuffer->size(),
+        _tag,
+        false,
+        [this, buffer, offset, length](ucs_status_t status, std::shared_ptr<void> request) {
+          decodeChunk(status, request, buffer, offset, length);
+        },
+        bufferRequest);
+    });
   }
 
-  ucxx_trace_req("RequestTagMulti::markCompleted request: %p, tag: %lx, completed: %lu/%lu",
+  ucxx_trace_req("RequestTagMulti::recvEncodedFrame request: %p, tag: %lx, buffer: %p, chunks: %lu",
                  this,
                  _tag,
-                 _completedRequests.size(),
-                 _totalFrames);
+                 buffer,
+                 numChunks);
 }
 
-void RequestTagMulti::recvHeader()
+void RequestTagMulti::decodeChunk(ucs_status_t status,
+                                  std::shared_ptr<void> request,
+                                  Buffer* buffer,
+                                  const size_t offset,
+                                  const size_t length)
 {
-  if (_send) throw std::runtime_error("Send requests cannot call recvHeader()");
+  auto bufferRequest = reinterpret_cast<BufferRequest*>(request.get());
+
+  if (status == UCS_OK) {
+    try {
+      codecDecode(bufferRequest->stringBuffer->data(),
+                  bufferRequest->stringBuffer->size(),
+                  reinterpret_cast<char*>(buffer->data()) + offset,
+                  length);
+    } catch (const ucxx::Error& e) {
+      ucxx_debug("RequestTagMulti::decodeChunk request: %p, tag: %lx, failed decoding chunk at "
+                 "offset %lu: %s",
+                 this,
+                 _tag,
+                 offset,
+                 e.what());
+      status = UCS_ERR_IO_ERROR;
+    }
+  }
+  bufferRequest->stringBuffer = nullptr;
+
+  markCompleted(status, request);
+}
+
+void RequestTagMulti::markCompleted(ucs_status_t status, std::shared_ptr<void> request)
+{
+  ucxx_trace_req("RequestTagMulti::markCompleted request: %p, tag: %lx, status: %d (%s)",
+                 this,
+                 _tag,
+                 status,
+                 ucs_status_string(status));
+  if (status != UCS_OK) {
+    ucs_status_t expected = UCS_OK;
+    _framesStatus.compare_exchange_strong(expected, status);
+  }
+
+  status = UCS_INPROGRESS;
+  {
+    std::lock_guard<std::mutex> lock(_completedRequestsMutex);
+
+    /* TODO: Move away from std::shared_ptr<void> to avoid casting void* to
+     * BufferRequest*, or remove pointer holding entirely here since it
+     * is not currently used for anything besides counting completed transfers.
+     */
+    _completedRequests.push_back(reinterpret_cast<BufferRequest*>(request.get()));
+
+    if (_completedRequests.size() == _totalFrames) {
+      status = _framesStatus;
+      if (status == UCS_OK && !_dedupFrames.empty()) status = applyDedup();
+    }
+
+    ucxx_trace_req("RequestTagMulti::markCompleted request: %p, tag: %lx, completed: %lu/%lu",
+                   this,
+                   _tag,
+                   _completedRequests.size(),
+                   _totalFrames);
+  }
+
+  // The completion callback may release this request, it must be called last.
+  if (status != UCS_INPROGRESS) setCompleted(status);
+}
+
+void RequestTagMulti::setCompleted(const ucs_status_t status)
+{
+  // The receiver may not have stored the frames of a failed send, resynchronize caches.
+  if (_send && _dedupSent && status != UCS_OK)
+    if (auto dedupCache = _endpoint->getDedupSendCache()) dedupCache->invalidate(_dedupEpoch);
 
-  ucxx_trace_req("RequestTagMulti::recvHeader entering, request: %p, tag: %lx", this, _tag);
+  _status = status;
+  if (_future) _future->notify(_status);
+  if (_completedCallback) _completedCallback();
+}
 
-  auto bufferRequest = std::make_shared<BufferRequest>();
+void RequestTagMulti::postRecv(BufferRequestPtr bufferRequest,
+                               std::function<std::shared_ptr<Request>()> post)
+{
+  std::lock_guard<std::recursive_mutex> lock(_bufferRequestsMutex);
   _bufferRequests.push_back(bufferRequest);
-  bufferRequest->stringBuffer = std::make_shared<std::string>(Header::dataSize(), 0);
-  bufferRequest->request =
-    _endpoint->tagRecv(&bufferRequest->stringBuffer->front(),
-                       bufferRequest->stringBuffer->size(),
-                       _tag,
-                       false,
-                       std::bind(std::mem_fn(&RequestTagMulti::callback), this),
-                       nullptr);
+  bufferRequest->request = post();
+}
+
+void RequestTagMulti::cancel()
+{
+  if (_send) throw std::runtime_error("Send requests cannot call cancel()");
+
+  std::shared_ptr<Request> header{nullptr};
+  {
+    std::lock_guard<std::recursive_mutex> lock(_bufferRequestsMutex);
+    _canceled = true;
+    if (!_isFilled && !_bufferRequests.empty()) header = _bufferRequests.back()->request;
+  }
+
+  ucxx_trace_req("RequestTagMulti::cancel request: %p, tag: %lx, header: %p",
+                 this,
+                 _tag,
+                 header.get());
+  // Canceling a header that already completed is a no-op, its frames complete normally.
+  if (header != nullptr) header->cancel();
+}
+
+ucs_status_t RequestTagMulti::applyDedup()
+{
+  auto dedupCache = _endpoint->getDedupRecvCache();
+
+  // Without deduplication enabled stored frames were received in full, only references fail.
+  if (dedupCache == nullptr) {
+    if (std::none_of(_dedupFrames.begin(), _dedupFrames.end(), [](const auto& frame) {
+          return frame.action == static_cast<int>(DedupAction::Reference);
+        }))
+      return UCS_OK;
+    ucxx_debug("RequestTagMulti::applyDedup request: %p, tag: %lx, deduplication not enabled",
+               this,
+               _tag);
+    return UCS_ERR_NO_ELEM;
+  }
+
+  // All extended headers of a transfer carry the same epoch.
+  uint64_t epoch = 0;
+  for (const auto& header : _headers)
+    if (header.extended) epoch = header.dedupEpoch;
+
+  std::vector<int> action;
+  std::vector<uint64_t> fingerprint;
+  std::vector<size_t> size;
+  std::vector<void*> data;
+  for (const auto& frame : _dedupFrames) {
+    uint64_t frameFingerprint = 0;
+    if (frame.fingerprint != nullptr)
+      std::memcpy(&frameFingerprint, frame.fingerprint->data(), sizeof(frameFingerprint));
+
+    action.push_back(frame.action);
+    fingerprint.push_back(frameFingerprint);
+    size.push_back(frame.buffer->getSize());
+    data.push_back(frame.buffer->data());
+  }
+
+  if (!dedupCache->applyRecv(action, fingerprint, size, data, epoch)) {
+    ucxx_debug("RequestTagMulti::applyDedup request: %p, tag: %lx, failed resolving references",
+               this,
+               _tag);
+    return UCS_ERR_NO_ELEM;
+  }
+  return UCS_OK;
+}
+
+void RequestTagMulti::recvHeader(const bool extension)
+{
+  if (_send) throw std::runtime_error("Send requests cannot call recvHeader()");
+
+  ucxx_trace_req("RequestTagMulti::recvHeader entering, request: %p, tag: %lx, extension: %d",
+                 this,
+                 _tag,
+                 extension);
+
+  auto bufferRequest          = std::make_shared<BufferRequest>();
+  bufferRequest->stringBuffer = std::make_shared<std::string>(
+    extension ? Header::extensionDataSize() : Header::dataSize(), 0);
+  postRecv(bufferRequest, [&]() {
+    return _endpoint->tagRecv(
+      &bufferRequest->stringBuffer->front(),
+      bufferRequest->stringBuffer->size(),
+      _tag,
+      false,
+      extension
+        ? std::bind(std::mem_fn(&RequestTagMulti::extensionCallback), this, std::placeholders::_1)
+        : std::bind(std::mem_fn(&RequestTagMulti::callback), this, std::placeholders::_1),
+      nullptr);
+  });
+
+  // A header posted after `cancel()`, such as the next header of a multi-header transfer
+  if (_canceled) bufferRequest->request->cancel();
 
   if (bufferRequest->request->isCompleted()) {
     // TODO: Errors may not be raisable within callback
@@ -196,7 +426,7 @@ void RequestTagMulti::recvHeader()
                  _bufferRequests.empty());
 }
 
-void RequestTagMulti::callback()
+void RequestTagMulti::callback(ucs_status_t status)
 {
   if (_send) throw std::runtime_error("Send requests cannot call callback()");
 
@@ -206,12 +436,6 @@ void RequestTagMulti::callback()
   if (_bufferRequests.empty()) {
     recvHeader();
   } else {
-    const auto request = _bufferRequests.back();
-
-    // nullptr/NULL and UCS_OK have the same meaning, request completed immediately.
-    const ucs_status_t status =
-      request->request == nullptr ? UCS_OK : request->request->getStatus();
-
     if (status == UCS_OK) {
       ucxx_trace_req(
         "RequestTagMulti::callback header received, multi request: %p, tag: %lx", this, _tag);
@@ -224,51 +448,138 @@ void RequestTagMulti::callback()
         this,
         _tag);
 
-      _status = status;
-      if (_future) _future->notify(status);
-
+      setCompleted(status);
       return;
     }
 
-    auto header = Header(*_bufferRequests.back()->stringBuffer);
+    _headers.push_back(Header(*_bufferRequests.back()->stringBuffer));
 
-    if (header.next)
+    if (_headers.back().extended)
+      recvHeader(true);
+    else if (_headers.back().next)
       recvHeader();
     else
       recvFrames();
   }
 }
 
+void RequestTagMulti::extensionCallback(ucs_status_t status)
+{
+  if (status == UCS_OK &&
+      !_headers.back().deserializeExtension(*_bufferRequests.back()->stringBuffer)) {
+    ucxx_debug(
+      "RequestTagMulti::extensionCallback unsupported header extension, multi request: %p, "
+      "tag: %lx",
+      this,
+      _tag);
+    status = UCS_ERR_INVALID_PARAM;
+  }
+
+  if (status != UCS_OK) {
+    ucxx_trace_req(
+      "RequestTagMulti::extensionCallback failed receiving header extension with status %d "
+      "(%s), multi request: %p, tag: %lx",
+      status,
+      ucs_status_string(status),
+      this,
+      _tag);
+
+    setCompleted(status);
+    return;
+  }
+
+  if (_headers.back().next)
+    recvHeader();
+  else
+    recvFrames();
+}
+
 void RequestTagMulti::send(const std::vector<void*>& buffer,
                            const std::vector<size_t>& size,
-                           const std::vector<int>& isCUDA)
+                           const std::vector<int>& isCUDA,
+                           const CodecParams& codecParams)
 {
-  _totalFrames = buffer.size();
+  const size_t numFrames = buffer.size();
 
-  if ((size.size() != _totalFrames) || (isCUDA.size() != _totalFrames))
+  if ((size.size() != numFrames) || (isCUDA.size() != numFrames))
     throw std::length_error("buffer, size and isCUDA must have the same length");
 
-  auto headers = Header::buildHeaders(size, isCUDA);
+  codecValidateParams(codecParams);
+
+  std::vector<int> dedup(numFrames, static_cast<int>(DedupAction::None));
+  std::vector<uint64_t> fingerprint(numFrames, 0);
+  if (auto dedupCache = _endpoint->getDedupSendCache()) {
+    std::vector<int> eligible(numFrames, 0);
+    for (size_t i = 0; i < numFrames; ++i) {
+      if (!isCUDA[i] && size[i] >= dedupCache->getParams().minFrameSize) {
+        eligible[i]    = 1;
+        fingerprint[i] = dedupFingerprint(buffer[i], size[i]);
+      }
+    }
+    dedup      = dedupCache->planSend(fingerprint, size, eligible, _dedupEpoch);
+    _dedupSent = std::any_of(
+      dedup.begin(), dedup.end(), [](int a) { return a != static_cast<int>(DedupAction::None); });
+  }
 
-  for (const auto& header : headers) {
-    auto serializedHeader = std::make_shared<std::string>(header.serialize());
-    auto r = _endpoint->tagSend(&serializedHeader->front(), serializedHeader->size(), _tag, false);
+  std::vector<int> codec(numFrames, static_cast<int>(CodecType::Raw));
+  _totalFrames = 0;
+  for (size_t i = 0; i < numFrames; ++i) {
+    if (codecParams.codec != CodecType::Raw && !isCUDA[i] && size[i] > 0 &&
+        dedup[i] != static_cast<int>(DedupAction::Reference) &&
+        size[i] >= codecParams.minFrameSize) {
+      codec[i] = static_cast<int>(codecParams.codec);
+      _totalFrames += getNumChunks(size[i], codecParams.chunkSize);
+    } else {
+      ++_totalFrames;
+    }
+  }
 
-    auto bufferRequest          = std::make_shared<BufferRequest>();
-    bufferRequest->request      = r;
-    bufferRequest->stringBuffer = serializedHeader;
-    _bufferRequests.push_back(bufferRequest);
+  auto headers =
+    Header::buildHeaders(size, isCUDA, codec, codecParams.chunkSize, dedup, _dedupEpoch);
+
+  for (const auto& header : headers) {
+    // The extension is sent only by headers of encoded or deduplicated frames
+    std::vector<std::string> serialized{header.serialize()};
+    if (header.extended) serialized.push_back(header.serializeExtension());
+
+    for (auto& data : serialized) {
+      auto bufferRequest          = std::make_shared<BufferRequest>();
+      bufferRequest->stringBuffer = std::make_shared<std::string>(std::move(data));
+      bufferRequest->request      = _endpoint->tagSend(
+        &bufferRequest->stringBuffer->front(), bufferRequest->stringBuffer->size(), _tag, false);
+      _bufferRequests.push_back(bufferRequest);
+    }
   }
 
-  for (size_t i = 0; i < _totalFrames; ++i) {
+  for (size_t i = 0; i < numFrames; ++i) {
+    if (codec[i] != static_cast<int>(CodecType::Raw)) {
+      sendEncodedFrame(buffer[i], size[i], codecParams);
+      continue;
+    }
+
     auto bufferRequest = std::make_shared<BufferRequest>();
-    auto r             = _endpoint->tagSend(
-      buffer[i],
-      size[i],
+
+    // References carry only the fingerprint, the receiver copies the frame from its cache.
+    void* data    = buffer[i];
+    size_t length = size[i];
+    if (dedup[i] == static_cast<int>(DedupAction::Reference)) {
+      bufferRequest->stringBuffer = std::make_shared<std::string>(
+        reinterpret_cast<const char*>(&fingerprint[i]), sizeof(fingerprint[i]));
+      data   = &bufferRequest->stringBuffer->front();
+      length = bufferRequest->stringBuffer->size();
+    }
+
+    auto r = _endpoint->tagSend(
+      data,
+      length,
       _tag,
       false,
-      std::bind(std::mem_fn(&RequestTagMulti::markCompleted), this, std::placeholders::_1),
-      bufferRequest);
+      std::bind(std::mem_fn(&RequestTagMulti::markCompleted),
+                this,
+                std::placeholders::_1,
+                std::placeholders::_2),
+      bufferRequest,
+      _sendMode);
     bufferRequest->request = r;
     _bufferRequests.push_back(bufferRequest);
   }
@@ -278,6 +589,43 @@ void RequestTagMulti::send(const std::vector<void*>& buffer,
     "RequestTagMulti::send request: %p, tag: %lx, isFilled: %d", this, _tag, _isFilled);
 }
 
+void RequestTagMulti::sendEncodedFrame(void* buffer,
+                                       const size_t size,
+                                       const CodecParams& codecParams)
+{
+  const size_t numChunks = getNumChunks(size, codecParams.chunkSize);
+
+  // Each chunk is encoded only after the previous one was posted, allowing encoding to
+  // overlap with the transfer of the previous chunk.
+  for (size_t chunk = 0; chunk < numChunks; ++chunk) {
+    const size_t offset = chunk * codecParams.chunkSize;
+    const size_t length = std::min(codecParams.chunkSize, size - offset);
+
+    auto bufferRequest          = std::make_shared<BufferRequest>();
+    bufferRequest->stringBuffer = std::make_shared<std::string>(
+      codecEncode(codecParams, reinterpret_cast<char*>(buffer) + offset, length));
+    _bufferRequests.push_back(bufferRequest);
+
+    bufferRequest->request = _endpoint->tagSend(
+      &bufferRequest->stringBuffer->front(),
+      bufferRequest->stringBuffer->size(),
+      _tag,
+      false,
+      std::bind(std::mem_fn(&RequestTagMulti::markCompleted),
+                this,
+                std::placeholders::_1,
+                std::placeholders::_2),
+      bufferRequest,
+      _sendMode);
+  }
+
+  ucxx_trace_req("RequestTagMulti::sendEncodedFrame request: %p, tag: %lx, buffer: %p, chunks: %lu",
+                 this,
+                 _tag,
+                 buffer,
+                 numChunks);
+}
+
 ucs_status_t RequestTagMulti::getStatus() { return _status; }
 
 void* RequestTagMulti::getFuture() { return _future ? _future->getHandle() : nullptr; }
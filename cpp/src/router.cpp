@@ -0,0 +1,235 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <ucxx/address.h>
+#include <ucxx/exception.h>
+#include <ucxx/log.h>
+#include <ucxx/router.h>
+
+namespace ucxx {
+
+namespace {
+
+size_t getIndex(const Locality locality) { return static_cast<size_t>(locality); }
+
+const char* getLocalityName(const Locality locality)
+{
+  return locality == Locality::IntraNode ? "intra-node" : "inter-node";
+}
+
+void appendField(std::string& serialized, const std::string& field)
+{
+  const uint64_t size = field.size();
+  serialized.append(reinterpret_cast<const char*>(&size), sizeof(size));
+  serialized.append(field);
+}
+
+}  // namespace
+
+Router::Router(const RouterParams& params)
+  : _params(params), _hostId(params.hostId.empty() ? getLocalHostId() : params.hostId)
+{
+  for (const auto locality : {Locality::IntraNode, Locality::InterNode}) {
+    const auto& config = locality == Locality::IntraNode ? _params.intraNodeConfig
+                                                          : _params.interNodeConfig;
+    auto index         = getIndex(locality);
+    _contexts[index]   = createContext(config, _params.featureFlags);
+    _workers[index]    = _contexts[index]->createWorker(_params.enableDelayedSubmission);
+  }
+
+  ucxx_trace("Router created: %p, host: %s, intra-node worker: %p, inter-node worker: %p",
+             this,
+             _hostId.c_str(),
+             _workers[getIndex(Locality::IntraNode)].get(),
+             _workers[getIndex(Locality::InterNode)].get());
+}
+
+Router::~Router()
+{
+  if (_progressThreads) stopProgressThreads();
+  ucxx_trace("Router destroyed: %p", this);
+}
+
+std::string Router::getLocalHostId()
+{
+  char hostname[256]{};
+  if (gethostname(hostname, sizeof(hostname) - 1) != 0)
+    ucxx_warn("Failed to get hostname, host identifier relies on boot identifier only");
+
+  // The boot identifier tells apart hosts sharing a hostname, such as containers
+  // configured with the same hostname on different hosts.
+  std::string bootId;
+  std::ifstream file("/proc/sys/kernel/random/boot_id");
+  if (file) std::getline(file, bootId);
+
+  return std::string(hostname) + "/" + bootId;
+}
+
+const std::string& Router::getHostId() const { return _hostId; }
+
+std::shared_ptr<Context> Router::getContext(const Locality locality) const
+{
+  return _contexts[getIndex(locality)];
+}
+
+std::shared_ptr<Worker> Router::getWorker(const Locality locality) const
+{
+  return _workers[getIndex(locality)];
+}
+
+std::string Router::getAddress() const
+{
+  // The router address is the host identifier followed by the worker address of each
+  // locality, each preceded by its size as `uint64_t`.
+  std::string serialized;
+  appendField(serialized, _hostId);
+  for (const auto& worker : _workers)
+    appendField(serialized, worker->getAddress()->getString());
+  return serialized;
+}
+
+Router::PeerAddress Router::parseAddress(const std::string& address)
+{
+  auto malformed = []() { throw ucxx::Error("Router address is malformed"); };
+
+  size_t offset  = 0;
+  auto readField = [&address, &offset, &malformed]() {
+    uint64_t size = 0;
+    if (address.size() - offset < sizeof(size)) malformed();
+    std::memcpy(&size, address.data() + offset, sizeof(size));
+    offset += sizeof(size);
+    if (address.size() - offset < size) malformed();
+    auto field = address.substr(offset, size);
+    offset += size;
+    return field;
+  };
+
+  PeerAddress peerAddress;
+  peerAddress.hostId = readField();
+  for (auto& workerAddress : peerAddress.workerAddress)
+    workerAddress = readField();
+  if (offset != address.size()) malformed();
+  return peerAddress;
+}
+
+Locality Router::getLocality(const std::string& peerAddress) const
+{
+  return parseAddress(peerAddress).hostId == _hostId ? Locality::IntraNode
+                                                     : Locality::InterNode;
+}
+
+std::shared_ptr<Endpoint> Router::createEndpoint(const std::string& peerAddress,
+                                                 const bool endpointErrorHandling)
+{
+  auto parsed   = parseAddress(peerAddress);
+  auto locality = parsed.hostId == _hostId ? Locality::IntraNode : Locality::InterNode;
+  auto index    = getIndex(locality);
+
+  auto endpoint = _workers[index]->createEndpointFromWorkerAddress(
+    createAddressFromString(parsed.workerAddress[index]), endpointErrorHandling);
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    ++_endpointCount[index];
+    _endpoints[index].push_back(endpoint);
+  }
+
+  ucxx_debug("Router %p created %s endpoint %p to host %s",
+             this,
+             getLocalityName(locality),
+             endpoint.get(),
+             parsed.hostId.c_str());
+  return endpoint;
+}
+
+bool Router::progress()
+{
+  // Progress both workers even if the first one progressed communication
+  bool progressed = false;
+  for (auto& worker : _workers)
+    progressed |= worker->progress();
+  return progressed;
+}
+
+void Router::startProgressThreads(const bool pollingMode)
+{
+  for (auto& worker : _workers)
+    worker->startProgressThread(pollingMode);
+  _progressThreads = true;
+}
+
+void Router::stopProgressThreads()
+{
+  for (auto& worker : _workers)
+    worker->stopProgressThread();
+  _progressThreads = false;
+}
+
+RouterStats Router::getStats()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  std::array<RouterLocalityStats, 2> stats{};
+  for (size_t index = 0; index < stats.size(); ++index) {
+    auto& endpoints = _endpoints[index];
+    // Forget endpoints released by the application, so that tracking doesn't grow
+    // unbounded with short-lived connections.
+    endpoints.erase(std::remove_if(endpoints.begin(),
+                                   endpoints.end(),
+                                   [](const auto& endpoint) { return endpoint.expired(); }),
+                    endpoints.end());
+
+    stats[index].endpoints = _endpointCount[index];
+    for (const auto& endpoint : endpoints)
+      if (auto e = endpoint.lock(); e && e->isAlive()) ++stats[index].aliveEndpoints;
+  }
+
+  return RouterStats{.intraNode = stats[getIndex(Locality::IntraNode)],
+                     .interNode = stats[getIndex(Locality::InterNode)]};
+}
+
+std::vector<std::shared_ptr<Endpoint>> bootstrapRouterEndpoints(
+  Router& router,
+  BootstrapBackend& backend,
+  const size_t rank,
+  const size_t worldSize,
+  const std::chrono::milliseconds timeout,
+  const bool endpointErrorHandling)
+{
+  if (rank >= worldSize)
+    throw ucxx::Error("Bootstrap rank " + std::to_string(rank) + " out of range for " +
+                      std::to_string(worldSize) + " ranks");
+
+  backend.publish(rank, router.getAddress());
+  auto addresses = backend.fetchAll(worldSize, timeout);
+
+  std::vector<std::shared_ptr<Endpoint>> endpoints(worldSize);
+  for (size_t peer = 0; peer < worldSize; ++peer) {
+    if (peer == rank) continue;
+    endpoints[peer] = router.createEndpoint(addresses[peer], endpointErrorHandling);
+  }
+
+  auto stats = router.getStats();
+  ucxx_debug("Bootstrap rank %lu connected to %lu intra-node and %lu inter-node ranks",
+             rank,
+             stats.intraNode.endpoints,
+             stats.interNode.endpoints);
+
+  return endpoints;
+}
+
+}  // namespace ucxx
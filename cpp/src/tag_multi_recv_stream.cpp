@@ -0,0 +1,194 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <ucp/api/ucp.h>
+
+#include <ucxx/exception.h>
+#include <ucxx/log.h>
+#include <ucxx/tag_multi_recv_stream.h>
+#include <ucxx/worker.h>
+
+namespace ucxx {
+
+TagMultiRecvStream::TagMultiRecvStream(std::shared_ptr<Endpoint> endpoint,
+                                       const ucp_tag_t tag,
+                                       TagMultiRecvStreamCallback callback)
+  : _tag(tag), _callback(callback)
+{
+  if (endpoint == nullptr || endpoint->getHandle() == nullptr)
+    throw ucxx::Error("Endpoint not initialized");
+
+  setParent(endpoint);
+  ucxx_trace("TagMultiRecvStream created: %p, endpoint: %p, tag: %lx", this, endpoint.get(), _tag);
+}
+
+std::shared_ptr<TagMultiRecvStream> createTagMultiRecvStream(std::shared_ptr<Endpoint> endpoint,
+                                                             const ucp_tag_t tag,
+                                                             TagMultiRecvStreamCallback callback)
+{
+  auto stream =
+    std::shared_ptr<TagMultiRecvStream>(new TagMultiRecvStream(endpoint, tag, callback));
+  // Requests hold a weak reference to the stream, which is only available after construction
+  stream->arm();
+  return stream;
+}
+
+TagMultiRecvStream::~TagMultiRecvStream()
+{
+  close();
+  ucxx_trace("TagMultiRecvStream destroyed: %p, received %lu messages", this, _received);
+}
+
+std::shared_ptr<Endpoint> TagMultiRecvStream::getEndpoint() const
+{
+  return std::static_pointer_cast<Endpoint>(_parent);
+}
+
+ucp_tag_t TagMultiRecvStream::getTag() const { return _tag; }
+
+void TagMultiRecvStream::arm()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    ++_pendingArms;
+    if (_arming) return;
+    _arming = true;
+  }
+
+  auto stream    = weak_from_this();
+  auto filled    = [stream]() {
+    if (auto s = stream.lock()) std::static_pointer_cast<TagMultiRecvStream>(s)->arm();
+  };
+  auto completed = [stream]() {
+    if (auto s = stream.lock()) std::static_pointer_cast<TagMultiRecvStream>(s)->deliver();
+  };
+
+  auto endpoint = getEndpoint();
+  while (true) {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      if (_pendingArms == 0 || _closed) {
+        _pendingArms = 0;
+        _arming      = false;
+        return;
+      }
+      --_pendingArms;
+    }
+
+    // The header may be matched immediately, in which case `filled` and `completed` run
+    // before the request is registered, and are handled by this loop and `deliver()`.
+    auto request = std::shared_ptr<RequestTagMulti>(
+      new RequestTagMulti(endpoint, _tag, false, filled, completed));
+
+    bool cancel = false;
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _posted.push_back(request);
+      // Closed after the check above, `close()` did not see the request.
+      cancel = _closed;
+    }
+    if (cancel) request->cancel();
+
+    deliver();
+  }
+}
+
+void TagMultiRecvStream::deliver()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_delivering) return;
+    _delivering = true;
+  }
+
+  // Notified once outside the lock, waking a consumer waiting on `getFuture()`.
+  std::shared_ptr<Future> future{nullptr};
+  while (true) {
+    std::vector<std::shared_ptr<RequestTagMulti>> ready;
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      while (!_posted.empty() && _posted.front()->isCompleted()) {
+        auto request = std::move(_posted.front());
+        _posted.pop_front();
+        if (_closed && request->getStatus() == UCS_ERR_CANCELED) continue;
+        ++_received;
+        if (_callback)
+          ready.push_back(std::move(request));
+        else
+          _queue.push_back(std::move(request));
+      }
+      if (!_queue.empty()) future = std::move(_future);
+      // A delivery skipped by another thread while this one was delivering is picked up
+      // by checking again under the lock before giving up delivery.
+      if (ready.empty()) {
+        _delivering = false;
+        break;
+      }
+    }
+
+    for (auto& request : ready)
+      _callback(request);
+  }
+
+  if (future) future->notify(UCS_OK);
+}
+
+std::shared_ptr<RequestTagMulti> TagMultiRecvStream::pop()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (_queue.empty()) return nullptr;
+  auto request = std::move(_queue.front());
+  _queue.pop_front();
+  return request;
+}
+
+size_t TagMultiRecvStream::getQueuedCount()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _queue.size();
+}
+
+void* TagMultiRecvStream::getFuture()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (!_queue.empty() || _closed) return nullptr;
+  if (_future == nullptr) _future = getEndpoint()->getWorker()->getFuture();
+  return _future->getHandle();
+}
+
+size_t TagMultiRecvStream::getReceivedCount()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _received;
+}
+
+bool TagMultiRecvStream::isClosed() const { return _closed; }
+
+void TagMultiRecvStream::close()
+{
+  std::vector<std::shared_ptr<RequestTagMulti>> posted;
+  std::shared_ptr<Future> future{nullptr};
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_closed.exchange(true)) return;
+    posted.assign(_posted.begin(), _posted.end());
+    future = std::move(_future);
+  }
+  if (future) future->notify(UCS_OK);
+
+  // Cancel outside the lock, cancelation may execute completion callbacks immediately.
+  // Only the last message may still be waiting for its header, others are left to complete.
+  for (auto& request : posted)
+    request->cancel();
+
+  ucxx_debug(
+    "TagMultiRecvStream %p closed, tag: %lx, received %lu messages", this, _tag, _received);
+}
+
+}  // namespace ucxx
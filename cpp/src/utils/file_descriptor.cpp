@@ -3,7 +3,9 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 #include <cstdio>
+#include <cstdlib>
 #include <exception>
+#include <functional>
 #include <ios>
 #include <string>
 
@@ -40,6 +42,24 @@ std::string decodeTextFileDescriptor(FILE* textFileDescriptor)
   return textString;
 }
 
+std::string captureTextFileDescriptor(std::function<void(FILE*)> print)
+{
+  char* buffer = nullptr;
+  size_t size  = 0;
+
+  FILE* textFileDescriptor = open_memstream(&buffer, &size);
+  if (textFileDescriptor == nullptr) throw std::ios_base::failure("open_memstream() failed");
+
+  print(textFileDescriptor);
+
+  // Closing the stream flushes it, only then `buffer` and `size` are valid.
+  fclose(textFileDescriptor);
+  std::string textString(buffer, size);
+  free(buffer);
+
+  return textString;
+}
+
 }  // namespace utils
 
 }  // namespace ucxx
@@ -2,12 +2,22 @@
  * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
  * SPDX-License-Identifier: BSD-3-Clause
  */
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
 #include <functional>
+#include <future>
 #include <ios>
+#include <map>
 #include <memory>
 #include <mutex>
+#include <new>
 #include <queue>
+#include <set>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -15,6 +25,7 @@
 #include <sys/eventfd.h>
 #include <unistd.h>
 
+#include <ucxx/exception.h>
 #include <ucxx/request_tag.h>
 #include <ucxx/utils/file_descriptor.h>
 #include <ucxx/utils/ucx.h>
@@ -22,6 +33,15 @@
 
 namespace ucxx {
 
+namespace {
+
+bool submittedEarlier(const InflightRequestInfo& a, const InflightRequestInfo& b)
+{
+  return a.submitTime < b.submitTime;
+}
+
+}  // namespace
+
 Worker::Worker(std::shared_ptr<Context> context, const bool enableDelayedSubmission)
 {
   ucp_worker_params_t params{};
@@ -33,6 +53,8 @@ Worker::Worker(std::shared_ptr<Context> context, const bool enableDelayedSubmiss
   params.thread_mode = UCS_THREAD_MODE_MULTI;
   utils::ucsErrorThrow(ucp_worker_create(context->getHandle(), &params, &_handle));
 
+  _enableWakeup = context->getFeatureFlags() & UCP_FEATURE_WAKEUP;
+
   if (enableDelayedSubmission)
     _delayedSubmissionCollection = std::make_shared<DelayedSubmissionCollection>();
 
@@ -44,43 +66,105 @@ Worker::Worker(std::shared_ptr<Context> context, const bool enableDelayedSubmiss
   setParent(std::dynamic_pointer_cast<Component>(context));
 }
 
-static void _drainCallback(void* request,
-                           ucs_status_t status,
-                           const ucp_tag_recv_info_t* info,
-                           void* arg)
+WorkerDrainReport Worker::drainWorkerTagRecv()
 {
-  *reinterpret_cast<ucs_status_t*>(request) = status;
-}
+  WorkerDrainReport report{};
 
-void Worker::drainWorkerTagRecv()
-{
   auto context = std::dynamic_pointer_cast<Context>(_parent);
-  if (!(context->getFeatureFlags() & UCP_FEATURE_TAG)) return;
-
-  ucp_tag_message_h message;
-  ucp_tag_recv_info_t info;
-
-  while ((message = ucp_tag_probe_nb(_handle, 0, 0, 1, &info)) != NULL) {
-    ucxx_debug("Draining tag receive messages, worker: %p, tag: 0x%lx, length: %lu",
-               _handle,
-               info.sender_tag,
-               info.length);
-
-    std::vector<char> buf(info.length);
-
-    ucp_request_param_t param = {
-      .op_attr_mask = UCP_OP_ATTR_FIELD_CALLBACK | UCP_OP_ATTR_FIELD_DATATYPE,
-      .cb           = {.recv = _drainCallback},
-      .datatype     = ucp_dt_make_contig(1)};
+  if (!(context->getFeatureFlags() & UCP_FEATURE_TAG)) return report;
+
+  // Receives canceled by previous calls may still write to their scratch buffer until
+  // they complete, release those that completed since.
+  _drainCanceled.erase(std::remove_if(_drainCanceled.begin(),
+                                      _drainCanceled.end(),
+                                      [](const auto& canceled) {
+                                        if (ucp_request_check_status(canceled.first) ==
+                                            UCS_INPROGRESS)
+                                          return false;
+                                        ucp_request_free(canceled.first);
+                                        return true;
+                                      }),
+                       _drainCanceled.end());
+
+  const auto start         = std::chrono::steady_clock::now();
+  const auto deadline      = start + _teardownParams.drainTimeout;
+  const size_t maxInflight = std::max(_teardownParams.maxInflightReceives, size_t{1});
+  auto buffer              = std::make_shared<std::vector<char>>();
+
+  // Requests are checked for completion instead of relying on a callback, as requests
+  // canceled at the deadline may only complete after this method has returned.
+  ucp_request_param_t param = {.op_attr_mask = UCP_OP_ATTR_FIELD_DATATYPE,
+                               .datatype     = ucp_dt_make_contig(1)};
+
+  std::vector<std::pair<ucp_tag_message_h, ucp_tag_recv_info_t>> messages;
+  std::vector<void*> pending;
+  while (!report.timedOut) {
+    // Messages received immediately leave no receive pending, the deadline must also bound
+    // the number of batches in case peers keep sending.
+    if (std::chrono::steady_clock::now() > deadline) {
+      report.timedOut = true;
+      break;
+    }
 
-    ucs_status_ptr_t status =
-      ucp_tag_msg_recv_nbx(_handle, buf.data(), info.length, message, &param);
+    // Probe a batch of messages before posting any receives, so that the scratch buffer is
+    // only resized while no receives are inflight. The contents of drained messages are
+    // discarded, thus all receives of a batch share the same scratch buffer.
+    messages.clear();
+    ucp_tag_message_h message;
+    ucp_tag_recv_info_t info;
+    while (messages.size() < maxInflight &&
+           (message = ucp_tag_probe_nb(_handle, 0, 0, 1, &info)) != NULL)
+      messages.emplace_back(message, info);
+    if (messages.empty()) break;
+
+    size_t maxLength = 0;
+    for (const auto& m : messages)
+      maxLength = std::max(maxLength, m.second.length);
+    if (buffer->size() < maxLength) buffer->resize(maxLength);
+
+    for (const auto& m : messages) {
+      ucxx_trace("Draining tag receive messages, worker: %p, tag: 0x%lx, length: %lu",
+                 _handle,
+                 m.second.sender_tag,
+                 m.second.length);
+
+      ucs_status_ptr_t status =
+        ucp_tag_msg_recv_nbx(_handle, buffer->data(), m.second.length, m.first, &param);
+      if (UCS_PTR_IS_PTR(status)) pending.push_back(status);
+
+      ++report.messages;
+      report.bytes += m.second.length;
+    }
 
-    if (status != nullptr) {
-      while (UCS_PTR_STATUS(status) == UCS_INPROGRESS)
-        progress();
+    while (!pending.empty()) {
+      if (std::chrono::steady_clock::now() > deadline) {
+        report.timedOut = true;
+        break;
+      }
+
+      ucp_worker_progress(_handle);
+      pending.erase(std::remove_if(pending.begin(),
+                                   pending.end(),
+                                   [](void* request) {
+                                     if (ucp_request_check_status(request) == UCS_INPROGRESS)
+                                       return false;
+                                     ucp_request_free(request);
+                                     return true;
+                                   }),
+                    pending.end());
     }
   }
+
+  // Canceled requests are only freed once completed, keeping the scratch buffer they may
+  // still write to alive until then.
+  for (auto request : pending) {
+    ucp_request_cancel(_handle, request);
+    _drainCanceled.emplace_back(request, buffer);
+  }
+  report.canceled = pending.size();
+
+  report.elapsed = std::chrono::steady_clock::now() - start;
+  return report;
 }
 
 std::shared_ptr<Worker> createWorker(std::shared_ptr<Context> context,
@@ -91,13 +175,38 @@ std::shared_ptr<Worker> createWorker(std::shared_ptr<Context> context,
 
 Worker::~Worker()
 {
+  stopInflightRequestsWatchdog();
+
   size_t canceled = cancelInflightRequests();
   ucxx_debug("Worker %p canceled %lu requests", _handle, canceled);
 
   stopProgressThreadNoWarn();
   if (_notifier) _notifier->stopRequestNotifierThread();
 
-  drainWorkerTagRecv();
+  WorkerDrainReport report{};
+  if (_teardownParams.drainTagRecv)
+    report = drainWorkerTagRecv();
+  else
+    report.skipped = true;
+  ucxx_debug("Worker %p drained %lu unexpected tag messages (%lu bytes, %lu canceled) in %ld ns",
+             _handle,
+             report.messages,
+             report.bytes,
+             report.canceled,
+             static_cast<int64_t>(report.elapsed.count()));
+  if (report.timedOut)
+    ucxx_warn("Worker %p timed out draining unexpected tag messages, %lu receives canceled",
+              _handle,
+              report.canceled);
+  if (_teardownParams.reportCallback) _teardownParams.reportCallback(report);
+
+  // Drop the io_uring polling the worker file descriptor before it is closed
+  _ioUring = nullptr;
+
+  // Canceled drain receives are released by UCX when the worker is destroyed, their scratch
+  // buffers are only released with the members of the worker, after that.
+  for (auto& canceled : _drainCanceled)
+    ucp_request_free(canceled.first);
 
   ucp_worker_destroy(_handle);
   ucxx_trace("Worker destroyed: %p", _handle);
@@ -107,6 +216,8 @@ Worker::~Worker()
 
 ucp_worker_h Worker::getHandle() { return _handle; }
 
+void Worker::setTeardownParams(const WorkerTeardownParams& params) { _teardownParams = params; }
+
 std::string Worker::getInfo()
 {
   FILE* TextFileDescriptor = utils::createTextFileDescriptor();
@@ -116,7 +227,29 @@ std::string Worker::getInfo()
 
 bool Worker::isFutureEnabled() const { return _enableFuture; }
 
-void Worker::initBlockingProgressMode()
+bool Worker::isDelayedSubmissionEnabled() const { return _delayedSubmissionCollection != nullptr; }
+
+void Worker::setDelayedSubmissionPolicy(const DelayedSubmissionPolicy policy)
+{
+  if (_delayedSubmissionCollection == nullptr) throw ucxx::Error("Delayed submission disabled");
+  _delayedSubmissionCollection->setPolicy(policy);
+}
+
+DelayedSubmissionPolicy Worker::getDelayedSubmissionPolicy() const
+{
+  if (_delayedSubmissionCollection == nullptr) throw ucxx::Error("Delayed submission disabled");
+  return _delayedSubmissionCollection->getPolicy();
+}
+
+DelayedSubmissionStats Worker::getDelayedSubmissionStats() const
+{
+  if (_delayedSubmissionCollection == nullptr) return DelayedSubmissionStats{};
+  return _delayedSubmissionCollection->getStats();
+}
+
+bool Worker::isDirectSubmissionAllowed() { return true; }
+
+void Worker::initBlockingProgressMode(const ProgressBackend backend)
 {
   // In blocking progress mode, we create an epoll file
   // descriptor that we can wait on later.
@@ -125,42 +258,79 @@ void Worker::initBlockingProgressMode()
   int err;
 
   // Return if blocking progress mode was already initialized
-  if (_epollFileDescriptor >= 0) return;
+  if (_workerFileDescriptor >= 0) return;
+
+  if (!_enableWakeup)
+    throw ucxx::Error("Blocking progress mode requires a context with UCP_FEATURE_WAKEUP");
+
+  // Create the io_uring before querying the worker file descriptor, so that a failure
+  // leaves blocking progress mode uninitialized.
+  if (backend == ProgressBackend::IoUring) {
+    if (IoUring::isAvailable())
+      _ioUring = std::make_unique<IoUring>();
+    else
+      ucxx_warn("io_uring not available, blocking progress mode will use epoll");
+  }
 
-  utils::ucsErrorThrow(ucp_worker_get_efd(_handle, &_workerFileDescriptor));
+  try {
+    utils::ucsErrorThrow(ucp_worker_get_efd(_handle, &_workerFileDescriptor));
 
-  arm();
+    arm();
 
-  _epollFileDescriptor = epoll_create(1);
-  if (_epollFileDescriptor == -1) throw std::ios_base::failure("epoll_create(1) returned -1");
+    // The io_uring polls the worker file descriptor itself, ucp_worker_signal() wakes it
+    // up as well, thus no epoll file descriptor is needed.
+    if (_ioUring) return;
 
-  epoll_event workerEvent = {.events = EPOLLIN,
-                             .data   = {
-                               .fd = _workerFileDescriptor,
-                             }};
+    _epollFileDescriptor = epoll_create(1);
+    if (_epollFileDescriptor == -1) throw std::ios_base::failure("epoll_create(1) returned -1");
 
-  err = epoll_ctl(_epollFileDescriptor, EPOLL_CTL_ADD, _workerFileDescriptor, &workerEvent);
-  if (err != 0) throw std::ios_base::failure(std::string("epoll_ctl() returned " + err));
+    epoll_event workerEvent = {.events = EPOLLIN,
+                               .data   = {
+                                 .fd = _workerFileDescriptor,
+                               }};
+
+    err = epoll_ctl(_epollFileDescriptor, EPOLL_CTL_ADD, _workerFileDescriptor, &workerEvent);
+    if (err != 0) throw std::ios_base::failure(std::string("epoll_ctl() returned " + err));
+  } catch (...) {
+    // Leave blocking progress mode uninitialized, so that it may be initialized again.
+    if (_epollFileDescriptor >= 0) close(_epollFileDescriptor);
+    _epollFileDescriptor  = -1;
+    _workerFileDescriptor = -1;
+    _ioUring              = nullptr;
+    throw;
+  }
 }
 
 bool Worker::arm()
 {
-  ucs_status_t status = ucp_worker_arm(_handle);
+  ucs_status_t status = arm(std::nothrow);
   if (status == UCS_ERR_BUSY) return false;
   utils::ucsErrorThrow(status);
   return true;
 }
 
+ucs_status_t Worker::arm(std::nothrow_t) noexcept { return ucp_worker_arm(_handle); }
+
 bool Worker::progressWorkerEvent(const int epollTimeout)
 {
   int ret;
   epoll_event ev;
 
-  cancelInflightRequests();
+  {
+    // Release the worker before waiting, so that submissions are not held by an idle wait.
+    DelayedSubmissionCollection::WorkerLock workerLock(_delayedSubmissionCollection.get());
 
-  if (progress()) return true;
+    cancelInflightRequests();
 
-  if ((_epollFileDescriptor == -1) || !arm()) return false;
+    if (progress()) return true;
+
+    if ((_workerFileDescriptor == -1) || !arm()) return false;
+  }
+
+  if (_ioUring) {
+    _ioUring->wait(_workerFileDescriptor, epollTimeout);
+    return false;
+  }
 
   do {
     ret = epoll_wait(_epollFileDescriptor, &ev, 1, epollTimeout);
@@ -169,15 +339,34 @@ bool Worker::progressWorkerEvent(const int epollTimeout)
   return false;
 }
 
-void Worker::signal() { utils::ucsErrorThrow(ucp_worker_signal(_handle)); }
+ProgressBackend Worker::getProgressBackend() const
+{
+  return _ioUring ? ProgressBackend::IoUring : ProgressBackend::Epoll;
+}
+
+void Worker::signal() { utils::ucsErrorThrow(signal(std::nothrow)); }
 
-bool Worker::waitProgress()
+ucs_status_t Worker::signal(std::nothrow_t) noexcept { return ucp_worker_signal(_handle); }
+
+bool Worker::waitProgress() { return waitProgress(std::nothrow).getValue(); }
+
+Expected<bool> Worker::waitProgress(std::nothrow_t) noexcept
 {
-  utils::ucsErrorThrow(ucp_worker_wait(_handle));
-  return progress();
+  ucs_status_t status = ucp_worker_wait(_handle);
+  if (status != UCS_OK) return status;
+
+  try {
+    return progress();
+  } catch (...) {
+    return Expected<bool>::fromCurrentException();
+  }
 }
 
-bool Worker::progressOnce() { return ucp_worker_progress(_handle) != 0; }
+bool Worker::progressOnce()
+{
+  DelayedSubmissionCollection::WorkerLock workerLock(_delayedSubmissionCollection.get());
+  return ucp_worker_progress(_handle) != 0;
+}
 
 bool Worker::progressPending()
 {
@@ -191,6 +380,8 @@ bool Worker::progressPending()
 
 bool Worker::progress()
 {
+  DelayedSubmissionCollection::WorkerLock workerLock(_delayedSubmissionCollection.get());
+
   bool ret = progressPending();
 
   // Before canceling requests scheduled for cancelation, attempt to let them complete.
@@ -206,15 +397,21 @@ void Worker::registerDelayedSubmission(DelayedSubmissionCallbackType callback)
 {
   if (_delayedSubmissionCollection == nullptr) {
     callback();
-  } else {
-    _delayedSubmissionCollection->registerRequest(callback);
-
-    /* Waking the progress event is needed here because the UCX request is
-     * not dispatched immediately. Thus we must signal the progress task so
-     * it will ensure the request is dispatched.
-     */
-    signal();
+    return;
   }
+
+  if (_delayedSubmissionCollection->getPolicy() == DelayedSubmissionPolicy::Adaptive &&
+      isDirectSubmissionAllowed() && _delayedSubmissionCollection->trySubmit(callback))
+    return;
+
+  _delayedSubmissionCollection->registerRequest(callback);
+
+  /* Waking the progress event is needed here because the UCX request is
+   * not dispatched immediately. Thus we must signal the progress task so
+   * it will ensure the request is dispatched. Without wakeup support the
+   * progress task is always polling and there is nothing to wake.
+   */
+  if (_enableWakeup) signal();
 }
 
 #define THROW_FUTURE_NOT_IMPLEMENTED()                                                      \
@@ -244,25 +441,32 @@ void Worker::setProgressThreadStartCallback(std::function<void(void*)> callback,
   _progressThreadStartCallbackArg = callbackArg;
 }
 
-void Worker::startProgressThread(const bool pollingMode, const int epollTimeout)
+void Worker::startProgressThread(const bool pollingMode,
+                                 const int epollTimeout,
+                                 const ProgressBackend backend)
 {
   if (_progressThread) {
     ucxx_warn("Worker progress thread already running");
     return;
   }
 
+  // Without wakeup support the worker can only be progressed in polling mode
+  const bool usePollingMode = pollingMode || !_enableWakeup;
+  if (usePollingMode != pollingMode)
+    ucxx_warn("Context created without UCP_FEATURE_WAKEUP, progress thread will use polling");
+
   std::function<bool()> progressFunction;
   std::function<void()> signalWorkerFunction;
-  if (pollingMode) {
+  if (usePollingMode) {
     progressFunction     = [this]() { return this->progress(); };
     signalWorkerFunction = []() {};
   } else {
-    initBlockingProgressMode();
+    initBlockingProgressMode(backend);
     progressFunction = [this, epollTimeout]() { return this->progressWorkerEvent(epollTimeout); };
     signalWorkerFunction = [this]() { return this->signal(); };
   }
 
-  _progressThread = std::make_shared<WorkerProgressThread>(pollingMode,
+  _progressThread = std::make_shared<WorkerProgressThread>(usePollingMode,
                                                            progressFunction,
                                                            signalWorkerFunction,
                                                            _progressThreadStartCallback,
@@ -280,6 +484,32 @@ void Worker::stopProgressThread()
     stopProgressThreadNoWarn();
 }
 
+void Worker::submitFileRead(
+  int fd, void* buffer, const size_t length, const off_t offset, FileIOCallback callback)
+{
+  // Submitted by the next wait of the thread progressing the worker, together with all
+  // operations prepared meanwhile, only the first operation of a batch wakes it up.
+  if (_ioUring) {
+    if (_ioUring->prepareRead(fd, buffer, length, offset, std::move(callback)) == 1) signal();
+    return;
+  }
+
+  ssize_t result = pread(fd, buffer, length, offset);
+  if (callback) callback(result < 0 ? -errno : result);
+}
+
+void Worker::submitFileWrite(
+  int fd, const void* buffer, const size_t length, const off_t offset, FileIOCallback callback)
+{
+  if (_ioUring) {
+    if (_ioUring->prepareWrite(fd, buffer, length, offset, std::move(callback)) == 1) signal();
+    return;
+  }
+
+  ssize_t result = pwrite(fd, buffer, length, offset);
+  if (callback) callback(result < 0 ? -errno : result);
+}
+
 size_t Worker::cancelInflightRequests()
 {
   auto inflightRequestsToCancel = std::make_shared<InflightRequests>();
@@ -315,6 +545,159 @@ void Worker::removeInflightRequest(const Request* const request)
   }
 }
 
+void Worker::registerEndpointInflightRequests(std::shared_ptr<InflightRequests> inflightRequests)
+{
+  std::lock_guard<std::mutex> lock(_endpointInflightRequestsMutex);
+
+  // Prune references to destroyed endpoints each time the container doubles in size, so that
+  // registering endpoints remains amortized constant time.
+  if (_endpointInflightRequests.size() >= _endpointInflightRequestsPruneSize) {
+    _endpointInflightRequests.erase(
+      std::remove_if(_endpointInflightRequests.begin(),
+                     _endpointInflightRequests.end(),
+                     [](const auto& inflightRequests) { return inflightRequests.expired(); }),
+      _endpointInflightRequests.end());
+    _endpointInflightRequestsPruneSize =
+      std::max(_endpointInflightRequestsPruneSize, 2 * _endpointInflightRequests.size());
+  }
+  _endpointInflightRequests.push_back(inflightRequests);
+}
+
+std::vector<InflightRequestInfo> Worker::collectInflightRequestsInfo(
+  const std::chrono::milliseconds minAge)
+{
+  std::vector<std::shared_ptr<InflightRequests>> sources;
+  {
+    std::lock_guard<std::mutex> lock(_inflightRequestsMutex);
+    sources.push_back(_inflightRequests);
+  }
+  {
+    std::lock_guard<std::mutex> lock(_endpointInflightRequestsMutex);
+    for (const auto& weak : _endpointInflightRequests)
+      if (auto inflightRequests = weak.lock()) sources.push_back(inflightRequests);
+  }
+
+  const auto submittedBefore = std::chrono::steady_clock::now() - minAge;
+  std::vector<InflightRequestInfo> info;
+  for (const auto& inflightRequests : sources)
+    for (auto& request : inflightRequests->getInfo())
+      if (request.submitTime <= submittedBefore) info.push_back(std::move(request));
+  return info;
+}
+
+std::vector<InflightRequestInfo> Worker::getInflightRequestsInfo(
+  const size_t maxRequests, const std::chrono::milliseconds minAge)
+{
+  auto info        = collectInflightRequestsInfo(minAge);
+  const size_t size = maxRequests > 0 ? std::min(maxRequests, info.size()) : info.size();
+  std::partial_sort(info.begin(), info.begin() + size, info.end(), submittedEarlier);
+  info.resize(size);
+  return info;
+}
+
+std::string Worker::formatInflightRequestsReport(std::vector<InflightRequestInfo> info,
+                                                 const size_t maxRequests,
+                                                 const std::chrono::milliseconds minAge)
+{
+  struct Group {
+    size_t requests{0};
+    size_t length{0};
+    std::chrono::steady_clock::time_point oldest{std::chrono::steady_clock::time_point::max()};
+    std::set<std::string> operations{};
+  };
+
+  const size_t total = info.size();
+  const size_t size  = maxRequests > 0 ? std::min(maxRequests, total) : total;
+  std::partial_sort(info.begin(), info.begin() + size, info.end(), submittedEarlier);
+
+  std::map<std::pair<std::string, ucp_tag_t>, Group> groups;
+  for (size_t i = 0; i < size; ++i) {
+    auto& group = groups[{info[i].ownerString, info[i].tag}];
+    ++group.requests;
+    group.length += info[i].length;
+    group.oldest = std::min(group.oldest, info[i].submitTime);
+    group.operations.insert(info[i].operationName);
+  }
+
+  // Report groups from the one waiting the longest
+  std::vector<std::pair<std::pair<std::string, ucp_tag_t>, Group>> sorted(groups.begin(),
+                                                                          groups.end());
+  std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) {
+    return a.second.oldest < b.second.oldest;
+  });
+
+  const auto now = std::chrono::steady_clock::now();
+  std::stringstream ss;
+  ss << "Worker " << _handle << ": " << total << " inflight requests";
+  if (minAge.count() > 0) ss << " pending for more than " << minAge.count() << " ms";
+  if (size < total) ss << ", " << size << " oldest";
+  for (const auto& [key, group] : sorted) {
+    auto age = std::chrono::duration_cast<std::chrono::milliseconds>(now - group.oldest);
+    ss << "\n  " << key.first << ", tag 0x" << std::hex << key.second << std::dec << ": "
+       << group.requests << " requests (";
+    for (auto it = group.operations.begin(); it != group.operations.end(); ++it)
+      ss << (it == group.operations.begin() ? "" : ", ") << *it;
+    ss << "), " << group.length << " bytes, oldest " << age.count() << " ms";
+  }
+  return ss.str();
+}
+
+std::string Worker::getInflightRequestsReport(const size_t maxRequests,
+                                              const std::chrono::milliseconds minAge)
+{
+  return formatInflightRequestsReport(collectInflightRequestsInfo(minAge), maxRequests, minAge);
+}
+
+void Worker::startInflightRequestsWatchdog(const std::chrono::milliseconds threshold,
+                                           const std::chrono::milliseconds interval,
+                                           const size_t maxRequests)
+{
+  if (threshold.count() <= 0) throw ucxx::Error("Watchdog threshold must be positive");
+
+  std::lock_guard<std::mutex> controlLock(_inflightWatchdogControlMutex);
+  if (_inflightWatchdogThread.joinable())
+    throw ucxx::Error("Inflight requests watchdog already running");
+
+  {
+    std::lock_guard<std::mutex> lock(_inflightWatchdogMutex);
+    _inflightWatchdogStop = false;
+  }
+
+  const auto period       = interval.count() > 0 ? interval : threshold;
+  _inflightWatchdogThread = std::thread([this, threshold, period, maxRequests]() {
+    std::unique_lock<std::mutex> lock(_inflightWatchdogMutex);
+    while (!_inflightWatchdogCondition.wait_for(
+      lock, period, [this]() { return _inflightWatchdogStop; })) {
+      lock.unlock();
+      auto info = collectInflightRequestsInfo(threshold);
+      if (!info.empty())
+        ucxx_warn("%s",
+                  formatInflightRequestsReport(std::move(info), maxRequests, threshold).c_str());
+      lock.lock();
+    }
+  });
+
+  ucxx_debug("Worker %p started inflight requests watchdog, threshold: %ld ms, interval: %ld ms",
+             _handle,
+             static_cast<int64_t>(threshold.count()),
+             static_cast<int64_t>(period.count()));
+}
+
+void Worker::stopInflightRequestsWatchdog()
+{
+  std::lock_guard<std::mutex> controlLock(_inflightWatchdogControlMutex);
+  if (!_inflightWatchdogThread.joinable()) return;
+
+  {
+    std::lock_guard<std::mutex> lock(_inflightWatchdogMutex);
+    _inflightWatchdogStop = true;
+  }
+  _inflightWatchdogCondition.notify_all();
+  _inflightWatchdogThread.join();
+
+  ucxx_debug("Worker %p stopped inflight requests watchdog", _handle);
+}
+
 bool Worker::tagProbe(ucp_tag_t tag)
 {
   ucp_tag_recv_info_t info;
@@ -323,24 +706,65 @@ bool Worker::tagProbe(ucp_tag_t tag)
   return tag_message != NULL;
 }
 
+bool Worker::tagProbe(ucp_tag_t tag, size_t& length)
+{
+  ucp_tag_recv_info_t info;
+  ucp_tag_message_h tag_message = ucp_tag_probe_nb(_handle, tag, -1, 0, &info);
+
+  if (tag_message == NULL) return false;
+  length = info.length;
+  return true;
+}
+
+std::shared_ptr<Request> Worker::tagProbeRecv(ucp_tag_t tag,
+                                              std::function<void*(size_t)> allocate,
+                                              const bool enableFuture,
+                                              RequestCallbackUserFunction callbackFunction,
+                                              RequestCallbackUserData callbackData)
+{
+  ucp_tag_recv_info_t info;
+  ucp_tag_message_h message = ucp_tag_probe_nb(_handle, tag, -1, 1, &info);
+
+  if (message == NULL) return nullptr;
+
+  auto worker  = std::static_pointer_cast<Worker>(shared_from_this());
+  auto request = createRequestTag(worker,
+                                  message,
+                                  allocate(info.length),
+                                  info.length,
+                                  info.sender_tag,
+                                  enableFuture,
+                                  callbackFunction,
+                                  callbackData);
+  registerInflightRequest(request);
+  return request;
+}
+
 std::shared_ptr<Request> Worker::tagRecv(
   void* buffer,
   size_t length,
   ucp_tag_t tag,
   const bool enableFuture,
-  std::function<void(std::shared_ptr<void>)> callbackFunction,
-  std::shared_ptr<void> callbackData)
+  RequestCallbackUserFunction callbackFunction,
+  RequestCallbackUserData callbackData)
 {
-  auto worker  = std::dynamic_pointer_cast<Worker>(shared_from_this());
-  auto request = createRequestTag(
-    worker, false, buffer, length, tag, enableFuture, callbackFunction, callbackData);
+  auto worker  = std::static_pointer_cast<Worker>(shared_from_this());
+  auto request = createRequestTag(worker,
+                                  false,
+                                  buffer,
+                                  length,
+                                  tag,
+                                  enableFuture,
+                                  callbackFunction,
+                                  callbackData,
+                                  TagSendMode::Standard);
   registerInflightRequest(request);
   return request;
 }
 
 std::shared_ptr<Address> Worker::getAddress()
 {
-  auto worker  = std::dynamic_pointer_cast<Worker>(shared_from_this());
+  auto worker  = std::static_pointer_cast<Worker>(shared_from_this());
   auto address = ucxx::createAddressFromWorker(worker);
   return address;
 }
@@ -349,7 +773,7 @@ std::shared_ptr<Endpoint> Worker::createEndpointFromHostname(std::string ipAddre
                                                              uint16_t port,
                                                              bool endpointErrorHandling)
 {
-  auto worker   = std::dynamic_pointer_cast<Worker>(shared_from_this());
+  auto worker   = std::static_pointer_cast<Worker>(shared_from_this());
   auto endpoint = ucxx::createEndpointFromHostname(worker, ipAddress, port, endpointErrorHandling);
   return endpoint;
 }
@@ -357,16 +781,52 @@ std::shared_ptr<Endpoint> Worker::createEndpointFromHostname(std::string ipAddre
 std::shared_ptr<Endpoint> Worker::createEndpointFromWorkerAddress(std::shared_ptr<Address> address,
                                                                   bool endpointErrorHandling)
 {
-  auto worker   = std::dynamic_pointer_cast<Worker>(shared_from_this());
+  auto worker   = std::static_pointer_cast<Worker>(shared_from_this());
   auto endpoint = ucxx::createEndpointFromWorkerAddress(worker, address, endpointErrorHandling);
   return endpoint;
 }
 
+Expected<std::shared_ptr<Endpoint>> Worker::createEndpointFromHostname(
+  std::nothrow_t, std::string ipAddress, uint16_t port, bool endpointErrorHandling) noexcept
+{
+  auto worker = std::static_pointer_cast<Worker>(weak_from_this().lock());
+  return ucxx::createEndpointFromHostname(
+    std::nothrow, worker, std::move(ipAddress), port, endpointErrorHandling);
+}
+
+Expected<std::shared_ptr<Endpoint>> Worker::createEndpointFromWorkerAddress(
+  std::nothrow_t, std::shared_ptr<Address> address, bool endpointErrorHandling) noexcept
+{
+  auto worker = std::static_pointer_cast<Worker>(weak_from_this().lock());
+  return ucxx::createEndpointFromWorkerAddress(
+    std::nothrow, worker, std::move(address), endpointErrorHandling);
+}
+
+std::future<std::shared_ptr<Endpoint>> Worker::createEndpointFromHostnameAsync(
+  std::string ipAddress, uint16_t port, bool endpointErrorHandling)
+{
+  auto worker = std::static_pointer_cast<Worker>(shared_from_this());
+  return registerDelayedSubmissionFuture<std::shared_ptr<Endpoint>>(
+    [worker, ipAddress, port, endpointErrorHandling]() {
+      return ucxx::createEndpointFromHostname(worker, ipAddress, port, endpointErrorHandling);
+    });
+}
+
+std::future<std::shared_ptr<Endpoint>> Worker::createEndpointFromWorkerAddressAsync(
+  std::shared_ptr<Address> address, bool endpointErrorHandling)
+{
+  auto worker = std::static_pointer_cast<Worker>(shared_from_this());
+  return registerDelayedSubmissionFuture<std::shared_ptr<Endpoint>>(
+    [worker, address, endpointErrorHandling]() {
+      return ucxx::createEndpointFromWorkerAddress(worker, address, endpointErrorHandling);
+    });
+}
+
 std::shared_ptr<Listener> Worker::createListener(uint16_t port,
                                                  ucp_listener_conn_callback_t callback,
                                                  void* callbackArgs)
 {
-  auto worker   = std::dynamic_pointer_cast<Worker>(shared_from_this());
+  auto worker   = std::static_pointer_cast<Worker>(shared_from_this());
   auto listener = ucxx::createListener(worker, port, callback, callbackArgs);
   return listener;
 }
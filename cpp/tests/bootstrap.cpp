@@ -0,0 +1,176 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <ucxx/api.h>
+
+namespace {
+
+using ::testing::ContainerEq;
+
+const std::chrono::milliseconds timeout{std::chrono::seconds(10)};
+
+std::vector<std::string> testAddresses(const size_t worldSize)
+{
+  std::vector<std::string> addresses;
+  for (size_t rank = 0; rank < worldSize; ++rank)
+    addresses.push_back("address-" + std::to_string(rank) + std::string(rank, '\0'));
+  return addresses;
+}
+
+TEST(InProcessBootstrapBackendTest, FetchAll)
+{
+  ucxx::InProcessBootstrapBackend backend;
+  auto addresses = testAddresses(4);
+
+  std::vector<std::future<std::vector<std::string>>> fetched;
+  for (size_t rank = 0; rank < addresses.size(); ++rank)
+    fetched.push_back(std::async(std::launch::async, [&backend, &addresses, rank]() {
+      backend.publish(rank, addresses[rank]);
+      return backend.fetchAll(addresses.size(), timeout);
+    }));
+
+  for (auto& f : fetched)
+    ASSERT_THAT(f.get(), ContainerEq(addresses));
+}
+
+TEST(InProcessBootstrapBackendTest, Timeout)
+{
+  ucxx::InProcessBootstrapBackend backend;
+  backend.publish(0, "address-0");
+  EXPECT_THROW(backend.fetchAll(2, std::chrono::milliseconds(10)), ucxx::Error);
+  EXPECT_THROW(backend.publish(0, "address-0"), ucxx::Error);
+}
+
+TEST(FileBootstrapBackendTest, FetchAll)
+{
+  char directory[] = "/tmp/ucxx-bootstrap-XXXXXX";
+  ASSERT_NE(mkdtemp(directory), nullptr);
+  auto addresses = testAddresses(3);
+
+  {
+    ucxx::FileBootstrapBackend backend(directory, "job-0");
+
+    // Rank 0 starts fetching before other ranks have published
+    backend.publish(0, addresses[0]);
+    auto fetched = std::async(std::launch::async, [&backend, &addresses]() {
+      return backend.fetchAll(addresses.size(), timeout);
+    });
+    for (size_t rank = 1; rank < addresses.size(); ++rank)
+      backend.publish(rank, addresses[rank]);
+
+    ASSERT_THAT(fetched.get(), ContainerEq(addresses));
+    EXPECT_THROW(backend.fetchAll(addresses.size() + 1, std::chrono::milliseconds(10)),
+                 ucxx::Error);
+  }
+
+  // Published files are removed once the backend is destroyed
+  for (size_t rank = 0; rank < addresses.size(); ++rank)
+    EXPECT_FALSE(std::ifstream(std::string(directory) + "/job-0." + std::to_string(rank) +
+                               ".address")
+                   .is_open());
+  EXPECT_THROW(ucxx::FileBootstrapBackend(directory, ""), ucxx::Error);
+  EXPECT_THROW(ucxx::FileBootstrapBackend(directory, "job/0"), ucxx::Error);
+}
+
+TEST(FileBootstrapBackendTest, RejectStale)
+{
+  char directory[] = "/tmp/ucxx-bootstrap-XXXXXX";
+  ASSERT_NE(mkdtemp(directory), nullptr);
+  auto addresses = testAddresses(2);
+
+  // Addresses of a previous run of the job are not fetched
+  ucxx::FileBootstrapBackend previous(directory, "job-0");
+  for (size_t rank = 0; rank < addresses.size(); ++rank)
+    previous.publish(rank, "stale-" + addresses[rank]);
+  ucxx::FileBootstrapBackend backend(directory, "job-1");
+  EXPECT_THROW(backend.fetchAll(addresses.size(), std::chrono::milliseconds(10)), ucxx::Error);
+
+  // A file not published by the backend is rejected until published again
+  {
+    std::ofstream file(std::string(directory) + "/job-1.1.address", std::ios::binary);
+    file << addresses[1];
+  }
+  backend.publish(0, addresses[0]);
+  EXPECT_THROW(backend.fetchAll(addresses.size(), std::chrono::milliseconds(10)), ucxx::Error);
+
+  backend.publish(1, addresses[1]);
+  ASSERT_THAT(backend.fetchAll(addresses.size(), timeout), ContainerEq(addresses));
+}
+
+class BootstrapTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<ucxx::Context> _context{
+    ucxx::createContext({}, ucxx::Context::defaultFeatureFlags)};
+};
+
+TEST_F(BootstrapTest, ListenerFetchAll)
+{
+  const size_t worldSize = 3;
+  auto addresses         = testAddresses(worldSize);
+
+  auto root = std::make_shared<ucxx::ListenerBootstrapBackend>(_context, 0, "127.0.0.1", 0);
+  std::vector<std::future<std::vector<std::string>>> fetched;
+  for (size_t rank = 0; rank < worldSize; ++rank)
+    fetched.push_back(std::async(std::launch::async, [&, rank]() {
+      auto backend = rank == 0 ? root
+                               : std::make_shared<ucxx::ListenerBootstrapBackend>(
+                                   _context, rank, "127.0.0.1", root->getPort());
+      backend->publish(rank, addresses[rank]);
+      return backend->fetchAll(worldSize, timeout);
+    }));
+
+  for (auto& f : fetched)
+    ASSERT_THAT(f.get(), ContainerEq(addresses));
+}
+
+TEST_F(BootstrapTest, Endpoints)
+{
+  const size_t worldSize = 3;
+  ucxx::InProcessBootstrapBackend backend;
+
+  std::vector<std::shared_ptr<ucxx::Worker>> workers;
+  for (size_t rank = 0; rank < worldSize; ++rank)
+    workers.push_back(_context->createWorker());
+
+  std::vector<std::future<std::vector<std::shared_ptr<ucxx::Endpoint>>>> connected;
+  for (size_t rank = 0; rank < worldSize; ++rank)
+    connected.push_back(std::async(std::launch::async, [&, rank]() {
+      return ucxx::bootstrapEndpoints(workers[rank], backend, rank, worldSize, timeout);
+    }));
+
+  std::vector<std::vector<std::shared_ptr<ucxx::Endpoint>>> endpoints;
+  for (auto& c : connected)
+    endpoints.push_back(c.get());
+
+  for (size_t rank = 0; rank < worldSize; ++rank) {
+    ASSERT_EQ(endpoints[rank].size(), worldSize);
+    for (size_t peer = 0; peer < worldSize; ++peer)
+      ASSERT_EQ(endpoints[rank][peer] == nullptr, peer == rank);
+  }
+
+  // Transfer from rank 1 to rank 2
+  std::vector<int> send{1, 2, 3};
+  std::vector<int> recv(send.size());
+  auto sendRequest = endpoints[1][2]->tagSend(send.data(), send.size() * sizeof(int), 0);
+  auto recvRequest = endpoints[2][1]->tagRecv(recv.data(), recv.size() * sizeof(int), 0);
+  while (!sendRequest->isCompleted() || !recvRequest->isCompleted())
+    for (auto& worker : workers)
+      worker->progress();
+
+  ASSERT_EQ(recvRequest->getStatus(), UCS_OK);
+  ASSERT_THAT(recv, ContainerEq(send));
+}
+
+}  // namespace
@@ -0,0 +1,138 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ucxx/api.h>
+
+#include "include/utils.h"
+
+namespace {
+
+class ChannelTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<ucxx::Context> _context{
+    ucxx::createContext({}, ucxx::Context::defaultFeatureFlags)};
+  std::shared_ptr<ucxx::Worker> _worker{nullptr};
+  std::shared_ptr<ucxx::Endpoint> _ep{nullptr};
+  std::function<void()> _progressWorker;
+
+  virtual void SetUp()
+  {
+    _worker         = _context->createWorker();
+    _ep             = _worker->createEndpointFromWorkerAddress(_worker->getAddress());
+    _progressWorker = getProgressFunction(_worker, ProgressMode::Polling);
+  }
+};
+
+TEST_F(ChannelTest, InvalidParams)
+{
+  EXPECT_THROW(ucxx::createChannel(_ep, ucxx::MaxChannelId + 1), ucxx::Error);
+
+  auto channel = ucxx::createChannel(_ep, ucxx::MaxChannelId);
+  std::vector<int> buffer(1);
+  EXPECT_THROW(channel->tagSend(buffer.data(), sizeof(int), ucxx::MaxChannelTag + 1),
+               ucxx::Error);
+}
+
+TEST_F(ChannelTest, IdBoundToEndpoint)
+{
+  auto otherEp = _worker->createEndpointFromWorkerAddress(_worker->getAddress());
+  auto channel = ucxx::createChannel(_ep, 0);
+  auto twin    = ucxx::createChannel(_ep, 0);
+
+  // Receives of both endpoints would match the same tags
+  EXPECT_THROW(ucxx::createChannel(otherEp, 0), ucxx::Error);
+  auto other = ucxx::createChannel(otherEp, 1);
+
+  channel->close();
+  EXPECT_THROW(ucxx::createChannel(otherEp, 0), ucxx::Error);
+  twin.reset();
+  ucxx::createChannel(otherEp, 0);
+}
+
+TEST_F(ChannelTest, Isolation)
+{
+  auto channel0 = ucxx::createChannel(_ep, 0);
+  auto channel1 = ucxx::createChannel(_ep, 1);
+
+  std::vector<int> send0{0}, send1{1}, sendEp{2};
+  std::vector<int> recv0(1), recv1(1), recvEp(1);
+
+  // Same tag on different channels and on the endpoint itself must not match each other
+  std::vector<std::shared_ptr<ucxx::Request>> requests;
+  requests.push_back(channel1->tagRecv(recv1.data(), sizeof(int), 0));
+  requests.push_back(_ep->tagRecv(recvEp.data(), sizeof(int), 0));
+  requests.push_back(channel0->tagRecv(recv0.data(), sizeof(int), 0));
+  requests.push_back(channel0->tagSend(send0.data(), sizeof(int), 0));
+  requests.push_back(_ep->tagSend(sendEp.data(), sizeof(int), 0));
+  requests.push_back(channel1->tagSend(send1.data(), sizeof(int), 0));
+  waitRequests(_worker, requests, _progressWorker);
+
+  ASSERT_EQ(recv0[0], send0[0]);
+  ASSERT_EQ(recv1[0], send1[0]);
+  ASSERT_EQ(recvEp[0], sendEp[0]);
+
+  auto stats = channel0->getStats();
+  ASSERT_EQ(stats.sendCount, 1);
+  ASSERT_EQ(stats.sendBytes, sizeof(int));
+  ASSERT_EQ(stats.recvCount, 1);
+  ASSERT_EQ(stats.recvBytes, sizeof(int));
+  ASSERT_EQ(stats.completed, 2);
+  ASSERT_EQ(stats.inflight, 0);
+  ASSERT_EQ(channel0->getInflightCount(), 0);
+}
+
+TEST_F(ChannelTest, CloseCancelsOwnRequests)
+{
+  auto channel0 = ucxx::createChannel(_ep, 0);
+  auto channel1 = ucxx::createChannel(_ep, 1);
+
+  std::vector<int> recv0(1), recv1(1);
+  auto request0 = channel0->tagRecv(recv0.data(), sizeof(int), 0);
+  auto request1 = channel1->tagRecv(recv1.data(), sizeof(int), 0);
+  ASSERT_EQ(channel0->getInflightCount(), 1);
+
+  ASSERT_EQ(channel0->close(), 1);
+  ASSERT_TRUE(channel0->isClosed());
+  ASSERT_EQ(channel0->close(), 0);
+  while (!request0->isCompleted())
+    _progressWorker();
+  ASSERT_EQ(request0->getStatus(), UCS_ERR_CANCELED);
+  ASSERT_EQ(channel0->getStats().canceled, 1);
+  EXPECT_THROW(channel0->tagRecv(recv0.data(), sizeof(int), 0), ucxx::NotConnectedError);
+
+  // The endpoint and the other channel remain usable
+  ASSERT_TRUE(_ep->isAlive());
+  ASSERT_FALSE(request1->isCompleted());
+  std::vector<int> send1{123};
+  std::vector<std::shared_ptr<ucxx::Request>> requests{
+    request1, channel1->tagSend(send1.data(), sizeof(int), 0)};
+  waitRequests(_worker, requests, _progressWorker);
+  ASSERT_EQ(recv1[0], send1[0]);
+}
+
+TEST_F(ChannelTest, ManyChannels)
+{
+  const size_t numChannels = 1000;
+
+  std::vector<std::shared_ptr<ucxx::Channel>> channels;
+  std::vector<int> send(numChannels), recv(numChannels);
+  std::vector<std::shared_ptr<ucxx::Request>> requests;
+  for (size_t i = 0; i < numChannels; ++i) {
+    channels.push_back(ucxx::createChannel(_ep, i));
+    send[i] = i;
+    requests.push_back(channels[i]->tagRecv(&recv[i], sizeof(int), 0));
+  }
+  for (size_t i = numChannels; i > 0; --i)
+    requests.push_back(channels[i - 1]->tagSend(&send[i - 1], sizeof(int), 0));
+  waitRequests(_worker, requests, _progressWorker);
+
+  ASSERT_EQ(recv, send);
+}
+
+}  // namespace
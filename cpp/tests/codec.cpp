@@ -0,0 +1,221 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <ucxx/api.h>
+
+#include "include/utils.h"
+
+namespace {
+
+using ::testing::Combine;
+using ::testing::ContainerEq;
+using ::testing::Values;
+
+std::vector<int64_t> compressibleData(const size_t length)
+{
+  std::vector<int64_t> data(length);
+  std::iota(data.begin(), data.end(), 0);
+  return data;
+}
+
+std::vector<int64_t> randomData(const size_t length)
+{
+  std::mt19937_64 generator(42);
+  std::vector<int64_t> data(length);
+  for (auto& d : data)
+    d = generator();
+  return data;
+}
+
+class CodecTest : public ::testing::TestWithParam<std::tuple<ucxx::CodecType, size_t>> {
+ protected:
+  ucxx::CodecParams _params{};
+  size_t _length{0};
+
+  void SetUp() { std::tie(_params.codec, _length) = GetParam(); }
+
+  std::vector<int64_t> roundTrip(const std::vector<int64_t>& data, std::string& encoded)
+  {
+    encoded = ucxx::codecEncode(_params, data.data(), data.size() * sizeof(int64_t));
+
+    std::vector<int64_t> decoded(data.size());
+    ucxx::codecDecode(
+      encoded.data(), encoded.size(), decoded.data(), data.size() * sizeof(int64_t));
+    return decoded;
+  }
+};
+
+TEST_P(CodecTest, Compressible)
+{
+  auto data = compressibleData(_length);
+  std::string encoded;
+
+  ASSERT_THAT(roundTrip(data, encoded), ContainerEq(data));
+  if (_params.codec != ucxx::CodecType::Raw && _length >= 1024) {
+    ASSERT_LT(encoded.size(), data.size() * sizeof(int64_t) * _params.maxRatio);
+  }
+}
+
+TEST_P(CodecTest, RawFallback)
+{
+  auto data = randomData(_length);
+  std::string encoded;
+
+  ASSERT_THAT(roundTrip(data, encoded), ContainerEq(data));
+  ASSERT_EQ(encoded.size(), ucxx::codecMaxEncodedSize(data.size() * sizeof(int64_t)));
+}
+
+TEST_P(CodecTest, Truncated)
+{
+  auto data    = compressibleData(_length);
+  auto encoded = ucxx::codecEncode(_params, data.data(), data.size() * sizeof(int64_t));
+
+  std::vector<int64_t> decoded(data.size());
+  EXPECT_THROW(ucxx::codecDecode(
+                 encoded.data(), encoded.size() - 1, decoded.data(), _length * sizeof(int64_t)),
+               ucxx::Error);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+  Codecs,
+  CodecTest,
+  Combine(Values(ucxx::CodecType::Raw, ucxx::CodecType::Lz, ucxx::CodecType::ShuffleLz),
+          Values(1, 1024, 1048576)));
+
+TEST(CodecParamsTest, Invalid)
+{
+  ucxx::CodecParams params{};
+  params.chunkSize = 0;
+  EXPECT_THROW(ucxx::codecValidateParams(params), ucxx::Error);
+
+  params          = ucxx::CodecParams{};
+  params.maxRatio = 0.0;
+  EXPECT_THROW(ucxx::codecValidateParams(params), ucxx::Error);
+
+  params             = ucxx::CodecParams{};
+  params.elementSize = 0;
+  EXPECT_THROW(ucxx::codecValidateParams(params), ucxx::Error);
+}
+
+class CodecTagMultiTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<ucxx::Context> _context{
+    ucxx::createContext({}, ucxx::Context::defaultFeatureFlags)};
+  std::shared_ptr<ucxx::Worker> _worker{nullptr};
+  std::shared_ptr<ucxx::Endpoint> _ep{nullptr};
+
+  void SetUp()
+  {
+    _worker = _context->createWorker();
+    _ep     = _worker->createEndpointFromWorkerAddress(_worker->getAddress());
+  }
+};
+
+TEST_F(CodecTagMultiTest, SendRecv)
+{
+  ucxx::CodecParams params{};
+  params.codec        = ucxx::CodecType::ShuffleLz;
+  params.chunkSize    = 64 * 1024;
+  params.minFrameSize = 1024;
+
+  // Multiple chunks, a single partial chunk, a raw fallback and a frame below the threshold
+  std::vector<std::vector<int64_t>> send{
+    compressibleData(100000), compressibleData(1000), randomData(10000), compressibleData(10)};
+
+  std::vector<void*> buffer;
+  std::vector<size_t> size;
+  for (auto& s : send) {
+    buffer.push_back(s.data());
+    size.push_back(s.size() * sizeof(int64_t));
+  }
+  std::vector<int> isCUDA(send.size(), 0);
+
+  std::vector<std::shared_ptr<ucxx::RequestTagMulti>> requests;
+  requests.push_back(_ep->tagMultiSend(buffer, size, isCUDA, 0, false, params));
+  requests.push_back(_ep->tagMultiRecv(0, false));
+  waitRequestsTagMulti(_worker, requests, getProgressFunction(_worker, ProgressMode::Polling));
+
+  for (const auto& request : requests)
+    ASSERT_EQ(request->getStatus(), UCS_OK);
+
+  std::vector<std::vector<int64_t>> recv;
+  for (const auto& br : requests[1]->_bufferRequests) {
+    // br->buffer == nullptr are headers or chunks of encoded frames other than the last
+    if (br->buffer) {
+      auto data = reinterpret_cast<int64_t*>(br->buffer->data());
+      recv.push_back(std::vector<int64_t>(data, data + br->buffer->getSize() / sizeof(int64_t)));
+    }
+  }
+
+  ASSERT_THAT(recv, ContainerEq(send));
+}
+
+TEST_F(CodecTagMultiTest, InvalidHeader)
+{
+  // Encoded frames with a zero chunk size, and an unknown codec
+  std::vector<std::pair<int, size_t>> invalid{
+    {static_cast<int>(ucxx::CodecType::Lz), 0},
+    {static_cast<int>(ucxx::CodecType::Invalid), 1024},
+  };
+
+  for (const auto& [codec, chunkSize] : invalid) {
+    std::vector<int> isCUDA{0};
+    std::vector<size_t> size{8};
+    std::vector<int> frameCodec{codec};
+    auto header = ucxx::Header(false, 1, isCUDA.data(), size.data(), frameCodec.data(), chunkSize);
+    ASSERT_TRUE(header.extended);
+    ASSERT_FALSE(header.isValid());
+
+    auto serialized          = header.serialize();
+    auto serializedExtension = header.serializeExtension();
+    std::vector<std::shared_ptr<ucxx::Request>> sendRequests{
+      _ep->tagSend(serialized.data(), serialized.size(), 0),
+      _ep->tagSend(serializedExtension.data(), serializedExtension.size(), 0)};
+
+    std::vector<std::shared_ptr<ucxx::RequestTagMulti>> requests{_ep->tagMultiRecv(0, false)};
+    auto progress = getProgressFunction(_worker, ProgressMode::Polling);
+    waitRequestsTagMulti(_worker, requests, progress);
+    waitRequests(_worker, sendRequests, progress);
+
+    // No frames are received for an invalid header
+    ASSERT_EQ(requests[0]->getStatus(), UCS_ERR_INVALID_PARAM);
+    ASSERT_EQ(requests[0]->_bufferRequests.size(), 2);
+  }
+}
+
+TEST_F(CodecTagMultiTest, UnextendedHeader)
+{
+  // Headers of raw frames are serialized as by peers predating header extensions
+  std::vector<int> isCUDA{0};
+  std::vector<size_t> size{8};
+  auto header = ucxx::Header(false, 1, isCUDA.data(), size.data());
+  ASSERT_FALSE(header.extended);
+  ASSERT_EQ(header.serialize().size(), ucxx::Header::dataSize());
+
+  std::vector<int64_t> send{42};
+  std::vector<std::shared_ptr<ucxx::RequestTagMulti>> requests;
+  requests.push_back(_ep->tagMultiSend(
+    {send.data()}, {send.size() * sizeof(int64_t)}, {0}, 0, false, ucxx::CodecParams{}));
+  requests.push_back(_ep->tagMultiRecv(0, false));
+  waitRequestsTagMulti(_worker, requests, getProgressFunction(_worker, ProgressMode::Polling));
+
+  for (const auto& request : requests)
+    ASSERT_EQ(request->getStatus(), UCS_OK);
+  // A single header message and a single frame
+  ASSERT_EQ(requests[1]->_bufferRequests.size(), 2);
+}
+
+}  // namespace
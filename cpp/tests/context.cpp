@@ -2,13 +2,18 @@
  * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
  * SPDX-License-Identifier: BSD-3-Clause
  */
+#include <algorithm>
 #include <cstdlib>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
 #include <ucxx/api.h>
 
+#include "include/utils.h"
+
 namespace {
 
 static std::vector<std::string> TlsConfig{"^tcp", "^tcp,sm", "tcp", "tcp,sm", "all"};
@@ -52,6 +57,76 @@ TEST_P(ContextTestCustomConfig, TLS)
   ASSERT_EQ(context->getFeatureFlags(), featureFlags);
 }
 
+TEST_P(ContextTestCustomConfig, Capabilities)
+{
+  auto tls     = GetParam();
+  auto context = ucxx::createContext({{"TLS", tls}}, ucxx::Context::defaultFeatureFlags);
+
+  auto& capabilities = context->getCapabilities();
+  ASSERT_EQ(capabilities.transportsExcluded, tls[0] == '^');
+  ASSERT_EQ(capabilities.transports.size(),
+            static_cast<size_t>(std::count(tls.begin(), tls.end(), ',') + 1));
+  ASSERT_EQ(capabilities.transports[0], tls.substr(capabilities.transportsExcluded));
+  ASSERT_TRUE(capabilities.memoryTypes & UCS_BIT(UCS_MEMORY_TYPE_HOST));
+}
+
+TEST(ContextTest, SharedContext)
+{
+  static constexpr auto featureFlags = ucxx::Context::defaultFeatureFlags;
+  auto context                       = ucxx::createSharedContext({}, featureFlags);
+
+  ASSERT_EQ(ucxx::createSharedContext({}, featureFlags), context);
+  ASSERT_NE(ucxx::createSharedContext({{"TLS", "tcp"}}, featureFlags), context);
+  ASSERT_NE(ucxx::createSharedContext({}, UCP_FEATURE_TAG), context);
+
+  // A new context is created once all references to the shared context are released
+  context = nullptr;
+  context = ucxx::createSharedContext({}, featureFlags);
+  ASSERT_TRUE(context->getHandle() != nullptr);
+}
+
+TEST(ContextTest, Profiles)
+{
+  for (auto profile : {ucxx::ContextProfile::Full,
+                       ucxx::ContextProfile::TagOnly,
+                       ucxx::ContextProfile::StreamOnly,
+                       ucxx::ContextProfile::Rma,
+                       ucxx::ContextProfile::PollingOnly}) {
+    auto featureFlags = ucxx::Context::getProfileFeatureFlags(profile);
+    auto context      = ucxx::createContextFromProfile({}, profile);
+
+    ASSERT_EQ(context->getFeatureFlags(), featureFlags);
+    ASSERT_EQ(static_cast<bool>(featureFlags & UCP_FEATURE_WAKEUP),
+              profile != ucxx::ContextProfile::PollingOnly);
+    ASSERT_TRUE(context->createWorker() != nullptr);
+  }
+
+  ASSERT_EQ(ucxx::Context::getProfileFeatureFlags(ucxx::ContextProfile::Full),
+            ucxx::Context::defaultFeatureFlags);
+}
+
+TEST(ContextTest, PollingOnlyProfile)
+{
+  auto context = ucxx::createContextFromProfile({}, ucxx::ContextProfile::PollingOnly);
+  auto worker  = context->createWorker(true);
+
+  EXPECT_THROW(worker->initBlockingProgressMode(), ucxx::Error);
+
+  // Blocking progress thread falls back to polling mode
+  worker->startProgressThread(false);
+  auto ep = worker->createEndpointFromWorkerAddressAsync(worker->getAddress()).get();
+
+  std::vector<int> send{123};
+  std::vector<int> recv(1);
+  std::vector<std::shared_ptr<ucxx::Request>> requests;
+  requests.push_back(ep->tagSend(send.data(), send.size() * sizeof(int), 0));
+  requests.push_back(ep->tagRecv(recv.data(), recv.size() * sizeof(int), 0));
+  waitRequests(worker, requests, getProgressFunction(worker, ProgressMode::ThreadPolling));
+
+  ASSERT_EQ(recv[0], send[0]);
+  worker->stopProgressThread();
+}
+
 TEST(ContextTest, CustomFlags)
 {
   uint64_t featureFlags = UCP_FEATURE_TAG | UCP_FEATURE_WAKEUP;
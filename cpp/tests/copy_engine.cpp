@@ -0,0 +1,121 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ucxx/api.h>
+
+namespace {
+
+std::vector<uint8_t> makeSource(const size_t size)
+{
+  std::vector<uint8_t> source(size);
+  for (size_t i = 0; i < size; ++i)
+    source[i] = static_cast<uint8_t>(i * 131 + (i >> 12));
+  return source;
+}
+
+TEST(CopyEngineTest, Inline)
+{
+  ucxx::CopyEngine engine(ucxx::CopyEngineParams{.inlineThreshold = 1 << 20});
+
+  auto source = makeSource(4096);
+  std::vector<uint8_t> destination(source.size());
+  engine.copy(destination.data(), source.data(), source.size());
+  ASSERT_EQ(destination, source);
+
+  auto stats = engine.getStats();
+  ASSERT_EQ(stats.inlineCopies, 1);
+  ASSERT_EQ(stats.parallelCopies, 0);
+  ASSERT_EQ(stats.bytes, source.size());
+}
+
+TEST(CopyEngineTest, Parallel)
+{
+  ucxx::CopyEngine engine(ucxx::CopyEngineParams{
+    .numThreads = 3, .inlineThreshold = 1 << 20, .minChunkSize = 64 << 10});
+
+  auto source = makeSource(8 << 20);
+  std::vector<uint8_t> destination(source.size());
+  engine.copy(destination.data(), source.data(), source.size());
+  ASSERT_EQ(destination, source);
+
+  auto stats = engine.getStats();
+  ASSERT_EQ(stats.inlineCopies, 0);
+  ASSERT_EQ(stats.parallelCopies, 1);
+  ASSERT_GE(stats.chunks, 4);
+  ASSERT_EQ(stats.bytes, source.size());
+  ASSERT_GE(engine.getNumaNodeCount(), 1);
+}
+
+TEST(CopyEngineTest, Unaligned)
+{
+  ucxx::CopyEngine engine(ucxx::CopyEngineParams{
+    .numThreads = 2, .inlineThreshold = 1 << 16, .minChunkSize = 4096});
+
+  auto source = makeSource((1 << 20) + 4096);
+  for (const size_t offset : {1, 7, 4095}) {
+    const size_t size = (1 << 20) + 13;
+    std::vector<uint8_t> destination(size + 2 * offset, 0);
+    engine.copy(destination.data() + offset, source.data() + offset, size);
+    for (size_t i = 0; i < offset; ++i)
+      ASSERT_EQ(destination[i], 0);
+    for (size_t i = 0; i < size; ++i)
+      ASSERT_EQ(destination[offset + i], source[offset + i]);
+    for (size_t i = offset + size; i < destination.size(); ++i)
+      ASSERT_EQ(destination[i], 0);
+  }
+  ASSERT_EQ(engine.getStats().parallelCopies, 3);
+}
+
+TEST(CopyEngineTest, NoHelperThreads)
+{
+  ucxx::CopyEngine engine(ucxx::CopyEngineParams{.numThreads = 0, .inlineThreshold = 0});
+
+  auto source = makeSource(4 << 20);
+  std::vector<uint8_t> destination(source.size());
+  engine.copy(destination.data(), source.data(), source.size());
+  ASSERT_EQ(destination, source);
+  ASSERT_EQ(engine.getStats().inlineCopies, 1);
+}
+
+TEST(CopyEngineTest, Concurrent)
+{
+  ucxx::CopyEngine engine(ucxx::CopyEngineParams{
+    .numThreads = 2, .inlineThreshold = 1 << 16, .minChunkSize = 16 << 10});
+
+  const size_t numCallers = 4;
+  const size_t numCopies  = 16;
+  auto source             = makeSource(2 << 20);
+  std::vector<std::vector<uint8_t>> destinations(numCallers,
+                                                 std::vector<uint8_t>(source.size()));
+
+  std::vector<std::thread> callers;
+  for (size_t c = 0; c < numCallers; ++c)
+    callers.emplace_back([&engine, &source, &destinations, c]() {
+      for (size_t n = 0; n < numCopies; ++n)
+        engine.copy(destinations[c].data(), source.data(), source.size());
+    });
+  for (auto& caller : callers)
+    caller.join();
+
+  for (const auto& destination : destinations)
+    ASSERT_EQ(destination, source);
+  ASSERT_EQ(engine.getStats().parallelCopies, numCallers * numCopies);
+}
+
+TEST(CopyEngineTest, DefaultEngine)
+{
+  auto source = makeSource(4 << 20);
+  std::vector<uint8_t> destination(source.size());
+  ucxx::copyMemory(destination.data(), source.data(), source.size());
+  ASSERT_EQ(destination, source);
+  ASSERT_EQ(&ucxx::getDefaultCopyEngine(), &ucxx::getDefaultCopyEngine());
+}
+
+}  // namespace
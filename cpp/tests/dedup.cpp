@@ -0,0 +1,254 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <cstdint>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <ucxx/api.h>
+
+#include "include/utils.h"
+
+namespace {
+
+using ::testing::ContainerEq;
+using ::testing::ElementsAre;
+
+constexpr int Store     = static_cast<int>(ucxx::DedupAction::Store);
+constexpr int Reference = static_cast<int>(ucxx::DedupAction::Reference);
+
+std::vector<int64_t> frameData(const size_t length, const int64_t start)
+{
+  std::vector<int64_t> data(length);
+  std::iota(data.begin(), data.end(), start);
+  return data;
+}
+
+TEST(DedupFingerprintTest, KnownValues)
+{
+  const std::string a{"a"};
+  const std::string abc{"abc"};
+
+  ASSERT_EQ(ucxx::dedupFingerprint(nullptr, 0), 0xef46db3751d8e999ull);
+  ASSERT_EQ(ucxx::dedupFingerprint(a.data(), a.size()), 0xd24ec4f1a98c6e5bull);
+  ASSERT_EQ(ucxx::dedupFingerprint(abc.data(), abc.size()), 0x44bc2cf5ad770999ull);
+}
+
+TEST(DedupFingerprintTest, Distinct)
+{
+  auto data  = frameData(1000, 0);
+  auto other = data;
+  other[500] += 1;
+  const auto size = data.size() * sizeof(int64_t);
+
+  ASSERT_EQ(ucxx::dedupFingerprint(data.data(), size), ucxx::dedupFingerprint(data.data(), size));
+  ASSERT_NE(ucxx::dedupFingerprint(data.data(), size), ucxx::dedupFingerprint(other.data(), size));
+}
+
+TEST(DedupCacheTest, MirrorEviction)
+{
+  ucxx::DedupParams params{.minFrameSize = 16, .maxEntries = 2};
+  ucxx::DedupCache sender(params, false);
+  ucxx::DedupCache receiver(params, true);
+
+  std::vector<std::vector<int64_t>> frames{frameData(4, 0), frameData(4, 10), frameData(4, 20)};
+  const size_t size = 4 * sizeof(int64_t);
+
+  auto transfer = [&](const std::vector<size_t>& indices) {
+    std::vector<uint64_t> fingerprint;
+    for (const auto& i : indices)
+      fingerprint.push_back(ucxx::dedupFingerprint(frames[i].data(), size));
+    std::vector<size_t> sizes(indices.size(), size);
+
+    uint64_t epoch = 0;
+    auto action =
+      sender.planSend(fingerprint, sizes, std::vector<int>(indices.size(), 1), epoch);
+
+    std::vector<std::vector<int64_t>> recv(indices.size(), std::vector<int64_t>(4, 0));
+    std::vector<void*> data;
+    for (size_t i = 0; i < indices.size(); ++i) {
+      if (action[i] != Reference) recv[i] = frames[indices[i]];
+      data.push_back(recv[i].data());
+    }
+
+    EXPECT_TRUE(receiver.applyRecv(action, fingerprint, sizes, data, epoch));
+    for (size_t i = 0; i < indices.size(); ++i)
+      EXPECT_THAT(recv[i], ContainerEq(frames[indices[i]]));
+    return action;
+  };
+
+  ASSERT_THAT(transfer({0, 1}), ElementsAre(Store, Store));
+  ASSERT_THAT(transfer({0}), ElementsAre(Reference));
+  // Frame 1 is the least recently used and is evicted by frame 2
+  ASSERT_THAT(transfer({2}), ElementsAre(Store));
+  ASSERT_THAT(transfer({1, 0, 2}), ElementsAre(Store, Reference, Reference));
+
+  auto stats = sender.getStats();
+  ASSERT_EQ(stats.frames, 7u);
+  ASSERT_EQ(stats.hits, 3u);
+  ASSERT_EQ(stats.bytesSaved, 3 * (size - sizeof(uint64_t)));
+
+  auto receiverStats = receiver.getStats();
+  ASSERT_EQ(receiverStats.frames, stats.frames);
+  ASSERT_EQ(receiverStats.hits, stats.hits);
+  ASSERT_EQ(receiverStats.bytesSaved, stats.bytesSaved);
+}
+
+TEST(DedupCacheTest, UnresolvedReference)
+{
+  ucxx::DedupCache receiver(ucxx::DedupParams{}, true);
+
+  std::vector<int64_t> recv(1024, 0);
+  ASSERT_FALSE(
+    receiver.applyRecv({Reference}, {42}, {recv.size() * sizeof(int64_t)}, {recv.data()}, 0));
+}
+
+TEST(DedupCacheTest, Invalidate)
+{
+  ucxx::DedupCache sender(ucxx::DedupParams{}, false);
+  ucxx::DedupCache receiver(ucxx::DedupParams{}, true);
+
+  auto frame             = frameData(1024, 0);
+  const size_t size      = frame.size() * sizeof(int64_t);
+  const auto fingerprint = ucxx::dedupFingerprint(frame.data(), size);
+
+  uint64_t epoch = 0;
+  ASSERT_THAT(sender.planSend({fingerprint}, {size}, {1}, epoch), ElementsAre(Store));
+  ASSERT_TRUE(receiver.applyRecv({Store}, {0}, {size}, {frame.data()}, epoch));
+
+  // The failed send is stored again in a new epoch, invalidating only once
+  ASSERT_THAT(sender.planSend({fingerprint}, {size}, {1}, epoch), ElementsAre(Reference));
+  sender.invalidate(epoch);
+  sender.invalidate(epoch);
+  ASSERT_THAT(sender.planSend({fingerprint}, {size}, {1}, epoch), ElementsAre(Store));
+  ASSERT_EQ(epoch, 1u);
+
+  // References of the invalidated epoch are not resolved anymore
+  std::vector<int64_t> recv(frame.size(), 0);
+  ASSERT_TRUE(receiver.applyRecv({Store}, {0}, {size}, {frame.data()}, epoch));
+  ASSERT_FALSE(receiver.applyRecv({Reference}, {fingerprint}, {size}, {recv.data()}, 0));
+  ASSERT_TRUE(receiver.applyRecv({Reference}, {fingerprint}, {size}, {recv.data()}, epoch));
+  ASSERT_THAT(recv, ContainerEq(frame));
+}
+
+class DedupTagMultiTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<ucxx::Context> _context{
+    ucxx::createContext({}, ucxx::Context::defaultFeatureFlags)};
+  std::shared_ptr<ucxx::Worker> _worker{nullptr};
+  std::shared_ptr<ucxx::Endpoint> _ep{nullptr};
+
+  void SetUp()
+  {
+    _worker = _context->createWorker();
+    _ep     = _worker->createEndpointFromWorkerAddress(_worker->getAddress());
+    _ep->enableDedup(ucxx::DedupParams{.minFrameSize = 1024});
+  }
+
+  std::vector<std::vector<int64_t>> transfer(std::vector<std::vector<int64_t>>& send,
+                                             const ucxx::CodecParams& codecParams = {})
+  {
+    std::vector<void*> buffer;
+    std::vector<size_t> size;
+    for (auto& s : send) {
+      buffer.push_back(s.data());
+      size.push_back(s.size() * sizeof(int64_t));
+    }
+    std::vector<int> isCUDA(send.size(), 0);
+
+    std::vector<std::shared_ptr<ucxx::RequestTagMulti>> requests;
+    requests.push_back(_ep->tagMultiSend(buffer, size, isCUDA, 0, false, codecParams));
+    requests.push_back(_ep->tagMultiRecv(0, false));
+    waitRequestsTagMulti(_worker, requests, getProgressFunction(_worker, ProgressMode::Polling));
+
+    for (const auto& request : requests)
+      EXPECT_EQ(request->getStatus(), UCS_OK);
+
+    std::vector<std::vector<int64_t>> recv;
+    for (const auto& br : requests[1]->_bufferRequests) {
+      if (br->buffer) {
+        auto data = reinterpret_cast<int64_t*>(br->buffer->data());
+        recv.push_back(std::vector<int64_t>(data, data + br->buffer->getSize() / sizeof(int64_t)));
+      }
+    }
+    return recv;
+  }
+};
+
+TEST_F(DedupTagMultiTest, SendRecv)
+{
+  // Two eligible frames and a frame below the threshold
+  std::vector<std::vector<int64_t>> first{
+    frameData(10000, 0), frameData(5000, 1), frameData(10, 2)};
+  ASSERT_THAT(transfer(first), ContainerEq(first));
+  ASSERT_EQ(_ep->getDedupSendCache()->getStats().hits, 0u);
+
+  // The first frame is repeated while the second is modified
+  std::vector<std::vector<int64_t>> second{
+    frameData(10000, 0), frameData(5000, 3), frameData(10, 2)};
+  ASSERT_THAT(transfer(second), ContainerEq(second));
+
+  auto sendStats = _ep->getDedupSendCache()->getStats();
+  ASSERT_EQ(sendStats.frames, 4u);
+  ASSERT_EQ(sendStats.hits, 1u);
+  ASSERT_EQ(sendStats.bytesSaved, 10000 * sizeof(int64_t) - sizeof(uint64_t));
+  ASSERT_DOUBLE_EQ(sendStats.hitRate(), 0.25);
+
+  auto recvStats = _ep->getDedupRecvCache()->getStats();
+  ASSERT_EQ(recvStats.hits, sendStats.hits);
+  ASSERT_EQ(recvStats.bytesSaved, sendStats.bytesSaved);
+}
+
+TEST_F(DedupTagMultiTest, SendRecvCodec)
+{
+  ucxx::CodecParams codecParams{};
+  codecParams.codec        = ucxx::CodecType::Lz;
+  codecParams.chunkSize    = 16 * 1024;
+  codecParams.minFrameSize = 1024;
+
+  // Stored frames are encoded, references are not
+  std::vector<std::vector<int64_t>> send{frameData(10000, 0), frameData(10000, 0)};
+  ASSERT_THAT(transfer(send, codecParams), ContainerEq(send));
+  ASSERT_THAT(transfer(send, codecParams), ContainerEq(send));
+
+  auto stats = _ep->getDedupRecvCache()->getStats();
+  ASSERT_EQ(stats.frames, 4u);
+  ASSERT_EQ(stats.hits, 2u);
+}
+
+TEST_F(DedupTagMultiTest, RecvWithoutDedup)
+{
+  // Tag receives match on the worker, the endpoint they are posted on has no cache
+  auto ep = _worker->createEndpointFromWorkerAddress(_worker->getAddress());
+
+  std::vector<std::vector<int64_t>> send{frameData(10000, 0)};
+  std::vector<std::shared_ptr<ucxx::RequestTagMulti>> requests;
+  requests.push_back(_ep->tagMultiSend(
+    {send[0].data()}, {send[0].size() * sizeof(int64_t)}, {0}, 0, false));
+  requests.push_back(ep->tagMultiRecv(0, false));
+  waitRequestsTagMulti(_worker, requests, getProgressFunction(_worker, ProgressMode::Polling));
+  ASSERT_EQ(requests[1]->getStatus(), UCS_OK);
+
+  // References can't be resolved without a cache
+  requests.clear();
+  requests.push_back(_ep->tagMultiSend(
+    {send[0].data()}, {send[0].size() * sizeof(int64_t)}, {0}, 0, false));
+  requests.push_back(ep->tagMultiRecv(0, false));
+  while (!requests[0]->isCompleted() || !requests[1]->isCompleted())
+    _worker->progress();
+  ASSERT_EQ(requests[1]->getStatus(), UCS_ERR_NO_ELEM);
+}
+
+TEST_F(DedupTagMultiTest, InvalidParams)
+{
+  EXPECT_THROW(_ep->enableDedup(ucxx::DedupParams{.minFrameSize = sizeof(uint64_t)}),
+               ucxx::Error);
+}
+
+}  // namespace
@@ -0,0 +1,115 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <ucxx/api.h>
+
+namespace {
+
+using ::testing::ContainerEq;
+
+class DeltaSyncTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<ucxx::Context> _context{
+    ucxx::createContext({}, ucxx::Context::defaultFeatureFlags)};
+  std::shared_ptr<ucxx::Worker> _worker{nullptr};
+  std::shared_ptr<ucxx::Endpoint> _ep{nullptr};
+  const size_t _blockSize{1024};
+  std::vector<int> _source  = std::vector<int>(64 * 1024);
+  std::vector<int> _replica = std::vector<int>(64 * 1024);
+  std::shared_ptr<ucxx::DeltaSyncSender> _sender{nullptr};
+  std::shared_ptr<ucxx::DeltaSyncReceiver> _receiver{nullptr};
+
+  virtual void SetUp()
+  {
+    _worker = _context->createWorker();
+    _ep     = _worker->createEndpointFromWorkerAddress(_worker->getAddress());
+
+    std::iota(_source.begin(), _source.end(), 0);
+    _sender = ucxx::createDeltaSyncSender(
+      _ep, _source.data(), _source.size() * sizeof(int), _blockSize, 0);
+    _receiver = ucxx::createDeltaSyncReceiver(
+      _ep, _replica.data(), _replica.size() * sizeof(int), _blockSize, 0);
+  }
+
+  ucxx::DeltaSyncStats sync()
+  {
+    _receiver->receive();
+    auto stats = _sender->sync();
+    while (!_receiver->isCompleted() || !_sender->isCompleted())
+      _worker->progress();
+    return stats;
+  }
+};
+
+TEST_F(DeltaSyncTest, FullFirstRound)
+{
+  auto stats = sync();
+
+  ASSERT_EQ(_receiver->getStatus(), UCS_OK);
+  ASSERT_THAT(_replica, ContainerEq(_source));
+  ASSERT_EQ(stats.bytesSent, _source.size() * sizeof(int));
+  ASSERT_EQ(stats.bytesSaved, 0);
+  ASSERT_EQ(stats.extents, 1);
+}
+
+TEST_F(DeltaSyncTest, SparseUpdate)
+{
+  sync();
+
+  _source[0]                  = -1;
+  _source[1]                  = -1;
+  _source[_source.size() / 2] = -1;
+  auto stats = sync();
+
+  ASSERT_EQ(_receiver->getStatus(), UCS_OK);
+  ASSERT_THAT(_replica, ContainerEq(_source));
+  ASSERT_EQ(stats.dirtyBlocks, 2);
+  ASSERT_EQ(stats.extents, 2);
+  ASSERT_EQ(stats.bytesSent, 2 * _blockSize);
+  ASSERT_EQ(stats.bytesSaved, _source.size() * sizeof(int) - 2 * _blockSize);
+
+  auto receiverStats = _receiver->getStats();
+  auto senderStats   = _sender->getStats();
+  ASSERT_EQ(receiverStats.rounds, 2);
+  ASSERT_EQ(receiverStats.bytesSaved, senderStats.bytesSaved);
+}
+
+TEST_F(DeltaSyncTest, Unchanged)
+{
+  sync();
+  auto stats = sync();
+
+  ASSERT_EQ(_receiver->getStatus(), UCS_OK);
+  ASSERT_EQ(stats.dirtyBlocks, 0);
+  ASSERT_EQ(stats.bytesSent, 0);
+  ASSERT_THAT(_replica, ContainerEq(_source));
+}
+
+TEST_F(DeltaSyncTest, RoundInProgress)
+{
+  _receiver->receive();
+  EXPECT_THROW(_receiver->receive(), ucxx::Error);
+}
+
+TEST_F(DeltaSyncTest, DestroyInProgress)
+{
+  _receiver->receive();
+  _receiver.reset();
+
+  _receiver = ucxx::createDeltaSyncReceiver(
+    _ep, _replica.data(), _replica.size() * sizeof(int), _blockSize, 0);
+  sync();
+
+  ASSERT_EQ(_receiver->getStatus(), UCS_OK);
+  ASSERT_THAT(_replica, ContainerEq(_source));
+}
+
+}  // namespace
@@ -2,7 +2,10 @@
  * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
  * SPDX-License-Identifier: BSD-3-Clause
  */
+#include <algorithm>
+#include <functional>
 #include <memory>
+#include <new>
 #include <vector>
 
 #include <gtest/gtest.h>
@@ -56,4 +59,178 @@ TEST_F(EndpointTest, IsAlive)
   ASSERT_FALSE(ep->isAlive());
 }
 
+TEST_F(EndpointTest, CreateNoThrow)
+{
+  auto ep = _worker->createEndpointFromWorkerAddress(std::nothrow, _worker->getAddress());
+  ASSERT_TRUE(ep);
+  ASSERT_EQ(ep.getStatus(), UCS_OK);
+  ASSERT_TRUE(ep.getValue()->getHandle() != nullptr);
+
+  auto invalid = ucxx::createEndpointFromWorkerAddress(std::nothrow, _worker, nullptr, true);
+  ASSERT_FALSE(invalid);
+  ASSERT_EQ(invalid.getStatus(), UCS_ERR_INVALID_ADDR);
+  EXPECT_THROW(invalid.getValue(), ucxx::InvalidAddrError);
+  EXPECT_THROW(_worker->createEndpointFromWorkerAddress(nullptr), ucxx::InvalidAddrError);
+}
+
+TEST_F(EndpointTest, SubmitNoThrow)
+{
+  auto ep = _worker->createEndpointFromWorkerAddress(_worker->getAddress());
+
+  std::vector<int> send{123};
+  std::vector<int> recv(send.size());
+  auto sendRequest = ep->tagSend(std::nothrow, send.data(), send.size() * sizeof(int), 0);
+  auto recvRequest = ep->tagRecv(std::nothrow, recv.data(), recv.size() * sizeof(int), 0);
+  ASSERT_TRUE(sendRequest);
+  ASSERT_TRUE(recvRequest);
+  while (!sendRequest.getValue()->isCompleted() || !recvRequest.getValue()->isCompleted())
+    _worker->progress();
+
+  ASSERT_EQ(sendRequest.getValue()->checkError(std::nothrow), UCS_OK);
+  ASSERT_EQ(recvRequest.getValue()->checkError(std::nothrow), UCS_OK);
+  ASSERT_EQ(recv, send);
+
+  // Submitting on a closed endpoint is reported as a status
+  ep->close();
+  auto closedRequest = ep->tagSend(std::nothrow, send.data(), send.size() * sizeof(int), 0);
+  ASSERT_FALSE(closedRequest);
+  ASSERT_EQ(closedRequest.getStatus(), UCS_ERR_NOT_CONNECTED);
+  EXPECT_THROW(ep->tagSend(send.data(), send.size() * sizeof(int), 0), ucxx::NotConnectedError);
+}
+
+TEST_F(EndpointTest, CheckErrorNoThrow)
+{
+  auto ep = _worker->createEndpointFromWorkerAddress(_worker->getAddress());
+
+  std::vector<int> recv(1);
+  auto request = ep->tagRecv(recv.data(), recv.size() * sizeof(int), 0);
+  ASSERT_EQ(request->checkError(std::nothrow), UCS_OK);
+
+  request->cancel();
+  while (!request->isCompleted())
+    _worker->progress();
+
+  ASSERT_EQ(request->checkError(std::nothrow), UCS_ERR_CANCELED);
+  EXPECT_THROW(request->checkError(), ucxx::CanceledError);
+}
+
+TEST_F(EndpointTest, CallbackStatus)
+{
+  auto ep = _worker->createEndpointFromWorkerAddress(_worker->getAddress());
+
+  std::vector<ucs_status_t> status;
+  auto callback = [&status](ucs_status_t s, std::shared_ptr<void>) { status.push_back(s); };
+
+  // The send completes before the receive is posted, which then completes immediately
+  std::vector<int> send(4, 1);
+  std::vector<int> recv(2);
+  auto sendRequest = ep->tagSend(send.data(), send.size() * sizeof(int), 0, false, callback);
+  while (!sendRequest->isCompleted())
+    _worker->progress();
+  auto recvRequest = ep->tagRecv(recv.data(), recv.size() * sizeof(int), 0, false, callback);
+  while (!recvRequest->isCompleted())
+    _worker->progress();
+
+  // Completion by callback
+  auto canceledRequest = ep->tagRecv(recv.data(), recv.size() * sizeof(int), 1, false, callback);
+  canceledRequest->cancel();
+  while (!canceledRequest->isCompleted())
+    _worker->progress();
+
+  ASSERT_EQ(status.size(), 3);
+  ASSERT_EQ(status[0], UCS_OK);
+  ASSERT_EQ(status[1], UCS_ERR_MESSAGE_TRUNCATED);
+  ASSERT_EQ(status[1], recvRequest->getStatus());
+  ASSERT_EQ(status[2], UCS_ERR_CANCELED);
+  ASSERT_EQ(status[2], canceledRequest->getStatus());
+}
+
+TEST_F(EndpointTest, StatuslessCallback)
+{
+  auto ep = _worker->createEndpointFromWorkerAddress(_worker->getAddress());
+
+  size_t completed = 0;
+  std::function<void(std::shared_ptr<void>)> callback = [&completed](std::shared_ptr<void> data) {
+    ++completed;
+    ASSERT_EQ(data, nullptr);
+  };
+
+  std::vector<int> send(1, 1);
+  std::vector<int> recv(1);
+  std::vector<std::shared_ptr<ucxx::Request>> requests;
+  requests.push_back(ep->tagSend(send.data(), send.size() * sizeof(int), 0, false, callback));
+  requests.push_back(ep->tagRecv(recv.data(), recv.size() * sizeof(int), 0, false, callback));
+  while (!std::all_of(requests.cbegin(), requests.cend(), [](const auto& r) {
+    return r->isCompleted();
+  }))
+    _worker->progress();
+
+  ASSERT_EQ(completed, 2);
+  ASSERT_EQ(recv[0], send[0]);
+
+  // Empty functions are not called
+  auto request = ep->tagSend(send.data(),
+                             send.size() * sizeof(int),
+                             0,
+                             false,
+                             std::function<void(std::shared_ptr<void>)>{});
+  requests.push_back(ep->tagRecv(recv.data(), recv.size() * sizeof(int), 0, false, callback));
+  while (!request->isCompleted() || !requests.back()->isCompleted())
+    _worker->progress();
+  ASSERT_EQ(completed, 3);
+}
+
+TEST_F(EndpointTest, TagSendSync)
+{
+  auto ep = _worker->createEndpointFromWorkerAddress(_worker->getAddress());
+
+  std::vector<int> send{123};
+  std::vector<int> recv(send.size());
+  auto sendRequest = ep->tagSend(send.data(),
+                                 send.size() * sizeof(int),
+                                 0,
+                                 false,
+                                 nullptr,
+                                 nullptr,
+                                 ucxx::TagSendMode::Sync);
+
+  // A synchronous send does not complete before being matched by the receiver
+  for (size_t i = 0; i < 100; ++i)
+    _worker->progress();
+  ASSERT_FALSE(sendRequest->isCompleted());
+
+  auto recvRequest = ep->tagRecv(recv.data(), recv.size() * sizeof(int), 0);
+  while (!sendRequest->isCompleted() || !recvRequest->isCompleted())
+    _worker->progress();
+
+  sendRequest->checkError();
+  recvRequest->checkError();
+  ASSERT_EQ(recv, send);
+}
+
+TEST_F(EndpointTest, TagMultiSendSync)
+{
+  auto ep = _worker->createEndpointFromWorkerAddress(_worker->getAddress());
+
+  std::vector<int> send0{1}, send1{2, 3};
+  auto sendRequest = ep->tagMultiSend({send0.data(), send1.data()},
+                                      {sizeof(int), 2 * sizeof(int)},
+                                      {false, false},
+                                      0,
+                                      false,
+                                      {},
+                                      ucxx::TagSendMode::Sync);
+
+  for (size_t i = 0; i < 100; ++i)
+    _worker->progress();
+  ASSERT_FALSE(sendRequest->isCompleted());
+
+  auto recvRequest = ep->tagMultiRecv(0, false);
+  while (!sendRequest->isCompleted() || !recvRequest->isCompleted())
+    _worker->progress();
+
+  sendRequest->checkError();
+  recvRequest->checkError();
+}
+
 }  // namespace
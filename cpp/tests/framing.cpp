@@ -0,0 +1,205 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ucxx/api.h>
+
+#include "include/utils.h"
+
+namespace {
+
+struct RpcHeader {
+  uint64_t requestId;
+  uint32_t method;
+};
+
+using RpcMessage = ucxx::Frame<RpcHeader, char, float, uint16_t>;
+
+class FramingTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<ucxx::Context> _context{
+    ucxx::createContext({}, ucxx::Context::defaultFeatureFlags)};
+  std::shared_ptr<ucxx::Worker> _worker{nullptr};
+  std::shared_ptr<ucxx::Endpoint> _ep{nullptr};
+  std::function<void()> _progressWorker;
+
+  virtual void SetUp()
+  {
+    _worker         = _context->createWorker();
+    _ep             = _worker->createEndpointFromWorkerAddress(_worker->getAddress());
+    _progressWorker = getProgressFunction(_worker, ProgressMode::Polling);
+  }
+
+  std::vector<uint64_t> receive(ucp_tag_t tag, size_t& length)
+  {
+    // `uint64_t` elements to guarantee the alignment required by `ucxx::Frame::View`
+    std::vector<uint64_t> buffer;
+    auto allocate = [&buffer, &length](size_t messageLength) {
+      length = messageLength;
+      buffer.resize((length + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+      return static_cast<void*>(buffer.data());
+    };
+
+    std::shared_ptr<ucxx::Request> request;
+    while (!(request = _worker->tagProbeRecv(tag, allocate)))
+      _progressWorker();
+    std::vector<std::shared_ptr<ucxx::Request>> requests{request};
+    waitRequests(_worker, requests, _progressWorker);
+    return buffer;
+  }
+};
+
+TEST_F(FramingTest, TagSendIov)
+{
+  std::vector<int> first{1, 2, 3}, second{4, 5};
+  std::vector<int> recv(first.size() + second.size());
+
+  std::vector<std::shared_ptr<ucxx::Request>> requests;
+  requests.push_back(_ep->tagRecv(recv.data(), recv.size() * sizeof(int), 0));
+  requests.push_back(_ep->tagSendIov(
+    {{first.data(), first.size() * sizeof(int)}, {second.data(), second.size() * sizeof(int)}},
+    0));
+  waitRequests(_worker, requests, _progressWorker);
+
+  ASSERT_EQ(recv, std::vector<int>({1, 2, 3, 4, 5}));
+  EXPECT_THROW(_ep->tagSendIov({}, 0), ucxx::Error);
+}
+
+TEST_F(FramingTest, TagProbeLength)
+{
+  std::vector<char> send(123);
+  auto request = _ep->tagSend(send.data(), send.size(), 0);
+
+  size_t length = 0;
+  while (!_worker->tagProbe(0, length))
+    _progressWorker();
+  ASSERT_EQ(length, send.size());
+
+  // The message remains uncaught after probing
+  std::vector<char> recv(length);
+  std::vector<std::shared_ptr<ucxx::Request>> requests{
+    request, _worker->tagRecv(recv.data(), recv.size(), 0)};
+  waitRequests(_worker, requests, _progressWorker);
+}
+
+TEST_F(FramingTest, TagProbeRecv)
+{
+  std::vector<char> send(123), other(45);
+  std::vector<std::shared_ptr<ucxx::Request>> requests{_ep->tagSend(send.data(), send.size(), 0)};
+
+  std::vector<char> recv;
+  auto allocate = [&recv](size_t length) {
+    recv.resize(length);
+    return static_cast<void*>(recv.data());
+  };
+  std::shared_ptr<ucxx::Request> request;
+  while (!(request = _worker->tagProbeRecv(0, allocate)))
+    _progressWorker();
+  ASSERT_EQ(recv.size(), send.size());
+
+  // The probed message is removed from the worker, a later message is not matched by it
+  ASSERT_FALSE(_worker->tagProbe(0));
+  requests.push_back(request);
+  requests.push_back(_ep->tagSend(other.data(), other.size(), 0));
+  std::vector<char> recvOther(other.size());
+  requests.push_back(_worker->tagRecv(recvOther.data(), recvOther.size(), 0));
+  waitRequests(_worker, requests, _progressWorker);
+
+  ASSERT_EQ(_worker->tagProbeRecv(0, allocate), nullptr);
+}
+
+TEST_F(FramingTest, SendRecv)
+{
+  const std::string key = "some-key";
+  const std::vector<float> values{1.0f, 2.0f, 3.0f};
+  const std::vector<uint16_t> empty{};
+
+  auto request = RpcMessage::tagSend(_ep,
+                                     {42, 7},
+                                     {key.data(), key.size()},
+                                     {values.data(), values.size()},
+                                     {empty.data(), empty.size()},
+                                     0);
+
+  size_t length = 0;
+  auto buffer   = receive(0, length);
+  std::vector<std::shared_ptr<ucxx::Request>> requests{request};
+  waitRequests(_worker, requests, _progressWorker);
+
+  ASSERT_EQ(length,
+            RpcMessage::getSize({key.data(), key.size()},
+                                {values.data(), values.size()},
+                                {empty.data(), empty.size()}));
+
+  auto view = RpcMessage::View(buffer.data(), length);
+  ASSERT_EQ(view.getFixed().requestId, 42);
+  ASSERT_EQ(view.getFixed().method, 7);
+
+  auto recvKey = view.get<0>();
+  ASSERT_EQ(std::string(recvKey.data, recvKey.size), key);
+
+  // Fields point into the receive buffer
+  auto recvValues = view.get<1>();
+  auto begin      = reinterpret_cast<const char*>(buffer.data());
+  ASSERT_GE(reinterpret_cast<const char*>(recvValues.data), begin);
+  ASSERT_LT(reinterpret_cast<const char*>(recvValues.data), begin + length);
+  ASSERT_EQ(reinterpret_cast<uintptr_t>(recvValues.data) % ucxx::FrameAlignment, 0);
+  ASSERT_EQ(std::vector<float>(recvValues.data, recvValues.data + recvValues.size), values);
+
+  ASSERT_EQ(view.get<2>().size, 0);
+}
+
+TEST_F(FramingTest, FixedOnly)
+{
+  using FixedMessage = ucxx::Frame<RpcHeader>;
+
+  auto request = FixedMessage::tagSend(_ep, {1, 2}, 0);
+
+  size_t length = 0;
+  auto buffer   = receive(0, length);
+  std::vector<std::shared_ptr<ucxx::Request>> requests{request};
+  waitRequests(_worker, requests, _progressWorker);
+
+  ASSERT_EQ(length, FixedMessage::getSize());
+  auto view = FixedMessage::View(buffer.data(), length);
+  ASSERT_EQ(view.getFixed().requestId, 1);
+  ASSERT_EQ(view.getFixed().method, 2);
+}
+
+TEST_F(FramingTest, InvalidView)
+{
+  const std::string key = "key";
+  const std::vector<float> values{1.0f};
+  const std::vector<uint16_t> empty{};
+
+  auto request = RpcMessage::tagSend(_ep,
+                                     {0, 0},
+                                     {key.data(), key.size()},
+                                     {values.data(), values.size()},
+                                     {empty.data(), empty.size()},
+                                     0);
+
+  size_t length = 0;
+  auto buffer   = receive(0, length);
+  std::vector<std::shared_ptr<ucxx::Request>> requests{request};
+  waitRequests(_worker, requests, _progressWorker);
+
+  auto data = reinterpret_cast<char*>(buffer.data());
+  EXPECT_NO_THROW(RpcMessage::View(data, length));
+  EXPECT_THROW(RpcMessage::View(data, 1), ucxx::Error);
+  EXPECT_THROW(RpcMessage::View(data, length - 1), ucxx::Error);
+  EXPECT_THROW(RpcMessage::View(data + 1, length - 1), ucxx::Error);
+
+  // Element count larger than the message
+  buffer[2] = UINT64_MAX;
+  EXPECT_THROW(RpcMessage::View(data, length), ucxx::Error);
+}
+
+}  // namespace
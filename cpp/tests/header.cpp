@@ -27,8 +27,70 @@ TEST(HeaderTest, DataSize)
 
   const size_t ExpectedDataSize =
     sizeof(header.next) + sizeof(header.nframes) + (sizeof(header.isCUDA) + sizeof(header.size));
+  const size_t ExpectedExtensionDataSize = sizeof(ucxx::HeaderExtensionVersion) +
+                                           sizeof(header.codec) + sizeof(header.chunkSize) +
+                                           sizeof(header.dedup) + sizeof(header.dedupEpoch);
 
   ASSERT_EQ(header.dataSize(), ExpectedDataSize);
+  ASSERT_EQ(header.extensionDataSize(), ExpectedExtensionDataSize);
+  ASSERT_EQ(header.serialize().size(), ExpectedDataSize);
+}
+
+TEST(HeaderTest, Extension)
+{
+  const bool next         = true;
+  const size_t framesSize = 3;
+  std::vector<int> isCUDA{0, 0, 1};
+  std::vector<size_t> size{1, 2, 3};
+  std::vector<int> codec{static_cast<int>(ucxx::CodecType::Raw),
+                         static_cast<int>(ucxx::CodecType::Lz),
+                         static_cast<int>(ucxx::CodecType::Raw)};
+  std::vector<int> dedup{static_cast<int>(ucxx::DedupAction::Store),
+                         static_cast<int>(ucxx::DedupAction::None),
+                         static_cast<int>(ucxx::DedupAction::None)};
+
+  const ucxx::Header header(
+    next, framesSize, isCUDA.data(), size.data(), codec.data(), 1024, dedup.data(), 3);
+  ASSERT_TRUE(header.extended);
+  ASSERT_TRUE(header.isValid());
+
+  auto deserialized = ucxx::Header(header.serialize());
+  ASSERT_EQ(deserialized.next, header.next);
+  ASSERT_TRUE(deserialized.extended);
+  ASSERT_EQ(deserialized.codec[1], static_cast<int>(ucxx::CodecType::Raw));
+
+  auto serializedExtension = header.serializeExtension();
+  ASSERT_EQ(serializedExtension.size(), ucxx::Header::extensionDataSize());
+  ASSERT_TRUE(deserialized.deserializeExtension(serializedExtension));
+  ASSERT_THAT(deserialized.codec, ContainerEq(header.codec));
+  ASSERT_EQ(deserialized.chunkSize, header.chunkSize);
+  ASSERT_THAT(deserialized.dedup, ContainerEq(header.dedup));
+  ASSERT_EQ(deserialized.dedupEpoch, header.dedupEpoch);
+  ASSERT_TRUE(deserialized.isValid());
+
+  // Unknown versions are rejected
+  serializedExtension[0] = static_cast<char>(ucxx::HeaderExtensionVersion + 1);
+  ASSERT_FALSE(deserialized.deserializeExtension(serializedExtension));
+}
+
+TEST(HeaderTest, Invalid)
+{
+  std::vector<int> isCUDA{0};
+  std::vector<size_t> size{1};
+
+  std::vector<int> codec{static_cast<int>(ucxx::CodecType::Lz)};
+  ASSERT_FALSE(ucxx::Header(false, 1, isCUDA.data(), size.data(), codec.data(), 0).isValid());
+
+  codec[0] = static_cast<int>(ucxx::CodecType::Invalid);
+  ASSERT_FALSE(ucxx::Header(false, 1, isCUDA.data(), size.data(), codec.data(), 1).isValid());
+
+  std::vector<int> dedup{-1};
+  ASSERT_FALSE(
+    ucxx::Header(false, 1, isCUDA.data(), size.data(), nullptr, 0, dedup.data()).isValid());
+
+  auto header    = ucxx::Header(false, 1, isCUDA.data(), size.data());
+  header.nframes = ucxx::HeaderFramesSize + 1;
+  ASSERT_FALSE(header.isValid());
 }
 
 TEST(HeaderTest, PointerConstructor)
@@ -0,0 +1,205 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <ucxx/api.h>
+
+namespace {
+
+using ::testing::ContainerEq;
+
+class ProgressiveTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<ucxx::Context> _context{
+    ucxx::createContext({}, ucxx::Context::defaultFeatureFlags)};
+  std::shared_ptr<ucxx::Worker> _worker{nullptr};
+  std::shared_ptr<ucxx::Endpoint> _ep{nullptr};
+  std::vector<int> _send{std::vector<int>(10000)};
+  const size_t _chunkSize{4096};
+
+  virtual void SetUp()
+  {
+    _worker = _context->createWorker();
+    _ep     = _worker->createEndpointFromWorkerAddress(_worker->getAddress());
+    std::iota(_send.begin(), _send.end(), 0);
+  }
+
+  size_t getSize() const { return _send.size() * sizeof(int); }
+
+  void wait(std::shared_ptr<ucxx::ProgressiveSender> sender,
+            std::shared_ptr<ucxx::ProgressiveReceiver> receiver)
+  {
+    while (!sender->isCompleted() || !receiver->isCompleted())
+      _worker->progress();
+  }
+};
+
+TEST_F(ProgressiveTest, PublishInOrder)
+{
+  std::vector<int> recv(_send.size());
+  auto receiver =
+    ucxx::createProgressiveReceiver(_ep, recv.data(), recv.size() * sizeof(int), 0);
+  auto sender = ucxx::createProgressiveSender(_ep, _send.data(), getSize(), 0, _chunkSize);
+  ASSERT_EQ(sender->getNumChunks(), 10);
+
+  // Publish in ranges not aligned to chunks, progressing in between
+  for (size_t offset = 0; offset < getSize(); offset += 1000) {
+    sender->publish(offset, std::min<size_t>(1000, getSize() - offset));
+    _worker->progress();
+  }
+  wait(sender, receiver);
+
+  ASSERT_EQ(sender->getStatus(), UCS_OK);
+  ASSERT_EQ(sender->getSentChunks(), 10);
+  ASSERT_EQ(receiver->getStatus(), UCS_OK);
+  ASSERT_EQ(receiver->getSize(), getSize());
+  ASSERT_EQ(receiver->getReceivedChunks(), 10);
+  ASSERT_THAT(recv, ContainerEq(_send));
+}
+
+TEST_F(ProgressiveTest, PublishOutOfOrder)
+{
+  std::vector<int> recv(_send.size());
+  auto receiver =
+    ucxx::createProgressiveReceiver(_ep, recv.data(), recv.size() * sizeof(int), 0);
+  auto sender = ucxx::createProgressiveSender(_ep, _send.data(), getSize(), 0, _chunkSize);
+
+  // Nothing is sent before the first chunk is complete
+  sender->publish(_chunkSize, getSize() - _chunkSize);
+  while (!receiver->isReady())
+    _worker->progress();
+  for (size_t i = 0; i < 10; ++i)
+    _worker->progress();
+  ASSERT_EQ(sender->getSentChunks(), 0);
+  ASSERT_FALSE(sender->isCompleted());
+  ASSERT_EQ(receiver->getReceivedChunks(), 0);
+
+  sender->publish(0, _chunkSize);
+  wait(sender, receiver);
+
+  ASSERT_EQ(receiver->getStatus(), UCS_OK);
+  ASSERT_THAT(recv, ContainerEq(_send));
+}
+
+TEST_F(ProgressiveTest, PublishInvalidRange)
+{
+  auto receiver = ucxx::createProgressiveReceiver(_ep, nullptr, 0, 0);
+  auto sender   = ucxx::createProgressiveSender(_ep, _send.data(), getSize(), 0, _chunkSize);
+
+  EXPECT_THROW(sender->publish(getSize(), 1), ucxx::Error);
+  sender->publish(0, 100);
+  EXPECT_THROW(sender->publish(50, 100), ucxx::Error);
+
+  // A rejected range is not published, its non-overlapping part may still be
+  sender->publish(100, getSize() - 100);
+  wait(sender, receiver);
+  ASSERT_EQ(receiver->getStatus(), UCS_OK);
+}
+
+TEST_F(ProgressiveTest, ChunkCallback)
+{
+  std::vector<int> recv(_send.size());
+  std::vector<std::pair<size_t, size_t>> chunks;
+  auto receiver = ucxx::createProgressiveReceiver(
+    _ep, recv.data(), recv.size() * sizeof(int), 0, [&chunks](size_t offset, size_t length) {
+      chunks.push_back({offset, length});
+    });
+  auto sender = ucxx::createProgressiveSender(_ep, _send.data(), getSize(), 0, _chunkSize);
+  sender->publish(0, getSize());
+  wait(sender, receiver);
+
+  ASSERT_EQ(receiver->getStatus(), UCS_OK);
+  ASSERT_EQ(chunks.size(), receiver->getNumChunks());
+  std::sort(chunks.begin(), chunks.end());
+  size_t offset = 0;
+  for (const auto& chunk : chunks) {
+    ASSERT_EQ(chunk.first, offset);
+    offset += chunk.second;
+  }
+  ASSERT_EQ(offset, getSize());
+}
+
+TEST_F(ProgressiveTest, Allocate)
+{
+  auto receiver = ucxx::createProgressiveReceiver(_ep, nullptr, 0, 0);
+  EXPECT_THROW(receiver->getBuffer(), ucxx::Error);
+
+  auto sender = ucxx::createProgressiveSender(_ep, _send.data(), getSize(), 0);
+  ASSERT_EQ(sender->getNumChunks(), 1);
+  sender->publish(0, getSize());
+  wait(sender, receiver);
+
+  ASSERT_EQ(receiver->getStatus(), UCS_OK);
+  ASSERT_EQ(receiver->getSize(), getSize());
+  auto data = reinterpret_cast<int*>(receiver->getBuffer());
+  std::vector<int> recv(data, data + receiver->getSize() / sizeof(int));
+  ASSERT_THAT(recv, ContainerEq(_send));
+}
+
+TEST_F(ProgressiveTest, Empty)
+{
+  auto receiver = ucxx::createProgressiveReceiver(_ep, nullptr, 0, 0);
+  auto sender   = ucxx::createProgressiveSender(_ep, nullptr, 0, 0);
+  wait(sender, receiver);
+
+  ASSERT_EQ(sender->getStatus(), UCS_OK);
+  ASSERT_EQ(receiver->getStatus(), UCS_OK);
+  ASSERT_EQ(receiver->getSize(), 0);
+  ASSERT_EQ(receiver->getNumChunks(), 0);
+}
+
+TEST_F(ProgressiveTest, Truncated)
+{
+  std::vector<int> recv(_send.size() / 2);
+  auto receiver =
+    ucxx::createProgressiveReceiver(_ep, recv.data(), recv.size() * sizeof(int), 0);
+  auto sender = ucxx::createProgressiveSender(_ep, _send.data(), getSize(), 0, _chunkSize);
+  sender->publish(0, getSize());
+
+  while (!receiver->isCompleted())
+    _worker->progress();
+  ASSERT_EQ(receiver->getStatus(), UCS_ERR_MESSAGE_TRUNCATED);
+  EXPECT_THROW(receiver->checkError(), ucxx::Error);
+  while (!sender->isCompleted())
+    _worker->progress();
+
+  // All chunks were consumed, the next transfer with the same tag is unaffected
+  std::vector<int> next(_send.size());
+  receiver = ucxx::createProgressiveReceiver(_ep, next.data(), next.size() * sizeof(int), 0);
+  sender   = ucxx::createProgressiveSender(_ep, _send.data(), getSize(), 0, _chunkSize);
+  sender->publish(0, getSize());
+  wait(sender, receiver);
+  ASSERT_EQ(receiver->getStatus(), UCS_OK);
+  ASSERT_THAT(next, ContainerEq(_send));
+}
+
+TEST_F(ProgressiveTest, AllocationFailure)
+{
+  auto receiver = ucxx::createProgressiveReceiver(_ep, nullptr, 0, 0);
+
+  // A forged header announcing a single chunk too large to be allocated
+  uint64_t header[3] = {0x75637878'70726f67ull, uint64_t{1} << 62, uint64_t{1} << 62};
+  auto headerRequest = _ep->tagSend(header, sizeof(header), 0);
+  while (!receiver->isReady())
+    _worker->progress();
+
+  int chunk         = 0;
+  auto chunkRequest = _ep->tagSend(&chunk, sizeof(chunk), 0);
+  while (!receiver->isCompleted() || !headerRequest->isCompleted() ||
+         !chunkRequest->isCompleted())
+    _worker->progress();
+
+  ASSERT_EQ(receiver->getStatus(), UCS_ERR_NO_MEMORY);
+  EXPECT_THROW(receiver->checkError(), ucxx::Error);
+}
+
+}  // namespace
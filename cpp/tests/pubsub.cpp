@@ -0,0 +1,215 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <ucxx/api.h>
+
+namespace {
+
+using ::testing::ContainerEq;
+
+class PubSubTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<ucxx::Context> _context{
+    ucxx::createContext({}, ucxx::Context::defaultFeatureFlags)};
+  std::shared_ptr<ucxx::Worker> _worker{nullptr};
+  std::shared_ptr<ucxx::Endpoint> _ep{nullptr};
+  std::vector<std::vector<int>> _received{};
+  const ucp_tag_t _topic{0x1234};
+
+  virtual void SetUp()
+  {
+    _worker = _context->createWorker();
+    _ep     = _worker->createEndpointFromWorkerAddress(_worker->getAddress());
+  }
+
+  std::shared_ptr<ucxx::Subscription> subscribe()
+  {
+    return ucxx::createSubscription(
+      _worker, _topic, [this](std::shared_ptr<ucxx::Buffer> payload) {
+        auto data = reinterpret_cast<int*>(payload->data());
+        _received.push_back(std::vector<int>(data, data + payload->getSize() / sizeof(int)));
+      });
+  }
+};
+
+TEST_F(PubSubTest, NoSubscribers)
+{
+  auto publisher = ucxx::createPublisher(_worker, 8, ucxx::SlowSubscriberPolicy::Skip);
+
+  bool released = false;
+  auto release  = [&released](ucs_status_t, std::shared_ptr<void>) { released = true; };
+  std::vector<int> data(16, 1);
+  auto publication = publisher->publish(_topic, data.data(), data.size() * sizeof(int), release);
+
+  ASSERT_TRUE(publication->isCompleted());
+  ASSERT_TRUE(released);
+  ASSERT_EQ(publication->getFanout(), 0);
+}
+
+TEST_F(PubSubTest, PublishReceive)
+{
+  auto publisher    = ucxx::createPublisher(_worker, 8, ucxx::SlowSubscriberPolicy::Skip);
+  auto subscription = subscribe();
+  publisher->subscribe(_topic, _ep);
+
+  std::vector<std::vector<int>> sent{std::vector<int>(16), std::vector<int>(1024)};
+  std::vector<std::shared_ptr<ucxx::Publication>> publications;
+  size_t released = 0;
+  auto release    = [&released](ucs_status_t, std::shared_ptr<void>) { ++released; };
+  for (auto& data : sent) {
+    std::iota(data.begin(), data.end(), data.size());
+    publications.push_back(
+      publisher->publish(_topic, data.data(), data.size() * sizeof(int), release));
+  }
+
+  while (subscription->getReceivedCount() < sent.size() || released < sent.size())
+    _worker->progress();
+
+  for (const auto& publication : publications) {
+    ASSERT_TRUE(publication->isCompleted());
+    ASSERT_EQ(publication->getFanout(), 1);
+  }
+  ASSERT_THAT(_received, ContainerEq(sent));
+
+  ASSERT_TRUE(publisher->unsubscribe(_topic, _ep));
+  ASSERT_EQ(publisher->getSubscriberCount(_topic), 0);
+}
+
+TEST_F(PubSubTest, SkipSlowSubscriber)
+{
+  auto publisher    = ucxx::createPublisher(_worker, 1, ucxx::SlowSubscriberPolicy::Skip);
+  auto subscription = subscribe();
+  publisher->subscribe(_topic, _ep);
+
+  // Large enough to be sent with rendezvous, not completing until the worker progresses
+  std::vector<std::vector<int>> sent{
+    std::vector<int>(1 << 20, 1), std::vector<int>(1 << 20, 2), std::vector<int>(16, 3)};
+  auto first  = publisher->publish(_topic, sent[0].data(), sent[0].size() * sizeof(int));
+  auto second = publisher->publish(_topic, sent[1].data(), sent[1].size() * sizeof(int));
+  ASSERT_EQ(first->getFanout(), 1);
+  ASSERT_EQ(second->getFanout(), 0);
+  ASSERT_EQ(second->getSkipped(), 1);
+  ASSERT_EQ(second->getStatus(), UCS_OK);
+  ASSERT_EQ(publisher->getSubscriberCount(_topic), 1);
+
+  while (subscription->getReceivedCount() < 1 || !first->isCompleted())
+    _worker->progress();
+
+  // The subscriber caught up and receives publications again
+  auto third = publisher->publish(_topic, sent[2].data(), sent[2].size() * sizeof(int));
+  ASSERT_EQ(third->getFanout(), 1);
+  while (subscription->getReceivedCount() < 2 || !third->isCompleted())
+    _worker->progress();
+
+  ASSERT_EQ(first->getStatus(), UCS_OK);
+  ASSERT_EQ(third->getStatus(), UCS_OK);
+  ASSERT_THAT(_received, ContainerEq(std::vector<std::vector<int>>{sent[0], sent[2]}));
+}
+
+TEST_F(PubSubTest, DropSlowSubscriber)
+{
+  auto publisher    = ucxx::createPublisher(_worker, 1, ucxx::SlowSubscriberPolicy::Drop);
+  auto subscription = subscribe();
+  publisher->subscribe(_topic, _ep);
+
+  std::vector<std::vector<int>> sent{
+    std::vector<int>(1 << 20, 1), std::vector<int>(1 << 20, 2), std::vector<int>(16, 3)};
+  auto first  = publisher->publish(_topic, sent[0].data(), sent[0].size() * sizeof(int));
+  auto second = publisher->publish(_topic, sent[1].data(), sent[1].size() * sizeof(int));
+  ASSERT_EQ(second->getFanout(), 0);
+  ASSERT_EQ(second->getSkipped(), 1);
+  ASSERT_EQ(publisher->getSubscriberCount(_topic), 0);
+
+  while (subscription->getReceivedCount() < 1 || !first->isCompleted())
+    _worker->progress();
+
+  // The subscriber was dropped and doesn't receive publications anymore
+  auto third = publisher->publish(_topic, sent[2].data(), sent[2].size() * sizeof(int));
+  ASSERT_EQ(third->getFanout(), 0);
+  ASSERT_TRUE(third->isCompleted());
+  for (size_t i = 0; i < 10; ++i)
+    _worker->progress();
+
+  ASSERT_THAT(_received, ContainerEq(std::vector<std::vector<int>>{sent[0]}));
+}
+
+TEST_F(PubSubTest, InvalidMessage)
+{
+  auto subscription = subscribe();
+
+  // A message that is not a publication, larger than a header, truncates the receive
+  std::vector<int> invalid(64);
+  auto request = _ep->tagSend(invalid.data(), invalid.size() * sizeof(int), _topic);
+  while (subscription->getStatus() == UCS_OK || !request->isCompleted())
+    _worker->progress();
+
+  ASSERT_EQ(subscription->getStatus(), UCS_ERR_MESSAGE_TRUNCATED);
+  ASSERT_EQ(subscription->getReceivedCount(), 0);
+}
+
+TEST_F(PubSubTest, DuplicateSubscription)
+{
+  auto subscription = subscribe();
+  EXPECT_THROW(subscribe(), ucxx::Error);
+
+  // The topic may be subscribed to again once the subscription is destroyed
+  subscription.reset();
+  subscription = subscribe();
+}
+
+TEST_F(PubSubTest, SecondPublisher)
+{
+  auto subscription = subscribe();
+  auto first        = ucxx::createPublisher(_worker, 8, ucxx::SlowSubscriberPolicy::Skip);
+  auto second       = ucxx::createPublisher(_worker, 8, ucxx::SlowSubscriberPolicy::Skip);
+  first->subscribe(_topic, _ep);
+  second->subscribe(_topic, _ep);
+
+  std::vector<int> data(16);
+  auto publication = first->publish(_topic, data.data(), data.size() * sizeof(int));
+  while (subscription->getReceivedCount() < 1 || !publication->isCompleted())
+    _worker->progress();
+
+  publication = second->publish(_topic, data.data(), data.size() * sizeof(int));
+  while (subscription->getStatus() == UCS_OK)
+    _worker->progress();
+
+  ASSERT_EQ(subscription->getStatus(), UCS_ERR_ALREADY_EXISTS);
+  ASSERT_EQ(subscription->getReceivedCount(), 1);
+  subscription->close();
+  while (!publication->isCompleted())
+    _worker->progress();
+}
+
+TEST_F(PubSubTest, Relay)
+{
+  auto publisher   = ucxx::createPublisher(_worker, 8, ucxx::SlowSubscriberPolicy::Skip);
+  auto relayWorker = _context->createWorker();
+  auto relayEp     = _worker->createEndpointFromWorkerAddress(relayWorker->getAddress());
+  auto relay       = ucxx::createSubscription(relayWorker, _topic, nullptr);
+  relay->addRelay(relayWorker->createEndpointFromWorkerAddress(_worker->getAddress()));
+  auto subscription = subscribe();
+  publisher->subscribe(_topic, relayEp);
+
+  std::vector<int> data(128);
+  std::iota(data.begin(), data.end(), 0);
+  auto publication = publisher->publish(_topic, data.data(), data.size() * sizeof(int));
+
+  while (subscription->getReceivedCount() < 1 || !publication->isCompleted()) {
+    _worker->progress();
+    relayWorker->progress();
+  }
+
+  ASSERT_EQ(relay->getReceivedCount(), 1);
+  ASSERT_THAT(_received, ContainerEq(std::vector<std::vector<int>>{data}));
+}
+
+}  // namespace
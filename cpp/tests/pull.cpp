@@ -0,0 +1,131 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <ucxx/api.h>
+
+namespace {
+
+using ::testing::ContainerEq;
+
+class PullTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<ucxx::Context> _context{
+    ucxx::createContext({}, ucxx::Context::defaultFeatureFlags)};
+  std::shared_ptr<ucxx::Worker> _worker{nullptr};
+  std::shared_ptr<ucxx::Endpoint> _ep{nullptr};
+  std::vector<std::vector<int>> _send{
+    std::vector<int>(100000), std::vector<int>(1000), std::vector<int>()};
+  std::shared_ptr<ucxx::PullSender> _sender{nullptr};
+  std::shared_ptr<ucxx::PullReceiver> _receiver{nullptr};
+
+  virtual void SetUp()
+  {
+    _worker = _context->createWorker();
+    _ep     = _worker->createEndpointFromWorkerAddress(_worker->getAddress());
+
+    std::vector<void*> buffer;
+    std::vector<size_t> size;
+    for (size_t i = 0; i < _send.size(); ++i) {
+      std::iota(_send[i].begin(), _send[i].end(), static_cast<int>(i));
+      buffer.push_back(_send[i].data());
+      size.push_back(_send[i].size() * sizeof(int));
+    }
+
+    _receiver = ucxx::createPullReceiver(_ep, 0, 2, 16 * 1024);
+    _sender   = ucxx::createPullSender(_ep, buffer, size, 0);
+
+    while (!_receiver->isReady())
+      _worker->progress();
+  }
+
+  void release()
+  {
+    auto request = _receiver->release();
+    while (!request->isCompleted() || !_sender->isReleased())
+      _worker->progress();
+  }
+};
+
+TEST_F(PullTest, FetchAll)
+{
+  ASSERT_EQ(_receiver->getStatus(), UCS_OK);
+  ASSERT_EQ(_receiver->getNumFrames(), _send.size());
+
+  std::vector<std::vector<int>> recv;
+  for (size_t i = 0; i < _send.size(); ++i) {
+    ASSERT_EQ(_receiver->getFrameSize(i), _send[i].size() * sizeof(int));
+    recv.push_back(std::vector<int>(_send[i].size()));
+  }
+
+  // Fetched in reverse order, the last (empty) frame having the highest priority
+  for (size_t i = 0; i < _send.size(); ++i)
+    _receiver->fetch(i, recv[i].data(), i);
+  while (!_receiver->isCompleted())
+    _worker->progress();
+
+  ASSERT_EQ(_receiver->getStatus(), UCS_OK);
+  ASSERT_THAT(recv, ContainerEq(_send));
+  ASSERT_FALSE(_sender->isReleased());
+
+  release();
+  ASSERT_EQ(_sender->getStatus(), UCS_OK);
+}
+
+TEST_F(PullTest, FetchSubset)
+{
+  std::vector<int> recv(_send[1].size());
+  _receiver->fetch(1, recv.data());
+  while (!_receiver->isCompleted())
+    _worker->progress();
+
+  ASSERT_EQ(_receiver->getStatus(), UCS_OK);
+  ASSERT_THAT(recv, ContainerEq(_send[1]));
+
+  release();
+  ASSERT_EQ(_sender->getStatus(), UCS_OK);
+  EXPECT_THROW(_receiver->fetch(0, recv.data()), ucxx::Error);
+  EXPECT_THROW(_receiver->release(), ucxx::Error);
+}
+
+TEST_F(PullTest, InvalidFrame)
+{
+  std::vector<int> recv(1);
+  EXPECT_THROW(_receiver->fetch(_send.size(), recv.data()), ucxx::Error);
+  EXPECT_THROW(_receiver->getFrameSize(_send.size()), ucxx::Error);
+  release();
+}
+
+TEST_F(PullTest, DestroyInProgress)
+{
+  std::vector<int> recv(_send[1].size());
+  _receiver->fetch(1, recv.data());
+  while (!_receiver->isCompleted())
+    _worker->progress();
+  ASSERT_EQ(_receiver->getStatus(), UCS_OK);
+  ASSERT_THAT(recv, ContainerEq(_send[1]));
+
+  // Destroying the sender cancels the receive of the release notification, and destroying
+  // a receiver cancels the receive of the descriptor.
+  _sender.reset();
+  auto receiver = ucxx::createPullReceiver(_ep, 1);
+  receiver.reset();
+  _receiver.reset();
+}
+
+TEST_F(PullTest, InvalidParams)
+{
+  EXPECT_THROW(ucxx::createPullReceiver(_ep, 1, 0), ucxx::Error);
+  EXPECT_THROW(ucxx::createPullReceiver(_ep, 1, 1, 0), ucxx::Error);
+  EXPECT_THROW(ucxx::createPullReceiver(_ep, ucxx::PullReleaseTagBit), ucxx::Error);
+  release();
+}
+
+}  // namespace
@@ -0,0 +1,114 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <ucxx/api.h>
+
+namespace {
+
+using ::testing::ContainerEq;
+
+class RemoteObjectCacheTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<ucxx::Context> _context{
+    ucxx::createContext({}, ucxx::Context::defaultFeatureFlags)};
+  std::shared_ptr<ucxx::Worker> _worker{nullptr};
+  std::shared_ptr<ucxx::Endpoint> _ep{nullptr};
+  std::shared_ptr<ucxx::RemoteObjectCache> _cache{nullptr};
+  std::shared_ptr<ucxx::RemoteObjectCacheClient> _client{nullptr};
+
+  virtual void SetUp()
+  {
+    _worker = _context->createWorker();
+    _ep     = _worker->createEndpointFromWorkerAddress(_worker->getAddress());
+    _cache  = ucxx::createRemoteObjectCache(_worker, 16);
+    _client = ucxx::createRemoteObjectCacheClient(_ep, _cache->getDescriptor());
+  }
+
+  std::vector<int> getObject(const std::string& key)
+  {
+    auto object = _client->get(key);
+    if (object == nullptr) return {};
+
+    auto data = reinterpret_cast<int*>(object->data());
+    return std::vector<int>(data, data + object->getSize() / sizeof(int));
+  }
+};
+
+TEST_F(RemoteObjectCacheTest, Miss) { ASSERT_EQ(_client->get("missing"), nullptr); }
+
+TEST_F(RemoteObjectCacheTest, PutGet)
+{
+  std::vector<int> object(1024);
+  std::iota(object.begin(), object.end(), 0);
+
+  _cache->put("object", object.data(), object.size() * sizeof(int));
+
+  ASSERT_THAT(getObject("object"), ContainerEq(object));
+}
+
+TEST_F(RemoteObjectCacheTest, Replace)
+{
+  std::vector<int> first(16, 1);
+  std::vector<int> second(32, 2);
+
+  _cache->put("object", first.data(), first.size() * sizeof(int));
+  ASSERT_THAT(getObject("object"), ContainerEq(first));
+
+  _cache->put("object", second.data(), second.size() * sizeof(int));
+  ASSERT_THAT(getObject("object"), ContainerEq(second));
+}
+
+TEST_F(RemoteObjectCacheTest, Evict)
+{
+  std::vector<int> object(16, 1);
+
+  _cache->put("object", object.data(), object.size() * sizeof(int));
+  ASSERT_TRUE(_cache->evict("object"));
+  ASSERT_FALSE(_cache->evict("object"));
+
+  ASSERT_EQ(_client->get("object"), nullptr);
+}
+
+TEST_F(RemoteObjectCacheTest, BucketCollision)
+{
+  // More keys than buckets, keys sharing a bucket must never return each other's object
+  std::vector<std::vector<int>> objects;
+  for (int i = 0; i < 64; ++i)
+    objects.push_back(std::vector<int>(16, i));
+  for (size_t i = 0; i < objects.size(); ++i)
+    _cache->put("object" + std::to_string(i), objects[i].data(), objects[i].size() * sizeof(int));
+
+  size_t found = 0;
+  for (size_t i = 0; i < objects.size(); ++i) {
+    auto object = getObject("object" + std::to_string(i));
+    if (object.empty()) continue;
+    ASSERT_THAT(object, ContainerEq(objects[i]));
+    ++found;
+  }
+  ASSERT_GT(found, 0);
+  ASSERT_LE(found, 16);
+}
+
+TEST_F(RemoteObjectCacheTest, KeyTooLong)
+{
+  std::vector<int> object(16, 1);
+  const std::string key(ucxx::RemoteObjectCacheMaxKeySize + 1, 'k');
+  EXPECT_THROW(_cache->put(key, object.data(), object.size() * sizeof(int)), ucxx::Error);
+  ASSERT_EQ(_client->get(key), nullptr);
+}
+
+TEST_F(RemoteObjectCacheTest, MalformedDescriptor)
+{
+  EXPECT_THROW(ucxx::createRemoteObjectCacheClient(_ep, "invalid"), ucxx::Error);
+}
+
+}  // namespace
@@ -0,0 +1,156 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ucxx/api.h>
+
+namespace {
+
+const std::chrono::milliseconds timeout{std::chrono::seconds(10)};
+
+ucxx::RouterParams getParams(const std::string& hostId)
+{
+  ucxx::RouterParams params{};
+  params.hostId = hostId;
+  return params;
+}
+
+void transfer(std::vector<ucxx::Router*> routers,
+              std::shared_ptr<ucxx::Endpoint> sendEndpoint,
+              std::shared_ptr<ucxx::Endpoint> recvEndpoint)
+{
+  std::vector<int> send{1, 2, 3};
+  std::vector<int> recv(send.size());
+  auto sendRequest = sendEndpoint->tagSend(send.data(), send.size() * sizeof(int), 0);
+  auto recvRequest = recvEndpoint->tagRecv(recv.data(), recv.size() * sizeof(int), 0);
+  while (!sendRequest->isCompleted() || !recvRequest->isCompleted())
+    for (auto& router : routers)
+      router->progress();
+
+  ASSERT_EQ(sendRequest->getStatus(), UCS_OK);
+  ASSERT_EQ(recvRequest->getStatus(), UCS_OK);
+  ASSERT_EQ(recv, send);
+}
+
+TEST(RouterTest, HostId)
+{
+  ASSERT_FALSE(ucxx::Router::getLocalHostId().empty());
+  ASSERT_EQ(ucxx::Router::getLocalHostId(), ucxx::Router::getLocalHostId());
+
+  ucxx::Router router;
+  ASSERT_EQ(router.getHostId(), ucxx::Router::getLocalHostId());
+  ASSERT_NE(router.getWorker(ucxx::Locality::IntraNode),
+            router.getWorker(ucxx::Locality::InterNode));
+  ASSERT_NE(router.getContext(ucxx::Locality::IntraNode),
+            router.getContext(ucxx::Locality::InterNode));
+}
+
+TEST(RouterTest, Locality)
+{
+  ucxx::Router router(getParams("host-a"));
+  ucxx::Router colocated(getParams("host-a"));
+  ucxx::Router remote(getParams("host-b"));
+
+  ASSERT_EQ(router.getLocality(colocated.getAddress()), ucxx::Locality::IntraNode);
+  ASSERT_EQ(router.getLocality(remote.getAddress()), ucxx::Locality::InterNode);
+
+  auto address = colocated.getAddress();
+  EXPECT_THROW(router.getLocality(address.substr(0, address.size() - 1)), ucxx::Error);
+  EXPECT_THROW(router.getLocality(address + "x"), ucxx::Error);
+  EXPECT_THROW(router.createEndpoint(""), ucxx::Error);
+}
+
+TEST(RouterTest, Transfer)
+{
+  ucxx::Router router(getParams("host-a"));
+  ucxx::Router colocated(getParams("host-a"));
+  ucxx::Router remote(getParams("host-b"));
+
+  auto intraEndpoint = router.createEndpoint(colocated.getAddress());
+  auto intraPeer     = colocated.createEndpoint(router.getAddress());
+  auto interEndpoint = router.createEndpoint(remote.getAddress());
+  auto interPeer     = remote.createEndpoint(router.getAddress());
+
+  ASSERT_EQ(intraEndpoint->getWorker(), router.getWorker(ucxx::Locality::IntraNode));
+  ASSERT_EQ(interEndpoint->getWorker(), router.getWorker(ucxx::Locality::InterNode));
+
+  std::vector<ucxx::Router*> routers{&router, &colocated, &remote};
+  transfer(routers, intraEndpoint, intraPeer);
+  transfer(routers, interEndpoint, interPeer);
+
+  auto stats = router.getStats();
+  ASSERT_EQ(stats.intraNode.endpoints, 1);
+  ASSERT_EQ(stats.intraNode.aliveEndpoints, 1);
+  ASSERT_EQ(stats.interNode.endpoints, 1);
+  ASSERT_EQ(stats.interNode.aliveEndpoints, 1);
+
+  intraEndpoint = nullptr;
+  stats         = router.getStats();
+  ASSERT_EQ(stats.intraNode.endpoints, 1);
+  ASSERT_EQ(stats.intraNode.aliveEndpoints, 0);
+}
+
+TEST(RouterTest, ProgressThreads)
+{
+  ucxx::Router router(getParams("host-a"));
+  ucxx::Router remote(getParams("host-b"));
+  router.startProgressThreads(true);
+  remote.startProgressThreads(true);
+
+  auto endpoint = router.createEndpoint(remote.getAddress());
+  auto peer     = remote.createEndpoint(router.getAddress());
+
+  std::vector<int> send{1, 2, 3};
+  std::vector<int> recv(send.size());
+  auto sendRequest = endpoint->tagSend(send.data(), send.size() * sizeof(int), 0);
+  auto recvRequest = peer->tagRecv(recv.data(), recv.size() * sizeof(int), 0);
+  while (!sendRequest->isCompleted() || !recvRequest->isCompleted())
+    std::this_thread::yield();
+  ASSERT_EQ(recv, send);
+
+  router.stopProgressThreads();
+}
+
+TEST(RouterTest, BootstrapEndpoints)
+{
+  const std::vector<std::string> hostIds{"host-a", "host-a", "host-b"};
+  const size_t worldSize = hostIds.size();
+  ucxx::InProcessBootstrapBackend backend;
+
+  std::vector<std::unique_ptr<ucxx::Router>> routers;
+  for (const auto& hostId : hostIds)
+    routers.push_back(std::make_unique<ucxx::Router>(getParams(hostId)));
+
+  std::vector<std::future<std::vector<std::shared_ptr<ucxx::Endpoint>>>> connected;
+  for (size_t rank = 0; rank < worldSize; ++rank)
+    connected.push_back(std::async(std::launch::async, [&, rank]() {
+      return ucxx::bootstrapRouterEndpoints(*routers[rank], backend, rank, worldSize, timeout);
+    }));
+
+  std::vector<std::vector<std::shared_ptr<ucxx::Endpoint>>> endpoints;
+  for (auto& c : connected)
+    endpoints.push_back(c.get());
+
+  auto stats = routers[0]->getStats();
+  ASSERT_EQ(stats.intraNode.endpoints, 1);
+  ASSERT_EQ(stats.interNode.endpoints, 1);
+  ASSERT_EQ(endpoints[0][1]->getWorker(), routers[0]->getWorker(ucxx::Locality::IntraNode));
+  ASSERT_EQ(endpoints[0][2]->getWorker(), routers[0]->getWorker(ucxx::Locality::InterNode));
+
+  std::vector<ucxx::Router*> routerPointers;
+  for (auto& router : routers)
+    routerPointers.push_back(router.get());
+  transfer(routerPointers, endpoints[0][1], endpoints[1][0]);
+  transfer(routerPointers, endpoints[2][0], endpoints[0][2]);
+}
+
+}  // namespace
@@ -0,0 +1,164 @@
+/**
+ * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ucxx/api.h>
+
+#include "include/utils.h"
+
+namespace {
+
+class TagMultiRecvStreamTest : public ::testing::Test {
+ protected:
+  std::shared_ptr<ucxx::Context> _context{
+    ucxx::createContext({}, ucxx::Context::defaultFeatureFlags)};
+  std::shared_ptr<ucxx::Worker> _worker{nullptr};
+  std::shared_ptr<ucxx::Endpoint> _ep{nullptr};
+  std::function<void()> _progressWorker;
+  std::vector<std::vector<int>> _send{};
+  std::vector<std::shared_ptr<ucxx::RequestTagMulti>> _sendRequests{};
+
+  virtual void SetUp()
+  {
+    _worker         = _context->createWorker();
+    _ep             = _worker->createEndpointFromWorkerAddress(_worker->getAddress());
+    _progressWorker = getProgressFunction(_worker, ProgressMode::Polling);
+  }
+
+  // Send message `index` made of `index + 1` frames, frame `i` holding `i + 1` integers.
+  void sendMessage(const size_t index, const ucp_tag_t tag = 0)
+  {
+    std::vector<void*> buffer;
+    std::vector<size_t> size;
+    for (size_t i = 0; i <= index; ++i) {
+      _send.push_back(std::vector<int>(i + 1, static_cast<int>(index * 100 + i)));
+      buffer.push_back(_send.back().data());
+      size.push_back(_send.back().size() * sizeof(int));
+    }
+    std::vector<int> isCUDA(buffer.size(), 0);
+    _sendRequests.push_back(_ep->tagMultiSend(buffer, size, isCUDA, tag, false));
+  }
+
+  void checkMessage(std::shared_ptr<ucxx::RequestTagMulti> message, const size_t index)
+  {
+    ASSERT_EQ(message->getStatus(), UCS_OK);
+
+    size_t frame = 0;
+    for (const auto& br : message->_bufferRequests) {
+      // br->buffer == nullptr are headers
+      if (br->buffer == nullptr) continue;
+      auto data = reinterpret_cast<int*>(br->buffer->data());
+      std::vector<int> recv(data, data + br->buffer->getSize() / sizeof(int));
+      ASSERT_EQ(recv, std::vector<int>(frame + 1, static_cast<int>(index * 100 + frame)));
+      ++frame;
+    }
+    ASSERT_EQ(frame, index + 1);
+  }
+};
+
+TEST_F(TagMultiRecvStreamTest, Queue)
+{
+  const size_t numMessages = 5;
+  auto stream              = ucxx::createTagMultiRecvStream(_ep, 0);
+  ASSERT_EQ(stream->getEndpoint(), _ep);
+  ASSERT_EQ(stream->getTag(), 0);
+  ASSERT_EQ(stream->pop(), nullptr);
+
+  for (size_t i = 0; i < numMessages; ++i)
+    sendMessage(i);
+
+  while (stream->getReceivedCount() < numMessages)
+    _progressWorker();
+  waitRequestsTagMulti(_worker, _sendRequests, _progressWorker);
+
+  ASSERT_EQ(stream->getQueuedCount(), numMessages);
+  for (size_t i = 0; i < numMessages; ++i)
+    checkMessage(stream->pop(), i);
+  ASSERT_EQ(stream->pop(), nullptr);
+  ASSERT_EQ(stream->getQueuedCount(), 0);
+}
+
+TEST_F(TagMultiRecvStreamTest, Callback)
+{
+  const size_t numMessages = 4;
+  std::mutex mutex;
+  std::vector<std::shared_ptr<ucxx::RequestTagMulti>> received;
+  auto stream =
+    ucxx::createTagMultiRecvStream(_ep, 1, [&](std::shared_ptr<ucxx::RequestTagMulti> message) {
+      std::lock_guard<std::mutex> lock(mutex);
+      received.push_back(message);
+    });
+
+  for (size_t i = 0; i < numMessages; ++i)
+    sendMessage(i, 1);
+
+  while (stream->getReceivedCount() < numMessages)
+    _progressWorker();
+  waitRequestsTagMulti(_worker, _sendRequests, _progressWorker);
+
+  ASSERT_EQ(stream->pop(), nullptr);
+  ASSERT_EQ(received.size(), numMessages);
+  for (size_t i = 0; i < numMessages; ++i)
+    checkMessage(received[i], i);
+}
+
+TEST_F(TagMultiRecvStreamTest, SentBeforeCreation)
+{
+  const size_t numMessages = 3;
+  for (size_t i = 0; i < numMessages; ++i)
+    sendMessage(i);
+  for (size_t i = 0; i < 10; ++i)
+    _progressWorker();
+
+  auto stream = ucxx::createTagMultiRecvStream(_ep, 0);
+  while (stream->getReceivedCount() < numMessages)
+    _progressWorker();
+  waitRequestsTagMulti(_worker, _sendRequests, _progressWorker);
+
+  for (size_t i = 0; i < numMessages; ++i)
+    checkMessage(stream->pop(), i);
+}
+
+TEST_F(TagMultiRecvStreamTest, Close)
+{
+  auto stream = ucxx::createTagMultiRecvStream(_ep, 0);
+  // Waiting without polling requires a worker supporting futures
+  EXPECT_THROW(stream->getFuture(), std::runtime_error);
+  sendMessage(0);
+  while (stream->getReceivedCount() < 1)
+    _progressWorker();
+  waitRequestsTagMulti(_worker, _sendRequests, _progressWorker);
+
+  // Nothing to wait for while a message is queued or once closed
+  ASSERT_EQ(stream->getFuture(), nullptr);
+
+  ASSERT_FALSE(stream->isClosed());
+  stream->close();
+  ASSERT_TRUE(stream->isClosed());
+  ASSERT_EQ(stream->getFuture(), nullptr);
+  for (size_t i = 0; i < 10; ++i)
+    _progressWorker();
+
+  // The pending header receive is canceled and not delivered
+  ASSERT_EQ(stream->getReceivedCount(), 1);
+  checkMessage(stream->pop(), 0);
+  ASSERT_EQ(stream->pop(), nullptr);
+
+  // Messages sent after closing are left for other receives
+  _sendRequests.clear();
+  sendMessage(1);
+  auto recvRequest = _ep->tagMultiRecv(0, false);
+  _sendRequests.push_back(recvRequest);
+  waitRequestsTagMulti(_worker, _sendRequests, _progressWorker);
+  checkMessage(recvRequest, 1);
+  ASSERT_EQ(stream->getReceivedCount(), 1);
+}
+
+}  // namespace
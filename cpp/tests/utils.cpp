@@ -45,7 +45,8 @@ std::function<void()> getProgressFunction(std::shared_ptr<ucxx::Worker> worker,
   else if (progressMode == ProgressMode::Blocking)
     return std::bind(std::mem_fn(&ucxx::Worker::progressWorkerEvent), worker, -1);
   else if (progressMode == ProgressMode::Wait)
-    return std::bind(std::mem_fn(&ucxx::Worker::waitProgress), worker);
+    return std::bind(
+      std::mem_fn(static_cast<bool (ucxx::Worker::*)()>(&ucxx::Worker::waitProgress)), worker);
   else
     return std::function<void()>();
 }
@@ -2,7 +2,16 @@
  * SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
  * SPDX-License-Identifier: BSD-3-Clause
  */
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <future>
 #include <memory>
+#include <numeric>
+#include <string>
+#include <thread>
 #include <tuple>
 #include <vector>
 
@@ -72,6 +81,243 @@ TEST_F(WorkerTest, TagProbe)
   ASSERT_TRUE(_worker->tagProbe(0));
 }
 
+TEST_F(WorkerTest, DrainTagRecv)
+{
+  auto progressWorker = getProgressFunction(_worker, ProgressMode::Polling);
+  auto ep             = _worker->createEndpointFromWorkerAddress(_worker->getAddress());
+
+  // Unexpected messages of different sizes, larger ones using rendezvous protocol
+  const std::vector<size_t> sizes{1, 1000, 1000000, 10, 100000};
+  std::vector<std::vector<char>> buffers;
+  std::vector<std::shared_ptr<ucxx::Request>> requests;
+  for (const auto size : sizes) {
+    buffers.push_back(std::vector<char>(size));
+    requests.push_back(ep->tagSend(buffers.back().data(), size, 0));
+  }
+
+  // Messages may not all have arrived by the time the first drain is attempted
+  _worker->setTeardownParams({.maxInflightReceives = 2});
+  size_t messages = 0, bytes = 0;
+  for (size_t i = 0; i < 100 && messages < sizes.size(); ++i) {
+    progressWorker();
+    auto report = _worker->drainWorkerTagRecv();
+    ASSERT_EQ(report.canceled, 0u);
+    ASSERT_FALSE(report.timedOut);
+    messages += report.messages;
+    bytes += report.bytes;
+  }
+  waitRequests(_worker, requests, progressWorker);
+
+  ASSERT_EQ(messages, sizes.size());
+  ASSERT_EQ(bytes, std::accumulate(sizes.begin(), sizes.end(), size_t{0}));
+  ASSERT_FALSE(_worker->tagProbe(0));
+}
+
+TEST_F(WorkerTest, TeardownReport)
+{
+  auto ep = _worker->createEndpointFromWorkerAddress(_worker->getAddress());
+
+  std::vector<int> buf{123};
+  std::vector<std::shared_ptr<ucxx::Request>> requests;
+  requests.push_back(ep->tagSend(buf.data(), buf.size() * sizeof(int), 0));
+  waitRequests(_worker, requests, getProgressFunction(_worker, ProgressMode::Polling));
+  for (size_t i = 0; i < 10 && !_worker->tagProbe(0); ++i)
+    _worker->progress();
+  ASSERT_TRUE(_worker->tagProbe(0));
+
+  std::vector<ucxx::WorkerDrainReport> reports;
+  _worker->setTeardownParams(
+    {.reportCallback = [&reports](const ucxx::WorkerDrainReport& report) {
+      reports.push_back(report);
+    }});
+
+  requests.clear();
+  ep      = nullptr;
+  _worker = nullptr;
+
+  ASSERT_EQ(reports.size(), 1u);
+  ASSERT_FALSE(reports[0].skipped);
+  ASSERT_EQ(reports[0].messages, 1u);
+  ASSERT_EQ(reports[0].bytes, buf.size() * sizeof(int));
+}
+
+TEST_F(WorkerTest, TeardownSkipDrain)
+{
+  bool skipped = false;
+  _worker->setTeardownParams(
+    {.drainTagRecv   = false,
+     .reportCallback = [&skipped](const ucxx::WorkerDrainReport& report) {
+       skipped = report.skipped;
+     }});
+  _worker = nullptr;
+
+  ASSERT_TRUE(skipped);
+}
+
+TEST_F(WorkerTest, FileIO)
+{
+  char path[] = "/tmp/ucxx_worker_file_io_XXXXXX";
+  int fd      = mkstemp(path);
+  ASSERT_GE(fd, 0);
+  unlink(path);
+
+  std::string send{"ucxx file I/O"};
+  std::string recv(send.size(), '\0');
+  ssize_t written = 0, read = 0;
+
+  // Without an io_uring the I/O executes synchronously
+  _worker->submitFileWrite(
+    fd, send.data(), send.size(), 0, [&written](ssize_t result) { written = result; });
+  ASSERT_EQ(written, static_cast<ssize_t>(send.size()));
+  _worker->submitFileRead(
+    fd, recv.data(), recv.size(), 0, [&read](ssize_t result) { read = result; });
+  ASSERT_EQ(read, static_cast<ssize_t>(recv.size()));
+  ASSERT_EQ(recv, send);
+
+  close(fd);
+}
+
+TEST_F(WorkerTest, IoUringProgressBackend)
+{
+  _worker->initBlockingProgressMode(ucxx::ProgressBackend::IoUring);
+  if (!ucxx::IoUring::isAvailable()) {
+    ASSERT_EQ(_worker->getProgressBackend(), ucxx::ProgressBackend::Epoll);
+    GTEST_SKIP() << "io_uring is not available";
+  }
+  ASSERT_EQ(_worker->getProgressBackend(), ucxx::ProgressBackend::IoUring);
+
+  auto progressWorker = getProgressFunction(_worker, ProgressMode::Blocking);
+  auto ep             = _worker->createEndpointFromWorkerAddress(_worker->getAddress());
+
+  std::vector<int> send{123};
+  std::vector<int> recv(1);
+
+  std::vector<std::shared_ptr<ucxx::Request>> requests;
+  requests.push_back(ep->tagSend(send.data(), send.size() * sizeof(int), 0));
+  requests.push_back(ep->tagRecv(recv.data(), recv.size() * sizeof(int), 0));
+  waitRequests(_worker, requests, progressWorker);
+  ASSERT_EQ(recv[0], send[0]);
+
+  // File I/O completes while progressing the worker
+  char path[] = "/tmp/ucxx_worker_io_uring_XXXXXX";
+  int fd      = mkstemp(path);
+  ASSERT_GE(fd, 0);
+  unlink(path);
+
+  ssize_t written = -1;
+  _worker->submitFileWrite(
+    fd, send.data(), send.size() * sizeof(int), 0, [&written](ssize_t result) {
+      written = result;
+    });
+  while (written < 0)
+    _worker->progressWorkerEvent(1);
+  ASSERT_EQ(written, static_cast<ssize_t>(send.size() * sizeof(int)));
+
+  ssize_t read = -1;
+  _worker->submitFileRead(
+    fd, recv.data(), recv.size() * sizeof(int), 0, [&read](ssize_t result) { read = result; });
+  while (read < 0)
+    _worker->progressWorkerEvent(1);
+  ASSERT_EQ(read, static_cast<ssize_t>(recv.size() * sizeof(int)));
+  ASSERT_EQ(recv[0], send[0]);
+
+  // Operations prepared before the worker is progressed are submitted together
+  std::vector<ssize_t> results(4, -1);
+  for (size_t i = 0; i < results.size(); ++i)
+    _worker->submitFileWrite(fd,
+                             send.data(),
+                             send.size() * sizeof(int),
+                             i * sizeof(int),
+                             [&results, i](ssize_t result) { results[i] = result; });
+  while (std::any_of(results.begin(), results.end(), [](ssize_t r) { return r < 0; }))
+    _worker->progressWorkerEvent(1);
+  for (const auto& result : results)
+    ASSERT_EQ(result, static_cast<ssize_t>(send.size() * sizeof(int)));
+
+  close(fd);
+}
+
+TEST_F(WorkerTest, DelayedSubmissionPolicy)
+{
+  EXPECT_THROW(_worker->setDelayedSubmissionPolicy(ucxx::DelayedSubmissionPolicy::Adaptive),
+               ucxx::Error);
+  ASSERT_EQ(_worker->getDelayedSubmissionStats().direct, 0);
+
+  auto worker = _context->createWorker(true);
+  ASSERT_EQ(worker->getDelayedSubmissionPolicy(), ucxx::DelayedSubmissionPolicy::Always);
+  worker->setDelayedSubmissionPolicy(ucxx::DelayedSubmissionPolicy::Adaptive);
+  ASSERT_EQ(worker->getDelayedSubmissionPolicy(), ucxx::DelayedSubmissionPolicy::Adaptive);
+
+  auto ep = worker->createEndpointFromWorkerAddress(worker->getAddress());
+  std::vector<int> send{123};
+  std::vector<int> recv(1);
+
+  // Uncontended requests are submitted immediately, without a progress thread to submit them
+  std::vector<std::shared_ptr<ucxx::Request>> requests;
+  requests.push_back(ep->tagSend(send.data(), send.size() * sizeof(int), 0));
+  requests.push_back(ep->tagRecv(recv.data(), recv.size() * sizeof(int), 0));
+  waitRequests(worker, requests, getProgressFunction(worker, ProgressMode::Polling));
+  ASSERT_EQ(recv[0], send[0]);
+
+  auto stats = worker->getDelayedSubmissionStats();
+  ASSERT_EQ(stats.direct, 2);
+  ASSERT_EQ(stats.delayed, 0);
+
+  worker->setDelayedSubmissionPolicy(ucxx::DelayedSubmissionPolicy::Always);
+  worker->startProgressThread(true);
+  requests.clear();
+  requests.push_back(ep->tagSend(send.data(), send.size() * sizeof(int), 1));
+  requests.push_back(ep->tagRecv(recv.data(), recv.size() * sizeof(int), 1));
+  waitRequests(worker, requests, getProgressFunction(worker, ProgressMode::ThreadPolling));
+  worker->stopProgressThread();
+
+  stats = worker->getDelayedSubmissionStats();
+  ASSERT_EQ(stats.direct, 2);
+  ASSERT_EQ(stats.delayed, 2);
+}
+
+TEST_F(WorkerTest, InflightRequestsReport)
+{
+  auto ep = _worker->createEndpointFromWorkerAddress(_worker->getAddress());
+  ASSERT_TRUE(_worker->getInflightRequestsInfo().empty());
+
+  // Receives that are never matched remain inflight
+  std::vector<int> recv(2);
+  std::vector<std::shared_ptr<ucxx::Request>> requests;
+  requests.push_back(ep->tagRecv(&recv[0], sizeof(int), 0x2a));
+  requests.push_back(_worker->tagRecv(&recv[1], sizeof(int), 0x2b));
+
+  auto info = _worker->getInflightRequestsInfo();
+  ASSERT_EQ(info.size(), 2);
+  ASSERT_EQ(info[0].request, requests[0].get());
+  ASSERT_EQ(info[0].operationName, "tagRecv");
+  ASSERT_EQ(info[0].ownerString, requests[0]->getOwnerString());
+  ASSERT_EQ(info[0].tag, 0x2a);
+  ASSERT_EQ(info[0].length, sizeof(int));
+  ASSERT_EQ(info[1].request, requests[1].get());
+  ASSERT_LE(info[0].submitTime, info[1].submitTime);
+  ASSERT_EQ(_worker->getInflightRequestsInfo(1).size(), 1);
+  ASSERT_TRUE(_worker->getInflightRequestsInfo(0, std::chrono::hours(1)).empty());
+
+  auto report = _worker->getInflightRequestsReport();
+  ASSERT_NE(report.find("2 inflight requests"), std::string::npos);
+  ASSERT_NE(report.find(requests[0]->getOwnerString() + ", tag 0x2a: 1 requests (tagRecv)"),
+            std::string::npos);
+  ASSERT_NE(report.find(requests[1]->getOwnerString() + ", tag 0x2b"), std::string::npos);
+
+  EXPECT_THROW(_worker->startInflightRequestsWatchdog(std::chrono::milliseconds(0)), ucxx::Error);
+  _worker->startInflightRequestsWatchdog(std::chrono::milliseconds(1));
+  EXPECT_THROW(_worker->startInflightRequestsWatchdog(std::chrono::milliseconds(1)), ucxx::Error);
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  _worker->stopInflightRequestsWatchdog();
+  _worker->stopInflightRequestsWatchdog();
+
+  for (auto& request : requests)
+    request->cancel();
+  waitRequests(_worker, requests, getProgressFunction(_worker, ProgressMode::Polling));
+  ASSERT_TRUE(_worker->getInflightRequestsInfo().empty());
+}
+
 TEST_P(WorkerProgressTest, ProgressStream)
 {
   auto ep = _worker->createEndpointFromWorkerAddress(_worker->getAddress());
@@ -102,6 +348,29 @@ TEST_P(WorkerProgressTest, ProgressTag)
   ASSERT_EQ(recv[0], send[0]);
 }
 
+TEST_P(WorkerProgressTest, EndpointAsync)
+{
+  auto ep = _worker->createEndpointFromWorkerAddressAsync(_worker->getAddress()).get();
+  ASSERT_TRUE(ep->getHandle() != nullptr);
+
+  std::vector<int> send{123};
+  std::vector<int> recv(1);
+
+  std::vector<std::shared_ptr<ucxx::Request>> requests;
+  requests.push_back(ep->tagSend(send.data(), send.size() * sizeof(int), 0));
+  requests.push_back(ep->tagRecv(recv.data(), recv.size() * sizeof(int), 0));
+  waitRequests(_worker, requests, _progressWorker);
+
+  ASSERT_EQ(recv[0], send[0]);
+
+  // Closing completes from the request callback, the worker must be progressed meanwhile
+  auto closed = ep->closeAsync();
+  while (closed.wait_for(std::chrono::milliseconds(0)) != std::future_status::ready)
+    _progressWorker();
+  closed.get();
+  ASSERT_TRUE(ep->getHandle() == nullptr);
+}
+
 TEST_P(WorkerProgressTest, ProgressTagMulti)
 {
   if (_progressMode == ProgressMode::Wait) {
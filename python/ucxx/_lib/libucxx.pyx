@@ -204,6 +204,19 @@ class Feature(enum.Enum):
     AM = UCP_FEATURE_AM
 
 
+class ContextProfile(enum.Enum):
+    Full = UcxxContextProfileFull
+    TagOnly = UcxxContextProfileTagOnly
+    StreamOnly = UcxxContextProfileStreamOnly
+    Rma = UcxxContextProfileRma
+    PollingOnly = UcxxContextProfilePollingOnly
+
+
+class DelayedSubmissionPolicy(enum.Enum):
+    Always = UcxxDelayedSubmissionPolicyAlways
+    Adaptive = UcxxDelayedSubmissionPolicyAdaptive
+
+
 class PythonRequestNotifierWaitState(enum.Enum):
     Ready = UcxxRequestNotifierWaitStateReady
     Timeout = UcxxRequestNotifierWaitStateTimeout
@@ -243,6 +256,9 @@ cdef class UCXContext():
         UCX options such as "MEMTYPE_CACHE=n" and "SEG_SIZE=3M"
     feature_flags: Iterable[Feature]
         Tuple of UCX feature flags
+    profile: ContextProfile, optional
+        Usage profile enabling only the features it requires, `feature_flags`
+        is ignored if specified.
     """
     cdef:
         shared_ptr[Context] _context
@@ -257,7 +273,8 @@ cdef class UCXContext():
             Feature.STREAM,
             Feature.AM,
             Feature.RMA
-        )
+        ),
+        profile=None,
     ):
         cdef ConfigMap cpp_config_in, cpp_config_out
         cdef dict context_config
@@ -268,8 +285,16 @@ cdef class UCXContext():
             lambda x, y: x | y.value, feature_flags, 0
         )
 
+        cdef bint use_profile = profile is not None
+        cdef UcxxContextProfile cpp_profile = (
+            profile.value if use_profile else UcxxContextProfileFull
+        )
+
         with nogil:
-            self._context = createContext(cpp_config_in, feature_flags_uint)
+            if use_profile:
+                self._context = createContextFromProfile(cpp_config_in, cpp_profile)
+            else:
+                self._context = createContext(cpp_config_in, feature_flags_uint)
             cpp_config_out = self._context.get().getConfig()
 
         context_config = cpp_config_out
@@ -484,6 +509,30 @@ cdef class UCXWorker():
             self, address, endpoint_error_handling
         )
 
+    def set_delayed_submission_policy(self, policy):
+        cdef UcxxDelayedSubmissionPolicy ucxx_policy = (
+            DelayedSubmissionPolicy(policy).value
+        )
+
+        with nogil:
+            self._worker.get().setDelayedSubmissionPolicy(ucxx_policy)
+
+    def get_delayed_submission_policy(self):
+        cdef UcxxDelayedSubmissionPolicy policy
+
+        with nogil:
+            policy = self._worker.get().getDelayedSubmissionPolicy()
+
+        return DelayedSubmissionPolicy(policy)
+
+    def get_delayed_submission_stats(self):
+        cdef DelayedSubmissionStats stats
+
+        with nogil:
+            stats = self._worker.get().getDelayedSubmissionStats()
+
+        return {"direct": stats.direct, "delayed": stats.delayed}
+
     def init_blocking_progress_mode(self):
         with nogil:
             self._worker.get().initBlockingProgressMode()
@@ -804,6 +853,73 @@ cdef class UCXBufferRequests:
         return [b for b in py_buffers if b is not None]
 
 
+cdef class UCXTagMultiRecvStream:
+    cdef:
+        shared_ptr[TagMultiRecvStream] _stream
+        bint _enable_python_future
+
+    def __init__(self, uintptr_t shared_ptr_stream, bint enable_python_future):
+        self._stream = deref(<shared_ptr[TagMultiRecvStream] *> shared_ptr_stream)
+        self._enable_python_future = enable_python_future
+
+    def pop(self):
+        cdef RequestTagMultiPtr ucxx_buffer_requests
+
+        with nogil:
+            ucxx_buffer_requests = self._stream.get().pop()
+
+        if ucxx_buffer_requests == nullptr:
+            return None
+        # Messages are only delivered once completed, no future is needed to wait on them
+        return UCXBufferRequests(<uintptr_t><void*>&ucxx_buffer_requests, False)
+
+    def get_queued_count(self):
+        cdef size_t count
+
+        with nogil:
+            count = self._stream.get().getQueuedCount()
+
+        return count
+
+    def get_received_count(self):
+        cdef size_t count
+
+        with nogil:
+            count = self._stream.get().getReceivedCount()
+
+        return count
+
+    def is_closed(self):
+        cdef bint is_closed
+
+        with nogil:
+            is_closed = self._stream.get().isClosed()
+
+        return is_closed
+
+    def get_future(self):
+        cdef PyObject* future_ptr
+
+        with nogil:
+            future_ptr = <PyObject*>self._stream.get().getFuture()
+
+        if future_ptr == NULL:
+            return None
+        return <object>future_ptr
+
+    async def wait(self):
+        if self._enable_python_future:
+            future = self.get_future()
+            if future is not None:
+                await future
+        else:
+            await asyncio.sleep(0)
+
+    def close(self):
+        with nogil:
+            self._stream.get().close()
+
+
 cdef void _endpoint_close_callback(void *args) with gil:
     """Callback function called when UCXEndpoint closes or errors"""
     cdef dict cb_data = <dict> args
@@ -930,6 +1046,15 @@ cdef class UCXEndpoint():
         with nogil:
             self._endpoint.get().close()
 
+    def close_async(self):
+        """Submit closing the endpoint without progressing the worker.
+
+        Closing completes once the worker is progressed, after which `handle`
+        is ``0``.
+        """
+        with nogil:
+            self._endpoint.get().closeAsync()
+
     def stream_send(self, Array arr):
         cdef void* buf = <void*>arr.ptr
         cdef size_t nbytes = arr.nbytes
@@ -964,9 +1089,14 @@ cdef class UCXEndpoint():
 
         return UCXRequest(<uintptr_t><void*>&req, self._enable_python_future)
 
-    def tag_send(self, Array arr, size_t tag):
+    def tag_send(self, Array arr, size_t tag, bint sync=False):
         cdef void* buf = <void*>arr.ptr
         cdef size_t nbytes = arr.nbytes
+        cdef function[void(shared_ptr[void])] callback_function
+        cdef shared_ptr[void] callback_data
+        cdef TagSendMode send_mode = (
+            UcxxTagSendModeSync if sync else UcxxTagSendModeStandard
+        )
         cdef shared_ptr[Request] req
 
         if not self._context_feature_flags & Feature.TAG.value:
@@ -977,7 +1107,10 @@ cdef class UCXEndpoint():
                 buf,
                 nbytes,
                 tag,
-                self._enable_python_future
+                self._enable_python_future,
+                callback_function,
+                callback_data,
+                send_mode,
             )
 
         return UCXRequest(<uintptr_t><void*>&req, self._enable_python_future)
@@ -1000,10 +1133,14 @@ cdef class UCXEndpoint():
 
         return UCXRequest(<uintptr_t><void*>&req, self._enable_python_future)
 
-    def tag_send_multi(self, tuple arrays, size_t tag):
+    def tag_send_multi(self, tuple arrays, size_t tag, bint sync=False):
         cdef vector[void*] v_buffer
         cdef vector[size_t] v_size
         cdef vector[int] v_is_cuda
+        cdef CodecParams codec_params
+        cdef TagSendMode send_mode = (
+            UcxxTagSendModeSync if sync else UcxxTagSendModeStandard
+        )
         cdef RequestTagMultiPtr ucxx_buffer_requests
 
         for arr in arrays:
@@ -1024,6 +1161,8 @@ cdef class UCXEndpoint():
                 v_is_cuda,
                 tag,
                 self._enable_python_future,
+                codec_params,
+                send_mode,
             )
 
         return UCXBufferRequests(
@@ -1042,6 +1181,16 @@ cdef class UCXEndpoint():
             <uintptr_t><void*>&ucxx_buffer_requests, self._enable_python_future,
         )
 
+    def tag_recv_multi_stream(self, size_t tag):
+        cdef shared_ptr[TagMultiRecvStream] stream
+
+        with nogil:
+            stream = createTagMultiRecvStream(self._endpoint, tag)
+
+        return UCXTagMultiRecvStream(
+            <uintptr_t><void*>&stream, self._enable_python_future
+        )
+
     def is_alive(self):
         cdef bint is_alive
 
@@ -1,6 +1,7 @@
 # SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
 # SPDX-License-Identifier: BSD-3-Clause
 
+import functools
 import os
 
 import pytest
@@ -85,3 +86,25 @@ def test_feature_flags_mismatch(feature_flag):
             ValueError, match="UCXContext must be created with `Feature.STREAM`"
         ):
             ep.stream_recv(msg)
+
+
+@pytest.mark.parametrize(
+    "profile,features",
+    [
+        (ucx_api.ContextProfile.TagOnly, (ucx_api.Feature.TAG,)),
+        (ucx_api.ContextProfile.StreamOnly, (ucx_api.Feature.STREAM,)),
+        (ucx_api.ContextProfile.Rma, (ucx_api.Feature.RMA, ucx_api.Feature.TAG)),
+    ],
+)
+def test_context_profile(profile, features):
+    ctx = ucx_api.UCXContext(profile=profile)
+    expected = functools.reduce(
+        lambda x, y: x | y.value, features, ucx_api.Feature.WAKEUP.value
+    )
+    assert ctx.feature_flags == expected
+
+
+def test_context_profile_polling_only():
+    ctx = ucx_api.UCXContext(profile=ucx_api.ContextProfile.PollingOnly)
+    assert not ctx.feature_flags & ucx_api.Feature.WAKEUP.value
+    assert ctx.feature_flags & ucx_api.Feature.TAG.value
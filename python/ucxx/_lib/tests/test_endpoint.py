@@ -100,3 +100,107 @@ def test_close_callback(server_close_callback):
     server.join(timeout=10)
     terminate_process(client)
     terminate_process(server)
+
+
+@pytest.mark.parametrize("multi", [False, True])
+def test_tag_send_sync(multi):
+    ctx = ucx_api.UCXContext(feature_flags=(ucx_api.Feature.TAG,))
+    worker = ucx_api.UCXWorker(ctx)
+    ep = ucx_api.UCXEndpoint.create_from_worker_address(
+        worker, worker.get_address(), endpoint_error_handling=True
+    )
+
+    send_msg = Array(bytes(os.urandom(WireupMessageSize)))
+    if multi:
+        send_request = ep.tag_send_multi((send_msg,), tag=0, sync=True)
+    else:
+        send_request = ep.tag_send(send_msg, tag=0, sync=True)
+
+    # A synchronous send does not complete before being matched by the receiver
+    for _ in range(100):
+        worker.progress()
+    assert not send_request.is_completed()
+
+    if multi:
+        recv_request = ep.tag_recv_multi(tag=0)
+    else:
+        recv_msg = Array(bytearray(WireupMessageSize))
+        recv_request = ep.tag_recv(recv_msg, tag=0)
+    while not (send_request.is_completed() and recv_request.is_completed()):
+        worker.progress()
+    send_request.check_error()
+    recv_request.check_error()
+
+    if not multi:
+        assert bytes(recv_msg.obj) == bytes(send_msg.obj)
+
+
+def test_tag_recv_multi_stream():
+    num_messages = 3
+    ctx = ucx_api.UCXContext(feature_flags=(ucx_api.Feature.TAG,))
+    worker = ucx_api.UCXWorker(ctx)
+    ep = ucx_api.UCXEndpoint.create_from_worker_address(
+        worker, worker.get_address(), endpoint_error_handling=True
+    )
+
+    stream = ep.tag_recv_multi_stream(tag=0)
+    assert stream.pop() is None
+
+    send_msgs = [
+        Array(bytes(os.urandom(WireupMessageSize))) for _ in range(num_messages)
+    ]
+    send_requests = [ep.tag_send_multi((msg,), tag=0) for msg in send_msgs]
+    while stream.get_received_count() < num_messages or not all(
+        r.is_completed() for r in send_requests
+    ):
+        worker.progress()
+
+    assert stream.get_queued_count() == num_messages
+    for send_msg in send_msgs:
+        recv_request = stream.pop()
+        recv_request.check_error()
+        (recv_msg,) = recv_request.get_py_buffers()
+        assert bytes(recv_msg) == bytes(send_msg.obj)
+    assert stream.pop() is None
+
+    stream.close()
+    assert stream.is_closed()
+
+
+def test_delayed_submission_policy():
+    ctx = ucx_api.UCXContext(feature_flags=(ucx_api.Feature.TAG,))
+    worker = ucx_api.UCXWorker(ctx, enable_delayed_submission=True)
+    assert (
+        worker.get_delayed_submission_policy() == ucx_api.DelayedSubmissionPolicy.Always
+    )
+    worker.set_delayed_submission_policy(ucx_api.DelayedSubmissionPolicy.Adaptive)
+    ep = ucx_api.UCXEndpoint.create_from_worker_address(
+        worker, worker.get_address(), endpoint_error_handling=True
+    )
+
+    # Submitted immediately, no progress thread is needed to submit the requests
+    send_msg = Array(bytes(os.urandom(WireupMessageSize)))
+    recv_msg = Array(bytearray(WireupMessageSize))
+    requests = [ep.tag_send(send_msg, tag=0), ep.tag_recv(recv_msg, tag=0)]
+    while not all(r.is_completed() for r in requests):
+        worker.progress()
+    for r in requests:
+        r.check_error()
+    assert bytes(recv_msg.obj) == bytes(send_msg.obj)
+
+    assert worker.get_delayed_submission_stats() == {"direct": 2, "delayed": 0}
+
+
+def test_close_async():
+    ctx = ucx_api.UCXContext(feature_flags=(ucx_api.Feature.TAG,))
+    worker = ucx_api.UCXWorker(ctx)
+    ep = ucx_api.UCXEndpoint.create_from_worker_address(
+        worker, worker.get_address(), endpoint_error_handling=True
+    )
+    closed = [False]
+    ep.set_close_callback(_close_callback, cb_args=(closed,))
+
+    ep.close_async()
+    while ep.handle != 0:
+        worker.progress()
+    assert closed[0] is True
@@ -0,0 +1,59 @@
+# SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+# SPDX-License-Identifier: BSD-3-Clause
+
+import asyncio
+import threading
+
+import pytest
+import ucxx._lib.libucxx as ucx_api
+from ucxx._lib.arr import Array
+
+# Exceeds the size of a futures pool, forcing pools to be refilled
+NumMessages = 150
+
+
+def _submit(ep, thread_index, messages, received, requests):
+    # Python futures are bound to the event loop of the thread that creates them
+    asyncio.set_event_loop(asyncio.new_event_loop())
+    for i in range(NumMessages):
+        tag = thread_index * NumMessages + i
+        requests[thread_index].append(ep.tag_send(Array(messages[i]), tag=tag))
+        requests[thread_index].append(ep.tag_recv(Array(received[tag]), tag=tag))
+
+
+@pytest.mark.parametrize("num_threads", [1, 4])
+def test_python_future_multithreaded(num_threads):
+    ctx = ucx_api.UCXContext(feature_flags=(ucx_api.Feature.TAG,))
+    worker = ucx_api.UCXWorker(ctx, enable_python_future=True)
+    assert worker.is_python_future_enabled()
+
+    ep = ucx_api.UCXEndpoint.create_from_worker_address(
+        worker,
+        worker.get_address(),
+        endpoint_error_handling=True,
+    )
+
+    messages = [bytearray(i.to_bytes(4, "little")) for i in range(NumMessages)]
+    received = [bytearray(4) for _ in range(num_threads * NumMessages)]
+    requests = [[] for _ in range(num_threads)]
+    threads = [
+        threading.Thread(target=_submit, args=(ep, t, messages, received, requests))
+        for t in range(num_threads)
+    ]
+    for t in threads:
+        t.start()
+    for t in threads:
+        t.join()
+
+    all_requests = [r for thread_requests in requests for r in thread_requests]
+    while not all(r.is_completed() for r in all_requests):
+        worker.progress()
+    for r in all_requests:
+        r.check_error()
+
+    # Each request acquired its own future
+    futures = [r.get_future() for r in all_requests]
+    assert len(set(id(f) for f in futures)) == len(all_requests)
+
+    for tag, message in enumerate(received):
+        assert message == messages[tag % NumMessages]
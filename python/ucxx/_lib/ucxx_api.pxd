@@ -176,6 +176,39 @@ cdef extern from "<ucxx/notifier.h>" namespace "ucxx" nogil:
         UcxxRequestNotifierWaitStateShutdown "ucxx::RequestNotifierWaitState::Shutdown"  # noqa: E501
 
 
+cdef extern from "<ucxx/context.h>" namespace "ucxx" nogil:
+    # TODO: use `cdef enum class` after moving to Cython 3.x
+    ctypedef enum UcxxContextProfile "ucxx::ContextProfile":
+        UcxxContextProfileFull "ucxx::ContextProfile::Full"
+        UcxxContextProfileTagOnly "ucxx::ContextProfile::TagOnly"
+        UcxxContextProfileStreamOnly "ucxx::ContextProfile::StreamOnly"
+        UcxxContextProfileRma "ucxx::ContextProfile::Rma"
+        UcxxContextProfilePollingOnly "ucxx::ContextProfile::PollingOnly"
+
+
+cdef extern from "<ucxx/delayed_submission.h>" namespace "ucxx" nogil:
+    # TODO: use `cdef enum class` after moving to Cython 3.x
+    ctypedef enum UcxxDelayedSubmissionPolicy "ucxx::DelayedSubmissionPolicy":
+        UcxxDelayedSubmissionPolicyAlways "ucxx::DelayedSubmissionPolicy::Always"
+        UcxxDelayedSubmissionPolicyAdaptive "ucxx::DelayedSubmissionPolicy::Adaptive"
+
+    cdef cppclass DelayedSubmissionStats:
+        size_t direct
+        size_t delayed
+
+
+cdef extern from "<ucxx/typedefs.h>" namespace "ucxx" nogil:
+    # TODO: use `cdef enum class` after moving to Cython 3.x
+    ctypedef enum TagSendMode:
+        UcxxTagSendModeStandard "ucxx::TagSendMode::Standard"
+        UcxxTagSendModeSync "ucxx::TagSendMode::Sync"
+
+
+cdef extern from "<ucxx/codec.h>" namespace "ucxx" nogil:
+    cdef cppclass CodecParams:
+        pass
+
+
 cdef extern from "<ucxx/api.h>" namespace "ucxx" nogil:
     ctypedef cpp_unordered_map[string, string] ConfigMap
 
@@ -183,6 +216,10 @@ cdef extern from "<ucxx/api.h>" namespace "ucxx" nogil:
         ConfigMap ucx_config, uint64_t feature_flags
     ) except +raise_py_error
 
+    shared_ptr[Context] createContextFromProfile(
+        ConfigMap ucx_config, UcxxContextProfile profile
+    ) except +raise_py_error
+
     shared_ptr[Address] createAddressFromWorker(shared_ptr[Worker] worker)
     shared_ptr[Address] createAddressFromString(string address_string)
 
@@ -240,10 +277,16 @@ cdef extern from "<ucxx/api.h>" namespace "ucxx" nogil:
             void* buffer, size_t length, ucp_tag_t tag, bint enable_python_future
         ) except +raise_py_error
         bint isFutureEnabled() const
+        void setDelayedSubmissionPolicy(
+            UcxxDelayedSubmissionPolicy policy
+        ) except +raise_py_error
+        UcxxDelayedSubmissionPolicy getDelayedSubmissionPolicy() except +raise_py_error
+        DelayedSubmissionStats getDelayedSubmissionStats()
 
     cdef cppclass Endpoint(Component):
         ucp_ep_h getHandle()
         void close()
+        void closeAsync() except +raise_py_error
         shared_ptr[Request] streamSend(
             void* buffer, size_t length, bint enable_python_future
         ) except +raise_py_error
@@ -253,6 +296,15 @@ cdef extern from "<ucxx/api.h>" namespace "ucxx" nogil:
         shared_ptr[Request] tagSend(
             void* buffer, size_t length, ucp_tag_t tag, bint enable_python_future
         ) except +raise_py_error
+        shared_ptr[Request] tagSend(
+            void* buffer,
+            size_t length,
+            ucp_tag_t tag,
+            bint enable_python_future,
+            function[void(shared_ptr[void])] callback_function,
+            shared_ptr[void] callback_data,
+            TagSendMode send_mode,
+        ) except +raise_py_error
         shared_ptr[Request] tagRecv(
             void* buffer, size_t length, ucp_tag_t tag, bint enable_python_future
         ) except +raise_py_error
@@ -263,6 +315,15 @@ cdef extern from "<ucxx/api.h>" namespace "ucxx" nogil:
             ucp_tag_t tag,
             bint enable_python_future
         ) except +raise_py_error
+        shared_ptr[RequestTagMulti] tagMultiSend(
+            const vector[void*]& buffer,
+            const vector[size_t]& length,
+            const vector[int]& isCUDA,
+            ucp_tag_t tag,
+            bint enable_python_future,
+            const CodecParams& codec_params,
+            TagSendMode send_mode,
+        ) except +raise_py_error
         shared_ptr[RequestTagMulti] tagMultiRecv(
             ucp_tag_t tag, bint enable_python_future
         ) except +raise_py_error
@@ -315,5 +376,19 @@ cdef extern from "<ucxx/request_tag_multi.h>" namespace "ucxx" nogil:
         void* getFuture() except +raise_py_error
 
 
+cdef extern from "<ucxx/tag_multi_recv_stream.h>" namespace "ucxx" nogil:
+
+    cdef cppclass TagMultiRecvStream(Component):
+        RequestTagMultiPtr pop()
+        size_t getQueuedCount()
+        void* getFuture() except +raise_py_error
+        size_t getReceivedCount()
+        cpp_bool isClosed()
+        void close()
+
+    shared_ptr[TagMultiRecvStream] createTagMultiRecvStream(
+        shared_ptr[Endpoint] endpoint, ucp_tag_t tag
+    ) except +raise_py_error
+
 cdef extern from "<ucxx/utils/python.h>" namespace "ucxx::utils" nogil:
     cpp_bool isPythonAvailable()
@@ -23,6 +23,13 @@ logger = logging.getLogger("ucx")
 class ApplicationContext:
     """
     The context of the Asyncio interface of UCX.
+
+    Parameters
+    ----------
+    profile: ucxx._lib.libucxx.ContextProfile, optional
+        Usage profile of the UCX context. Contexts of the ``PollingOnly`` profile
+        have no wakeup support, the default progress mode is then 'thread-polling'
+        and the blocking 'thread' mode is rejected.
     """
 
     def __init__(
@@ -31,6 +38,8 @@ class ApplicationContext:
         progress_mode=None,
         enable_delayed_submission=None,
         enable_python_future=None,
+        delayed_submission_policy=None,
+        profile=None,
     ):
         self.progress_tasks = []
         self.notifier_thread_q = None
@@ -38,7 +47,9 @@ class ApplicationContext:
         self._listener_active_clients = ActiveClients()
         self._next_listener_id = 0
 
-        self.progress_mode = ApplicationContext._check_progress_mode(progress_mode)
+        self.progress_mode = ApplicationContext._check_progress_mode(
+            progress_mode, profile
+        )
 
         enable_delayed_submission = ApplicationContext._check_enable_delayed_submission(
             enable_delayed_submission
@@ -46,14 +57,19 @@ class ApplicationContext:
         enable_python_future = ApplicationContext._check_enable_python_future(
             enable_python_future, self.progress_mode
         )
+        delayed_submission_policy = ApplicationContext._check_delayed_submission_policy(
+            delayed_submission_policy
+        )
 
         # For now, a application context only has one worker
-        self.context = ucx_api.UCXContext(config_dict)
+        self.context = ucx_api.UCXContext(config_dict, profile=profile)
         self.worker = ucx_api.UCXWorker(
             self.context,
             enable_delayed_submission=enable_delayed_submission,
             enable_python_future=enable_python_future,
         )
+        if enable_delayed_submission:
+            self.worker.set_delayed_submission_policy(delayed_submission_policy)
 
         self.start_notifier_thread()
 
@@ -65,10 +81,14 @@ class ApplicationContext:
         self.continuous_ucx_progress()
 
     @staticmethod
-    def _check_progress_mode(progress_mode):
+    def _check_progress_mode(progress_mode, profile=None):
+        polling_only = profile == ucx_api.ContextProfile.PollingOnly
+
         if progress_mode is None:
             if "UCXPY_PROGRESS_MODE" in os.environ:
                 progress_mode = os.environ["UCXPY_PROGRESS_MODE"]
+            elif polling_only:
+                progress_mode = "thread-polling"
             else:
                 progress_mode = "thread"
 
@@ -81,6 +101,12 @@ class ApplicationContext:
                 "valid modes are: 'blocking', 'polling', 'thread' or 'thread-polling'"
             )
 
+        if polling_only and progress_mode == "thread":
+            raise ValueError(
+                "Progress mode 'thread' requires wakeup support, which the "
+                "PollingOnly profile disables, use 'thread-polling' or 'polling'"
+            )
+
         return progress_mode
 
     @staticmethod
@@ -95,6 +121,27 @@ class ApplicationContext:
             else:
                 enable_delayed_submission = True
 
+    @staticmethod
+    def _check_delayed_submission_policy(delayed_submission_policy):
+        if delayed_submission_policy is None:
+            delayed_submission_policy = os.environ.get(
+                "UCXPY_DELAYED_SUBMISSION_POLICY", "always"
+            )
+
+        if isinstance(delayed_submission_policy, str):
+            valid_policies = {
+                "always": ucx_api.DelayedSubmissionPolicy.Always,
+                "adaptive": ucx_api.DelayedSubmissionPolicy.Adaptive,
+            }
+            if delayed_submission_policy not in valid_policies:
+                raise ValueError(
+                    f"Unknown delayed submission policy {delayed_submission_policy}, "
+                    "valid policies are: 'always' or 'adaptive'"
+                )
+            delayed_submission_policy = valid_policies[delayed_submission_policy]
+
+        return ucx_api.DelayedSubmissionPolicy(delayed_submission_policy)
+
     @staticmethod
     def _check_enable_python_future(enable_python_future, progress_mode):
         if enable_python_future is None:
@@ -37,6 +37,7 @@ class Endpoint:
         self._finished_recv_count = 0  # Number of returned (finished) self.recv() calls
         self._shutting_down_peer = False  # Told peer to shutdown
         self._close_after_n_recv = None
+        self._close_cb = None  # User close callback as (func, args, kwargs)
         self._tags = tags
 
     def __del__(self):
@@ -64,10 +65,16 @@ class Endpoint:
         self._ep = None
         self._ctx = None
 
-    async def close(self):
+    async def close(self, timeout=5.0):
         """Close the endpoint cleanly.
         This will attempt to flush outgoing buffers before actually
         closing the underlying UCX endpoint.
+
+        Parameters
+        ----------
+        timeout: float
+            Seconds to wait for the endpoint to close cleanly, after which it
+            is closed with `Endpoint.abort()`.
         """
         if self.closed():
             self.abort()
@@ -83,10 +90,45 @@ class Endpoint:
                 # Give all current outstanding send() calls a chance to return
                 self._ctx.worker.progress()
                 await asyncio.sleep(0)
+                if self._ep is not None:
+                    # Let the progress task complete closing instead of
+                    # progressing the worker from the event loop
+                    logger.debug("Endpoint.close(): %s" % hex(self.uid))
+                    await self._close_async(timeout)
                 self.abort()
 
+    async def _close_async(self, timeout):
+        """Submit closing the endpoint and wait for it to complete.
+
+        The close callback runs on the thread progressing the worker, it
+        resolves a future on the event loop and then calls the user close
+        callback, if any.
+        """
+        loop = asyncio.get_running_loop()
+        closed = loop.create_future()
+        user_cb = self._close_cb
+
+        def _set_closed():
+            if not closed.done():
+                closed.set_result(None)
+
+        def _close_callback():
+            loop.call_soon_threadsafe(_set_closed)
+            if user_cb is not None:
+                user_cb[0](*user_cb[1], **user_cb[2])
+
+        self._ep.set_close_callback(_close_callback)
+        self._ep.close_async()
+        try:
+            await asyncio.wait_for(closed, timeout)
+        except asyncio.TimeoutError:
+            logger.debug(
+                "Endpoint.close(): %s timed out after %s seconds, aborting"
+                % (hex(self.uid), timeout)
+            )
+
     # @ucx_api.nvtx_annotate("UCXPY_SEND", color="green", domain="ucxpy")
-    async def send(self, buffer, tag=None, force_tag=False):
+    async def send(self, buffer, tag=None, force_tag=False, sync=False):
         """Send `buffer` to connected peer.
 
         Parameters
@@ -104,6 +146,9 @@ class Endpoint:
             If true, force using `tag` as is, otherwise the value
             specified with `tag` (if any) will be hashed with the
             internal Endpoint tag.
+        sync: bool
+            If true, complete only after the receiver matched the message,
+            otherwise complete as soon as `buffer` may be reused.
         """
         self._ep.raise_on_error()
         if self.closed():
@@ -130,7 +175,7 @@ class Endpoint:
         self._send_count += 1
 
         try:
-            request = self._ep.tag_send(buffer, tag)
+            request = self._ep.tag_send(buffer, tag, sync=sync)
             return await request.wait()
         except UCXCanceled as e:
             # If self._ep has already been closed and destroyed, we reraise the
@@ -138,7 +183,7 @@ class Endpoint:
             if self._ep is None:
                 raise e
 
-    async def send_multi(self, buffers, tag=None, force_tag=False):
+    async def send_multi(self, buffers, tag=None, force_tag=False, sync=False):
         """Send `buffer` to connected peer.
 
         Parameters
@@ -156,6 +201,9 @@ class Endpoint:
             If true, force using `tag` as is, otherwise the value
             specified with `tag` (if any) will be hashed with the
             internal Endpoint tag.
+        sync: bool
+            If true, complete only after the receiver matched all buffers,
+            otherwise complete as soon as `buffers` may be reused.
         """
         self._ep.raise_on_error()
         if self.closed():
@@ -182,7 +230,7 @@ class Endpoint:
         self._send_count += 1
 
         try:
-            buffer_requests = self._ep.tag_send_multi(buffers, tag)
+            buffer_requests = self._ep.tag_send_multi(buffers, tag, sync=sync)
             await buffer_requests.wait()
             buffer_requests.check_error()
         except UCXCanceled as e:
@@ -324,6 +372,69 @@ class Endpoint:
             self.abort()
         return buffers
 
+    async def recv_multi_stream(self, tag=None, force_tag=False):
+        """Continuously receive multi-buffer messages from connected peer.
+
+        Asynchronous iterator yielding the buffers of each message sent
+        with `send_multi()`, in order. The receive of the next message is
+        always kept posted, removing the latency of posting a receive
+        per message, until the iterator is closed or the endpoint errors.
+
+        Parameters
+        ----------
+        tag: hashable, optional
+            Set a tag that must match the received messages. Currently
+            the tag is hashed together with the internal Endpoint tag
+            that is agreed with the remote end at connection time.
+            To enforce using the user tag, make sure to specify
+            `force_tag=True`.
+        force_tag: bool
+            If true, force using `tag` as is, otherwise the value
+            specified with `tag` (if any) will be hashed with the
+            internal Endpoint tag.
+
+        Examples
+        --------
+        >>> async for buffers in ep.recv_multi_stream():
+        ...     process(buffers)
+        """
+        if tag is None:
+            tag = self._tags["msg_recv"]
+        elif not force_tag:
+            tag = hash64bits(self._tags["msg_recv"], hash(tag))
+
+        if logger.isEnabledFor(logging.DEBUG):
+            logger.debug(
+                "[Recv Multi Stream] ep: %s, tag: %s" % (hex(self.uid), hex(tag))
+            )
+
+        stream = self._ep.tag_recv_multi_stream(tag)
+        try:
+            while True:
+                buffer_requests = stream.pop()
+                if buffer_requests is None:
+                    self._ep.raise_on_error()
+                    if self.closed():
+                        raise UCXCloseError("Endpoint closed")
+                    await stream.wait()
+                    continue
+
+                buffer_requests.check_error()
+                for r in buffer_requests.get_requests():
+                    r.check_error()
+                buffers = buffer_requests.get_py_buffers()
+
+                self._recv_count += 1
+                self._finished_recv_count += 1
+                if (
+                    self._close_after_n_recv is not None
+                    and self._finished_recv_count >= self._close_after_n_recv
+                ):
+                    self.abort()
+                yield buffers
+        finally:
+            stream.close()
+
     async def recv_obj(self, tag=None, allocator=bytearray):
         """Receive from connected peer that calls `send_obj()`.
 
@@ -421,6 +532,7 @@ class Endpoint:
         Example
         >>> ep.set_close_callback(lambda: print("Executing close callback"))
         """
+        self._close_cb = (callback_func, cb_args or (), cb_kwargs or {})
         self._ep.set_close_callback(callback_func, cb_args, cb_kwargs)
 
     def is_alive(self):
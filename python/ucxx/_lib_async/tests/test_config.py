@@ -91,3 +91,21 @@ def test_logging():
         ucxx.init(options)
 
     assert len(foreign_log.getvalue()) == 0
+
+
+def test_init_profile_polling_only():
+    with patch.dict(os.environ):
+        os.environ.pop("UCXPY_PROGRESS_MODE", None)
+        ucxx.reset()
+        ucxx.init(profile=ucxx._lib.libucxx.ContextProfile.PollingOnly)
+        assert ucxx.core._get_ctx().progress_mode == "thread-polling"
+        ucxx.reset()
+
+
+def test_init_profile_polling_only_blocking():
+    ucxx.reset()
+    with pytest.raises(ValueError, match="PollingOnly"):
+        ucxx.init(
+            progress_mode="thread",
+            profile=ucxx._lib.libucxx.ContextProfile.PollingOnly,
+        )
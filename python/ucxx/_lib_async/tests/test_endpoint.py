@@ -37,6 +37,25 @@ async def test_close_callback(server_close_callback):
         await asyncio.sleep(0.01)
 
 
+@pytest.mark.asyncio
+async def test_close_awaits_callback():
+    closed = [False]
+
+    def _close_callback():
+        closed[0] = True
+
+    async def server_node(ep):
+        pass
+
+    listener = ucxx.create_listener(server_node)
+    ep = await ucxx.create_endpoint(ucxx.get_address(), listener.port)
+    ep.set_close_callback(_close_callback)
+    await ep.close()
+    assert closed[0] is True
+    assert ep.closed()
+    listener.close()
+
+
 @pytest.mark.asyncio
 @pytest.mark.parametrize("transfer_api", ["am", "tag", "tag_multi"])
 @pytest.mark.xfail(reason="https://github.com/rapidsai/ucxx/issues/19")
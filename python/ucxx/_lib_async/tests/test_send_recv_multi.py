@@ -106,3 +106,32 @@ async def test_send_recv_numba(size, multi_size, dtype):
             r.copy_to_host().view(dtype), s.copy_to_host().view(dtype)
         )
     await wait_listener_client_handlers(listener)
+
+
+@pytest.mark.asyncio
+@pytest.mark.parametrize("multi_size", multi_sizes)
+async def test_send_recv_multi_stream(multi_size):
+    num_messages = 5
+
+    async def stream_server(ep):
+        received = 0
+        async for msg in ep.recv_multi_stream():
+            await ep.send_multi(msg)
+            received += 1
+            if received == num_messages:
+                break
+        await ep.close()
+
+    listener = ucxx.create_listener(stream_server)
+    client = await ucxx.create_endpoint(ucxx.get_address(), listener.port)
+    send_msgs = [
+        [np.full(16, i * multi_size + j, dtype="<i8") for j in range(multi_size)]
+        for i in range(num_messages)
+    ]
+    for send_msg in send_msgs:
+        await client.send_multi(send_msg)
+    for send_msg in send_msgs:
+        recv_msg = await client.recv_multi()
+        for r, s in zip(recv_msg, send_msg):
+            np.testing.assert_array_equal(r.view("<i8"), s)
+    await wait_listener_client_handlers(listener)
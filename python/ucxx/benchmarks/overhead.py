@@ -0,0 +1,278 @@
+# SPDX-FileCopyrightText: Copyright (c) 2022-2023, NVIDIA CORPORATION & AFFILIATES.
+# SPDX-License-Identifier: BSD-3-Clause
+
+"""Decompose transfer latency across the API layers of UCXX.
+
+The same ping-pong and windowed workloads run through each layer over an endpoint
+connected to its own worker, so that no network is involved and the difference between
+consecutive layers is the overhead the outer layer adds:
+
+- ``cpp-endpoint``: raw C++ ``ucxx::Endpoint`` API, the calling thread progresses
+  the worker (requires ``--cpp-benchmark``);
+- ``cpp-delayed-thread``: C++ with delayed submission and a polling progress thread
+  (requires ``--cpp-benchmark``);
+- ``cython-sync``: synchronous Cython ``UCXEndpoint``, the calling thread progresses
+  the worker;
+- ``async-no-notifier``: asyncio ``ucxx`` API with a progress thread, requests
+  awaited by polling their completion from the event loop;
+- ``async-notifier``: asyncio ``ucxx`` API with a progress thread, requests awaited
+  on Python futures completed by the notifier thread.
+
+Each layer runs in its own process. In the ping-pong workload one send/receive pair is
+inflight at a time, in the windowed workload ``--window`` pairs are submitted before
+waiting for all of them, in both cases the median time per message is reported.
+"""
+
+import argparse
+import asyncio
+import multiprocessing as mp
+import os
+import subprocess
+import time
+
+import numpy as np
+from ucxx.utils import format_bytes, parse_bytes, print_multi, print_separator
+
+mp = mp.get_context("spawn")
+
+Layers = [
+    "cpp-endpoint",
+    "cpp-delayed-thread",
+    "cython-sync",
+    "async-no-notifier",
+    "async-notifier",
+]
+Workloads = ["pingpong", "windowed"]
+
+
+def _windows(args):
+    return {"pingpong": 1, "windowed": args.window}
+
+
+def _cython_sync(args, queue):
+    import ucxx._lib.libucxx as ucx_api
+    from ucxx._lib.arr import Array
+
+    ctx = ucx_api.UCXContext(feature_flags=(ucx_api.Feature.TAG,))
+    worker = ucx_api.UCXWorker(ctx)
+    ep = ucx_api.UCXEndpoint.create_from_worker_address(
+        worker, worker.get_address(), endpoint_error_handling=True
+    )
+
+    def _transfer(send, recv, window):
+        start = time.monotonic_ns()
+        requests = []
+        for i in range(window):
+            requests.append(ep.tag_recv(recv[i], tag=i))
+            requests.append(ep.tag_send(send[i], tag=i))
+        while not all(r.is_completed() for r in requests):
+            worker.progress()
+        for r in requests:
+            r.check_error()
+        return (time.monotonic_ns() - start) // window
+
+    results = []
+    for n_bytes in args.n_bytes:
+        send = [Array(np.ones(n_bytes, dtype="u1")) for _ in range(args.window)]
+        recv = [Array(np.empty(n_bytes, dtype="u1")) for _ in range(args.window)]
+        for workload, window in _windows(args).items():
+            for _ in range(args.n_warmup_iter):
+                _transfer(send, recv, window)
+            times = [_transfer(send, recv, window) for _ in range(args.n_iter)]
+            results.append(("cython-sync", workload, n_bytes, int(np.median(times))))
+    queue.put(results)
+
+
+def _async(args, queue, layer):
+    os.environ["UCXPY_ENABLE_PYTHON_FUTURE"] = "1" if layer == "async-notifier" else "0"
+
+    import ucxx
+
+    ucxx.init(progress_mode="thread")
+
+    async def _run():
+        ep = await ucxx.create_endpoint_from_worker_address(ucxx.get_worker_address())
+
+        async def _transfer(send, recv, window):
+            start = time.monotonic_ns()
+            await asyncio.gather(
+                *[ep.recv(recv[i], tag=i, force_tag=True) for i in range(window)],
+                *[ep.send(send[i], tag=i, force_tag=True) for i in range(window)],
+            )
+            return (time.monotonic_ns() - start) // window
+
+        results = []
+        for n_bytes in args.n_bytes:
+            send = [np.ones(n_bytes, dtype="u1") for _ in range(args.window)]
+            recv = [np.empty(n_bytes, dtype="u1") for _ in range(args.window)]
+            for workload, window in _windows(args).items():
+                for _ in range(args.n_warmup_iter):
+                    await _transfer(send, recv, window)
+                times = [
+                    await _transfer(send, recv, window) for _ in range(args.n_iter)
+                ]
+                results.append((layer, workload, n_bytes, int(np.median(times))))
+
+        await ep.close()
+        return results
+
+    queue.put(asyncio.run(_run()))
+    ucxx.reset()
+
+
+def _run_python_layer(args, layer):
+    queue = mp.Queue()
+    if layer == "cython-sync":
+        p = mp.Process(target=_cython_sync, args=(args, queue))
+    else:
+        p = mp.Process(target=_async, args=(args, queue, layer))
+    p.start()
+    results = queue.get()
+    p.join()
+    assert not p.exitcode
+    return results
+
+
+def _run_cpp_layers(args):
+    command = [
+        args.cpp_benchmark,
+        "-s",
+        ",".join(str(n) for n in args.n_bytes),
+        "-n",
+        str(args.n_iter),
+        "-w",
+        str(args.n_warmup_iter),
+        "-W",
+        str(args.window),
+    ]
+    output = subprocess.run(command, check=True, capture_output=True, text=True).stdout
+
+    results = []
+    for line in output.splitlines()[1:]:
+        layer, workload, n_bytes, median_ns = line.split(",")
+        results.append((layer, workload, int(n_bytes), int(median_ns)))
+    return results
+
+
+def print_report(args, results):
+    medians = {(r[0], r[1], r[2]): r[3] for r in results}
+
+    print("Overhead decomposition benchmark")
+    print_separator(separator="=", length=104)
+    print_multi(values=["Iterations", f"{args.n_iter}"])
+    print_multi(values=["Warmup iterations", f"{args.n_warmup_iter}"])
+    print_multi(values=["Window", f"{args.window}"])
+
+    for n_bytes in args.n_bytes:
+        for workload in Workloads:
+            print_separator(separator="=", length=104)
+            print_multi(values=["Bytes", f"{format_bytes(n_bytes)}, {workload}"])
+            print_separator(separator="-", length=104)
+            print_multi(
+                values=[
+                    "Layer",
+                    "Median latency",
+                    "Delta vs. previous",
+                    "Delta vs. first",
+                ]
+            )
+            print_separator(separator="-", length=104)
+            first = previous = None
+            for layer in Layers:
+                median = medians.get((layer, workload, n_bytes))
+                if median is None:
+                    continue
+                first = median if first is None else first
+                delta_previous = (
+                    "" if previous is None else f"{median - previous:+d} ns"
+                )
+                print_multi(
+                    values=[
+                        layer,
+                        f"{median} ns",
+                        delta_previous,
+                        f"{median - first:+d} ns",
+                    ]
+                )
+                previous = median
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(
+        description="Decompose transfer latency across the API layers of UCXX"
+    )
+    parser.add_argument(
+        "-n",
+        "--n-bytes",
+        metavar="BYTES",
+        default="8,1024,65536,1048576",
+        type=str,
+        help="Comma-separated message sizes. Default '8,1024,65536,1048576'.",
+    )
+    parser.add_argument(
+        "--n-iter",
+        metavar="N",
+        default=1000,
+        type=int,
+        help="Number of iterations per workload (default 1000).",
+    )
+    parser.add_argument(
+        "--n-warmup-iter",
+        default=100,
+        type=int,
+        help="Number of warmup iterations per workload (default 100).",
+    )
+    parser.add_argument(
+        "-w",
+        "--window",
+        metavar="N",
+        default=16,
+        type=int,
+        help="Number of messages inflight in the windowed workload (default 16).",
+    )
+    parser.add_argument(
+        "--cpp-benchmark",
+        metavar="PATH",
+        default=None,
+        type=str,
+        help="Path to the `ucxx_overhead` C++ benchmark binary, C++ layers are "
+        "skipped if not specified.",
+    )
+    parser.add_argument(
+        "--layers",
+        default=",".join(Layers),
+        type=str,
+        help=f"Comma-separated layers to run (default '{','.join(Layers)}').",
+    )
+
+    args = parser.parse_args()
+
+    args.n_bytes = [
+        parse_bytes(n) if callable(parse_bytes) else int(n)
+        for n in args.n_bytes.split(",")
+    ]
+    args.layers = args.layers.split(",")
+    for layer in args.layers:
+        if layer not in Layers:
+            raise RuntimeError(f"Invalid layer: '{layer}'")
+    if args.window < 1:
+        raise RuntimeError("`--window` must be at least 1")
+
+    return args
+
+
+def main():
+    args = parse_args()
+
+    results = []
+    if args.cpp_benchmark is not None:
+        results += [r for r in _run_cpp_layers(args) if r[0] in args.layers]
+    for layer in args.layers:
+        if not layer.startswith("cpp"):
+            results += _run_python_layer(args, layer)
+
+    print_report(args, results)
+
+
+if __name__ == "__main__":
+    main()
@@ -29,7 +29,7 @@ def _get_ctx():
 # The following functions initialize and use a single ApplicationContext instance
 
 
-def init(options={}, env_takes_precedence=False, progress_mode=None):
+def init(options={}, env_takes_precedence=False, progress_mode=None, profile=None):
     """Initiate UCX.
 
     Usually this is done automatically at the first API call
@@ -47,6 +47,10 @@ def init(options={}, env_takes_precedence=False, progress_mode=None):
         If None, thread UCX progress mode is used unless the environment variable
         `UCXPY_PROGRESS_MODE` is defined. Otherwise the options are 'blocking',
         'polling', 'thread'.
+    profile: ucxx._lib.libucxx.ContextProfile, optional
+        Usage profile of the UCX context, if None all features are enabled.
+        The ``PollingOnly`` profile defaults to 'thread-polling' progress mode
+        and rejects the 'thread' mode.
     """
     global _ctx
     if _ctx is not None:
@@ -69,7 +73,7 @@ def init(options={}, env_takes_precedence=False, progress_mode=None):
                     f"Ignoring environment {env_k}={env_v}; using option {k}={v}"
                 )
 
-    _ctx = ApplicationContext(options, progress_mode=progress_mode)
+    _ctx = ApplicationContext(options, progress_mode=progress_mode, profile=profile)
 
 
 def reset():